@@ -22,6 +22,7 @@
 #include "compiler_hints.h"
 #include "list.h"
 #include "msg.h"
+#include "thread.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -47,6 +48,17 @@ enum {
     BLOCKING,               /**< blocking mode */
 };
 
+/**
+ * @brief   An mbox put operation that can be cancelled
+ *
+ * @note    The contents of this structure are internal.
+ */
+typedef struct {
+    mbox_t *mbox;       /**< The mailbox to put the message into */
+    thread_t *thread;   /**< The thread trying to put the message */
+    uint8_t cancelled;  /**< Flag whether the operation has been cancelled */
+} mbox_cancel_t;
+
 /**
  * @brief Initialize mbox object
  *
@@ -157,6 +169,68 @@ static inline int mbox_try_get(mbox_t *mbox, msg_t *msg)
     return _mbox_get(mbox, msg, NON_BLOCKING);
 }
 
+/**
+ * @brief Get multiple messages from mailbox
+ *
+ * Retrieves up to @p num messages within a single critical section. This
+ * function never blocks. Senders that were blocked on a full mailbox are
+ * woken up for each free slot afterwards, with a single context switch to
+ * the one of highest priority.
+ *
+ * @param[in] mbox  ptr to mailbox to operate on
+ * @param[out] msgs ptr to storage for at least @p num messages
+ * @param[in] num   maximum number of messages to retrieve
+ *
+ * @return  number of messages retrieved
+ */
+size_t mbox_try_get_many(mbox_t *mbox, msg_t *msgs, size_t num);
+
+/**
+ * @brief   Initialize an mbox put operation that can be cancelled
+ *
+ * @param[in] mbox  ptr to mailbox to operate on
+ *
+ * @return  The initialized cancellation structure for the calling thread
+ */
+static inline mbox_cancel_t mbox_cancel_init(mbox_t *mbox)
+{
+    mbox_cancel_t result = { mbox, thread_get_active(), 0 };
+
+    return result;
+}
+
+/**
+ * @brief   Add message to mailbox, blocking until space becomes available or
+ *          the operation is cancelled
+ *
+ * This is the mailbox counterpart of @ref mutex_lock_cancelable and allows
+ * e.g. to implement @ref ztimer_mbox_put_timeout.
+ *
+ * @param[in,out] mc    cancellation structure initialized by
+ *                      @ref mbox_cancel_init for the calling thread
+ * @param[in] msg       ptr to message that will be copied into mailbox
+ *
+ * @retval  0               msg was delivered
+ * @retval  -ECANCELED      the operation was cancelled by @ref mbox_cancel
+ *                          before msg could be delivered
+ */
+int mbox_put_cancelable(mbox_cancel_t *mc, msg_t *msg);
+
+/**
+ * @brief   Cancels a call to @ref mbox_put_cancelable
+ *
+ * If the thread is currently blocked on the full mailbox, it is woken up and
+ * @ref mbox_put_cancelable returns `-ECANCELED`. If the call to
+ * @ref mbox_put_cancelable has not happened yet, it will return `-ECANCELED`
+ * right away. As for @ref mutex_cancel, @p mc must not be reused without
+ * reinitialization.
+ *
+ * @note    This function is safe to call from interrupt context.
+ *
+ * @param[in,out] mc    cancellation structure of the put operation
+ */
+void mbox_cancel(mbox_cancel_t *mc);
+
 /**
  * @brief Get mbox queue size (capacity)
  *
@@ -32,6 +32,10 @@
 /* If a device is flashed over USB bootloader, try to launch
  * the bootloader again on crash so the user can re-flash it.
  */
+#ifdef MODULE_STDIO_ASYNC
+#include "stdio_async.h"
+#endif
+
 #if defined(DEVELHELP) && defined(MODULE_USB_BOARD_RESET)
 #include "usb_board_reset.h"
 #endif
@@ -59,6 +63,11 @@ NORETURN void core_panic(core_panic_t crash_code, const char *message)
         /* print panic message to console (if possible) */
         crashed = 1;
 
+#ifdef MODULE_STDIO_ASYNC
+        /* the thread writing the buffered output won't run anymore */
+        stdio_async_sync();
+#endif
+
         /* Call back app in case it wants to store some context */
         panic_app(crash_code, message);
         printf("*** RIOT kernel panic:\n%s\n\n", message);
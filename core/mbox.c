@@ -15,6 +15,7 @@
  * @}
  */
 
+#include <errno.h>
 #include <string.h>
 
 #include "mbox.h"
@@ -54,7 +55,7 @@ static void _wait(list_node_t *wait_list, unsigned irqstate)
           thread_getpid());
 }
 
-int _mbox_put(mbox_t *mbox, msg_t *msg, int blocking)
+static int _put(mbox_t *mbox, msg_t *msg, int blocking, mbox_cancel_t *mc)
 {
     unsigned irqstate = irq_disable();
 
@@ -71,7 +72,7 @@ int _mbox_put(mbox_t *mbox, msg_t *msg, int blocking)
     }
     else {
         while (cib_full(&mbox->cib)) {
-            if (blocking) {
+            if (blocking && !(mc && mc->cancelled)) {
                 _wait(&mbox->writers, irqstate);
                 irqstate = irq_disable();
             }
@@ -91,6 +92,40 @@ int _mbox_put(mbox_t *mbox, msg_t *msg, int blocking)
     }
 }
 
+int _mbox_put(mbox_t *mbox, msg_t *msg, int blocking)
+{
+    return _put(mbox, msg, blocking, NULL);
+}
+
+int mbox_put_cancelable(mbox_cancel_t *mc, msg_t *msg)
+{
+    return _put(mc->mbox, msg, BLOCKING, mc) ? 0 : -ECANCELED;
+}
+
+void mbox_cancel(mbox_cancel_t *mc)
+{
+    unsigned irqstate = irq_disable();
+
+    mc->cancelled = 1;
+
+    thread_t *thread = mc->thread;
+
+    if (thread_is_active(thread)) {
+        /* thread is still running or about to run, so it will check
+         * `mc->cancelled` in time */
+        irq_restore(irqstate);
+        return;
+    }
+
+    if (list_remove(&mc->mbox->writers, (list_node_t *)&thread->rq_entry)) {
+        /* thread was waiting for space, wake it up */
+        _wake_waiter(thread, irqstate);
+        return;
+    }
+
+    irq_restore(irqstate);
+}
+
 int _mbox_get(mbox_t *mbox, msg_t *msg, int blocking)
 {
     unsigned irqstate = irq_disable();
@@ -122,3 +157,39 @@ int _mbox_get(mbox_t *mbox, msg_t *msg, int blocking)
         return 0;
     }
 }
+
+size_t mbox_try_get_many(mbox_t *mbox, msg_t *msgs, size_t num)
+{
+    unsigned irqstate = irq_disable();
+    uint16_t priority = SCHED_PRIO_LEVELS;
+    size_t got = 0;
+
+    while ((got < num) && cib_avail(&mbox->cib)) {
+        msgs[got++] = mbox->msg_array[cib_get_unsafe(&mbox->cib)];
+    }
+
+    /* Wake up a writer for each free slot. This also covers slots whose
+     * writer was woken up before, but was cancelled instead of filling it. */
+    size_t slots = mbox_size(mbox) - cib_avail(&mbox->cib);
+    list_node_t *next;
+
+    while (slots-- && (next = list_remove_head(&mbox->writers))) {
+        thread_t *thread = container_of((clist_node_t *)next, thread_t,
+                                        rq_entry);
+        sched_set_status(thread, STATUS_PENDING);
+        if (thread->priority < priority) {
+            priority = thread->priority;
+        }
+    }
+
+    DEBUG("mbox: Thread %" PRIkernel_pid " mbox 0x%08" PRIxPTR ": "
+          "_try_get_many(): got %u messages.\n", thread_getpid(),
+          (uintptr_t)mbox, (unsigned)got);
+
+    irq_restore(irqstate);
+    /* yield once to the highest priority writer woken up */
+    if (priority < SCHED_PRIO_LEVELS) {
+        sched_switch(priority);
+    }
+    return got;
+}
@@ -32,6 +32,13 @@
 #endif
 #include "irq.h"
 #include "cib.h"
+#if IS_USED(MODULE_TRACE_MSG)
+#include "trace.h"
+#define TRACE_MSG(event, pid, m) \
+    trace_event(event, ((uint32_t)(uint16_t)(pid) << 16) | (m)->type)
+#else
+#define TRACE_MSG(event, pid, m) (void)0
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -95,6 +102,8 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
         return -1;
     }
 
+    TRACE_MSG(TRACE_EVENT_MSG_SEND, target_pid, m);
+
     thread_t *me = thread_get_active();
 
     DEBUG("msg_send() %s:%i: Sending from %" PRIkernel_pid " to %" PRIkernel_pid
@@ -177,6 +186,7 @@ int msg_send_to_self(msg_t *m)
     unsigned state = irq_disable();
 
     m->sender_pid = thread_getpid();
+    TRACE_MSG(TRACE_EVENT_MSG_SEND, m->sender_pid, m);
     int res = queue_msg(thread_get_active(), m);
 
     irq_restore(state);
@@ -192,6 +202,8 @@ static int _msg_send_oneway(msg_t *m, kernel_pid_t target_pid)
         return -1;
     }
 
+    TRACE_MSG(TRACE_EVENT_MSG_SEND, target_pid, m);
+
     if (target->status == STATUS_RECEIVE_BLOCKED) {
         DEBUG("%s: Direct msg copy from %" PRIkernel_pid " to %"
               PRIkernel_pid ".\n", __func__, thread_getpid(), target_pid);
@@ -349,12 +361,20 @@ int msg_reply_int(msg_t *m, msg_t *reply)
 
 int msg_try_receive(msg_t *m)
 {
-    return _msg_receive(m, 0);
+    int res = _msg_receive(m, 0);
+
+    if (res > 0) {
+        TRACE_MSG(TRACE_EVENT_MSG_RECV, m->sender_pid, m);
+    }
+    return res;
 }
 
 int msg_receive(msg_t *m)
 {
-    return _msg_receive(m, 1);
+    int res = _msg_receive(m, 1);
+
+    TRACE_MSG(TRACE_EVENT_MSG_RECV, m->sender_pid, m);
+    return res;
 }
 
 static int _msg_receive(msg_t *m, int block)
@@ -15,6 +15,7 @@
  */
 
 #include <err.h>
+#include <inttypes.h>
 #include <stdio.h>
 #include <unistd.h>
 #include <stdlib.h>
@@ -29,6 +30,9 @@
 #include "sched.h"
 #include "test_utils/expect.h"
 
+#ifdef MODULE_RIOTBOOT_SLOT
+#include "riotboot/slot.h"
+#endif
 #ifdef MODULE_NETDEV_TAP
 #include "netdev_tap.h"
 extern netdev_tap_t netdev_tap;
@@ -228,6 +232,21 @@ void native_cpu_init(void)
 
 /* ========================================= */
 
+#ifdef MODULE_RIOTBOOT_SLOT
+uint32_t cpu_get_image_baseaddr(void)
+{
+    return riotboot_slot_get_image_startaddr(0);
+}
+
+void cpu_jump_to_image(uint32_t image_address)
+{
+    errx(EXIT_FAILURE, "cpu_jump_to_image(0x%" PRIx32 "): not supported on native",
+         image_address);
+}
+#endif
+
+/* ========================================= */
+
 static inline void *align_stack(uintptr_t start, int *stacksize)
 {
     const size_t alignment = sizeof(uintptr_t);
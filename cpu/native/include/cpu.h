@@ -51,6 +51,25 @@ __attribute__((always_inline)) static inline uintptr_t cpu_get_caller_pc(void)
 }
 /** @} */
 
+/* MARK: - riotboot */
+/**
+ * @name    riotboot slot emulation
+ *
+ * native does not execute the images in its emulated flash. For testing code
+ * that works on riotboot slots, the image in slot 0 is the running one.
+ * @{
+ */
+/**
+ * @brief   Get the start address of the running image
+ */
+uint32_t cpu_get_image_baseaddr(void);
+
+/**
+ * @brief   Starting an image from flash is not supported on native
+ */
+void cpu_jump_to_image(uint32_t image_address);
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
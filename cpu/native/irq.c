@@ -24,6 +24,7 @@
 
 #include "native_internal.h"
 #include "test_utils/expect.h"
+#include "trace.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -261,7 +262,13 @@ void _native_call_sig_handlers_and_switch(void)
 
         if (_native_irq_handlers[sig]) {
             DEBUG_IRQ("call sig handlers + switch: calling interrupt handler for %i\n", sig);
+#if IS_USED(MODULE_TRACE_ISR)
+            trace_isr_enter(sig);
+#endif
             _native_irq_handlers[sig]();
+#if IS_USED(MODULE_TRACE_ISR)
+            trace_isr_exit(sig);
+#endif
         }
         else if (sig == SIGUSR1) {
             warnx("call sig handlers + switch: ignoring SIGUSR1");
@@ -44,6 +44,7 @@
 #define NATIVE_SYSCALLS_DEFINITION 1
 #include "native_internal.h"
 #include "malloc_monitor_internal.h"
+#include "malloc_pool.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -93,7 +94,7 @@ void _native_syscall_leave(void)
  * detection abilities*/
 #if (!(defined MODULE_TLSF) && !(defined NATIVE_MEMORY)) || (defined(HAVE_VALGRIND))
 int _native_in_malloc = 0;
-void *malloc(size_t size)
+static void *_real_malloc(size_t size)
 {
     /* dynamically load malloc when it's needed - this is necessary to
      * support g++ 5.2.0 as it uses malloc before startup runs */
@@ -115,6 +116,18 @@ void *malloc(size_t size)
     _native_syscall_enter();
     r = real_malloc(size);
     _native_syscall_leave();
+    return r;
+}
+
+void *malloc(size_t size)
+{
+    void *r = NULL;
+    if (IS_USED(MODULE_MALLOC_POOL)) {
+        r = malloc_pool_alloc(size);
+    }
+    if (r == NULL) {
+        r = _real_malloc(size);
+    }
     if (IS_USED(MODULE_MALLOC_MONITOR)) {
         malloc_monitor_add(r, size, cpu_get_caller_pc(), "m");
     }
@@ -123,9 +136,11 @@ void *malloc(size_t size)
 
 void free(void *ptr)
 {
-    _native_syscall_enter();
-    real_free(ptr);
-    _native_syscall_leave();
+    if (!IS_USED(MODULE_MALLOC_POOL) || !malloc_pool_free(ptr)) {
+        _native_syscall_enter();
+        real_free(ptr);
+        _native_syscall_leave();
+    }
     if (IS_USED(MODULE_MALLOC_MONITOR)) {
         malloc_monitor_rm(ptr, cpu_get_caller_pc());
     }
@@ -134,25 +149,34 @@ void free(void *ptr)
 int _native_in_calloc = 0;
 void *calloc(size_t nmemb, size_t size)
 {
-    /* dynamically load calloc when it's needed - this is necessary to
-     * support profiling as it uses calloc before startup runs */
-    if (!real_calloc) {
-        if (_native_in_calloc) {
-            /* XXX: This is a dirty hack to enable old dlsym versions to run.
-             * Throw it out when Ubuntu 12.04 support runs out (in 2017-04)! */
-            return NULL;
-        }
-        else {
-            _native_in_calloc = 1;
-            *(void **)(&real_calloc) = dlsym(RTLD_NEXT, "calloc");
-            _native_in_calloc = 0;
+    void *r = NULL;
+    size_t total_size;
+    if (IS_USED(MODULE_MALLOC_POOL) && !__builtin_mul_overflow(nmemb, size, &total_size)) {
+        r = malloc_pool_alloc(total_size);
+        if (r) {
+            memset(r, 0, total_size);
         }
     }
+    if (r == NULL) {
+        /* dynamically load calloc when it's needed - this is necessary to
+         * support profiling as it uses calloc before startup runs */
+        if (!real_calloc) {
+            if (_native_in_calloc) {
+                /* XXX: This is a dirty hack to enable old dlsym versions to run.
+                 * Throw it out when Ubuntu 12.04 support runs out (in 2017-04)! */
+                return NULL;
+            }
+            else {
+                _native_in_calloc = 1;
+                *(void **)(&real_calloc) = dlsym(RTLD_NEXT, "calloc");
+                _native_in_calloc = 0;
+            }
+        }
 
-    void *r;
-    _native_syscall_enter();
-    r = real_calloc(nmemb, size);
-    _native_syscall_leave();
+        _native_syscall_enter();
+        r = real_calloc(nmemb, size);
+        _native_syscall_leave();
+    }
     if (IS_USED(MODULE_MALLOC_MONITOR)) {
         malloc_monitor_add(r, nmemb*size, cpu_get_caller_pc(), "c");
     }
@@ -161,10 +185,34 @@ void *calloc(size_t nmemb, size_t size)
 
 void *realloc(void *ptr, size_t size)
 {
-    void *r;
-    _native_syscall_enter();
-    r = real_realloc(ptr, size);
-    _native_syscall_leave();
+    void *r = NULL;
+    size_t block_size = 0;
+    if (IS_USED(MODULE_MALLOC_POOL)) {
+        block_size = malloc_pool_block_size(ptr);
+        if (ptr == NULL) {
+            r = malloc_pool_alloc(size);
+        }
+    }
+
+    if (block_size > 0) {
+        /* ptr is a pool block: grow it within the pools if possible, otherwise
+         * move it to the heap */
+        if (size == 0) {
+            malloc_pool_free(ptr);
+        }
+        else if ((r = malloc_pool_realloc(ptr, size)) == NULL) {
+            r = _real_malloc(size);
+            if (r) {
+                memcpy(r, ptr, block_size);
+                malloc_pool_free(ptr);
+            }
+        }
+    }
+    else if (r == NULL) {
+        _native_syscall_enter();
+        r = real_realloc(ptr, size);
+        _native_syscall_leave();
+    }
     if (IS_USED(MODULE_MALLOC_MONITOR)) {
         malloc_monitor_mv(ptr, r, size, cpu_get_caller_pc());
     }
@@ -23,6 +23,7 @@
 #include <string.h>
 #include <sys/random.h>
 #include <sys/time.h>
+#include <time.h>
 #include <unistd.h>
 
 #include "list.h"
@@ -42,10 +43,15 @@ typedef struct {
     uint32_t count_rx;
     uint32_t count_rt;
     uint32_t rtt_us;
+    uint32_t rtt_seq_no;
+    bool has_rtt_seq_no;
     size_t packet_len;
+    benchmark_udp_latency_t latency;
 } bench_client_t;
 
 static bool one_way;
+static bool latency_mode;
+static const char *export_file;
 static uint32_t cookie;
 static uint32_t delay_us    = 100 * US_PER_MS; /* 100 ms */
 static uint16_t payload_len = 32;
@@ -85,6 +91,74 @@ static uint64_t _tv_diff_msec(struct timeval *a, struct timeval *b)
          + (a->tv_usec - b->tv_usec) / US_PER_MS;
 }
 
+static uint32_t _now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * US_PER_SEC + ts.tv_nsec / 1000;
+}
+
+static void _update_latency(bench_client_t *node, benchmark_msg_ping_t *ping,
+                            size_t len)
+{
+    if (len < sizeof(*ping) + sizeof(benchmark_msg_latency_t)) {
+        return;
+    }
+
+    benchmark_msg_latency_t *hdr = (void *)ping->payload;
+
+    /* one-way transit time contains the clock offset, which cancels out in the jitter */
+    benchmark_udp_latency_rx(&node->latency, ping->seq_no, _now_us() - hdr->time_tx_us);
+
+    /* each RTT measured by the client is reported until the next reply, count it once */
+    if (ping->rtt_last &&
+        (!node->has_rtt_seq_no || hdr->rtt_seq_no != node->rtt_seq_no)) {
+        benchmark_udp_hist_add(&node->latency.rtt, ping->rtt_last);
+        node->rtt_seq_no = hdr->rtt_seq_no;
+        node->has_rtt_seq_no = true;
+    }
+}
+
+static void _export_stats(list_node_t *head)
+{
+    bool csv = strstr(export_file, ".csv") != NULL;
+    char line[256];
+
+    FILE *out = fopen(export_file, "w");
+    if (out == NULL) {
+        perror("can't open export file");
+        return;
+    }
+
+    if (csv) {
+        benchmark_udp_latency_format(line, sizeof(line), NULL, BENCH_FORMAT_CSV_HEADER);
+        fprintf(out, "host,%s\n", line);
+    }
+    else {
+        fprintf(out, "[\n");
+    }
+
+    for (list_node_t* n = head->next; n; n = n->next) {
+        bench_client_t *node = container_of(n, bench_client_t, node);
+
+        inet_ntop(AF_INET6, &node->addr.sin6_addr, addr_str, INET6_ADDRSTRLEN);
+        benchmark_udp_latency_format(line, sizeof(line), &node->latency,
+                                     csv ? BENCH_FORMAT_CSV : BENCH_FORMAT_JSON);
+        if (csv) {
+            fprintf(out, "%s,%s\n", addr_str, line);
+        }
+        else {
+            fprintf(out, "  { \"host\": \"%s\", \"latency\": %s }%s\n",
+                    addr_str, line, n->next ? "," : "");
+        }
+    }
+
+    if (!csv) {
+        fprintf(out, "]\n");
+    }
+    fclose(out);
+}
+
 static void _print_stats(list_node_t *head, struct timeval *now)
 {
     static uint8_t max_addr_len;
@@ -93,6 +167,9 @@ static void _print_stats(list_node_t *head, struct timeval *now)
     if (!one_way) {
         printf("\t\tnum RT\t\tRTT");
     }
+    if (latency_mode) {
+        printf("\tp50\tp90\tp99\tmax\tjitter\treord");
+    }
     printf("\tpkg size\n");
 
     for (list_node_t* n = head->next; n; n = n->next) {
@@ -124,6 +201,14 @@ static void _print_stats(list_node_t *head, struct timeval *now)
                                      : 0;
             printf("\t%u (%u%%)\t%u µs", node->count_rt, success_rate_rt, node->rtt_us);
         }
+        if (latency_mode) {
+            const benchmark_udp_hist_t *rtt = &node->latency.rtt;
+            printf("\t%u\t%u\t%u\t%u\t%u\t%u",
+                   benchmark_udp_hist_percentile(rtt, 500),
+                   benchmark_udp_hist_percentile(rtt, 900),
+                   benchmark_udp_hist_percentile(rtt, 990),
+                   rtt->max, node->latency.jitter >> 4, node->latency.reordered);
+        }
         printf("\t%zu\n", node->packet_len);
     }
 }
@@ -168,12 +253,23 @@ static void dispatch_loop(int sock)
             gettimeofday(&node->first_seen, NULL);
             node->count_rx   = 0;
 
+            if (latency_mode) {
+                cmd->flags |= BENCH_FLAG_LATENCY;
+            }
+            benchmark_udp_latency_reset(&node->latency);
+            node->has_rtt_seq_no = false;
+
             bytes_in = sizeof(*cmd);
             new_node = true;
-        } else if (ping->rtt_last) {
-            node->rtt_us = node->rtt_us
-                         ? (node->rtt_us + ping->rtt_last) / 2
-                         : ping->rtt_last;
+        } else {
+            if (ping->rtt_last) {
+                node->rtt_us = node->rtt_us
+                             ? (node->rtt_us + ping->rtt_last) / 2
+                             : ping->rtt_last;
+            }
+            if (latency_mode) {
+                _update_latency(node, ping, bytes_in);
+            }
         }
 
         /* send reply */
@@ -186,13 +282,17 @@ static void dispatch_loop(int sock)
             tv_last = tv_now;
             clrscr();
             _print_stats(&head, &tv_now);
+            if (export_file) {
+                _export_stats(&head);
+            }
         }
     }
 }
 
 static void _print_help(const char *progname)
 {
-    fprintf(stderr, "usage: %s [-i send interval] [-s payload size] <address> <port>\n",
+    fprintf(stderr, "usage: %s [-i send interval] [-s payload size] [-o] [-l] "
+                    "[-x file] <address> <port>\n",
             progname);
 
     fprintf(stderr, "\npositional arguments:\n");
@@ -203,6 +303,10 @@ static void _print_help(const char *progname)
     fprintf(stderr, "\t-i <interval>\tsend interval in µs\n");
     fprintf(stderr, "\t-s <size>\tadded payload size\n");
     fprintf(stderr, "\t-o one-way mode, don't echo back packets\n");
+    fprintf(stderr, "\t-l latency mode, timestamp every packet to measure "
+                    "RTT percentiles, jitter and reordering\n");
+    fprintf(stderr, "\t-x <file>\tkeep latency statistics updated in <file> "
+                    "as JSON, or CSV if <file> ends in .csv\n");
 }
 
 int main(int argc, char **argv)
@@ -210,7 +314,7 @@ int main(int argc, char **argv)
     const char *progname = argv[0];
     int c;
 
-    while ((c = getopt(argc, argv, "i:s:o")) != -1) {
+    while ((c = getopt(argc, argv, "i:s:olx:")) != -1) {
         switch (c) {
         case 'i':
             delay_us = atoi(optarg);
@@ -221,6 +325,12 @@ int main(int argc, char **argv)
         case 'o':
             one_way = true;
             break;
+        case 'l':
+            latency_mode = true;
+            break;
+        case 'x':
+            export_file = optarg;
+            break;
         default:
             _print_help(progname);
             exit(1);
@@ -235,6 +345,10 @@ int main(int argc, char **argv)
         exit(1);
     }
 
+    if (latency_mode && payload_len < sizeof(benchmark_msg_latency_t)) {
+        payload_len = sizeof(benchmark_msg_latency_t);
+    }
+
     if (getentropy(&cookie, sizeof(cookie)) != 0) {
         perror("getentropy() failed");
         exit(1);
@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 The RIOT authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+"""Create the C source of a zconstfs image from a directory"""
+
+import argparse
+import os
+import sys
+
+import rzip
+
+C_HEADER = """/* This file was automatically generated by mkzconstfs.
+ * !!!! DO NOT EDIT !!!!!
+ */
+
+#include <stdint.h>
+#include "fs/zconstfs.h"
+"""
+
+
+def c_bytes(data, indent="    ", per_line=12):
+    lines = []
+    for pos in range(0, len(data), per_line):
+        lines.append(indent + ", ".join("0x%02x" % b for b in data[pos:pos + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def mangle_name(fname):
+    return "_" + "".join(c if c.isalnum() else "_" for c in fname)
+
+
+def mkzconstfs(root_path, mount_point, name, codec, block_size, out):
+    files = []
+    total_in = 0
+    total_out = 0
+
+    print(C_HEADER, file=out)
+    for dirname, _, file_list in os.walk(root_path):
+        for fname in sorted(file_list):
+            local_fname = os.path.join(dirname, fname)
+            target_fname = "/" + os.path.relpath(local_fname, root_path)
+            with open(local_fname, "rb") as f:
+                data = f.read()
+
+            blocks = [0]
+            stream = bytearray()
+            for pos in range(0, len(data), block_size):
+                stream += rzip.compress(codec, data[pos:pos + block_size],
+                                        block_size=block_size)
+                blocks.append(len(stream))
+
+            mangled = mangle_name(target_fname)
+            print("static const uint8_t %s_data[] = {\n%s\n};" % (mangled, c_bytes(stream)),
+                  file=out)
+            print("static const uint32_t %s_blocks[] = { %s };\n"
+                  % (mangled, ", ".join(str(b) for b in blocks)), file=out)
+            files.append((target_fname, mangled, len(data)))
+            total_in += len(data)
+            total_out += len(stream) + 4 * len(blocks)
+
+    print("static const zconstfs_file_t _files[] = {", file=out)
+    for target_fname, mangled, size in files:
+        print("    {\n        .path = \"%s\",\n        .size = %d,\n"
+              "        .data = %s_data,\n        .blocks = %s_blocks,\n    },"
+              % (target_fname, size, mangled, mangled), file=out)
+    print("};", file=out)
+
+    print("""
+static const zconstfs_t _fs_data = {
+    .files = _files,
+    .nfiles = sizeof(_files) / sizeof(_files[0]),
+    .codec = %s,
+};
+
+vfs_mount_t %s = {
+    .fs = &zconstfs_file_system,
+    .mount_point = "%s",
+    .private_data = (void *)&_fs_data,
+};""" % ("DECOMPRESS_CODEC_" + codec.upper(), name, mount_point), file=out)
+
+    print("%d files, %d -> %d bytes" % (len(files), total_in, total_out),
+          file=sys.stderr)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("path", help="directory to pack")
+    parser.add_argument("-m", "--mount", default="/", help="mount point")
+    parser.add_argument("-n", "--name", default="_zconstfs",
+                        help="name of the vfs_mount_t")
+    parser.add_argument("-c", "--codec", choices=rzip.CODECS.keys(), default="heatshrink")
+    parser.add_argument("-b", "--block-size", type=int, default=512,
+                        help="CONFIG_ZCONSTFS_BLOCKSIZE")
+    parser.add_argument("-o", "--output", type=argparse.FileType("w"), default=sys.stdout)
+    args = parser.parse_args()
+
+    mkzconstfs(args.path, args.mount, args.name, args.codec, args.block_size,
+               args.output)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 The RIOT authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+"""Compress data into the stream formats understood by RIOT's decompress module
+
+Without --raw, the stream is preceded by a decompress_hdr_t, which is what the
+SUIT payload decompression (suit_decompress) expects.
+"""
+
+import argparse
+import struct
+import sys
+
+HDR_MAGIC = b"RZIP"
+CODEC_HEATSHRINK = 1
+CODEC_LZ4 = 2
+
+CODECS = {
+    "heatshrink": CODEC_HEATSHRINK,
+    "lz4": CODEC_LZ4,
+}
+
+
+def compress_heatshrink(data, window_bits=8, lookahead_bits=4):
+    import heatshrink2
+    return heatshrink2.compress(data, window_sz2=window_bits,
+                                lookahead_sz2=lookahead_bits)
+
+
+def compress_lz4(data, block_size=512):
+    import lz4.block
+    out = bytearray()
+    for pos in range(0, len(data), block_size):
+        block = lz4.block.compress(data[pos:pos + block_size], store_size=False)
+        out += struct.pack("<H", len(block)) + block
+    return bytes(out)
+
+
+def compress(codec, data, window_bits=8, lookahead_bits=4, block_size=512):
+    """Compress data into a raw stream of the given codec"""
+    if codec == "heatshrink":
+        return compress_heatshrink(data, window_bits, lookahead_bits)
+    return compress_lz4(data, block_size)
+
+
+def header(codec, size, window_bits=8, lookahead_bits=4, block_size=512):
+    """Create a decompress_hdr_t for a stream decoding to size bytes"""
+    if codec == "heatshrink":
+        param = (window_bits << 4) | lookahead_bits
+    else:
+        param = block_size.bit_length() - 1
+    return struct.pack("<4sBBHI", HDR_MAGIC, CODECS[codec], param, 0, size)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("infile", type=argparse.FileType("rb"))
+    parser.add_argument("outfile", type=argparse.FileType("wb"))
+    parser.add_argument("-c", "--codec", choices=CODECS.keys(), default="heatshrink")
+    parser.add_argument("-w", "--window-bits", type=int, default=8,
+                        help="heatshrink window size (HEATSHRINK_STATIC_WINDOW_BITS)")
+    parser.add_argument("-l", "--lookahead-bits", type=int, default=4,
+                        help="heatshrink lookahead size (HEATSHRINK_STATIC_LOOKAHEAD_BITS)")
+    parser.add_argument("-b", "--block-size", type=int, default=512,
+                        help="LZ4 block size, a power of two not larger than "
+                             "CONFIG_DECOMPRESS_LZ4_BLOCKSIZE")
+    parser.add_argument("--raw", action="store_true", help="omit the header")
+    args = parser.parse_args()
+
+    if args.block_size & (args.block_size - 1):
+        sys.exit("block size must be a power of two")
+
+    data = args.infile.read()
+    stream = compress(args.codec, data, args.window_bits, args.lookahead_bits,
+                      args.block_size)
+    if not args.raw:
+        args.outfile.write(header(args.codec, len(data), args.window_bits,
+                                  args.lookahead_bits, args.block_size))
+    args.outfile.write(stream)
+
+    print("%s: %d -> %d bytes" % (args.codec, len(data), len(stream)),
+          file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
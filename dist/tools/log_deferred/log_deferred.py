@@ -0,0 +1,232 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 The RIOT authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+"""Decode the output of RIOT's log_deferred module
+
+Log messages are written as binary frames holding the ID of the format string
+and the raw arguments. The format strings are read from the `.riot_log_fmt`
+section of the ELF file of the application. The input is read from a file or
+stdin, output that isn't a frame is passed through unchanged:
+
+    make term | log_deferred.py bin/native64/app.elf
+"""
+
+import argparse
+import collections
+import re
+import struct
+import sys
+
+FRAME_MAGIC = b"RLOG"
+FRAME_VERSION = 1
+FRAME_HDR = struct.Struct("<4sBB")
+SECTION = ".riot_log_fmt"
+
+TRUNCATED = 0x80
+
+ARG_INT32 = 1
+ARG_INT64 = 2
+ARG_DOUBLE = 3
+ARG_STR = 4
+ARG_FLOAT = 5
+
+LEVELS = {1: "ERROR", 2: "WARNING", 3: "INFO", 4: "DEBUG"}
+
+# integer argument, the value is unsigned
+Int = collections.namedtuple("Int", ["value", "bits"])
+
+CONVERSION = re.compile(
+    r"%(?P<flags>[-+ #0]*)(?P<width>\*|\d+)?(?:\.(?P<prec>\*|\d*))?"
+    r"(?:hh|h|ll|l|j|z|t|L)?(?P<conv>[diouxXeEfFgGaAcspn%])")
+
+
+def read_format_section(elf_path):
+    """Return the address and content of the format string section"""
+    with open(elf_path, "rb") as f:
+        elf = f.read()
+    if elf[:4] != b"\x7fELF":
+        raise ValueError("{} is not an ELF file".format(elf_path))
+    is64 = elf[4] == 2
+    endian = "<" if elf[5] == 1 else ">"
+    if is64:
+        shoff, = struct.unpack_from(endian + "Q", elf, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from(endian + "HHH", elf, 0x3a)
+        shdr = struct.Struct(endian + "IIQQQQIIQQ")
+    else:
+        shoff, = struct.unpack_from(endian + "I", elf, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from(endian + "HHH", elf, 0x2e)
+        shdr = struct.Struct(endian + "IIIIIIIIII")
+
+    sections = [shdr.unpack_from(elf, shoff + i * shentsize) for i in range(shnum)]
+    strtab = sections[shstrndx]
+    for sec in sections:
+        start = strtab[4] + sec[0]
+        name = elf[start:elf.index(b"\0", start)].decode()
+        if name == SECTION:
+            return sec[3], elf[sec[4]:sec[4] + sec[5]]
+    raise ValueError("{} has no {} section, is log_deferred used?"
+                     .format(elf_path, SECTION))
+
+
+class Decoder:
+    """Turn frames into text using the format strings of an ELF file"""
+
+    def __init__(self, elf_path, show_level=False):
+        self.addr, self.strings = read_format_section(elf_path)
+        self.show_level = show_level
+
+    def format_string(self, fmt_id):
+        offset = fmt_id - self.addr
+        if offset < 0 or offset >= len(self.strings):
+            return None
+        end = self.strings.index(b"\0", offset)
+        return self.strings[offset:end].decode(errors="replace")
+
+    @staticmethod
+    def parse_args(payload):
+        args = []
+        pos = 0
+        while pos < len(payload):
+            atype = payload[pos]
+            pos += 1
+            if atype == ARG_INT32:
+                args.append(Int(struct.unpack_from("<I", payload, pos)[0], 32))
+                pos += 4
+            elif atype == ARG_INT64:
+                args.append(Int(struct.unpack_from("<Q", payload, pos)[0], 64))
+                pos += 8
+            elif atype == ARG_DOUBLE:
+                args.append(struct.unpack_from("<d", payload, pos)[0])
+                pos += 8
+            elif atype == ARG_FLOAT:
+                args.append(struct.unpack_from("<f", payload, pos)[0])
+                pos += 4
+            elif atype == ARG_STR:
+                length = payload[pos]
+                args.append(payload[pos + 1:pos + 1 + length]
+                            .decode(errors="replace"))
+                pos += 1 + length
+            else:
+                raise ValueError("unknown argument type {}".format(atype))
+        return args
+
+    @staticmethod
+    def apply(fmt, args):
+        """printf() for the decoded arguments"""
+        args = list(args)
+        out = []
+        pos = 0
+        for m in CONVERSION.finditer(fmt):
+            out.append(fmt[pos:m.start()])
+            pos = m.end()
+            conv = m.group("conv")
+            if conv == "%":
+                out.append("%")
+                continue
+            spec = "%" + m.group("flags")
+            for part, prefix in (("width", ""), ("prec", ".")):
+                value = m.group(part)
+                if value == "*":
+                    value = str(_signed(args.pop(0)) if args else 0).lstrip("-")
+                if value is not None:
+                    spec += prefix + value
+            if not args:
+                out.append("<missing>")
+                continue
+            arg = args.pop(0)
+            if conv in "di":
+                out.append((spec + "d") % _signed(arg))
+            elif conv in "ouxX":
+                out.append((spec + conv) % _unsigned(arg))
+            elif conv in "eEfFgGaA":
+                conv = "f" if conv in "aA" else conv
+                out.append((spec + conv) % (arg if isinstance(arg, float) else 0.0))
+            elif conv == "c":
+                out.append((spec + "c") % chr(_unsigned(arg) & 0xff))
+            elif conv == "s":
+                out.append((spec + "s") % (arg if isinstance(arg, str) else "<?>"))
+            elif conv == "p":
+                out.append("0x%x" % _unsigned(arg))
+        out.append(fmt[pos:])
+        return "".join(out)
+
+    def decode(self, payload):
+        level, fmt_id = struct.unpack_from("<BI", payload)
+        fmt = self.format_string(fmt_id)
+        if fmt is None:
+            return "<unknown format string 0x{:x}>\n".format(fmt_id)
+        text = self.apply(fmt, self.parse_args(payload[5:]))
+        if level & TRUNCATED:
+            text = text.rstrip("\n") + " <truncated>\n"
+        if self.show_level:
+            text = "[{}] {}".format(LEVELS.get(level & ~TRUNCATED, level), text)
+        return text
+
+    def process(self, data, out, final=False):
+        """Write decoded frames and other output, return unprocessed data"""
+        while True:
+            pos = data.find(FRAME_MAGIC)
+            if pos < 0:
+                # the start of the magic number may be at the end
+                keep = 0 if final else len(FRAME_MAGIC) - 1
+                keep = min(keep, len(data))
+                out.write(data[:len(data) - keep].decode(errors="replace"))
+                return data[len(data) - keep:]
+            out.write(data[:pos].decode(errors="replace"))
+            data = data[pos:]
+            if len(data) < FRAME_HDR.size:
+                return b"" if final else data
+            _, version, length = FRAME_HDR.unpack_from(data)
+            if version != FRAME_VERSION or length < 5:
+                out.write(data[:1].decode(errors="replace"))
+                data = data[1:]
+                continue
+            if len(data) < FRAME_HDR.size + length:
+                return b"" if final else data
+            payload = data[FRAME_HDR.size:FRAME_HDR.size + length]
+            try:
+                out.write(self.decode(payload))
+            except (ValueError, IndexError, struct.error, TypeError):
+                out.write("<damaged log frame>\n")
+            data = data[FRAME_HDR.size + length:]
+
+
+def _unsigned(arg):
+    return arg.value if isinstance(arg, Int) else 0
+
+
+def _signed(arg):
+    if not isinstance(arg, Int):
+        return 0
+    if arg.value >= 1 << (arg.bits - 1):
+        return arg.value - (1 << arg.bits)
+    return arg.value
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("elf", help="ELF file of the application")
+    parser.add_argument("input", nargs="?", default="-",
+                        help="captured output, stdin if omitted")
+    parser.add_argument("-l", "--level", action="store_true",
+                        help="prefix messages with the log level")
+    args = parser.parse_args()
+
+    decoder = Decoder(args.elf, args.level)
+    infile = sys.stdin.buffer if args.input == "-" else open(args.input, "rb")
+    data = b""
+    with infile:
+        while True:
+            chunk = infile.read1(4096) if hasattr(infile, "read1") else infile.read(4096)
+            if not chunk:
+                break
+            data = decoder.process(data + chunk, sys.stdout)
+            sys.stdout.flush()
+        decoder.process(data, sys.stdout, final=True)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
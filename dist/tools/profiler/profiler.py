@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 The RIOT authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+"""Convert the output of RIOT's profiler_dump() to folded stacks
+
+The input is a capture of stdio containing the output of profiler_dump(), all
+other lines are ignored. The program counters are resolved to function names
+with addr2line and the ELF file of the application. Every output line is
+`thread;function count`, the input format of flamegraph.pl and speedscope.
+"""
+
+import argparse
+import collections
+import re
+import subprocess
+import sys
+
+THREAD = re.compile(r"profiler: thread (\d+) (.*?)\s*$")
+SAMPLE = re.compile(r"profiler: sample (-?\d+) 0x([0-9a-fA-F]+) (\d+)\s*$")
+TOTAL = re.compile(r"profiler: total (\d+) dropped (\d+)\s*$")
+
+
+def parse(lines):
+    threads = {}
+    samples = []
+    dropped = 0
+    for line in lines:
+        m = THREAD.search(line)
+        if m:
+            # threads are unnamed without DEVELHELP
+            if m.group(2) != "-":
+                threads[int(m.group(1))] = m.group(2)
+            continue
+        m = SAMPLE.search(line)
+        if m:
+            samples.append((int(m.group(1)), int(m.group(2), 16),
+                            int(m.group(3))))
+            continue
+        m = TOTAL.search(line)
+        if m:
+            dropped = int(m.group(2))
+    return threads, samples, dropped
+
+
+def symbolize(addr2line, elf, pcs, lines):
+    """Map every program counter to a function name (and source line)"""
+    pcs = sorted(set(pc for pc in pcs if pc))
+    if not pcs:
+        return {}
+    out = subprocess.run([addr2line, "-f", "-e", elf] + [hex(pc) for pc in pcs],
+                         check=True, capture_output=True, text=True).stdout
+    out = out.splitlines()
+    names = {}
+    for i, pc in enumerate(pcs):
+        func, loc = out[2 * i], out[2 * i + 1]
+        if func == "??":
+            func = hex(pc)
+        if lines and not loc.startswith("??"):
+            # strip the directory and the discriminator
+            func += ":" + loc.split("/")[-1].split(" ")[0]
+        names[pc] = func
+    return names
+
+
+def fold(threads, samples, names):
+    folded = collections.Counter()
+    for pid, pc, count in samples:
+        thread = threads.get(pid, "pid{}".format(pid))
+        func = names.get(pc, "[isr]" if pc == 0 else hex(pc))
+        folded["{};{}".format(thread, func)] += count
+    return folded
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("elf", help="ELF file of the profiled application")
+    parser.add_argument("input", type=argparse.FileType("r", errors="replace"),
+                        help="output of profiler_dump()")
+    parser.add_argument("output", nargs="?", type=argparse.FileType("w"),
+                        default=sys.stdout, help="folded stacks (default: stdout)")
+    parser.add_argument("--addr2line", default="addr2line",
+                        help="addr2line of the toolchain, e.g. "
+                             "arm-none-eabi-addr2line")
+    parser.add_argument("--lines", action="store_true",
+                        help="attribute samples to source lines instead of "
+                             "functions")
+    args = parser.parse_args()
+
+    threads, samples, dropped = parse(args.input)
+    if not samples:
+        sys.exit("no profiler samples found")
+    if dropped:
+        print("warning: {} samples were dropped, increase CONFIG_PROFILER_SLOTS"
+              .format(dropped), file=sys.stderr)
+
+    names = symbolize(args.addr2line, args.elf, [s[1] for s in samples],
+                      args.lines)
+    for stack, count in sorted(fold(threads, samples, names).items()):
+        print(stack, count, file=args.output)
+
+
+if __name__ == "__main__":
+    main()
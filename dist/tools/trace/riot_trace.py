@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 The RIOT authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+"""Convert traces exported by RIOT's trace module to the Chrome trace format
+
+The input is a capture of stdio, e.g. `make term > capture.bin` or a serial
+port read with pyserial. Frames written by trace_export() are extracted from
+it, all other output is ignored. The resulting JSON can be opened with
+https://ui.perfetto.dev or chrome://tracing.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+FRAME_MAGIC = b"RTRC"
+FRAME_VERSION = 1
+FRAME_HDR = struct.Struct("<4sBBH")
+FRAME_RECORDS = 0
+FRAME_THREAD = 1
+RECORD = struct.Struct("<IBBhI")
+
+EVENT_USER = 1
+EVENT_THREAD_SWITCH = 2
+EVENT_ISR_ENTER = 3
+EVENT_ISR_EXIT = 4
+EVENT_MSG_SEND = 5
+EVENT_MSG_RECV = 6
+EVENT_PKTBUF_ALLOC = 7
+EVENT_PKTBUF_FREE = 8
+EVENT_ZTIMER_FIRE = 9
+
+FLAG_ISR = 0x01
+
+PID = 1         # process id used for all events
+ISR_TID = -1    # pseudo thread for interrupt handlers
+KERNEL_PID_UNDEF = 0
+
+
+def parse_frames(data):
+    """Yield (type, payload) of all frames in data"""
+    pos = 0
+    while True:
+        pos = data.find(FRAME_MAGIC, pos)
+        if pos < 0 or pos + FRAME_HDR.size > len(data):
+            return
+        _, version, ftype, count = FRAME_HDR.unpack_from(data, pos)
+        if version != FRAME_VERSION:
+            pos += 1
+            continue
+        if ftype == FRAME_RECORDS:
+            length = count * RECORD.size
+        elif ftype == FRAME_THREAD:
+            length = count
+        else:
+            pos += 1
+            continue
+        start = pos + FRAME_HDR.size
+        if start + length > len(data):
+            return
+        yield ftype, data[start:start + length]
+        pos = start + length
+
+
+def parse(data):
+    """Return the thread names and the records of a capture"""
+    threads = {}
+    records = []
+    for ftype, payload in parse_frames(data):
+        if ftype == FRAME_THREAD:
+            pid, = struct.unpack_from("<h", payload)
+            threads[pid] = payload[2:].decode(errors="replace")
+        else:
+            records.extend(RECORD.iter_unpack(payload))
+    return threads, unwrap(records)
+
+
+def unwrap(records):
+    """Extend the 32 bit microsecond timestamps, which wrap after ~71 min"""
+    result = []
+    offset = 0
+    last = None
+    for time, etype, flags, pid, arg in records:
+        if last is not None and time + offset < last - (1 << 31):
+            offset += 1 << 32
+        last = time + offset
+        result.append((time + offset, etype, flags, pid, arg))
+    # records of events that preempted each other are not stored in order
+    result.sort(key=lambda r: r[0])
+    return result
+
+
+def to_chrome(threads, records):
+    events = []
+    names = dict(threads)
+    names[ISR_TID] = "ISR"
+
+    def tid_of(pid, flags):
+        return ISR_TID if flags & FLAG_ISR else pid
+
+    running = None      # (pid, start) of the thread on the CPU
+    pkt_bytes = 0
+
+    for time, etype, flags, pid, arg in records:
+        base = {"pid": PID, "ts": time}
+        if etype == EVENT_THREAD_SWITCH:
+            if running is not None and running[0] != KERNEL_PID_UNDEF:
+                events.append(dict(base, ph="X", name="running", tid=running[0],
+                                   ts=running[1], dur=time - running[1]))
+            running = (pid, time)
+        elif etype == EVENT_ISR_ENTER:
+            events.append(dict(base, ph="B", name="irq %d" % arg, tid=ISR_TID))
+        elif etype == EVENT_ISR_EXIT:
+            events.append(dict(base, ph="E", name="irq %d" % arg, tid=ISR_TID))
+        elif etype in (EVENT_MSG_SEND, EVENT_MSG_RECV):
+            peer = arg >> 16
+            if peer & 0x8000:
+                peer -= 0x10000
+            name = "send" if etype == EVENT_MSG_SEND else "recv"
+            events.append(dict(base, ph="i", s="t", name="msg " + name,
+                               tid=tid_of(pid, flags),
+                               args={"peer": names.get(peer, peer), "type": arg & 0xffff}))
+        elif etype in (EVENT_PKTBUF_ALLOC, EVENT_PKTBUF_FREE):
+            pkt_bytes += arg if etype == EVENT_PKTBUF_ALLOC else -arg
+            events.append(dict(base, ph="C", name="pktbuf", tid=0,
+                               args={"bytes": pkt_bytes}))
+        elif etype == EVENT_ZTIMER_FIRE:
+            events.append(dict(base, ph="i", s="t", name="ztimer",
+                               tid=tid_of(pid, flags), args={"timer": "0x%x" % arg}))
+        elif etype == EVENT_USER:
+            events.append(dict(base, ph="i", s="t", name="trace",
+                               tid=tid_of(pid, flags), args={"value": arg}))
+
+    for tid, name in names.items():
+        events.append({"ph": "M", "name": "thread_name", "pid": PID, "tid": tid,
+                       "args": {"name": name}})
+    events.append({"ph": "M", "name": "process_name", "pid": PID,
+                   "args": {"name": "RIOT"}})
+
+    return {"traceEvents": events, "displayTimeUnit": "ns"}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("input", type=argparse.FileType("rb"),
+                        help="capture of stdio, - for stdin")
+    parser.add_argument("output", nargs="?", type=argparse.FileType("w"),
+                        default=sys.stdout, help="JSON output (default: stdout)")
+    args = parser.parse_args()
+
+    data = args.input.read()
+    threads, records = parse(data)
+    json.dump(to_chrome(threads, records), args.output)
+    print("%d threads, %d records" % (len(threads), len(records)), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
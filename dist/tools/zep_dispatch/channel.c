@@ -0,0 +1,218 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "channel.h"
+#include "zep_parser.h"
+
+/* a receiver of a frame that is on the air */
+struct reception {
+    channel_rx_t rx;
+    struct sockaddr_in6 addr;
+    bool corrupted;
+};
+
+/* a frame that is on the air */
+struct frame {
+    uint64_t end;           /* end of transmission in µs */
+    uint64_t seq;           /* order of frames that end at the same time */
+    uint8_t buf[ZEP_DISPATCH_PDU];
+    size_t len;
+    unsigned rx_numof;
+    struct reception rx[];
+};
+
+struct node_state {
+    uint64_t tx_until;              /* end of the own transmission */
+    uint64_t rx_until;              /* end of the reception in progress */
+    struct reception *rx;           /* reception in progress */
+};
+
+struct channel {
+    struct frame **heap;    /* frames on the air, ordered by end of transmission */
+    unsigned heap_numof;
+    unsigned heap_size;
+    uint64_t seq;
+    unsigned seed;
+    unsigned nodes_numof;
+    struct node_state nodes[];
+};
+
+static uint64_t _now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+static bool _before(const struct frame *a, const struct frame *b)
+{
+    return a->end < b->end || (a->end == b->end && a->seq < b->seq);
+}
+
+static void _heap_push(channel_t *ch, struct frame *f)
+{
+    if (ch->heap_numof == ch->heap_size) {
+        ch->heap_size = ch->heap_size ? 2 * ch->heap_size : 16;
+        ch->heap = realloc(ch->heap, ch->heap_size * sizeof(*ch->heap));
+    }
+
+    unsigned i = ch->heap_numof++;
+    while (i && _before(f, ch->heap[(i - 1) / 2])) {
+        ch->heap[i] = ch->heap[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    ch->heap[i] = f;
+}
+
+static struct frame *_heap_pop(channel_t *ch)
+{
+    struct frame *top = ch->heap[0];
+    struct frame *last = ch->heap[--ch->heap_numof];
+    unsigned i = 0;
+
+    while (2 * i + 1 < ch->heap_numof) {
+        unsigned child = 2 * i + 1;
+        if (child + 1 < ch->heap_numof && _before(ch->heap[child + 1], ch->heap[child])) {
+            child++;
+        }
+        if (!_before(ch->heap[child], last)) {
+            break;
+        }
+        ch->heap[i] = ch->heap[child];
+        i = child;
+    }
+    ch->heap[i] = last;
+
+    return top;
+}
+
+channel_t *channel_new(unsigned nodes_numof, unsigned seed)
+{
+    channel_t *ch = calloc(1, sizeof(*ch) + nodes_numof * sizeof(ch->nodes[0]));
+
+    if (ch) {
+        ch->seed = seed;
+        ch->nodes_numof = nodes_numof;
+    }
+
+    return ch;
+}
+
+void channel_tx(channel_t *ch, unsigned src, const void *buffer, size_t len,
+                const channel_rx_t *rx, unsigned rx_numof)
+{
+    struct node_state *sender = &ch->nodes[src];
+    struct frame *f = malloc(sizeof(*f) + rx_numof * sizeof(f->rx[0]));
+
+    if (f == NULL || len > sizeof(f->buf)) {
+        free(f);
+        return;
+    }
+
+    uint64_t start = _now_us();
+    if (sender->tx_until > start) {
+        start = sender->tx_until;
+    }
+
+    f->end = start + (CHANNEL_PHY_OVERHEAD + zep_get_psdu_len(buffer, len))
+                   * CHANNEL_US_PER_BYTE;
+    f->seq = ch->seq++;
+    f->len = len;
+    f->rx_numof = rx_numof;
+    memcpy(f->buf, buffer, len);
+
+    /* the sender can't receive while it is sending */
+    if (sender->rx_until > start) {
+        sender->rx->corrupted = true;
+    }
+    sender->tx_until = f->end;
+
+    for (unsigned i = 0; i < rx_numof; i++) {
+        struct reception *r = &f->rx[i];
+        struct node_state *receiver = &ch->nodes[rx[i].id];
+
+        r->rx = rx[i];
+        r->rx.addr = &r->addr;
+        memcpy(&r->addr, rx[i].addr, sizeof(r->addr));
+        r->corrupted = false;
+
+        /* receiver is sending itself */
+        if (receiver->tx_until > start) {
+            r->corrupted = true;
+        }
+
+        /* receiver already hears a different frame - both are lost.
+         * The sender of that frame might not be in range of src (hidden node) */
+        if (receiver->rx_until > start) {
+            receiver->rx->corrupted = true;
+            r->corrupted = true;
+        }
+
+        if (f->end > receiver->rx_until) {
+            receiver->rx_until = f->end;
+            receiver->rx = r;
+        }
+    }
+
+    _heap_push(ch, f);
+}
+
+void channel_deliver(channel_t *ch, zep_tx_t *tx)
+{
+    uint64_t now = _now_us();
+
+    while (ch->heap_numof && ch->heap[0]->end <= now) {
+        struct frame *f = _heap_pop(ch);
+
+        for (unsigned i = 0; i < f->rx_numof; i++) {
+            struct reception *r = &f->rx[i];
+
+            if (r->corrupted) {
+                zep_stats_add(&tx->stats.collided, 1);
+                continue;
+            }
+
+            /* packet loss */
+            if (rand_r(&ch->seed) > r->rx.weight * RAND_MAX) {
+                zep_stats_add(&tx->stats.lost, 1);
+                continue;
+            }
+
+            zep_set_lqi(f->buf, r->rx.weight * 0xFF);
+            zep_tx_send(tx, f->buf, f->len, &r->addr, NULL);
+            __atomic_fetch_add(r->rx.num_rx, 1, __ATOMIC_RELAXED);
+        }
+
+        /* a later frame must not mark this reception as corrupted */
+        for (unsigned i = 0; i < f->rx_numof; i++) {
+            struct node_state *receiver = &ch->nodes[f->rx[i].rx.id];
+            if (receiver->rx == &f->rx[i]) {
+                receiver->rx = NULL;
+                receiver->rx_until = 0;
+            }
+        }
+
+        free(f);
+    }
+}
+
+int64_t channel_timeout_us(const channel_t *ch)
+{
+    if (ch->heap_numof == 0) {
+        return -1;
+    }
+
+    uint64_t now = _now_us();
+    if (ch->heap[0]->end <= now) {
+        return 0;
+    }
+
+    return ch->heap[0]->end - now;
+}
@@ -0,0 +1,96 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef CHANNEL_H
+#define CHANNEL_H
+
+#include <stdint.h>
+#include <netinet/in.h>
+
+#include "zep_tx.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Time it takes to transmit one byte at 250 kbit/s in µs
+ */
+#define CHANNEL_US_PER_BYTE     32
+
+/**
+ * @brief   Bytes sent before the PSDU (preamble, SFD and PHR)
+ */
+#define CHANNEL_PHY_OVERHEAD    6
+
+/**
+ * @brief   Radio channel model
+ *
+ *          The channel delays every frame by its airtime and drops frames
+ *          whose reception overlaps with another frame at the same receiver
+ *          (collisions, including those caused by hidden nodes) or with a
+ *          transmission of the receiver itself (half-duplex radios).
+ */
+typedef struct channel channel_t;
+
+/**
+ * @brief   Receiver of a frame
+ */
+typedef struct {
+    unsigned id;                        /**< receiving node */
+    const struct sockaddr_in6 *addr;    /**< address of the receiving node */
+    uint32_t *num_rx;                   /**< receive counter of the node */
+    float weight;                       /**< link quality, probability of reception */
+} channel_rx_t;
+
+/**
+ * @brief   Create a channel model
+ *
+ * @param[in] nodes_numof   number of nodes, node ids range from 0 to
+ *                          @p nodes_numof - 1
+ * @param[in] seed          random seed used to simulate packet loss
+ *
+ * @return the channel model, NULL if out of memory
+ */
+channel_t *channel_new(unsigned nodes_numof, unsigned seed);
+
+/**
+ * @brief   Start the transmission of a frame
+ *
+ *          The transmission starts now or, if the sender is still busy with
+ *          an earlier frame, right after that one.
+ *
+ * @param[in, out] ch       channel to send on
+ * @param[in]      src      sending node
+ * @param[in]      buffer   ZEP frame to send
+ * @param[in]      len      ZEP frame length
+ * @param[in]      rx       nodes in range of @p src
+ * @param[in]      rx_numof number of entries in @p rx
+ */
+void channel_tx(channel_t *ch, unsigned src, const void *buffer, size_t len,
+                const channel_rx_t *rx, unsigned rx_numof);
+
+/**
+ * @brief   Queue all frames whose airtime has passed for sending
+ *
+ * @param[in, out] ch       channel model
+ * @param[in, out] tx       batch to queue the frames in
+ */
+void channel_deliver(channel_t *ch, zep_tx_t *tx);
+
+/**
+ * @brief   Get the time until the next frame is due
+ *
+ * @param[in] ch            channel model
+ *
+ * @return time until the next frame is due in µs, -1 if no frame is pending
+ */
+int64_t channel_timeout_us(const channel_t *ch);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHANNEL_H */
@@ -5,12 +5,9 @@
  * License v2. See the file LICENSE for more details.
  */
 
-#ifndef ZEP_DISPATCH_PDU
-#define ZEP_DISPATCH_PDU    256
-#endif
-
 #include <arpa/inet.h>
 #include <netdb.h>
+#include <pthread.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -19,6 +16,8 @@
 #include <time.h>
 #include <unistd.h>
 
+#include <poll.h>
+
 #include <linux/if.h>
 #include <linux/if_packet.h>
 #include <sys/ioctl.h>
@@ -26,44 +25,99 @@
 #include "kernel_defines.h"
 #include "topology.h"
 #include "zep_parser.h"
+#include "zep_tx.h"
 
 #define ETH_P_IEEE802154 0x00F6
 
+/**
+ * @brief   Number of frames that are fetched with a single recvmmsg() call
+ */
+#ifndef ZEP_RX_BATCH
+#define ZEP_RX_BATCH    32
+#endif
+
 typedef struct {
     list_node_t node;
     struct sockaddr_in6 addr;
+    bool failed;    /**< set by any worker, only access with __atomic */
 } zep_client_t;
 
 typedef void (*dispatch_cb_t)(void *ctx, void *buffer, size_t len,
-                              int sock, struct sockaddr_in6 *src_addr);
+                              zep_tx_t *tx, struct sockaddr_in6 *src_addr);
+
+typedef struct {
+    pthread_t thread;
+    int sock;
+    int tap;
+    unsigned seed;
+    dispatch_cb_t dispatch;
+    void *ctx;
+    channel_t *channel;
+    zep_tx_t tx;
+} zep_worker_t;
+
+/* protects the list of flat topology clients */
+static pthread_rwlock_t _flat_lock = PTHREAD_RWLOCK_INITIALIZER;
+
+static void _flat_send_failed(void *arg)
+{
+    zep_client_t *client = arg;
+
+    /* remove client if sending fails, other workers may be sending to it
+     * concurrently under the read lock */
+    __atomic_store_n(&client->failed, true, __ATOMIC_RELAXED);
+}
 
 /* all nodes are directly connected */
 static void _send_flat(void *ctx, void *buffer, size_t len,
-                       int sock, struct sockaddr_in6 *src_addr)
+                       zep_tx_t *tx, struct sockaddr_in6 *src_addr)
 {
     list_node_t *head = ctx;
     char addr_str[INET6_ADDRSTRLEN];
 
     /* send packet to all other clients */
     bool known_node = false;
-    list_node_t *prev = head;
+    bool has_failed = false;
 
+    pthread_rwlock_rdlock(&_flat_lock);
     for (list_node_t *n = head->next; n; n = n->next) {
-        struct sockaddr_in6 *addr = &container_of(n, zep_client_t, node)->addr;
+        zep_client_t *client = container_of(n, zep_client_t, node);
 
         /* don't echo packet back to sender */
-        if (memcmp(src_addr, addr, sizeof(*addr)) == 0) {
+        if (memcmp(src_addr, &client->addr, sizeof(client->addr)) == 0) {
             known_node = true;
-            /* remove client if sending fails */
         }
-        else if (sendto(sock, buffer, len, 0, (struct sockaddr *)addr, sizeof(*addr)) < 0) {
-            inet_ntop(src_addr->sin6_family, &addr->sin6_addr, addr_str, INET6_ADDRSTRLEN);
-            printf("removing [%s]:%d\n", addr_str, ntohs(addr->sin6_port));
+        else if (!__atomic_load_n(&client->failed, __ATOMIC_RELAXED)) {
+            zep_tx_send(tx, buffer, len, &client->addr, client);
+        }
+    }
+    /* clients must not be freed while their frames are queued */
+    zep_tx_flush(tx);
+    for (list_node_t *n = head->next; n; n = n->next) {
+        has_failed |= __atomic_load_n(&container_of(n, zep_client_t, node)->failed,
+                                      __ATOMIC_RELAXED);
+    }
+    pthread_rwlock_unlock(&_flat_lock);
+
+    if (known_node && !has_failed) {
+        return;
+    }
+
+    pthread_rwlock_wrlock(&_flat_lock);
+    known_node = false;
+    for (list_node_t *prev = head, *n = head->next; n; n = prev->next) {
+        zep_client_t *client = container_of(n, zep_client_t, node);
+
+        if (__atomic_load_n(&client->failed, __ATOMIC_RELAXED)) {
+            inet_ntop(client->addr.sin6_family, &client->addr.sin6_addr,
+                      addr_str, INET6_ADDRSTRLEN);
+            printf("removing [%s]:%d\n", addr_str, ntohs(client->addr.sin6_port));
             prev->next = n->next;
-            free(n);
+            free(client);
             continue;
         }
 
+        known_node |= memcmp(src_addr, &client->addr, sizeof(client->addr)) == 0;
         prev = n;
     }
 
@@ -71,15 +125,16 @@ static void _send_flat(void *ctx, void *buffer, size_t len,
     if (!known_node) {
         inet_ntop(src_addr->sin6_family, &src_addr->sin6_addr, addr_str, INET6_ADDRSTRLEN);
         printf("adding [%s]:%d\n", addr_str, ntohs(src_addr->sin6_port));
-        zep_client_t *client = malloc(sizeof(zep_client_t));
+        zep_client_t *client = calloc(1, sizeof(zep_client_t));
         memcpy(&client->addr, src_addr, sizeof(*src_addr));
         list_add(head, &client->node);
     }
+    pthread_rwlock_unlock(&_flat_lock);
 }
 
 /* nodes are connected as described by topology */
 static void _send_topology(void *ctx, void *buffer, size_t len,
-                           int sock, struct sockaddr_in6 *src_addr)
+                           zep_tx_t *tx, struct sockaddr_in6 *src_addr)
 {
     uint8_t mac_src[8];
     uint8_t mac_src_len;
@@ -92,40 +147,126 @@ static void _send_topology(void *ctx, void *buffer, size_t len,
             topology_add(ctx, mac_src, mac_src_len, src_addr);
         }
     }
-    topology_send(ctx, sock, src_addr, buffer, len);
+    topology_send(ctx, tx, src_addr, buffer, len);
 }
 
-static void dispatch_loop(int sock, int tap, dispatch_cb_t dispatch, void *ctx)
+static void *dispatch_loop(void *arg)
 {
+    zep_worker_t *w = arg;
+    uint8_t buffer[ZEP_RX_BATCH][ZEP_DISPATCH_PDU];
+    struct sockaddr_in6 src_addr[ZEP_RX_BATCH];
+    struct iovec iov[ZEP_RX_BATCH];
+    struct mmsghdr msgs[ZEP_RX_BATCH];
+
+    topology_seed(w->seed);
+
+    for (unsigned i = 0; i < ZEP_RX_BATCH; i++) {
+        iov[i].iov_base = buffer[i];
+        iov[i].iov_len = sizeof(buffer[i]);
+        msgs[i].msg_hdr = (struct msghdr) {
+            .msg_iov = &iov[i],
+            .msg_iovlen = 1,
+            .msg_name = &src_addr[i],
+        };
+    }
+
     puts("entering loop…");
     while (1) {
-        uint8_t buffer[ZEP_DISPATCH_PDU];
-        struct sockaddr_in6 src_addr;
-        socklen_t addr_len = sizeof(src_addr);
+        for (unsigned i = 0; i < ZEP_RX_BATCH; i++) {
+            msgs[i].msg_hdr.msg_namelen = sizeof(src_addr[i]);
+        }
+
+        int num;
 
-        /* receive incoming packet */
-        ssize_t bytes_in = recvfrom(sock, buffer, sizeof(buffer), 0,
-                                    (struct sockaddr *)&src_addr, &addr_len);
+        if (w->channel) {
+            /* wait for a packet or until the next frame is due on the channel */
+            struct pollfd pfd = { .fd = w->sock, .events = POLLIN };
+            int64_t timeout = channel_timeout_us(w->channel);
+            struct timespec ts = {
+                .tv_sec = timeout / 1000000,
+                .tv_nsec = (timeout % 1000000) * 1000,
+            };
+
+            num = 0;
+            if (ppoll(&pfd, 1, timeout < 0 ? NULL : &ts, NULL) > 0) {
+                num = recvmmsg(w->sock, msgs, ZEP_RX_BATCH, MSG_DONTWAIT, NULL);
+            }
+            channel_deliver(w->channel, &w->tx);
+        }
+        else {
+            /* block until there is a packet, then take all that are pending */
+            num = recvmmsg(w->sock, msgs, ZEP_RX_BATCH, MSG_WAITFORONE, NULL);
+        }
 
-        if (bytes_in <= 0) {
+        if (num <= 0) {
+            zep_tx_flush(&w->tx);
             continue;
         }
 
-        /* send packet to virtual 802.15.4 interface */
-        if (tap) {
-            size_t len = bytes_in;
-            const void *payload = zep_get_payload(buffer, &len);
-            if (payload) {
-                if (write(tap, payload, len) < 0) {
-                    puts("Can't write to virtual 802.15.4 device");
-                    close(tap);
-                    tap = 0;
+        zep_stats_add(&w->tx.stats.rx, num);
+
+        for (int i = 0; i < num; i++) {
+            size_t bytes_in = msgs[i].msg_len;
+
+            if (bytes_in == 0) {
+                continue;
+            }
+
+            /* IPv4 addresses are shorter, don't compare stale bytes */
+            if (msgs[i].msg_hdr.msg_namelen < sizeof(src_addr[i])) {
+                memset((uint8_t *)&src_addr[i] + msgs[i].msg_hdr.msg_namelen, 0,
+                       sizeof(src_addr[i]) - msgs[i].msg_hdr.msg_namelen);
+            }
+
+            /* send packet to virtual 802.15.4 interface */
+            if (w->tap) {
+                size_t len = bytes_in;
+                const void *payload = zep_get_payload(buffer[i], &len);
+                if (payload) {
+                    if (write(w->tap, payload, len) < 0) {
+                        puts("Can't write to virtual 802.15.4 device");
+                        w->tap = 0;
+                    }
                 }
             }
+
+            /* send packet to the topology */
+            w->dispatch(w->ctx, buffer[i], bytes_in, &w->tx, &src_addr[i]);
+        }
+
+        zep_tx_flush(&w->tx);
+    }
+
+    return NULL;
+}
+
+static void _report_loop(zep_worker_t *workers, unsigned workers_numof,
+                         unsigned interval)
+{
+    zep_stats_t last = { 0 };
+
+    while (1) {
+        zep_stats_t now = { 0 };
+
+        sleep(interval);
+
+        for (unsigned i = 0; i < workers_numof; i++) {
+            const zep_stats_t *stats = &workers[i].tx.stats;
+            now.rx += zep_stats_get(&stats->rx);
+            now.tx += zep_stats_get(&stats->tx);
+            now.lost += zep_stats_get(&stats->lost);
+            now.failed += zep_stats_get(&stats->failed);
+            now.collided += zep_stats_get(&stats->collided);
         }
 
-        /* send packet to the topology */
-        dispatch(ctx, buffer, bytes_in, sock, &src_addr);
+        printf("{ rx_fps: %llu, tx_fps: %llu, lost: %llu, collided: %llu, failed: %llu }\n",
+               (unsigned long long)(now.rx - last.rx) / interval,
+               (unsigned long long)(now.tx - last.tx) / interval,
+               (unsigned long long)now.lost, (unsigned long long)now.collided,
+               (unsigned long long)now.failed);
+        fflush(stdout);
+
+        last = now;
     }
 }
 
@@ -191,8 +332,8 @@ error:
 
 static void _print_help(const char *progname)
 {
-    fprintf(stderr, "usage: %s [-t topology] [-s seed] "
-                    "[-g graphviz_out] [-w interface] <address> <port>\n",
+    fprintf(stderr, "usage: %s [-t topology] [-s seed] [-g graphviz_out] "
+                    "[-w interface] [-j workers] [-i interval] [-c] <address> <port>\n",
             progname);
 
     fprintf(stderr, "\npositional arguments:\n");
@@ -206,12 +347,21 @@ static void _print_help(const char *progname)
     fprintf(stderr, "\t-g <file>\tFile to dump topology as Graphviz visualisation on SIGUSR1\n");
     fprintf(stderr, "\t-w <interface>\tSend frames to virtual 802.15.4 "
                     "interface (mac802154_hwsim)\n");
+    fprintf(stderr, "\t-j <num>\tNumber of worker threads, each serving its own "
+                    "share of the nodes\n");
+    fprintf(stderr, "\t-i <seconds>\tPrint frame rate and drop counters "
+                    "every <seconds>\n");
+    fprintf(stderr, "\t-c\t\tSimulate airtime and collisions on the radio channel "
+                    "(requires a topology and a single worker)\n");
 }
 
 int main(int argc, char **argv)
 {
     int c, tap_fd = 0;
     unsigned int seed = time(NULL);
+    unsigned workers_numof = 1;
+    unsigned interval = 0;
+    bool channel = false;
     const char *topo_file = NULL;
     const char *progname = argv[0];
 
@@ -222,7 +372,7 @@ int main(int argc, char **argv)
         .ai_flags    = AI_NUMERICHOST,
     };
 
-    while ((c = getopt(argc, argv, "t:s:g:w:p:")) != -1) {
+    while ((c = getopt(argc, argv, "t:s:g:w:p:j:i:c")) != -1) {
         switch (c) {
         case 't':
             topo_file = optarg;
@@ -242,6 +392,18 @@ int main(int argc, char **argv)
         case 'p':
             pidfile = optarg;
             break;
+        case 'j':
+            workers_numof = atoi(optarg);
+            if (workers_numof == 0) {
+                workers_numof = 1;
+            }
+            break;
+        case 'i':
+            interval = atoi(optarg);
+            break;
+        case 'c':
+            channel = true;
+            break;
         default:
             _print_help(progname);
             exit(1);
@@ -256,8 +418,6 @@ int main(int argc, char **argv)
         exit(1);
     }
 
-    srand(seed);
-
     if (topo_file) {
         if (topology_parse(topo_file, &topology)) {
             fprintf(stderr, "can't open '%s'\n", topo_file);
@@ -269,6 +429,18 @@ int main(int argc, char **argv)
         topology.flat = true;
     }
 
+    if (channel) {
+        /* the channel model needs to see all frames in order */
+        if (topology.flat || workers_numof > 1) {
+            fprintf(stderr, "the channel model requires a topology and a single worker\n");
+            return -1;
+        }
+        if (topology_enable_channel(&topology, seed)) {
+            fprintf(stderr, "can't create channel model\n");
+            return -1;
+        }
+    }
+
     if (graphviz_file) {
         signal(SIGUSR1, _info_handler);
     }
@@ -285,17 +457,46 @@ int main(int argc, char **argv)
         exit(1);
     }
 
-    int sock = socket(server_addr->ai_family, server_addr->ai_socktype,
-                      server_addr->ai_protocol);
+    zep_worker_t *workers = calloc(workers_numof, sizeof(*workers));
 
-    if (sock < 0) {
-        perror("socket() failed");
-        exit(1);
-    }
+    /* with several workers, the kernel distributes the nodes among the
+     * sockets by their address, so each node is always served by the
+     * same worker */
+    for (unsigned i = 0; i < workers_numof; i++) {
+        int sock = socket(server_addr->ai_family, server_addr->ai_socktype,
+                          server_addr->ai_protocol);
 
-    if (bind(sock, server_addr->ai_addr, server_addr->ai_addrlen) < 0) {
-        perror("bind() failed");
-        exit(1);
+        if (sock < 0) {
+            perror("socket() failed");
+            exit(1);
+        }
+
+        if (workers_numof > 1) {
+            int one = 1;
+            if (setsockopt(sock, SOL_SOCKET, SO_REUSEPORT, &one, sizeof(one)) < 0) {
+                perror("setsockopt() failed");
+                exit(1);
+            }
+        }
+
+        if (bind(sock, server_addr->ai_addr, server_addr->ai_addrlen) < 0) {
+            perror("bind() failed");
+            exit(1);
+        }
+
+        workers[i].sock = sock;
+        workers[i].tap = tap_fd;
+        workers[i].seed = seed + i;
+        if (topology.flat) {
+            workers[i].dispatch = _send_flat;
+            workers[i].ctx = &topology.nodes;
+        }
+        else {
+            workers[i].dispatch = _send_topology;
+            workers[i].ctx = &topology;
+            workers[i].channel = topology.channel;
+        }
+        zep_tx_init(&workers[i].tx, sock, topology.flat ? _flat_send_failed : NULL);
     }
 
     freeaddrinfo(server_addr);
@@ -308,14 +509,22 @@ int main(int argc, char **argv)
         }
     }
 
-    if (topology.flat) {
-        dispatch_loop(sock, tap_fd, _send_flat, &topology.nodes);
+    if (workers_numof == 1 && interval == 0) {
+        dispatch_loop(&workers[0]);
     }
-    else {
-        dispatch_loop(sock, tap_fd, _send_topology, &topology);
+
+    for (unsigned i = 0; i < workers_numof; i++) {
+        pthread_create(&workers[i].thread, NULL, dispatch_loop, &workers[i]);
+    }
+
+    if (interval) {
+        _report_loop(workers, workers_numof, interval);
     }
 
-    close(sock);
+    for (unsigned i = 0; i < workers_numof; i++) {
+        pthread_join(workers[i].thread, NULL);
+        close(workers[i].sock);
+    }
 
     return 0;
 }
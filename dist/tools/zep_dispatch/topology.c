@@ -13,24 +13,56 @@
 #include <stdlib.h>
 #include <string.h>
 #include <limits.h>
+#include <pthread.h>
 
+#include "hashes.h"
 #include "kernel_defines.h"
 #include "topology.h"
 #include "zep_parser.h"
 
 #define NODE_NAME_MAX_LEN   32
 #define HW_ADDR_MAX_LEN      8
+#define INDEX_SIZE_MIN      64
+
+enum {
+    INDEX_NAME,
+    INDEX_MAC,
+    INDEX_ADDR,
+    INDEX_NUMOF,
+};
+
+/* outgoing connection of a node */
+struct link {
+    struct node *dst;
+    float weight;
+};
 
 struct node {
     list_node_t next;
+    struct node *chain[INDEX_NUMOF];    /* next node in the same hash bucket */
+    struct link *links;                 /* precomputed from the edges */
+    unsigned links_numof;
+    unsigned id;                        /* index in the list of all nodes */
     char name[NODE_NAME_MAX_LEN];
     uint8_t mac[HW_ADDR_MAX_LEN];
     struct sockaddr_in6 addr;
     uint32_t num_tx;
     uint32_t num_rx;
     uint8_t mac_len;
+    bool connected;
 };
 
+struct topology_index {
+    struct node **buckets[INDEX_NUMOF];
+    size_t mask;            /* number of buckets - 1 */
+    struct node **nodes;    /* all nodes in order of appearance */
+    size_t nodes_numof;
+    size_t next_free;       /* first node that might not be connected yet */
+    pthread_rwlock_t lock;  /* protects node addresses and the sniffer */
+};
+
+static __thread unsigned _seed;
+
 struct edge {
     list_node_t next;
     struct node *a;
@@ -57,32 +89,126 @@ static char *_fmt_addr(char *out, size_t out_len, const uint8_t *addr, uint8_t a
     return start;
 }
 
-static struct node *_find_node_by_name(const list_node_t *nodes, const char *name)
+static size_t _hash(const void *key, size_t len)
 {
-    for (list_node_t *node = nodes->next; node; node = node->next) {
-        struct node *super = container_of(node, struct node, next);
-        if (strncmp(super->name, name, sizeof(super->name)) == 0) {
-            return super;
+    return fnv1a_32(FNV1A_32_INIT, key, len);
+}
+
+static const void *_key(const struct node *n, unsigned idx, size_t *len)
+{
+    switch (idx) {
+    case INDEX_NAME:
+        *len = strlen(n->name);
+        return n->name;
+    case INDEX_MAC:
+        *len = n->mac_len;
+        return n->mac;
+    default:
+        *len = sizeof(n->addr);
+        return &n->addr;
+    }
+}
+
+static struct node *_index_find(const struct topology_index *index, unsigned idx,
+                                const void *key, size_t len)
+{
+    struct node *n = index->buckets[idx][_hash(key, len) & index->mask];
+
+    for (; n; n = n->chain[idx]) {
+        size_t n_len;
+        const void *n_key = _key(n, idx, &n_len);
+        if (n_len == len && memcmp(n_key, key, len) == 0) {
+            return n;
         }
     }
 
     return NULL;
 }
 
-static struct node *_find_or_create_node(list_node_t *nodes, const char *name)
+static void _index_add(struct topology_index *index, unsigned idx, struct node *n)
+{
+    size_t len;
+    const void *key = _key(n, idx, &len);
+    struct node **bucket = &index->buckets[idx][_hash(key, len) & index->mask];
+
+    n->chain[idx] = *bucket;
+    *bucket = n;
+}
+
+static void _index_remove(struct topology_index *index, unsigned idx, struct node *n)
+{
+    size_t len;
+    const void *key = _key(n, idx, &len);
+    struct node **p = &index->buckets[idx][_hash(key, len) & index->mask];
+
+    for (; *p; p = &(*p)->chain[idx]) {
+        if (*p == n) {
+            *p = n->chain[idx];
+            return;
+        }
+    }
+}
+
+/* size the hash tables so that there is at least one bucket per node */
+static void _index_resize(struct topology_index *index, size_t size)
+{
+    for (unsigned idx = 0; idx < INDEX_NUMOF; idx++) {
+        free(index->buckets[idx]);
+        index->buckets[idx] = calloc(size, sizeof(struct node *));
+    }
+    index->mask = size - 1;
+
+    for (size_t i = 0; i < index->nodes_numof; i++) {
+        struct node *n = index->nodes[i];
+        _index_add(index, INDEX_NAME, n);
+        if (n->mac_len) {
+            _index_add(index, INDEX_MAC, n);
+        }
+        if (n->connected) {
+            _index_add(index, INDEX_ADDR, n);
+        }
+    }
+}
+
+static struct node *_find_or_create_node(struct topology_index *index, const char *name)
 {
-    struct node *node = _find_node_by_name(nodes, name);
+    size_t len = strnlen(name, NODE_NAME_MAX_LEN - 1);
+    struct node *node = _index_find(index, INDEX_NAME, name, len);
 
     if (node == NULL) {
         node = calloc(1, sizeof(*node));
-        strncpy(node->name, name, sizeof(node->name) - 1);
-        list_add(nodes, &node->next);
+        memcpy(node->name, name, len);
+        node->id = index->nodes_numof;
+
+        if (index->nodes_numof > index->mask) {
+            index->nodes = realloc(index->nodes,
+                                   2 * (index->mask + 1) * sizeof(*index->nodes));
+            index->nodes[index->nodes_numof++] = node;
+            _index_resize(index, 2 * (index->mask + 1));
+        }
+        else {
+            index->nodes[index->nodes_numof++] = node;
+            _index_add(index, INDEX_NAME, node);
+        }
     }
 
     return node;
 }
 
-static bool _parse_line(char *line, list_node_t *nodes, list_node_t *edges)
+static void _add_link(struct node *src, struct node *dst, float weight)
+{
+    if (weight == 0) {
+        return;
+    }
+
+    src->links = realloc(src->links, (src->links_numof + 1) * sizeof(*src->links));
+    src->links[src->links_numof++] = (struct link) {
+        .dst = dst,
+        .weight = weight,
+    };
+}
+
+static bool _parse_line(char *line, struct topology_index *index, list_node_t *edges)
 {
     struct edge *e;
 
@@ -100,18 +226,24 @@ static bool _parse_line(char *line, list_node_t *nodes, list_node_t *edges)
     }
 
     if (b == NULL) {
-        _find_or_create_node(nodes, a);
+        _find_or_create_node(index, a);
         return true;
     }
 
     /* add node with a defined MAC address */
     if (strcmp(b, ":=") == 0) {
-        struct node *n = _find_or_create_node(nodes, a);
+        struct node *n = _find_or_create_node(index, a);
         if (n == NULL) {
             return false;
         }
 
+        if (n->mac_len) {
+            _index_remove(index, INDEX_MAC, n);
+        }
         n->mac_len = l2util_addr_from_str(e_ab, n->mac);
+        if (n->mac_len) {
+            _index_add(index, INDEX_MAC, n);
+        }
         return true;
     }
 
@@ -125,13 +257,16 @@ static bool _parse_line(char *line, list_node_t *nodes, list_node_t *edges)
 
     e = malloc(sizeof(*e));
 
-    e->a = _find_or_create_node(nodes, a);
-    e->b = _find_or_create_node(nodes, b);
+    e->a = _find_or_create_node(index, a);
+    e->b = _find_or_create_node(index, b);
     e->weight_a_b = atof(e_ab);
     e->weight_b_a = atof(e_ba);
 
     list_add(edges, &e->next);
 
+    _add_link(e->a, e->b, e->weight_a_b);
+    _add_link(e->b, e->a, e->weight_b_a);
+
     return true;
 }
 
@@ -158,8 +293,8 @@ int topology_print(const char *file, const topology_t *t)
 
     fprintf(out, "digraph G {\n");
 
-    for (list_node_t *node = t->nodes.next; node; node = node->next) {
-        struct node *super = container_of(node, struct node, next);
+    for (size_t i = 0; i < t->index->nodes_numof; i++) {
+        struct node *super = t->index->nodes[i];
         fprintf(out, "\t%s [ label = \"%s\\n[%s]\" ]\n",
                 super->name, super->name,
                 super->mac_len ? _fmt_addr(addr_str, sizeof(addr_str), super->mac, super->mac_len)
@@ -193,14 +328,19 @@ void topology_print_stats(const topology_t *t, bool reset)
 {
     uint32_t tx_total = 0;
 
+    if (t->flat) {
+        return;
+    }
+
     puts("{ nodes: [");
-    for (list_node_t *node = t->nodes.next; node; node = node->next) {
-        struct node *super = container_of(node, struct node, next);
+    for (size_t i = 0; i < t->index->nodes_numof; i++) {
+        struct node *super = t->index->nodes[i];
 
         tx_total += super->num_tx;
 
         printf("\t{ name: %s, tx: %u, rx: %u }%c\n",
-               super->name, super->num_tx, super->num_rx, node->next ? ',' : ' ');
+               super->name, super->num_tx, super->num_rx,
+               i + 1 < t->index->nodes_numof ? ',' : ' ');
         if (reset) {
             super->num_tx = 0;
             super->num_rx = 0;
@@ -226,77 +366,133 @@ int topology_parse(const char *file, topology_t *out)
         return -1;
     }
 
+    struct topology_index *index = calloc(1, sizeof(*index));
+    index->nodes = calloc(INDEX_SIZE_MIN, sizeof(*index->nodes));
+    _index_resize(index, INDEX_SIZE_MIN);
+    pthread_rwlock_init(&index->lock, NULL);
+    out->index = index;
+
     char *line = NULL;
     size_t line_len = 0;
 
     while (getline(&line, &line_len, in) > 0) {
-        _parse_line(line, &out->nodes, &out->edges);
+        _parse_line(line, index, &out->edges);
     }
 
     if (line) {
         free(line);
     }
 
+    /* keep the node list in order of appearance */
+    for (size_t i = index->nodes_numof; i > 0; i--) {
+        list_add(&out->nodes, &index->nodes[i - 1]->next);
+    }
+
     return 0;
 }
 
-void topology_send(const topology_t *t, int sock,
+int topology_enable_channel(topology_t *t, unsigned seed)
+{
+    t->channel = channel_new(t->index->nodes_numof, seed);
+
+    return t->channel ? 0 : -1;
+}
+
+void topology_seed(unsigned seed)
+{
+    _seed = seed;
+}
+
+static void _channel_tx(channel_t *ch, const struct node *sender,
+                        const void *buffer, size_t len)
+{
+    channel_rx_t rx[sender->links_numof + 1];   /* avoid a zero-length array */
+    unsigned rx_numof = 0;
+
+    for (unsigned i = 0; i < sender->links_numof; i++) {
+        struct node *dst = sender->links[i].dst;
+
+        if (!dst->connected) {
+            continue;
+        }
+
+        rx[rx_numof++] = (channel_rx_t) {
+            .id = dst->id,
+            .addr = &dst->addr,
+            .num_rx = &dst->num_rx,
+            .weight = sender->links[i].weight,
+        };
+    }
+
+    channel_tx(ch, sender->id, buffer, len, rx, rx_numof);
+}
+
+void topology_send(const topology_t *t, zep_tx_t *tx,
                    const struct sockaddr_in6 *src_addr,
                    void *buffer, size_t len)
 {
-    struct node *sender = NULL;
+    struct topology_index *index = t->index;
+
+    pthread_rwlock_rdlock(&index->lock);
 
     if (t->has_sniffer) {
-        sendto(sock, buffer, len, 0,
-               (struct sockaddr *)&t->sniffer_addr, sizeof(t->sniffer_addr));
+        zep_tx_send(tx, buffer, len, &t->sniffer_addr, NULL);
     }
 
-    for (list_node_t *edge = t->edges.next; edge; edge = edge->next) {
-        struct edge *super = container_of(edge, struct edge, next);
+    struct node *sender = _index_find(index, INDEX_ADDR, src_addr, sizeof(*src_addr));
+    if (sender == NULL) {
+        goto out;
+    }
 
-        if (!super->a->mac_len || !super->b->mac_len) {
+    __atomic_fetch_add(&sender->num_tx, 1, __ATOMIC_RELAXED);
+
+    /* frames that don't go over the air (e.g. HELLO) are forwarded right away */
+    if (t->channel && zep_get_psdu_len(buffer, len)) {
+        _channel_tx(t->channel, sender, buffer, len);
+        goto out;
+    }
+
+    for (unsigned i = 0; i < sender->links_numof; i++) {
+        const struct link *link = &sender->links[i];
+
+        if (!link->dst->connected) {
             continue;
         }
 
-        if (memcmp(&super->a->addr, src_addr, sizeof(*src_addr)) == 0) {
-            if (sender == NULL) {
-                sender = super->a;
-                sender->num_tx++;
-            }
-
-            /* packet loss */
-            if (random() > super->weight_a_b * RAND_MAX) {
-                continue;
-            }
-            zep_set_lqi(buffer, super->weight_a_b * 0xFF);
-            sendto(sock, buffer, len, 0,
-                   (struct sockaddr *)&super->b->addr,
-                   sizeof(super->b->addr));
-            super->b->num_rx++;
-        }
-        else if (memcmp(&super->b->addr, src_addr, sizeof(*src_addr)) == 0) {
-            if (sender == NULL) {
-                sender = super->b;
-                sender->num_tx++;
-            }
-
-            /* packet loss */
-            if (random() > super->weight_b_a * RAND_MAX) {
-                continue;
-            }
-            zep_set_lqi(buffer, super->weight_b_a * 0xFF);
-            sendto(sock, buffer, len, 0,
-                   (struct sockaddr *)&super->a->addr,
-                   sizeof(super->a->addr));
-            super->a->num_rx++;
+        /* packet loss */
+        if (rand_r(&_seed) > link->weight * RAND_MAX) {
+            zep_stats_add(&tx->stats.lost, 1);
+            continue;
         }
+        zep_set_lqi(buffer, link->weight * 0xFF);
+        zep_tx_send(tx, buffer, len, &link->dst->addr, NULL);
+        __atomic_fetch_add(&link->dst->num_rx, 1, __ATOMIC_RELAXED);
     }
+
+out:
+    pthread_rwlock_unlock(&index->lock);
+}
+
+/* look up the node of a MAC address, NULL if the node can't be used for this address */
+static struct node *_find_node_by_mac(struct topology_index *index,
+                                      const uint8_t *mac, uint8_t mac_len,
+                                      const struct sockaddr_in6 *addr)
+{
+    struct node *node = _index_find(index, INDEX_MAC, mac, mac_len);
+
+    if (node && node->connected && node->addr.sin6_port == addr->sin6_port) {
+        /* abort if node is already connected */
+        return node;
+    }
+
+    return NULL;
 }
 
 bool topology_add(topology_t *t, const uint8_t *mac, uint8_t mac_len,
                   struct sockaddr_in6 *addr)
 {
-    struct node *empty = NULL;
+    struct topology_index *index = t->index;
+    struct node *empty;
     char addr_str[3 * HW_ADDR_MAX_LEN];
 
     if (mac_len > HW_ADDR_MAX_LEN) {
@@ -304,34 +500,39 @@ bool topology_add(topology_t *t, const uint8_t *mac, uint8_t mac_len,
         return false;
     }
 
-    for (list_node_t *node = t->nodes.next; node; node = node->next) {
-        struct node *super = container_of(node, struct node, next);
+    /* fast path: node is already connected */
+    pthread_rwlock_rdlock(&index->lock);
+    empty = _find_node_by_mac(index, mac, mac_len, addr);
+    pthread_rwlock_unlock(&index->lock);
 
-        /* store free node */
-        if (!super->mac_len) {
-            empty = super;
-            continue;
-        }
+    if (empty) {
+        return true;
+    }
 
-        if (mac_len != super->mac_len) {
-            continue;
-        }
+    pthread_rwlock_wrlock(&index->lock);
+
+    /* another thread might have added the node in the meantime */
+    if (_find_node_by_mac(index, mac, mac_len, addr)) {
+        pthread_rwlock_unlock(&index->lock);
+        return true;
+    }
+
+    /* node is already in the list - either it is connected or MAC was pinned */
+    empty = _index_find(index, INDEX_MAC, mac, mac_len);
 
-        /* node is already in the list - either it is connected or MAC was pinned */
-        if (memcmp(super->mac, mac, mac_len) == 0) {
-            if (super->addr.sin6_port == addr->sin6_port) {
-                /* abort if node is already connected */
-                return true;
-            } else {
-                /* use pre-allocated node */
-                empty = super;
-                break;
-            }
+    /* otherwise use the first free node */
+    while (empty == NULL && index->next_free < index->nodes_numof) {
+        struct node *n = index->nodes[index->next_free];
+        if (!n->mac_len) {
+            empty = n;
+            break;
         }
+        index->next_free++;
     }
 
     /* topology full - can't add node */
     if (empty == NULL) {
+        pthread_rwlock_unlock(&index->lock);
         fprintf(stderr, "can't add %s - topology full\n",
                 _fmt_addr(addr_str, sizeof(addr_str), mac, mac_len));
         return false;
@@ -342,9 +543,27 @@ bool topology_add(topology_t *t, const uint8_t *mac, uint8_t mac_len,
             (char *)empty->name);
 
     /* add new node to empty spot */
-    memcpy(empty->mac, mac, sizeof(empty->mac));
+    if (empty->connected) {
+        _index_remove(index, INDEX_ADDR, empty);
+    }
+    if (!empty->mac_len) {
+        memcpy(empty->mac, mac, sizeof(empty->mac));
+        empty->mac_len = mac_len;
+        _index_add(index, INDEX_MAC, empty);
+    }
+
+    /* a different node that used this address before is gone */
+    struct node *stale = _index_find(index, INDEX_ADDR, addr, sizeof(*addr));
+    if (stale) {
+        _index_remove(index, INDEX_ADDR, stale);
+        stale->connected = false;
+    }
+
     memcpy(&empty->addr, addr, sizeof(empty->addr));
-    empty->mac_len = mac_len;
+    empty->connected = true;
+    _index_add(index, INDEX_ADDR, empty);
+
+    pthread_rwlock_unlock(&index->lock);
 
     return true;
 }
@@ -360,6 +579,8 @@ void topology_set_sniffer(topology_t *t, struct sockaddr_in6 *addr)
         printf("adding sniffer %s\n", addr_str);
     }
 
+    pthread_rwlock_wrlock(&t->index->lock);
     memcpy(&t->sniffer_addr, addr, sizeof(t->sniffer_addr));
     t->has_sniffer = true;
+    pthread_rwlock_unlock(&t->index->lock);
 }
@@ -8,19 +8,29 @@
 #ifndef TOPOLOGY_H
 #define TOPOLOGY_H
 
+#include "channel.h"
 #include "list.h"
+#include "zep_tx.h"
 #include <netinet/in.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief   Lookup tables of a topology
+ */
+struct topology_index;
+
 /**
  * @brief   Struct describing a graph of nodes and their connections
  */
 typedef struct {
     list_node_t nodes;  /**< list of nodes */
     list_node_t edges;  /**< list of connections between nodes. Unused if topology is flat */
+    struct topology_index *index;       /**< node lookup tables. Unused if topology is flat */
+    channel_t *channel;                 /**< radio channel model, NULL to forward
+                                             frames right away */
     struct sockaddr_in6 sniffer_addr;   /**< address of sniffer node. Unused if topology is flat */
     bool has_sniffer;   /**< true if a sniffer node is connected. Unused if topology is flat */
     bool flat;          /**< flat topology, all nodes are connected to each other */
@@ -78,16 +88,39 @@ bool topology_add(topology_t *t, const uint8_t *mac, uint8_t mac_len,
  */
 void topology_set_sniffer(topology_t *t, struct sockaddr_in6 *addr);
 
+/**
+ * @brief   Enable the radio channel model
+ *
+ *          Frames are then delivered after their airtime and may collide.
+ *          The caller has to call @ref channel_deliver when frames are due.
+ *
+ * @param[in, out] t        topology to use
+ * @param[in]      seed     random seed used to simulate packet loss
+ *
+ * @return 0 on success, error otherwise
+ */
+int topology_enable_channel(topology_t *t, unsigned seed);
+
+/**
+ * @brief   Seed the packet loss simulation of the calling thread
+ *
+ * @param[in] seed          random seed
+ */
+void topology_seed(unsigned seed);
+
 /**
  * @brief   Send a buffer to all nodes connected to a source node
  *
+ *          The frames are only queued, the caller has to flush @p tx.
+ *          May be called from several threads at once.
+ *
  * @param[in] t             topology to use
- * @param[in] sock          socket to use for sending
+ * @param[in, out] tx       batch to queue the frames in
  * @param[in] src_addr      source node address
  * @param[in] buffer        ZEP frame to send
  * @param[in] len           ZEP frame length
  */
-void topology_send(const topology_t *t, int sock,
+void topology_send(const topology_t *t, zep_tx_t *tx,
                    const struct sockaddr_in6 *src_addr,
                    void *buffer, size_t len);
 
@@ -46,6 +46,35 @@ const void *zep_get_payload(const void *buffer, size_t *len)
     return payload;
 }
 
+size_t zep_get_psdu_len(const void *buffer, size_t len)
+{
+    const zep_v2_data_hdr_t *zep = buffer;
+
+    if (len < sizeof(zep_v2_ack_hdr_t)) {
+        return 0;
+    }
+
+    if ((zep->hdr.preamble[0] != 'E') || (zep->hdr.preamble[1] != 'X')) {
+        return 0;
+    }
+
+    if (zep->hdr.version != 2) {
+        return 0;
+    }
+
+    switch (zep->type) {
+    case ZEP_V2_TYPE_DATA:
+        if (len < sizeof(zep_v2_data_hdr_t)) {
+            return 0;
+        }
+        return zep->length;
+    case ZEP_V2_TYPE_ACK:
+        return IEEE802154_ACK_FRAME_LEN;
+    default:
+        return 0;
+    }
+}
+
 bool zep_parse_mac(const void *buffer, size_t len, void *out, uint8_t *out_len)
 {
     const void *payload;
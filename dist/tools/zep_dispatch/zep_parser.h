@@ -10,6 +10,7 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -26,6 +27,17 @@ extern "C" {
  */
 const void *zep_get_payload(const void *buffer, size_t *len);
 
+/**
+ * @brief   Get the length of the 802.15.4 PSDU carried in a ZEP frame
+ *
+ * @param[in]  buffer   ZEP frame
+ * @param[in]  len      size of buffer
+ *
+ * @return PSDU length including the FCS,
+ *         0 if the frame does not carry a PSDU
+ */
+size_t zep_get_psdu_len(const void *buffer, size_t len);
+
 /**
  * @brief   Parse l2 source address of a ZEP frame
  *
@@ -0,0 +1,66 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include <string.h>
+
+#include "zep_tx.h"
+
+void zep_tx_init(zep_tx_t *tx, int sock, zep_tx_fail_cb_t fail_cb)
+{
+    memset(tx, 0, sizeof(*tx));
+
+    tx->sock = sock;
+    tx->fail_cb = fail_cb;
+
+    for (unsigned i = 0; i < ZEP_TX_BATCH; i++) {
+        tx->iov[i].iov_base = tx->buf[i];
+        tx->msgs[i].msg_hdr.msg_iov = &tx->iov[i];
+        tx->msgs[i].msg_hdr.msg_iovlen = 1;
+        tx->msgs[i].msg_hdr.msg_name = &tx->addr[i];
+        tx->msgs[i].msg_hdr.msg_namelen = sizeof(tx->addr[i]);
+    }
+}
+
+void zep_tx_send(zep_tx_t *tx, const void *buffer, size_t len,
+                 const struct sockaddr_in6 *dst, void *arg)
+{
+    if (len > sizeof(tx->buf[0])) {
+        len = sizeof(tx->buf[0]);
+    }
+
+    memcpy(tx->buf[tx->num], buffer, len);
+    memcpy(&tx->addr[tx->num], dst, sizeof(*dst));
+    tx->iov[tx->num].iov_len = len;
+    tx->arg[tx->num] = arg;
+
+    if (++tx->num == ZEP_TX_BATCH) {
+        zep_tx_flush(tx);
+    }
+}
+
+void zep_tx_flush(zep_tx_t *tx)
+{
+    unsigned sent = 0;
+
+    while (sent < tx->num) {
+        int res = sendmmsg(tx->sock, &tx->msgs[sent], tx->num - sent, 0);
+
+        /* the kernel stops at the first frame it can't send, skip over it */
+        if (res <= 0) {
+            zep_stats_add(&tx->stats.failed, 1);
+            if (tx->fail_cb) {
+                tx->fail_cb(tx->arg[sent]);
+            }
+            res = 1;
+        }
+        else {
+            zep_stats_add(&tx->stats.tx, res);
+        }
+
+        sent += res;
+    }
+
+    tx->num = 0;
+}
@@ -0,0 +1,123 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef ZEP_TX_H
+#define ZEP_TX_H
+
+#include <stdint.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef ZEP_DISPATCH_PDU
+#define ZEP_DISPATCH_PDU    256
+#endif
+
+/**
+ * @brief   Number of frames that are handed to the kernel with a single
+ *          sendmmsg() call
+ */
+#ifndef ZEP_TX_BATCH
+#define ZEP_TX_BATCH        64
+#endif
+
+/**
+ * @brief   Frame counters of a dispatcher thread
+ *
+ *          The counters are only ever incremented by the owning thread, but
+ *          may be read by others at any time.
+ */
+typedef struct {
+    uint64_t rx;        /**< frames received */
+    uint64_t tx;        /**< frames sent */
+    uint64_t lost;      /**< frames dropped by the simulated packet loss */
+    uint64_t failed;    /**< frames the kernel did not accept */
+    uint64_t collided;  /**< frames dropped by a simulated collision */
+} zep_stats_t;
+
+/**
+ * @brief   Called for every frame that could not be sent
+ *
+ * @param[in] arg   argument passed to @ref zep_tx_send for that frame
+ */
+typedef void (*zep_tx_fail_cb_t)(void *arg);
+
+/**
+ * @brief   Batch of outgoing frames
+ */
+typedef struct {
+    int sock;                                   /**< socket to send on */
+    unsigned num;                               /**< number of queued frames */
+    zep_tx_fail_cb_t fail_cb;                   /**< send error callback, may be NULL */
+    zep_stats_t stats;                          /**< frame counters */
+    struct mmsghdr msgs[ZEP_TX_BATCH];          /**< queued messages */
+    struct iovec iov[ZEP_TX_BATCH];             /**< payload of queued messages */
+    struct sockaddr_in6 addr[ZEP_TX_BATCH];     /**< destination of queued messages */
+    void *arg[ZEP_TX_BATCH];                    /**< fail_cb argument of queued messages */
+    uint8_t buf[ZEP_TX_BATCH][ZEP_DISPATCH_PDU];    /**< queued frames */
+} zep_tx_t;
+
+/**
+ * @brief   Initialize a batch of outgoing frames
+ *
+ * @param[out] tx       batch to initialize
+ * @param[in]  sock     socket to send on
+ * @param[in]  fail_cb  called for frames that could not be sent, may be NULL
+ */
+void zep_tx_init(zep_tx_t *tx, int sock, zep_tx_fail_cb_t fail_cb);
+
+/**
+ * @brief   Queue a frame for sending
+ *
+ *          The frame is copied, so @p buffer may be modified as soon as this
+ *          function returns. The batch is flushed if it is full.
+ *
+ * @param[in, out] tx       batch to add the frame to
+ * @param[in]      buffer   ZEP frame to send
+ * @param[in]      len      ZEP frame length
+ * @param[in]      dst      destination address
+ * @param[in]      arg      argument to the fail callback
+ */
+void zep_tx_send(zep_tx_t *tx, const void *buffer, size_t len,
+                 const struct sockaddr_in6 *dst, void *arg);
+
+/**
+ * @brief   Send all queued frames
+ *
+ * @param[in, out] tx       batch to send
+ */
+void zep_tx_flush(zep_tx_t *tx);
+
+/**
+ * @brief   Atomically increment a frame counter
+ *
+ * @param[in, out] counter  counter to increment
+ * @param[in]      num      value to add
+ */
+static inline void zep_stats_add(uint64_t *counter, uint64_t num)
+{
+    __atomic_fetch_add(counter, num, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief   Read a frame counter of a different thread
+ *
+ * @param[in] counter   counter to read
+ *
+ * @return  counter value
+ */
+static inline uint64_t zep_stats_get(const uint64_t *counter)
+{
+    return __atomic_load_n(counter, __ATOMIC_RELAXED);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEP_TX_H */
@@ -310,6 +310,19 @@ struct mtd_desc {
      */
     int (*power)(mtd_dev_t *dev, enum mtd_power_state power);
 
+    /**
+     * @brief   Write data buffered by the driver to the storage
+     *
+     * Only drivers that do not write through immediately need to implement
+     * this, e.g. caches.
+     *
+     * @param[in] dev       Pointer to the selected driver
+     *
+     * @retval 0 on success
+     * @retval <0 value on error
+     */
+    int (*flush)(mtd_dev_t *dev);
+
     /**
      * @brief   Properties of the MTD driver
      */
@@ -520,6 +533,22 @@ int mtd_write_sector(mtd_dev_t *mtd, const void *src, uint32_t sector, uint32_t
  */
 int mtd_power(mtd_dev_t *mtd, enum mtd_power_state power);
 
+/**
+ * @brief   Write all data buffered by a MTD device to the storage
+ *
+ * File systems call this when they need their data to be persistent, e.g.
+ * on `fsync()`. Devices that write through immediately don't buffer anything
+ * and succeed right away.
+ *
+ * @param      mtd   the device to flush
+ *
+ * @retval 0 on success
+ * @retval <0 if an error occurred
+ * @retval -ENODEV if @p mtd is not a valid device
+ * @retval -EIO if I/O error occurred
+ */
+int mtd_flush(mtd_dev_t *mtd);
+
 /**
  * @brief   Get an MTD device by index
  *
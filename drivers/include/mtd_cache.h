@@ -0,0 +1,154 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    drivers_mtd_cache  MTD write-back cache
+ * @ingroup     drivers_mtd
+ * @brief       Sector cache for MTD devices
+ *
+ * This MTD module keeps the most recently used sectors of another MTD device
+ * in RAM. Writes only modify the cached copy of a sector, so that many small
+ * writes (e.g. from a file system updating its metadata) are combined into a
+ * single erase and write of the sector when it is written back. Sectors are
+ * written back when they are evicted from the cache, when @ref mtd_flush is
+ * called (file systems do this on `fsync()`) and before the device is powered
+ * down.
+ *
+ * The cache remembers which pages of a sector are still erased on the
+ * backing device. Pages written after an erase that went through the cache are
+ * programmed without erasing the sector again, as long as none of them has
+ * been programmed before.
+ *
+ * Since writes are buffered, the cache accepts arbitrary writes (it sets
+ * @ref MTD_DRIVER_FLAG_DIRECT_WRITE), which removes the need for the
+ * read-modify-write cycles of @ref mtd_write_page and its sector sized
+ * `work_area`.
+ *
+ * @warning Data that has not been flushed is lost on reset or power loss.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += mtd_cache
+ * ```
+ *
+ * ```
+ * static mtd_cache_t cache = MTD_CACHE_INIT(MTD_0);
+ *
+ * mtd_dev_t *dev = &cache.mtd;
+ * ```
+ *
+ * The geometry of the cache device is taken over from the backing device on
+ * @ref mtd_init. The cache memory of @ref CONFIG_MTD_CACHE_SECTORS sectors is
+ * allocated with `malloc()` unless @ref mtd_cache_t::buf was set to a buffer
+ * of that size.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface definitions for the MTD write-back cache
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of sectors held in the cache
+ */
+#ifndef CONFIG_MTD_CACHE_SECTORS
+#define CONFIG_MTD_CACHE_SECTORS    (2)
+#endif
+
+/**
+ * @brief   Shortcut macro for initializing a @ref mtd_cache_t struct
+ *
+ * @param   _parent     MTD device to cache
+ */
+#define MTD_CACHE_INIT(_parent) \
+{ \
+    .mtd = { \
+        .driver = &mtd_cache_driver, \
+    }, \
+    .parent = _parent, \
+    .lock = MUTEX_INIT, \
+}
+
+/**
+ * @brief   Cache statistics
+ */
+typedef struct {
+    uint32_t hits;          /**< accesses to a cached sector */
+    uint32_t misses;        /**< accesses to a sector that was not cached */
+    uint32_t loads;         /**< sectors read from the backing device */
+    uint32_t writebacks;    /**< sectors written back to the backing device */
+    uint32_t erases;        /**< sector erases on the backing device */
+    uint32_t page_writes;   /**< pages written to the backing device */
+} mtd_cache_stats_t;
+
+/**
+ * @brief   A cached sector
+ *
+ * The pages of the sector are tracked in up to 32 groups of equal size, with
+ * one bit per group in @ref mtd_cache_entry_t::dirty and
+ * @ref mtd_cache_entry_t::erased.
+ */
+typedef struct {
+    uint8_t *data;          /**< contents of the sector */
+    uint32_t sector;        /**< sector number on the backing device */
+    uint32_t last_use;      /**< time of the last access for LRU replacement */
+    uint32_t dirty;         /**< page groups modified in the cache */
+    uint32_t erased;        /**< page groups erased on the backing device */
+    bool valid;             /**< entry holds a sector */
+} mtd_cache_entry_t;
+
+/**
+ * @brief   MTD write-back cache
+ */
+typedef struct {
+    mtd_dev_t mtd;                      /**< MTD context */
+    mtd_dev_t *parent;                  /**< cached MTD device */
+    uint8_t *buf;                       /**< memory for the cached sectors */
+    mutex_t lock;                       /**< protects the cache */
+    uint32_t tick;                      /**< LRU clock */
+    uint16_t group_pages;               /**< pages per dirty/erased group */
+    int16_t erased_val;                 /**< value of erased bytes, -1 if unknown */
+    mtd_cache_entry_t entries[CONFIG_MTD_CACHE_SECTORS]; /**< cached sectors */
+    mtd_cache_stats_t stats;            /**< statistics */
+} mtd_cache_t;
+
+/**
+ * @brief   Cache MTD device operations table
+ */
+extern const mtd_desc_t mtd_cache_driver;
+
+/**
+ * @brief   Get the statistics of a cache
+ *
+ * @param[in]  cache    cache to query
+ * @param[out] stats    statistics
+ */
+void mtd_cache_get_stats(mtd_cache_t *cache, mtd_cache_stats_t *stats);
+
+/**
+ * @brief   Reset the statistics of a cache
+ *
+ * @param[in]  cache    cache to reset the statistics of
+ */
+void mtd_cache_reset_stats(mtd_cache_t *cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -0,0 +1,422 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     drivers_mtd_cache
+ * @{
+ *
+ * @file
+ * @brief       MTD write-back cache
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "container.h"
+#include "macros/math.h"
+#include "macros/utils.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static uint32_t _sector_size(const mtd_cache_t *cache)
+{
+    return cache->mtd.pages_per_sector * cache->mtd.page_size;
+}
+
+static unsigned _groups(const mtd_cache_t *cache)
+{
+    return DIV_ROUND_UP(cache->mtd.pages_per_sector, cache->group_pages);
+}
+
+static uint32_t _all_groups(const mtd_cache_t *cache)
+{
+    unsigned groups = _groups(cache);
+    return groups == 32 ? UINT32_MAX : (1UL << groups) - 1;
+}
+
+/* page groups touched by the bytes [offset, offset + len) of a sector */
+static uint32_t _groups_of(const mtd_cache_t *cache, uint32_t offset, uint32_t len)
+{
+    unsigned first = offset / cache->mtd.page_size / cache->group_pages;
+    unsigned last = (offset + len - 1) / cache->mtd.page_size / cache->group_pages;
+    uint32_t mask = _all_groups(cache);
+
+    mask &= UINT32_MAX << first;
+    if (last < 31) {
+        mask &= (2UL << last) - 1;
+    }
+    return mask;
+}
+
+static bool _is_erased(const mtd_cache_t *cache, const uint8_t *data, uint32_t len)
+{
+    if (cache->erased_val < 0) {
+        return false;
+    }
+    for (uint32_t i = 0; i < len; i++) {
+        if (data[i] != cache->erased_val) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static mtd_cache_entry_t *_find(mtd_cache_t *cache, uint32_t sector)
+{
+    for (unsigned i = 0; i < CONFIG_MTD_CACHE_SECTORS; i++) {
+        mtd_cache_entry_t *entry = &cache->entries[i];
+        if (entry->valid && entry->sector == sector) {
+            entry->last_use = ++cache->tick;
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+/* like _find(), but counted as an access in the statistics */
+static mtd_cache_entry_t *_lookup(mtd_cache_t *cache, uint32_t sector)
+{
+    mtd_cache_entry_t *entry = _find(cache, sector);
+
+    if (entry) {
+        cache->stats.hits++;
+    }
+    else {
+        cache->stats.misses++;
+    }
+    return entry;
+}
+
+static int _writeback(mtd_cache_t *cache, mtd_cache_entry_t *entry)
+{
+    if (!entry->dirty) {
+        return 0;
+    }
+
+    mtd_dev_t *parent = cache->parent;
+    uint32_t write = entry->dirty;
+    int res;
+
+    DEBUG("mtd_cache: write back sector %" PRIu32 ", dirty=%" PRIx32 " erased=%" PRIx32 "\n",
+          entry->sector, entry->dirty, entry->erased);
+
+    if (!(parent->driver->flags & MTD_DRIVER_FLAG_DIRECT_WRITE) &&
+        (entry->dirty & ~entry->erased)) {
+        /* some of the modified pages have already been programmed */
+        res = mtd_erase_sector(parent, entry->sector, 1);
+        if (res < 0) {
+            return res;
+        }
+        cache->stats.erases++;
+        entry->erased = _all_groups(cache);
+        write = entry->erased;
+    }
+
+    const uint32_t page_size = cache->mtd.page_size;
+    const uint32_t pages_per_sector = cache->mtd.pages_per_sector;
+    const uint32_t first_page = entry->sector * pages_per_sector;
+    unsigned groups = _groups(cache);
+
+    for (unsigned i = 0; i < groups; i++) {
+        if (!(write & (1UL << i))) {
+            continue;
+        }
+
+        uint32_t page = i * cache->group_pages;
+        uint32_t pages = MIN(cache->group_pages, pages_per_sector - page);
+        uint8_t *data = entry->data + page * page_size;
+
+        /* leave pages that still hold the erased value erased, so they can
+         * be programmed later on without erasing the sector again */
+        if ((entry->erased & (1UL << i)) && _is_erased(cache, data, pages * page_size)) {
+            continue;
+        }
+
+        res = mtd_write_page_raw(parent, data, first_page + page, 0, pages * page_size);
+        if (res < 0) {
+            return res;
+        }
+        cache->stats.page_writes += pages;
+        entry->erased &= ~(1UL << i);
+    }
+
+    entry->dirty = 0;
+    cache->stats.writebacks++;
+    return 0;
+}
+
+/* Find an entry to hold a new sector. If @p clean_only is set, no entry will
+ * be written back to make room. */
+static mtd_cache_entry_t *_evict(mtd_cache_t *cache, bool clean_only, int *res)
+{
+    mtd_cache_entry_t *victim = NULL;
+
+    *res = 0;
+    for (unsigned i = 0; i < CONFIG_MTD_CACHE_SECTORS; i++) {
+        mtd_cache_entry_t *entry = &cache->entries[i];
+        if (!entry->valid) {
+            return entry;
+        }
+        if (clean_only && entry->dirty) {
+            continue;
+        }
+        if (victim == NULL || (cache->tick - entry->last_use) > (cache->tick - victim->last_use)) {
+            victim = entry;
+        }
+    }
+
+    if (victim) {
+        *res = _writeback(cache, victim);
+        if (*res < 0) {
+            return NULL;
+        }
+        victim->valid = false;
+    }
+
+    return victim;
+}
+
+static void _claim(mtd_cache_t *cache, mtd_cache_entry_t *entry, uint32_t sector)
+{
+    entry->sector = sector;
+    entry->last_use = ++cache->tick;
+    entry->dirty = 0;
+    entry->erased = 0;
+    entry->valid = true;
+}
+
+static int _load(mtd_cache_t *cache, mtd_cache_entry_t *entry, uint32_t sector)
+{
+    int res = mtd_read_page(cache->parent, entry->data,
+                            sector * cache->mtd.pages_per_sector, 0,
+                            _sector_size(cache));
+    if (res < 0) {
+        return res;
+    }
+    cache->stats.loads++;
+    _claim(cache, entry, sector);
+    return 0;
+}
+
+static int _init(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    mtd_dev_t *parent = cache->parent;
+
+    int res = mtd_init(parent);
+    if (res < 0) {
+        return res;
+    }
+
+    /* inherit physical properties, but allow writes of any size */
+    mtd->sector_count = parent->sector_count;
+    mtd->pages_per_sector = parent->pages_per_sector;
+    mtd->page_size = parent->page_size;
+    mtd->write_size = 1;
+
+    cache->group_pages = DIV_ROUND_UP(parent->pages_per_sector, 32);
+    cache->erased_val = -1;
+
+    if (cache->buf == NULL) {
+        cache->buf = malloc(CONFIG_MTD_CACHE_SECTORS * _sector_size(cache));
+        if (cache->buf == NULL) {
+            return -ENOMEM;
+        }
+    }
+
+    mutex_lock(&cache->lock);
+    for (unsigned i = 0; i < CONFIG_MTD_CACHE_SECTORS; i++) {
+        cache->entries[i].data = cache->buf + i * _sector_size(cache);
+        cache->entries[i].valid = false;
+    }
+    mutex_unlock(&cache->lock);
+
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *mtd, void *dest, uint32_t page,
+                      uint32_t offset, uint32_t size)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    const uint32_t sector = page / mtd->pages_per_sector;
+    offset += (page % mtd->pages_per_sector) * mtd->page_size;
+    size = MIN(size, _sector_size(cache) - offset);
+
+    int res = 0;
+    mutex_lock(&cache->lock);
+
+    mtd_cache_entry_t *entry = _lookup(cache, sector);
+    if (entry == NULL) {
+        /* reading must not cause write backs */
+        entry = _evict(cache, true, &res);
+        if (entry) {
+            res = _load(cache, entry, sector);
+        }
+        else {
+            res = mtd_read_page(cache->parent, dest, sector * mtd->pages_per_sector,
+                                offset, size);
+            goto out;
+        }
+    }
+    if (res == 0) {
+        memcpy(dest, entry->data + offset, size);
+    }
+
+out:
+    mutex_unlock(&cache->lock);
+    return res < 0 ? res : (int)size;
+}
+
+static int _write_page(mtd_dev_t *mtd, const void *src, uint32_t page,
+                       uint32_t offset, uint32_t size)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    const uint32_t sector = page / mtd->pages_per_sector;
+    offset += (page % mtd->pages_per_sector) * mtd->page_size;
+    size = MIN(size, _sector_size(cache) - offset);
+
+    int res = 0;
+    mutex_lock(&cache->lock);
+
+    mtd_cache_entry_t *entry = _lookup(cache, sector);
+    if (entry == NULL) {
+        entry = _evict(cache, false, &res);
+        if (entry == NULL) {
+            goto out;
+        }
+        if (size == _sector_size(cache)) {
+            /* sector gets overwritten completely, no need to read it */
+            _claim(cache, entry, sector);
+        }
+        else if ((res = _load(cache, entry, sector)) < 0) {
+            goto out;
+        }
+    }
+
+    memcpy(entry->data + offset, src, size);
+    entry->dirty |= _groups_of(cache, offset, size);
+
+out:
+    mutex_unlock(&cache->lock);
+    return res < 0 ? res : (int)size;
+}
+
+static int _erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    int res;
+
+    mutex_lock(&cache->lock);
+
+    res = mtd_erase_sector(cache->parent, sector, count);
+    if (res < 0) {
+        goto out;
+    }
+    cache->stats.erases += count;
+
+    for (uint32_t s = sector; s < sector + count; s++) {
+        /* Keep erased sectors in the cache, as they are usually written to
+         * right after. Erasing supersedes any pending modification. */
+        mtd_cache_entry_t *entry = _find(cache, s);
+        if (entry == NULL) {
+            entry = _evict(cache, true, &res);
+            if (entry == NULL) {
+                if (res < 0) {
+                    goto out;
+                }
+                continue;
+            }
+        }
+
+        if (cache->erased_val < 0) {
+            if ((res = _load(cache, entry, s)) < 0) {
+                goto out;
+            }
+            /* learn how erased memory looks like */
+            cache->erased_val = entry->data[0];
+            if (!_is_erased(cache, entry->data, _sector_size(cache))) {
+                cache->erased_val = -1;
+            }
+        }
+        else {
+            memset(entry->data, cache->erased_val, _sector_size(cache));
+            _claim(cache, entry, s);
+        }
+        entry->dirty = 0;
+        entry->erased = _all_groups(cache);
+    }
+
+out:
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int _flush(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    int res = 0;
+
+    mutex_lock(&cache->lock);
+    for (unsigned i = 0; i < CONFIG_MTD_CACHE_SECTORS; i++) {
+        mtd_cache_entry_t *entry = &cache->entries[i];
+        if (entry->valid) {
+            int err = _writeback(cache, entry);
+            if (err < 0 && res == 0) {
+                res = err;
+            }
+        }
+    }
+    mutex_unlock(&cache->lock);
+
+    if (res == 0) {
+        res = mtd_flush(cache->parent);
+    }
+    return res;
+}
+
+static int _power(mtd_dev_t *mtd, enum mtd_power_state power)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+
+    if (power == MTD_POWER_DOWN) {
+        int res = _flush(mtd);
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    return mtd_power(cache->parent, power);
+}
+
+void mtd_cache_get_stats(mtd_cache_t *cache, mtd_cache_stats_t *stats)
+{
+    mutex_lock(&cache->lock);
+    *stats = cache->stats;
+    mutex_unlock(&cache->lock);
+}
+
+void mtd_cache_reset_stats(mtd_cache_t *cache)
+{
+    mutex_lock(&cache->lock);
+    memset(&cache->stats, 0, sizeof(cache->stats));
+    mutex_unlock(&cache->lock);
+}
+
+const mtd_desc_t mtd_cache_driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+    .power = _power,
+    .flush = _flush,
+    .flags = MTD_DRIVER_FLAG_DIRECT_WRITE,
+};
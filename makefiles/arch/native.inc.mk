@@ -81,6 +81,9 @@ endif
 # XFA (cross file array) support
 LINKFLAGS += -T$(RIOTBASE)/cpu/native/ldscripts/xfa.ld
 
+# format strings of log_deferred
+LINKFLAGS += -T$(RIOTBASE)/cpu/native/ldscripts/log_fmt.ld
+
 # fix this warning:
 # ```
 # /usr/bin/ld: examples/basic/hello-world/bin/native/cpu/tramp.o: warning: relocation against `_native_saved_eip' in read-only section `.text'
@@ -97,6 +97,8 @@ PSEUDOMODULES += cpp
 PSEUDOMODULES += cpu_check_address
 PSEUDOMODULES += crc16_fast
 PSEUDOMODULES += crc32_fast
+PSEUDOMODULES += crc32_nibble
+PSEUDOMODULES += crc32_slice8
 PSEUDOMODULES += credman_load
 PSEUDOMODULES += crypto_aes_128
 PSEUDOMODULES += crypto_aes_192
@@ -107,6 +109,17 @@ PSEUDOMODULES += crypto_aes_precalculated
 PSEUDOMODULES += crypto_aes_unroll
 
 PSEUDOMODULES += dbgpin
+
+## @defgroup pseudomodule_decompress_heatshrink decompress_heatshrink
+## @brief Enables the heatshrink codec of @ref sys_decompress
+##
+PSEUDOMODULES += decompress_heatshrink
+
+## @defgroup pseudomodule_decompress_lz4 decompress_lz4
+## @brief Enables the LZ4 codec of @ref sys_decompress
+##
+PSEUDOMODULES += decompress_lz4
+
 PSEUDOMODULES += devfs_%
 PSEUDOMODULES += dhcpv6_%
 PSEUDOMODULES += dhcpv6_client_dns
@@ -183,6 +196,7 @@ PSEUDOMODULES += gnrc_netif_6lo
 PSEUDOMODULES += gnrc_netif_ipv6
 PSEUDOMODULES += gnrc_netif_single
 PSEUDOMODULES += gnrc_netif_dedup
+PSEUDOMODULES += gnrc_netif_pktq_fq
 
 
 ## @addtogroup 	net_gnrc_nettype
@@ -323,6 +337,13 @@ PSEUDOMODULES += lwext3_vfs
 PSEUDOMODULES += lwext4_vfs
 PSEUDOMODULES += lwext4_vfs_format
 
+## @defgroup pseudomodule_malloc_pool_tcache malloc_pool_tcache
+## @brief Per-thread caches of freed blocks for @ref sys_malloc_pool
+##
+## Freed pool blocks are kept in a free list of the freeing thread and are
+## handed out again to that thread without taking any lock.
+PSEUDOMODULES += malloc_pool_tcache
+
 ## @defgroup pseudomodule_mpu_stack_guard mpu_stack_guard
 ## @brief MPU based stack guard
 ##
@@ -454,6 +475,7 @@ PSEUDOMODULES += sema_deprecated
 ## @}
 PSEUDOMODULES += semtech_loramac_rx
 PSEUDOMODULES += senml_cbor
+PSEUDOMODULES += senml_gnrc
 PSEUDOMODULES += senml_phydat
 PSEUDOMODULES += senml_saul
 ## @defgroup drivers_servo_pwm PWM based servo driver
@@ -472,6 +494,7 @@ PSEUDOMODULES += servo_timer
 PSEUDOMODULES += servo_saul
 ## @}
 
+PSEUDOMODULES += shell_batch
 PSEUDOMODULES += shell_builtin_cmd_help_json
 PSEUDOMODULES += shell_cmd_app_metadata
 PSEUDOMODULES += shell_cmd_at30tse75x
@@ -521,6 +544,7 @@ PSEUDOMODULES += shell_cmd_opendsme
 PSEUDOMODULES += shell_cmd_openthread
 PSEUDOMODULES += shell_cmd_openwsn
 PSEUDOMODULES += shell_cmd_pm
+PSEUDOMODULES += shell_cmd_profiler
 PSEUDOMODULES += shell_cmd_ps
 PSEUDOMODULES += shell_cmd_random
 PSEUDOMODULES += shell_cmd_rtc
@@ -541,6 +565,7 @@ PSEUDOMODULES += shell_cmd_vfs
 PSEUDOMODULES += shell_cmds_default
 PSEUDOMODULES += shell_hooks
 PSEUDOMODULES += shell_lock_auto_locking
+PSEUDOMODULES += shell_lookup_hash
 PSEUDOMODULES += shield_llcc68
 PSEUDOMODULES += shield_sx1262
 PSEUDOMODULES += shield_w5100
@@ -560,6 +585,7 @@ PSEUDOMODULES += sock_aux_rssi
 PSEUDOMODULES += sock_aux_timestamp
 PSEUDOMODULES += sock_aux_ttl
 PSEUDOMODULES += sock_dtls
+PSEUDOMODULES += sock_dtls_session_cache
 PSEUDOMODULES += sock_dtls_verify_public_key
 PSEUDOMODULES += sock_ip
 PSEUDOMODULES += sock_tcp
@@ -596,6 +622,14 @@ PSEUDOMODULES += stm32_eth_tracing
 # STM32 periph pseudomodules
 PSEUDOMODULES += stm32_periph_%
 PSEUDOMODULES += stm32mp1_eng_mode
+## @defgroup pseudomodule_suit_decompress suit_decompress
+## @brief Decompress SUIT payloads that start with a @ref decompress_hdr_t
+##
+## The payload is decoded while it is fetched, so the storage backend only
+## sees the decompressed image. Select codecs with `decompress_heatshrink` or
+## `decompress_lz4`.
+##
+PSEUDOMODULES += suit_decompress
 PSEUDOMODULES += suit_transport_%
 PSEUDOMODULES += suit_storage_%
 PSEUDOMODULES += sys_bus_%
@@ -607,6 +641,36 @@ PSEUDOMODULES += test_utils_main_exit_cb
 PSEUDOMODULES += tiny_strerror_as_strerror
 PSEUDOMODULES += tiny_strerror_minimal
 
+## @defgroup pseudomodule_trace_isr trace_isr
+## @brief Record interrupt handler entry and exit with @ref trace.h
+##
+PSEUDOMODULES += trace_isr
+
+## @defgroup pseudomodule_trace_msg trace_msg
+## @brief Record sent and received messages with @ref trace.h
+##
+PSEUDOMODULES += trace_msg
+
+## @defgroup pseudomodule_trace_pktbuf trace_pktbuf
+## @brief Record GNRC packet buffer allocations with @ref trace.h
+##
+PSEUDOMODULES += trace_pktbuf
+
+## @defgroup pseudomodule_trace_sched trace_sched
+## @brief Record thread switches with @ref trace.h
+##
+PSEUDOMODULES += trace_sched
+
+## @defgroup pseudomodule_trace_stream trace_stream
+## @brief Periodically export the trace buffer to stdio
+##
+PSEUDOMODULES += trace_stream
+
+## @defgroup pseudomodule_trace_ztimer trace_ztimer
+## @brief Record expiring ztimers with @ref trace.h
+##
+PSEUDOMODULES += trace_ztimer
+
 # An umbrella module for the unicoap_driver_rfc7252_common_pdu
 # and unicoap_driver_rfc7252_common_messaging modules
 PSEUDOMODULES += unicoap_driver_rfc7252_common
@@ -655,6 +719,15 @@ PSEUDOMODULES += vfs_auto_mount
 ## backends.
 PSEUDOMODULES += vfs_default
 
+## @defgroup pseudomodule_vfs_stat_cache vfs_stat_cache
+## @brief Remember the results of recent @ref vfs_stat calls
+##
+## Applications that repeatedly check the same files (e.g. whether a log file
+## exists or how large it has grown) can skip the file system driver with this
+## module. Any modifying VFS operation flushes the cache.
+## See @ref VFS_STAT_CACHE_SIZE and @ref VFS_STAT_CACHE_PATH_MAX.
+PSEUDOMODULES += vfs_stat_cache
+
 PSEUDOMODULES += wakaama_objects_%
 PSEUDOMODULES += walltime_default
 PSEUDOMODULES += walltime_impl_ds1307
@@ -38,6 +38,11 @@ ifeq (1, $(call _is_greater,$(words $(sort $(filter $(STDIO_MODULES),$(USEMODULE
   USEMODULE += stdio_dispatch
 endif
 
+ifneq (,$(filter stdio_async,$(USEMODULE)))
+  USEMODULE += core_thread_flags
+  USEMODULE += tsrb
+endif
+
 ifneq (,$(filter stdio_cdc_acm,$(USEMODULE)))
   USEMODULE += usbus_cdc_acm
   USEMODULE += isrpipe
@@ -99,9 +99,11 @@ static int _dev_erase(const struct lfs_config *c, lfs_block_t block)
 
 static int _dev_sync(const struct lfs_config *c)
 {
-    (void)c;
+    littlefs2_desc_t *fs = c->context;
 
-    return 0;
+    DEBUG("lfs_sync: c=%p\n", (void *)c);
+
+    return mtd_flush(fs->dev);
 }
 
 static int prepare(littlefs2_desc_t *fs)
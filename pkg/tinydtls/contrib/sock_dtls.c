@@ -26,6 +26,11 @@
 #include "net/credman.h"
 #include "ztimer.h"
 
+#if IS_USED(MODULE_SOCK_DTLS_SESSION_CACHE)
+#include "mutex.h"
+#include "net/dtls.h"
+#endif
+
 #if SOCK_HAS_ASYNC
 #include "net/sock/async.h"
 #include "net/sock/async/event.h"
@@ -93,6 +98,276 @@ typedef struct ecdsa_key_assignment {
 static ecdsa_key_assignment_t _ecdsa_keys[CONFIG_DTLS_CREDENTIALS_MAX];
 #endif
 
+#if IS_USED(MODULE_SOCK_DTLS_SESSION_CACHE)
+/* RFC 6347, section 4.1 and 4.2.2 */
+#define DTLS_RECORD_HDR_LEN         (13U)
+#define DTLS_HANDSHAKE_HDR_LEN      (12U)
+#define DTLS_CONTENT_HANDSHAKE      (22U)
+#define DTLS_HANDSHAKE_CLIENT_HELLO (1U)
+
+/**
+ * @brief An entry of the session cache, a session holding a tinydtls peer or
+ *        a closed one
+ */
+typedef struct {
+    sock_dtls_t *sock;      /**< sock of the session, NULL if unused */
+    session_t session;      /**< the session */
+    uint32_t used;          /**< value of _cache_clock at the last use */
+    bool pending;           /**< handshake of a client not completed yet */
+    bool closed;            /**< evicted, the event session was not retrieved */
+} _cache_entry_t;
+
+static mutex_t _cache_lock = MUTEX_INIT;
+/* the sessions holding a tinydtls peer, and as many closed ones */
+static _cache_entry_t _cache[2 * CONFIG_DTLS_PEER_MAX];
+static uint32_t _cache_clock;
+/* number of open server socks */
+static unsigned _cache_servers;
+static sock_dtls_session_cache_stats_t _cache_stats;
+
+/* must be called with _cache_lock held */
+static _cache_entry_t *_cache_find(const sock_dtls_t *sock, const session_t *session)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_cache); i++) {
+        if (_cache[i].sock == sock && !_cache[i].closed &&
+            dtls_session_equals(&_cache[i].session, session)) {
+            return &_cache[i];
+        }
+    }
+    return NULL;
+}
+
+/* must be called with _cache_lock held, returns the least recently used
+ * session other than @p keep if less than @p free tinydtls peers are free.
+ * Pending handshakes of clients go first, with @p pending only those of the
+ * sock of @p keep. */
+static _cache_entry_t *_cache_get_lru(const _cache_entry_t *keep, bool pending,
+                                      unsigned free)
+{
+    _cache_entry_t *lru = NULL;
+    unsigned numof = 0;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_cache); i++) {
+        if (_cache[i].sock == NULL || _cache[i].closed) {
+            continue;
+        }
+        numof++;
+        if (&_cache[i] == keep ||
+            (pending && (!_cache[i].pending || _cache[i].sock != keep->sock))) {
+            continue;
+        }
+        if (!lru || (!lru->pending && _cache[i].pending) ||
+            (lru->pending == _cache[i].pending &&
+             (int32_t)(_cache[i].used - lru->used) < 0)) {
+            lru = &_cache[i];
+        }
+    }
+    return numof + free <= CONFIG_DTLS_PEER_MAX ? NULL : lru;
+}
+
+/* must be called with _cache_lock held and a tinydtls peer free, returns an
+ * unused entry, else the oldest closed one, dropping its event session */
+static _cache_entry_t *_cache_get_unused(void)
+{
+    _cache_entry_t *oldest = NULL;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_cache); i++) {
+        if (_cache[i].sock == NULL) {
+            return &_cache[i];
+        }
+        if (_cache[i].closed &&
+            (!oldest || (int32_t)(_cache[i].used - oldest->used) < 0)) {
+            oldest = &_cache[i];
+        }
+    }
+    return oldest;
+}
+
+/* must be called with _cache_lock held */
+static void _cache_evict(_cache_entry_t *entry, _cache_entry_t *evicted)
+{
+    *evicted = *entry;
+    _cache_stats.evicted++;
+#ifdef SOCK_HAS_ASYNC
+    if (entry->sock->async_cb != NULL) {
+        /* kept until sock_dtls_get_event_session() retrieves it, other
+         * events may come in before the owner handles the CONN_FIN */
+        entry->closed = true;
+        return;
+    }
+#endif
+    entry->sock = NULL;
+}
+
+static void _cache_close(const _cache_entry_t *entry)
+{
+    sock_dtls_t *sock = entry->sock;
+    dtls_peer_t *peer = dtls_get_peer(sock->dtls_ctx, &entry->session);
+
+    DEBUG("sock_dtls: evicting least recently used session\n");
+    if (peer) {
+        dtls_reset_peer(sock->dtls_ctx, peer);
+    }
+#ifdef SOCK_HAS_ASYNC
+    if (sock->async_cb != NULL) {
+        sock->async_cb(sock, SOCK_ASYNC_CONN_FIN, sock->async_cb_arg);
+    }
+#endif
+}
+
+/* Adds a session that got a tinydtls peer, or marks a @p pending handshake of
+ * a client completed. With @p reserve, the least recently used other session
+ * is closed if no slot is left afterwards. A pending handshake only closes
+ * another pending one, so a client that never completes its handshake can't
+ * evict established sessions. */
+static void _cache_add(sock_dtls_t *sock, const session_t *session,
+                       bool pending, bool reserve)
+{
+    _cache_entry_t evicted = { .sock = NULL };
+
+    mutex_lock(&_cache_lock);
+    _cache_entry_t *entry = _cache_find(sock, session);
+    if (entry == NULL) {
+        entry = _cache_get_lru(NULL, false, 1);
+        if (entry == NULL) {
+            entry = _cache_get_unused();
+        }
+        /* else all peers are taken by sessions whose end we missed */
+        entry->sock = sock;
+        entry->pending = pending;
+        entry->closed = false;
+        memcpy(&entry->session, session, sizeof(session_t));
+    }
+    entry->pending &= pending;
+    entry->used = ++_cache_clock;
+
+    if (reserve) {
+        _cache_entry_t *victim = _cache_get_lru(entry, pending, 1);
+        if (victim) {
+            _cache_evict(victim, &evicted);
+        }
+    }
+    mutex_unlock(&_cache_lock);
+
+    /* tinydtls may call back into _event, so don't hold the lock */
+    if (evicted.sock) {
+        _cache_close(&evicted);
+    }
+}
+
+/* Closes the least recently used sessions until a slot is free for a new one,
+ * besides the one a server keeps free for the next client */
+static void _cache_make_room(void)
+{
+    _cache_entry_t evicted;
+
+    do {
+        evicted.sock = NULL;
+        mutex_lock(&_cache_lock);
+        _cache_entry_t *victim = _cache_get_lru(NULL, false,
+                                                _cache_servers ? 2 : 1);
+        if (victim) {
+            _cache_evict(victim, &evicted);
+        }
+        mutex_unlock(&_cache_lock);
+
+        if (evicted.sock) {
+            _cache_close(&evicted);
+        }
+    } while (evicted.sock);
+}
+
+static void _cache_touch(const sock_dtls_t *sock, const session_t *session)
+{
+    mutex_lock(&_cache_lock);
+    _cache_entry_t *entry = _cache_find(sock, session);
+    if (entry) {
+        entry->used = ++_cache_clock;
+    }
+    mutex_unlock(&_cache_lock);
+}
+
+static void _cache_remove(const sock_dtls_t *sock, const session_t *session)
+{
+    mutex_lock(&_cache_lock);
+    for (unsigned i = 0; i < ARRAY_SIZE(_cache); i++) {
+        if (_cache[i].sock == sock && (session == NULL ||
+            (!_cache[i].closed && dtls_session_equals(&_cache[i].session, session)))) {
+            _cache[i].sock = NULL;
+        }
+    }
+    mutex_unlock(&_cache_lock);
+}
+
+/* Only a ClientHello that returns a cookie makes a server allocate a peer */
+static bool _is_client_hello_with_cookie(const uint8_t *buf, size_t len)
+{
+    /* client_version, random */
+    size_t pos = DTLS_RECORD_HDR_LEN + DTLS_HANDSHAKE_HDR_LEN + 2 + 32;
+
+    if (len <= pos || buf[0] != DTLS_CONTENT_HANDSHAKE ||
+        buf[3] != 0 || buf[4] != 0 ||   /* epoch */
+        buf[DTLS_RECORD_HDR_LEN] != DTLS_HANDSHAKE_CLIENT_HELLO) {
+        return false;
+    }
+    /* skip session_id */
+    pos += 1 + buf[pos];
+    /* cookie length */
+    return pos < len && buf[pos] > 0;
+}
+
+#ifdef SOCK_HAS_ASYNC
+/* Retrieves and frees an entry closed by the cache. Returns the number of
+ * closed entries of @p sock before, 0 if there was none. */
+static unsigned _cache_get_closed(const sock_dtls_t *sock, session_t *session)
+{
+    _cache_entry_t *entry = NULL;
+    unsigned numof = 0;
+
+    mutex_lock(&_cache_lock);
+    for (unsigned i = 0; i < ARRAY_SIZE(_cache); i++) {
+        if (_cache[i].sock == sock && _cache[i].closed) {
+            entry = &_cache[i];
+            numof++;
+        }
+    }
+    if (entry) {
+        memcpy(session, &entry->session, sizeof(session_t));
+        entry->sock = NULL;
+    }
+    mutex_unlock(&_cache_lock);
+
+    return numof;
+}
+#endif
+
+void sock_dtls_session_cache_stats(sock_dtls_session_cache_stats_t *stats)
+{
+    mutex_lock(&_cache_lock);
+    *stats = _cache_stats;
+    mutex_unlock(&_cache_lock);
+}
+#endif
+
+static int _handle_message(sock_dtls_t *sock, session_t *session,
+                           uint8_t *buf, size_t len)
+{
+#if IS_USED(MODULE_SOCK_DTLS_SESSION_CACHE)
+    bool new_peer = _is_client_hello_with_cookie(buf, len) &&
+                    !dtls_get_peer(sock->dtls_ctx, session);
+    int res = dtls_handle_message(sock->dtls_ctx, session, buf, len);
+
+    if (new_peer && dtls_get_peer(sock->dtls_ctx, session)) {
+        /* the cookie was valid and the handshake took a slot, free the next
+         * by reclaiming another pending one if any */
+        _cache_add(sock, session, true, true);
+    }
+    return res;
+#else
+    return dtls_handle_message(sock->dtls_ctx, session, buf, len);
+#endif
+}
+
 static int _read(struct dtls_context_t *ctx, session_t *session, uint8_t *buf, size_t len)
 {
     sock_dtls_t *sock = dtls_get_app_data(ctx);
@@ -104,6 +379,9 @@ static int _read(struct dtls_context_t *ctx, session_t *session, uint8_t *buf, s
     }
 
     DEBUG("sock_dtls: decrypted message arrived\n");
+#if IS_USED(MODULE_SOCK_DTLS_SESSION_CACHE)
+    _cache_touch(sock, session);
+#endif
     sock->buffer.data = buf;
     sock->buffer.datalen = len;
     sock->buffer.session = session;
@@ -154,6 +432,21 @@ static int _event(struct dtls_context_t *ctx, session_t *session,
         mbox_put(&sock->mbox, &msg);
     }
 
+#if IS_USED(MODULE_SOCK_DTLS_SESSION_CACHE)
+    if (code == DTLS_EVENT_CONNECTED) {
+        /* a server keeps one slot free for the next client */
+        _cache_add(sock, session, false,
+                   (unsigned)sock->role == SOCK_DTLS_SERVER);
+        mutex_lock(&_cache_lock);
+        _cache_stats.handshakes++;
+        mutex_unlock(&_cache_lock);
+    }
+    else if (level == DTLS_ALERT_LEVEL_FATAL || code == DTLS_ALERT_CLOSE_NOTIFY) {
+        /* tinydtls frees the peer */
+        _cache_remove(sock, session);
+    }
+#endif
+
 #if IS_ACTIVE(CONFIG_DTLS_ECC)
     if (code == DTLS_EVENT_CONNECTED) {
         for (unsigned i = 0; i < ARRAY_SIZE(_ecdsa_keys); i++) {
@@ -502,6 +795,13 @@ int sock_dtls_create(sock_dtls_t *sock, sock_udp_t *udp_sock,
     }
     mbox_init(&sock->mbox, sock->mbox_queue, SOCK_DTLS_MBOX_SIZE);
     dtls_set_handler(sock->dtls_ctx, &_dtls_handler);
+#if IS_USED(MODULE_SOCK_DTLS_SESSION_CACHE)
+    if (role == SOCK_DTLS_SERVER) {
+        mutex_lock(&_cache_lock);
+        _cache_servers++;
+        mutex_unlock(&_cache_lock);
+    }
+#endif
     return 0;
 }
 
@@ -615,6 +915,12 @@ int sock_dtls_session_init(sock_dtls_t *sock, const sock_udp_ep_t *ep,
     /* prepare the remote party to connect to */
     _ep_to_session(ep, &remote->dtls_session);
 
+#if IS_USED(MODULE_SOCK_DTLS_SESSION_CACHE)
+    if (!dtls_get_peer(sock->dtls_ctx, &remote->dtls_session)) {
+        _cache_make_room();
+    }
+#endif
+
     /* start the handshake */
     int res = dtls_connect(sock->dtls_ctx, &remote->dtls_session);
     if (res < 0) {
@@ -623,8 +929,17 @@ int sock_dtls_session_init(sock_dtls_t *sock, const sock_udp_ep_t *ep,
     }
     else if (res == 0) {
         DEBUG("sock_dtls: session already exist. Skip establishing session\n");
+#if IS_USED(MODULE_SOCK_DTLS_SESSION_CACHE)
+        _cache_touch(sock, &remote->dtls_session);
+        mutex_lock(&_cache_lock);
+        _cache_stats.reused++;
+        mutex_unlock(&_cache_lock);
+#endif
         return 0;
     }
+#if IS_USED(MODULE_SOCK_DTLS_SESSION_CACHE)
+    _cache_add(sock, &remote->dtls_session, false, false);
+#endif
 
     /* New handshake initiated */
     return 1;
@@ -634,6 +949,9 @@ void sock_dtls_session_destroy(sock_dtls_t *sock, sock_dtls_session_t *remote)
 {
     dtls_peer_t *peer = dtls_get_peer(sock->dtls_ctx, &remote->dtls_session);
 
+#if IS_USED(MODULE_SOCK_DTLS_SESSION_CACHE)
+    _cache_remove(sock, &remote->dtls_session);
+#endif
     if (peer) {
         /* dtls_reset_peer() also sends close_notify if not already sent */
         dtls_reset_peer(sock->dtls_ctx, peer);
@@ -675,6 +993,9 @@ ssize_t sock_dtls_sendv_aux(sock_dtls_t *sock, sock_dtls_session_t *remote,
             return -ENOTCONN;
         }
 
+#if IS_USED(MODULE_SOCK_DTLS_SESSION_CACHE)
+        _cache_make_room();
+#endif
         /* no session with remote, creating new session.
          * This will also create new peer for this session */
         res = dtls_connect(sock->dtls_ctx, &remote->dtls_session);
@@ -683,6 +1004,9 @@ ssize_t sock_dtls_sendv_aux(sock_dtls_t *sock, sock_dtls_session_t *remote,
             return -ENOMEM;
         }
         else if (res > 0) {
+#if IS_USED(MODULE_SOCK_DTLS_SESSION_CACHE)
+            _cache_add(sock, &remote->dtls_session, false, false);
+#endif
             /* handshake initiated, wait until connected or timed out */
 
             msg_t msg;
@@ -703,6 +1027,9 @@ ssize_t sock_dtls_sendv_aux(sock_dtls_t *sock, sock_dtls_session_t *remote,
                 /* deletes peer created in dtls_connect() before */
                 dtls_peer_t *peer = dtls_get_peer(sock->dtls_ctx,
                                                   &remote->dtls_session);
+#if IS_USED(MODULE_SOCK_DTLS_SESSION_CACHE)
+                _cache_remove(sock, &remote->dtls_session);
+#endif
                 dtls_reset_peer(sock->dtls_ctx, peer);
                 return -ETIMEDOUT;
             }
@@ -721,6 +1048,11 @@ ssize_t sock_dtls_sendv_aux(sock_dtls_t *sock, sock_dtls_session_t *remote,
 
     res = dtls_writev(sock->dtls_ctx, &remote->dtls_session,
                       snip_bufs, snip_len, snip_count);
+#if IS_USED(MODULE_SOCK_DTLS_SESSION_CACHE)
+    if (res >= 0) {
+        _cache_touch(sock, &remote->dtls_session);
+    }
+#endif
 
 #ifdef SOCK_HAS_ASYNC
     if ((res >= 0) && (sock->async_cb != NULL)) {
@@ -842,8 +1174,7 @@ ssize_t sock_dtls_recv_aux(sock_dtls_t *sock, sock_dtls_session_t *remote,
         }
 
         _ep_to_session(&ep, &remote->dtls_session);
-        res = dtls_handle_message(sock->dtls_ctx, &remote->dtls_session,
-                                  (uint8_t *)data, res);
+        res = _handle_message(sock, &remote->dtls_session, data, res);
 
         if ((timeout != SOCK_NO_TIMEOUT) && (timeout != 0)) {
             timeout = _update_timeout(start_recv, timeout);
@@ -917,8 +1248,7 @@ ssize_t sock_dtls_recv_buf_aux(sock_dtls_t *sock, sock_dtls_session_t *remote,
         }
 
         _ep_to_session(&ep, &remote->dtls_session);
-        res = dtls_handle_message(sock->dtls_ctx, &remote->dtls_session,
-                                  *data, res);
+        res = _handle_message(sock, &remote->dtls_session, *data, res);
 
         if ((timeout != SOCK_NO_TIMEOUT) && (timeout != 0)) {
             timeout = _update_timeout(start_recv, timeout);
@@ -932,6 +1262,14 @@ ssize_t sock_dtls_recv_buf_aux(sock_dtls_t *sock, sock_dtls_session_t *remote,
 
 void sock_dtls_close(sock_dtls_t *sock)
 {
+#if IS_USED(MODULE_SOCK_DTLS_SESSION_CACHE)
+    _cache_remove(sock, NULL);
+    if ((unsigned)sock->role == SOCK_DTLS_SERVER) {
+        mutex_lock(&_cache_lock);
+        _cache_servers--;
+        mutex_unlock(&_cache_lock);
+    }
+#endif
     dtls_free_context(sock->dtls_ctx);
 #ifdef SOCK_HAS_ASYNC_CTX
     sock_event_close(sock_dtls_get_async_ctx(sock));
@@ -1010,6 +1348,17 @@ bool sock_dtls_get_event_session(sock_dtls_t *sock,
 {
     assert(sock);
     assert(session);
+#if IS_USED(MODULE_SOCK_DTLS_SESSION_CACHE)
+    /* the CONN_FIN events of several evicted sessions are merged while they
+     * are queued, so report the others in a new one */
+    unsigned closed = _cache_get_closed(sock, &session->dtls_session);
+    if (closed) {
+        if (closed > 1 && sock->async_cb != NULL) {
+            sock->async_cb(sock, SOCK_ASYNC_CONN_FIN, sock->async_cb_arg);
+        }
+        return true;
+    }
+#endif
     if (sock->async_cb_session.size > 0) {
         memcpy(&session->dtls_session, &sock->async_cb_session,
                sizeof(sock->async_cb_session));
@@ -1043,8 +1392,7 @@ void _udp_cb(sock_udp_t *udp_sock, sock_async_flags_t flags, void *ctx)
         }
         _ep_to_session(&remote_ep, &remote);
         sock->buf_ctx = data_ctx;
-        res = dtls_handle_message(sock->dtls_ctx, &remote,
-                                  data, res);
+        res = _handle_message(sock, &remote, data, res);
         if (res < 0 || sock->buffer.data == NULL) {
             /* buffer.data will point to decrypted application data, if available.
              * if not or on failure, drop potential remaining udp chunks */
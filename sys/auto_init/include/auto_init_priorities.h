@@ -19,6 +19,12 @@
 extern "C" {
 #endif
 
+#ifndef AUTO_INIT_PRIO_MOD_STDIO_ASYNC
+/**
+ * @brief   asynchronous stdio priority
+ */
+#define AUTO_INIT_PRIO_MOD_STDIO_ASYNC                  1005
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_ZTIMER
 /**
  * @brief   ztimer priority
@@ -55,6 +61,18 @@ extern "C" {
  */
 #define AUTO_INIT_PRIO_MOD_SCHEDSTATISTICS              1050
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_TRACE
+/**
+ * @brief   execution tracing priority
+ */
+#define AUTO_INIT_PRIO_MOD_TRACE                        1055
+#endif
+#ifndef AUTO_INIT_PRIO_MOD_LOG_DEFERRED
+/**
+ * @brief   deferred logging priority
+ */
+#define AUTO_INIT_PRIO_MOD_LOG_DEFERRED                 1057
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_SCHED_ROUND_ROBIN
 /**
  * @brief   round robin scheduling priority
@@ -0,0 +1,115 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_bloom_blocked
+ * @{
+ *
+ * @file
+ * @brief       Blocked Bloom filter implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "bloom.h"
+#include "bloom/blocked.h"
+
+static_assert((CONFIG_BLOOM_BLOCKED_WORDS &
+               (CONFIG_BLOOM_BLOCKED_WORDS - 1)) == 0,
+              "CONFIG_BLOOM_BLOCKED_WORDS must be a power of two");
+
+#define BLOCK_BITS      (64 * CONFIG_BLOOM_BLOCKED_WORDS)
+
+typedef uint64_t _mask_t[CONFIG_BLOOM_BLOCKED_WORDS];
+
+void bloom_blocked_init(bloom_blocked_t *bloom, uint64_t *words,
+                        size_t words_numof, unsigned k)
+{
+    assert(words_numof >= CONFIG_BLOOM_BLOCKED_WORDS);
+    assert(words_numof % CONFIG_BLOOM_BLOCKED_WORDS == 0);
+    assert(k >= 1 && k <= 16);
+
+    bloom->words = words;
+    bloom->blocks_numof = words_numof / CONFIG_BLOOM_BLOCKED_WORDS;
+    bloom->k = k;
+    bloom_blocked_clear(bloom);
+}
+
+void bloom_blocked_clear(bloom_blocked_t *bloom)
+{
+    memset(bloom->words, 0,
+           bloom->blocks_numof * CONFIG_BLOOM_BLOCKED_WORDS * sizeof(uint64_t));
+}
+
+/* returns the block of the element and its bits in the block */
+static uint64_t *_locate(const bloom_blocked_t *bloom, const uint8_t *buf,
+                         size_t len, _mask_t mask)
+{
+    uint64_t hash = bloom_hash64(buf, len);
+
+    /* maps the upper half to [0, blocks_numof) without a division */
+    size_t block = ((hash >> 32) * bloom->blocks_numof) >> 32;
+
+    /* an odd step visits all bits of the block before it repeats */
+    unsigned pos = hash % BLOCK_BITS;
+    unsigned step = ((hash >> 12) % BLOCK_BITS) | 1;
+
+    memset(mask, 0, sizeof(_mask_t));
+    for (unsigned i = 0; i < bloom->k; i++) {
+        pos %= BLOCK_BITS;
+        mask[pos / 64] |= 1ULL << (pos % 64);
+        pos += step;
+    }
+
+    return &bloom->words[block * CONFIG_BLOOM_BLOCKED_WORDS];
+}
+
+static bool _isset(const uint64_t *block, const _mask_t mask)
+{
+    for (unsigned i = 0; i < CONFIG_BLOOM_BLOCKED_WORDS; i++) {
+        if ((block[i] & mask[i]) != mask[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void _set(uint64_t *block, const _mask_t mask)
+{
+    for (unsigned i = 0; i < CONFIG_BLOOM_BLOCKED_WORDS; i++) {
+        block[i] |= mask[i];
+    }
+}
+
+void bloom_blocked_add(bloom_blocked_t *bloom, const uint8_t *buf, size_t len)
+{
+    _mask_t mask;
+
+    _set(_locate(bloom, buf, len, mask), mask);
+}
+
+bool bloom_blocked_check(const bloom_blocked_t *bloom, const uint8_t *buf,
+                         size_t len)
+{
+    _mask_t mask;
+
+    return _isset(_locate(bloom, buf, len, mask), mask);
+}
+
+bool bloom_blocked_check_add(bloom_blocked_t *bloom, const uint8_t *buf,
+                             size_t len)
+{
+    _mask_t mask;
+    uint64_t *block = _locate(bloom, buf, len, mask);
+
+    if (_isset(block, mask)) {
+        return true;
+    }
+    _set(block, mask);
+    return false;
+}
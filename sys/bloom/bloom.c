@@ -60,3 +60,22 @@ bool bloom_check(bloom_t *bloom, const uint8_t *buf, size_t len)
 
     return true; /* ? */
 }
+
+uint64_t bloom_hash64(const uint8_t *buf, size_t len)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+
+    while (len--) {
+        hash ^= *buf++;
+        hash *= 0x100000001b3ULL;
+    }
+
+    /* FNV leaves the high bits badly mixed, finish as MurmurHash3 does */
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+
+    return hash;
+}
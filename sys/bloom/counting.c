@@ -0,0 +1,144 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_bloom_counting
+ * @{
+ *
+ * @file
+ * @brief       Counting Bloom filter implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "bloom.h"
+#include "bloom/counting.h"
+
+#define COUNTER_MAX     (0xf)
+
+/* enhanced double hashing: the step grows by one each time, so an even step
+ * and an even m can't make the positions repeat after a few probes */
+typedef struct {
+    uint32_t pos;
+    uint32_t step;
+    uint32_t inc;
+} _probe_t;
+
+/* (a + b) % m for a, b < m, without overflow */
+static uint32_t _add_mod(uint32_t a, uint32_t b, uint32_t m)
+{
+    return (a >= m - b) ? a - (m - b) : a + b;
+}
+
+static void _probe_init(const bloom_counting_t *bloom, _probe_t *probe,
+                        const uint8_t *buf, size_t len)
+{
+    uint64_t hash = bloom_hash64(buf, len);
+
+    probe->pos = (hash & UINT32_MAX) % bloom->m;
+    probe->step = (hash >> 32) % bloom->m;
+    probe->inc = 0;
+}
+
+static size_t _probe_next(const bloom_counting_t *bloom, _probe_t *probe)
+{
+    uint32_t m = bloom->m;
+    size_t pos = probe->pos;
+
+    probe->pos = _add_mod(probe->pos, probe->step, m);
+    probe->inc = _add_mod(probe->inc, 1 % m, m);
+    probe->step = _add_mod(probe->step, probe->inc, m);
+    return pos;
+}
+
+static unsigned _get(const bloom_counting_t *bloom, size_t pos)
+{
+    uint8_t byte = bloom->counters[pos / 2];
+
+    return (pos & 1) ? byte >> 4 : byte & 0xf;
+}
+
+static void _set(bloom_counting_t *bloom, size_t pos, unsigned val)
+{
+    uint8_t *byte = &bloom->counters[pos / 2];
+
+    if (pos & 1) {
+        *byte = (*byte & 0x0f) | (val << 4);
+    }
+    else {
+        *byte = (*byte & 0xf0) | val;
+    }
+}
+
+void bloom_counting_init(bloom_counting_t *bloom, size_t m, uint8_t *counters,
+                         unsigned k)
+{
+    assert(m > 0 && m <= UINT32_MAX);
+    assert(k > 0 && k <= UINT8_MAX);
+
+    bloom->counters = counters;
+    bloom->m = m;
+    bloom->k = k;
+    bloom_counting_clear(bloom);
+}
+
+void bloom_counting_clear(bloom_counting_t *bloom)
+{
+    memset(bloom->counters, 0, BLOOM_COUNTING_BYTES(bloom->m));
+}
+
+void bloom_counting_add(bloom_counting_t *bloom, const uint8_t *buf,
+                        size_t len)
+{
+    _probe_t probe;
+
+    _probe_init(bloom, &probe, buf, len);
+    for (unsigned i = 0; i < bloom->k; i++) {
+        size_t pos = _probe_next(bloom, &probe);
+        unsigned val = _get(bloom, pos);
+        if (val < COUNTER_MAX) {
+            _set(bloom, pos, val + 1);
+        }
+    }
+}
+
+bool bloom_counting_remove(bloom_counting_t *bloom, const uint8_t *buf,
+                           size_t len)
+{
+    _probe_t probe;
+
+    if (!bloom_counting_check(bloom, buf, len)) {
+        return false;
+    }
+
+    _probe_init(bloom, &probe, buf, len);
+    for (unsigned i = 0; i < bloom->k; i++) {
+        size_t pos = _probe_next(bloom, &probe);
+        unsigned val = _get(bloom, pos);
+        /* a saturated counter may belong to more elements than it counts,
+         * and an element may hit the same counter twice */
+        if (val > 0 && val < COUNTER_MAX) {
+            _set(bloom, pos, val - 1);
+        }
+    }
+    return true;
+}
+
+bool bloom_counting_check(const bloom_counting_t *bloom, const uint8_t *buf,
+                          size_t len)
+{
+    _probe_t probe;
+
+    _probe_init(bloom, &probe, buf, len);
+    for (unsigned i = 0; i < bloom->k; i++) {
+        if (_get(bloom, _probe_next(bloom, &probe)) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
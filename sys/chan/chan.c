@@ -0,0 +1,151 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief   Ownership-transfer channel implementation
+ */
+
+#include <assert.h>
+#include <errno.h>
+
+#include "atomic_utils.h"
+#include "chan.h"
+
+/* number of messages taken out of the mailbox per critical section */
+#define DRAIN_CHUNK     (8U)
+
+static inline msg_t _msg(const chan_t *chan, chan_buf_t *buf)
+{
+    msg_t msg = { .type = chan->type, .content = { .ptr = buf } };
+
+    return msg;
+}
+
+static inline chan_buf_t *_buf(const chan_t *chan, const msg_t *msg)
+{
+    /* a buffer of another type was sent to the channel */
+    assert(msg->type == chan->type);
+    (void)chan;
+    return msg->content.ptr;
+}
+
+void chan_buf_hold(chan_buf_t *buf, unsigned num)
+{
+    atomic_fetch_add_u16(&buf->refs, num);
+}
+
+void chan_buf_release(chan_buf_t *buf)
+{
+    uint16_t refs = atomic_fetch_sub_u16(&buf->refs, 1);
+
+    assert(refs > 0);
+    if ((refs == 1) && (buf->free != NULL)) {
+        buf->free(buf);
+    }
+}
+
+void chan_send(chan_t *chan, chan_buf_t *buf)
+{
+    msg_t msg = _msg(chan, buf);
+
+    mbox_put(&chan->mbox, &msg);
+}
+
+int chan_try_send(chan_t *chan, chan_buf_t *buf)
+{
+    msg_t msg = _msg(chan, buf);
+
+    return mbox_try_put(&chan->mbox, &msg) ? 0 : -EAGAIN;
+}
+
+int chan_send_timeout(chan_t *chan, chan_buf_t *buf,
+                      ztimer_clock_t *clock, uint32_t timeout)
+{
+    msg_t msg = _msg(chan, buf);
+
+    return ztimer_mbox_put_timeout(clock, &chan->mbox, &msg, timeout);
+}
+
+unsigned chan_dispatch(chan_t *const *chans, unsigned num, chan_buf_t *buf)
+{
+    unsigned sent = 0;
+
+    /* hold all references up front, so a receiver releasing its reference
+     * early can't free the buffer while it is still dispatched */
+    chan_buf_hold(buf, num);
+    for (unsigned i = 0; i < num; i++) {
+        if (chan_try_send(chans[i], buf) == 0) {
+            sent++;
+        }
+        else {
+            chan_buf_release(buf);
+        }
+    }
+    chan_buf_release(buf);
+    return sent;
+}
+
+chan_buf_t *chan_recv(chan_t *chan)
+{
+    msg_t msg;
+
+    mbox_get(&chan->mbox, &msg);
+    return _buf(chan, &msg);
+}
+
+chan_buf_t *chan_try_recv(chan_t *chan)
+{
+    msg_t msg;
+
+    if (!mbox_try_get(&chan->mbox, &msg)) {
+        return NULL;
+    }
+    return _buf(chan, &msg);
+}
+
+int chan_recv_timeout(chan_t *chan, chan_buf_t **buf,
+                      ztimer_clock_t *clock, uint32_t timeout)
+{
+    msg_t msg;
+    int res = ztimer_mbox_get_timeout(clock, &chan->mbox, &msg, timeout);
+
+    if (res == 0) {
+        *buf = _buf(chan, &msg);
+    }
+    return res;
+}
+
+size_t chan_recv_many(chan_t *chan, chan_buf_t **bufs, size_t num)
+{
+    if (num == 0) {
+        return 0;
+    }
+    bufs[0] = chan_recv(chan);
+    return 1 + chan_try_recv_many(chan, &bufs[1], num - 1);
+}
+
+size_t chan_try_recv_many(chan_t *chan, chan_buf_t **bufs, size_t num)
+{
+    size_t got = 0;
+
+    while (got < num) {
+        msg_t msgs[DRAIN_CHUNK];
+        size_t chunk = mbox_try_get_many(&chan->mbox, msgs,
+                                         (num - got < DRAIN_CHUNK) ? num - got
+                                                                   : DRAIN_CHUNK);
+        for (size_t i = 0; i < chunk; i++) {
+            bufs[got++] = _buf(chan, &msgs[i]);
+        }
+        if (chunk < DRAIN_CHUNK) {
+            break;
+        }
+    }
+    return got;
+}
+
+/** @} */
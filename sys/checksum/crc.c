@@ -0,0 +1,144 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_checksum_crc
+ * @{
+ *
+ * @file
+ * @brief       Generic CRC engine implementation
+ *
+ * Reflected CRCs are kept reflected in the lowest bits of the state and
+ * shifted right, the others are kept in the highest bits and shifted left.
+ * This way all widths are handled by the same code.
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "checksum/crc.h"
+
+static uint32_t _reflect(uint32_t val, unsigned width)
+{
+    uint32_t res = 0;
+
+    for (unsigned i = 0; i < width; i++) {
+        res = (res << 1) | (val & 1);
+        val >>= 1;
+    }
+    return res;
+}
+
+/* the polynomial as used by the shift direction */
+static uint32_t _poly(const crc_params_t *params)
+{
+    if (params->reflected) {
+        return _reflect(params->poly, params->width);
+    }
+    return params->poly << (32 - params->width);
+}
+
+static uint32_t _bits(uint32_t crc, uint32_t poly, bool reflected,
+                      unsigned bits)
+{
+    if (reflected) {
+        while (bits--) {
+            crc = (crc >> 1) ^ ((crc & 1) * poly);
+        }
+    }
+    else {
+        while (bits--) {
+            crc = (crc << 1) ^ ((crc >> 31) * poly);
+        }
+    }
+    return crc;
+}
+
+void crc_table_init(const crc_params_t *params, uint32_t *table,
+                    unsigned table_bits)
+{
+    assert(table_bits == 4 || table_bits == 8);
+
+    uint32_t poly = _poly(params);
+
+    for (uint32_t i = 0; i < (1U << table_bits); i++) {
+        uint32_t crc = params->reflected ? i : i << (32 - table_bits);
+        table[i] = _bits(crc, poly, params->reflected, table_bits);
+    }
+}
+
+uint32_t crc_init(const crc_params_t *params)
+{
+    assert(params->width >= 1 && params->width <= 32);
+
+    if (params->reflected) {
+        return _reflect(params->init, params->width);
+    }
+    return params->init << (32 - params->width);
+}
+
+uint32_t crc_update(const crc_params_t *params, uint32_t crc,
+                    const void *buf, size_t len)
+{
+    const uint8_t *p = buf;
+    const uint32_t *tab = params->table;
+
+    switch (params->table ? params->table_bits : 0) {
+    case 8:
+        if (params->reflected) {
+            while (len--) {
+                crc = tab[(crc ^ *p++) & 0xff] ^ (crc >> 8);
+            }
+        }
+        else {
+            while (len--) {
+                crc = tab[(crc >> 24) ^ *p++] ^ (crc << 8);
+            }
+        }
+        break;
+    case 4:
+        if (params->reflected) {
+            while (len--) {
+                crc ^= *p++;
+                crc = tab[crc & 0xf] ^ (crc >> 4);
+                crc = tab[crc & 0xf] ^ (crc >> 4);
+            }
+        }
+        else {
+            while (len--) {
+                crc ^= (uint32_t)*p++ << 24;
+                crc = tab[crc >> 28] ^ (crc << 4);
+                crc = tab[crc >> 28] ^ (crc << 4);
+            }
+        }
+        break;
+    default: {
+        uint32_t poly = _poly(params);
+        while (len--) {
+            crc ^= params->reflected ? *p : (uint32_t)*p << 24;
+            crc = _bits(crc, poly, params->reflected, 8);
+            p++;
+        }
+        break;
+    }
+    }
+
+    return crc;
+}
+
+uint32_t crc_finish(const crc_params_t *params, uint32_t crc)
+{
+    if (!params->reflected) {
+        crc >>= 32 - params->width;
+    }
+    crc ^= params->xorout;
+
+    /* drop the bits a narrow reflected CRC keeps above its width */
+    if (params->width < 32) {
+        crc &= (1UL << params->width) - 1;
+    }
+    return crc;
+}
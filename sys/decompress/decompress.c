@@ -0,0 +1,239 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_decompress
+ * @{
+ *
+ * @file
+ * @brief       Streaming decompression
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "byteorder.h"
+#include "decompress.h"
+#include "kernel_defines.h"
+#include "macros/utils.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static int _output(decompress_t *ctx, const uint8_t *buf, size_t len)
+{
+    ctx->out_bytes += len;
+    return ctx->write(ctx->arg, buf, len);
+}
+
+#if IS_USED(MODULE_DECOMPRESS_HEATSHRINK)
+static int _heatshrink_drain(decompress_t *ctx)
+{
+    HSD_poll_res res;
+
+    do {
+        size_t len = 0;
+        res = heatshrink_decoder_poll(&ctx->u.heatshrink.hsd, ctx->u.heatshrink.out,
+                                      sizeof(ctx->u.heatshrink.out), &len);
+        if (res < 0) {
+            return -EBADMSG;
+        }
+        if (len) {
+            int err = _output(ctx, ctx->u.heatshrink.out, len);
+            if (err < 0) {
+                return err;
+            }
+        }
+    } while (res == HSDR_POLL_MORE);
+
+    return 0;
+}
+
+static int _heatshrink_feed(decompress_t *ctx, const uint8_t *data, size_t len)
+{
+    while (len) {
+        size_t sunk = 0;
+        /* the decoder doesn't modify its input, it's just not declared const */
+        if (heatshrink_decoder_sink(&ctx->u.heatshrink.hsd, (uint8_t *)data, len,
+                                    &sunk) < 0) {
+            return -EINVAL;
+        }
+        data += sunk;
+        len -= sunk;
+
+        int res = _heatshrink_drain(ctx);
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    return 0;
+}
+
+static int _heatshrink_finish(decompress_t *ctx)
+{
+    HSD_finish_res res;
+
+    while ((res = heatshrink_decoder_finish(&ctx->u.heatshrink.hsd)) == HSDR_FINISH_MORE) {
+        int err = _heatshrink_drain(ctx);
+        if (err < 0) {
+            return err;
+        }
+    }
+
+    return res < 0 ? -EBADMSG : 0;
+}
+#endif
+
+#if IS_USED(MODULE_DECOMPRESS_LZ4)
+static int _lz4_feed(decompress_t *ctx, const uint8_t *data, size_t len)
+{
+    uint8_t *in = ctx->u.lz4.in;
+
+    while (len) {
+        size_t need = 2;
+        if (ctx->u.lz4.fill >= 2) {
+            size_t block_len = byteorder_lebuftohs(in);
+            if (block_len == 0 || block_len > sizeof(ctx->u.lz4.in) - 2) {
+                return -EBADMSG;
+            }
+            need += block_len;
+        }
+
+        size_t chunk = MIN(len, need - ctx->u.lz4.fill);
+        memcpy(&in[ctx->u.lz4.fill], data, chunk);
+        ctx->u.lz4.fill += chunk;
+        data += chunk;
+        len -= chunk;
+
+        if (ctx->u.lz4.fill == need && need > 2) {
+            int out = LZ4_decompress_safe((const char *)&in[2],
+                                          (char *)ctx->u.lz4.out, need - 2,
+                                          sizeof(ctx->u.lz4.out));
+            if (out < 0) {
+                return -EBADMSG;
+            }
+            ctx->u.lz4.fill = 0;
+
+            int res = _output(ctx, ctx->u.lz4.out, out);
+            if (res < 0) {
+                return res;
+            }
+        }
+    }
+
+    return 0;
+}
+
+static int _lz4_finish(decompress_t *ctx)
+{
+    /* a block was cut off */
+    return ctx->u.lz4.fill ? -EBADMSG : 0;
+}
+#endif
+
+int decompress_init(decompress_t *ctx, decompress_codec_t codec,
+                    decompress_write_cb_t write, void *arg)
+{
+    ctx->write = write;
+    ctx->arg = arg;
+    ctx->in_bytes = 0;
+    ctx->out_bytes = 0;
+    ctx->codec = codec;
+
+    switch (codec) {
+#if IS_USED(MODULE_DECOMPRESS_HEATSHRINK)
+    case DECOMPRESS_CODEC_HEATSHRINK:
+        heatshrink_decoder_reset(&ctx->u.heatshrink.hsd);
+        return 0;
+#endif
+#if IS_USED(MODULE_DECOMPRESS_LZ4)
+    case DECOMPRESS_CODEC_LZ4:
+        ctx->u.lz4.fill = 0;
+        return 0;
+#endif
+    default:
+        return -ENOTSUP;
+    }
+}
+
+int decompress_feed(decompress_t *ctx, const void *data, size_t len)
+{
+    DEBUG("decompress: feeding %u bytes\n", (unsigned)len);
+
+    ctx->in_bytes += len;
+
+    switch (ctx->codec) {
+#if IS_USED(MODULE_DECOMPRESS_HEATSHRINK)
+    case DECOMPRESS_CODEC_HEATSHRINK:
+        return _heatshrink_feed(ctx, data, len);
+#endif
+#if IS_USED(MODULE_DECOMPRESS_LZ4)
+    case DECOMPRESS_CODEC_LZ4:
+        return _lz4_feed(ctx, data, len);
+#endif
+    default:
+        (void)data;
+        return -ENOTSUP;
+    }
+}
+
+int decompress_finish(decompress_t *ctx)
+{
+    switch (ctx->codec) {
+#if IS_USED(MODULE_DECOMPRESS_HEATSHRINK)
+    case DECOMPRESS_CODEC_HEATSHRINK:
+        return _heatshrink_finish(ctx);
+#endif
+#if IS_USED(MODULE_DECOMPRESS_LZ4)
+    case DECOMPRESS_CODEC_LZ4:
+        return _lz4_finish(ctx);
+#endif
+    default:
+        return -ENOTSUP;
+    }
+}
+
+int decompress_hdr_parse(const void *buf, size_t len,
+                         decompress_codec_t *codec, uint32_t *size)
+{
+    const decompress_hdr_t *hdr = buf;
+
+    if (len < sizeof(*hdr) ||
+        memcmp(hdr->magic, DECOMPRESS_HDR_MAGIC, sizeof(hdr->magic))) {
+        return -EINVAL;
+    }
+    if (hdr->reserved) {
+        return -ENOTSUP;
+    }
+
+    switch (hdr->codec) {
+#if IS_USED(MODULE_DECOMPRESS_HEATSHRINK)
+    case DECOMPRESS_CODEC_HEATSHRINK:
+        if ((hdr->param >> 4) != HEATSHRINK_STATIC_WINDOW_BITS ||
+            (hdr->param & 0xf) != HEATSHRINK_STATIC_LOOKAHEAD_BITS) {
+            return -ENOTSUP;
+        }
+        break;
+#endif
+#if IS_USED(MODULE_DECOMPRESS_LZ4)
+    case DECOMPRESS_CODEC_LZ4:
+        if (hdr->param > bitarithm_msb(CONFIG_DECOMPRESS_LZ4_BLOCKSIZE)) {
+            return -ENOTSUP;
+        }
+        break;
+#endif
+    default:
+        return -ENOTSUP;
+    }
+
+    *codec = hdr->codec;
+    *size = byteorder_lebuftohl((const uint8_t *)&hdr->size);
+
+    return sizeof(*hdr);
+}
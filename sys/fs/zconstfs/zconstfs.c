@@ -0,0 +1,325 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_fs_zconstfs
+ * @{
+ *
+ * @file
+ * @brief       ZConstFS implementation
+ *
+ * @}
+ */
+
+/* Required for strnlen in string.h, when building with -std=c99 */
+#define _DEFAULT_SOURCE 1
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+
+#include "architecture.h"
+#include "fs/zconstfs.h"
+#include "macros/math.h"
+#include "macros/utils.h"
+#include "mutex.h"
+#include "vfs.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#ifdef MODULE_DECOMPRESS_LZ4
+static_assert(CONFIG_ZCONSTFS_BLOCKSIZE <= CONFIG_DECOMPRESS_LZ4_BLOCKSIZE,
+              "an LZ4 compressed block must fit into the LZ4 decoder");
+#endif
+
+typedef struct {
+    const zconstfs_file_t *file;    /**< file of the cached block, NULL if unused */
+    uint32_t block;                 /**< index of the cached block */
+    uint32_t used;                  /**< value of _clock at the last access */
+    uint16_t len;                   /**< decoded length */
+    uint8_t data[CONFIG_ZCONSTFS_BLOCKSIZE];
+} _cache_entry_t;
+
+/* decoder and cache are shared by all mounts */
+static mutex_t _lock = MUTEX_INIT;
+static decompress_t _ctx;
+static _cache_entry_t _cache[CONFIG_ZCONSTFS_CACHE_BLOCKS];
+static _cache_entry_t *_decoding;
+static uint32_t _clock;
+
+/* File system operations */
+static int zconstfs_stat(vfs_mount_t *mountp, const char *restrict name, struct stat *restrict buf);
+static int zconstfs_statvfs(vfs_mount_t *mountp, const char *restrict path, struct statvfs *restrict buf);
+
+/* File operations */
+static int zconstfs_fstat(vfs_file_t *filp, struct stat *buf);
+static off_t zconstfs_lseek(vfs_file_t *filp, off_t off, int whence);
+static int zconstfs_open(vfs_file_t *filp, const char *name, int flags, mode_t mode);
+static ssize_t zconstfs_read(vfs_file_t *filp, void *dest, size_t nbytes);
+
+/* Directory operations */
+static int zconstfs_opendir(vfs_DIR *dirp, const char *dirname);
+static int zconstfs_readdir(vfs_DIR *dirp, vfs_dirent_t *entry);
+
+static const vfs_file_system_ops_t zconstfs_fs_ops = {
+    .statvfs = zconstfs_statvfs,
+    .stat = zconstfs_stat,
+};
+
+static const vfs_file_ops_t zconstfs_file_ops = {
+    .fstat = zconstfs_fstat,
+    .lseek = zconstfs_lseek,
+    .open  = zconstfs_open,
+    .read  = zconstfs_read,
+};
+
+static const vfs_dir_ops_t zconstfs_dir_ops = {
+    .opendir = zconstfs_opendir,
+    .readdir = zconstfs_readdir,
+};
+
+const vfs_file_system_t zconstfs_file_system = {
+    .f_op = &zconstfs_file_ops,
+    .fs_op = &zconstfs_fs_ops,
+    .d_op = &zconstfs_dir_ops,
+};
+
+static void _zconstfs_write_stat(const zconstfs_file_t *fp, struct stat *restrict buf)
+{
+    /* buffer is cleared by vfs already */
+    buf->st_nlink = 1;
+    buf->st_mode = S_IFREG | S_IRUSR | S_IRGRP | S_IROTH;
+    buf->st_size = fp->size;
+    /* st_blocks counts 512 byte units of storage used by the compressed data */
+    buf->st_blocks = DIV_ROUND_UP(fp->blocks[DIV_ROUND_UP(fp->size, CONFIG_ZCONSTFS_BLOCKSIZE)]
+                                  - fp->blocks[0], 512);
+    buf->st_blksize = CONFIG_ZCONSTFS_BLOCKSIZE;
+}
+
+static int _cache_write(void *arg, const uint8_t *buf, size_t len)
+{
+    (void)arg;
+
+    if (_decoding->len + len > sizeof(_decoding->data)) {
+        return -EOVERFLOW;
+    }
+    memcpy(&_decoding->data[_decoding->len], buf, len);
+    _decoding->len += len;
+
+    return 0;
+}
+
+/* returns the decoded block, must be called with _lock held */
+static _cache_entry_t *_get_block(const zconstfs_t *fs, const zconstfs_file_t *fp,
+                                  uint32_t block)
+{
+    _cache_entry_t *victim = &_cache[0];
+
+    _clock++;
+    for (unsigned i = 0; i < ARRAY_SIZE(_cache); i++) {
+        if (_cache[i].file == fp && _cache[i].block == block) {
+            _cache[i].used = _clock;
+            return &_cache[i];
+        }
+        if (_cache[i].used < victim->used) {
+            victim = &_cache[i];
+        }
+    }
+
+    size_t expected = MIN(fp->size - block * CONFIG_ZCONSTFS_BLOCKSIZE,
+                          CONFIG_ZCONSTFS_BLOCKSIZE);
+    const uint8_t *data = (const uint8_t *)fp->data + fp->blocks[block];
+    size_t len = fp->blocks[block + 1] - fp->blocks[block];
+
+    DEBUG("zconstfs: decoding block %" PRIu32 " of \"%s\" (%" PRIuSIZE " bytes)\n",
+          block, fp->path, len);
+
+    _decoding = victim;
+    victim->file = NULL;
+    victim->len = 0;
+
+    if (decompress_init(&_ctx, fs->codec, _cache_write, NULL) < 0 ||
+        decompress_feed(&_ctx, data, len) < 0 ||
+        decompress_finish(&_ctx) < 0 ||
+        victim->len != expected) {
+        DEBUG("zconstfs: block %" PRIu32 " of \"%s\" is corrupt\n", block, fp->path);
+        return NULL;
+    }
+
+    victim->file = fp;
+    victim->block = block;
+    victim->used = _clock;
+
+    return victim;
+}
+
+static int zconstfs_stat(vfs_mount_t *mountp, const char *restrict name, struct stat *restrict buf)
+{
+    if (buf == NULL) {
+        return -EFAULT;
+    }
+    const zconstfs_t *fs = mountp->private_data;
+    for (size_t i = 0; i < fs->nfiles; ++i) {
+        if (strcmp(fs->files[i].path, name) == 0) {
+            _zconstfs_write_stat(&fs->files[i], buf);
+            buf->st_ino = i;
+            return 0;
+        }
+    }
+    return -ENOENT;
+}
+
+static int zconstfs_statvfs(vfs_mount_t *mountp, const char *restrict path, struct statvfs *restrict buf)
+{
+    (void) path;
+    if (buf == NULL) {
+        return -EFAULT;
+    }
+    const zconstfs_t *fs = mountp->private_data;
+    buf->f_bsize = sizeof(uint8_t); /* block size */
+    buf->f_frsize = sizeof(uint8_t); /* fundamental block size */
+    fsblkcnt_t f_blocks = 0;
+    for (size_t i = 0; i < fs->nfiles; ++i) {
+        f_blocks += fs->files[i].size;
+    }
+    buf->f_blocks = f_blocks;  /* Blocks total */
+    buf->f_bfree = 0;          /* Blocks free */
+    buf->f_bavail = 0;         /* Blocks available to non-privileged processes */
+    buf->f_files = fs->nfiles; /* Total number of file serial numbers */
+    buf->f_ffree = 0;          /* Total number of free file serial numbers */
+    buf->f_favail = 0;         /* Number of file serial numbers available to non-privileged process */
+    buf->f_fsid = 0;           /* File system id */
+    buf->f_flag = (ST_RDONLY | ST_NOSUID); /* File system flags */
+    buf->f_namemax = UINT8_MAX; /* Maximum file name length */
+    return 0;
+}
+
+static int zconstfs_fstat(vfs_file_t *filp, struct stat *buf)
+{
+    const zconstfs_file_t *fp = filp->private_data.ptr;
+    if (buf == NULL) {
+        return -EFAULT;
+    }
+    _zconstfs_write_stat(fp, buf);
+    return 0;
+}
+
+static off_t zconstfs_lseek(vfs_file_t *filp, off_t off, int whence)
+{
+    const zconstfs_file_t *fp = filp->private_data.ptr;
+    switch (whence) {
+        case SEEK_SET:
+            break;
+        case SEEK_CUR:
+            off += filp->pos;
+            break;
+        case SEEK_END:
+            off += fp->size;
+            break;
+        default:
+            return -EINVAL;
+    }
+    if (off < 0) {
+        /* the resulting file offset would be negative */
+        return -EINVAL;
+    }
+    /* POSIX allows seeking past the end of the file, even with O_RDONLY */
+    filp->pos = off;
+    return off;
+}
+
+static int zconstfs_open(vfs_file_t *filp, const char *name, int flags, mode_t mode)
+{
+    (void) mode;
+    const zconstfs_t *fs = filp->mp->private_data;
+    DEBUG("zconstfs_open: %p, \"%s\", 0x%x, 0%03lo\"\n", (void *)filp, name, flags, (unsigned long)mode);
+    /* We only support read access */
+    if ((flags & O_ACCMODE) != O_RDONLY) {
+        return -EROFS;
+    }
+    for (size_t i = 0; i < fs->nfiles; ++i) {
+        if (strcmp(fs->files[i].path, name) == 0) {
+            filp->private_data.ptr = (void *)&fs->files[i];
+            return 0;
+        }
+    }
+    return -ENOENT;
+}
+
+static ssize_t zconstfs_read(vfs_file_t *filp, void *dest, size_t nbytes)
+{
+    const zconstfs_t *fs = filp->mp->private_data;
+    const zconstfs_file_t *fp = filp->private_data.ptr;
+    uint8_t *out = dest;
+
+    DEBUG("zconstfs_read: %p, %p, %" PRIuSIZE "\n", (void *)filp, dest, nbytes);
+    if ((size_t)filp->pos >= fp->size) {
+        /* Current offset is at or beyond end of file */
+        return 0;
+    }
+
+    if (nbytes > (fp->size - filp->pos)) {
+        nbytes = fp->size - filp->pos;
+    }
+
+    mutex_lock(&_lock);
+    size_t done = 0;
+    while (done < nbytes) {
+        size_t pos = filp->pos + done;
+        _cache_entry_t *entry = _get_block(fs, fp, pos / CONFIG_ZCONSTFS_BLOCKSIZE);
+        if (entry == NULL) {
+            break;
+        }
+        size_t offset = pos % CONFIG_ZCONSTFS_BLOCKSIZE;
+        size_t chunk = MIN(nbytes - done, entry->len - offset);
+        memcpy(&out[done], &entry->data[offset], chunk);
+        done += chunk;
+    }
+    mutex_unlock(&_lock);
+
+    if (done == 0) {
+        return -EIO;
+    }
+    filp->pos += done;
+    return done;
+}
+
+static int zconstfs_opendir(vfs_DIR *dirp, const char *dirname)
+{
+    if (strncmp(dirname, "/", 2) != 0) {
+        /* flat file system, only a root directory */
+        return -ENOENT;
+    }
+    dirp->private_data.value = 0;
+    return 0;
+}
+
+static int zconstfs_readdir(vfs_DIR *dirp, vfs_dirent_t *entry)
+{
+    const zconstfs_t *fs = dirp->mp->private_data;
+    int filenum = dirp->private_data.value;
+    if ((size_t)filenum >= fs->nfiles) {
+        /* End of stream */
+        return 0;
+    }
+    const zconstfs_file_t *fp = &fs->files[filenum];
+    if (fp->path == NULL) {
+        return -EIO;
+    }
+    const char *filename = fp->path[0] == '/' ? fp->path + 1 : fp->path;
+    size_t len = strnlen(filename, VFS_NAME_MAX + 1);
+    /* skip past entries whose name does not fit in vfs_dirent_t */
+    dirp->private_data.value = ++filenum;
+    if (len > VFS_NAME_MAX) {
+        return -EAGAIN;
+    }
+    /* copy the string, including terminating null */
+    memcpy(&entry->d_name[0], filename, len + 1);
+    entry->d_ino = filenum - 1;
+    return 1;
+}
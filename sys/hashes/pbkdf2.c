@@ -19,9 +19,11 @@
 #include <assert.h>
 #include <string.h>
 
-#include "hashes/sha256.h"
-#include "hashes/pbkdf2.h"
+#include "byteorder.h"
 #include "crypto/helper.h"
+#include "hashes/pbkdf2.h"
+#include "hashes/sha256.h"
+#include "hashes/sha2xx_common.h"
 
 static void inplace_xor_scalar(uint8_t *bytes, size_t len, uint8_t c)
 {
@@ -31,15 +33,13 @@ static void inplace_xor_scalar(uint8_t *bytes, size_t len, uint8_t c)
     }
 }
 
-static void inplace_xor_digests(uint8_t *d1, const uint8_t *d2)
+/* words of a digest of a 64 + 32 byte message, padded to a full block */
+static void _digest_block(uint32_t block[16], const uint32_t digest[8])
 {
-    int len = SHA256_DIGEST_LENGTH;
-
-    while (len--) {
-        *d1 ^= *d2;
-        d1++;
-        d2++;
-    }
+    memcpy(block, digest, 8 * sizeof(uint32_t));
+    block[8] = 0x80000000;
+    memset(&block[9], 0, 6 * sizeof(uint32_t));
+    block[15] = (SHA256_INTERNAL_BLOCK_SIZE + SHA256_DIGEST_LENGTH) * 8;
 }
 
 void pbkdf2_sha256(const void *password, size_t password_len,
@@ -52,7 +52,6 @@ void pbkdf2_sha256(const void *password, size_t password_len,
     sha256_context_t inner;
     sha256_context_t outer;
     uint8_t tmp_digest[SHA256_DIGEST_LENGTH];
-    int first_iter = 1;
 
     {
         uint8_t processed_pass[SHA256_INTERNAL_BLOCK_SIZE] = {0};
@@ -81,32 +80,50 @@ void pbkdf2_sha256(const void *password, size_t password_len,
         crypto_secure_wipe(&processed_pass, sizeof(processed_pass));
     }
 
-    memset(output, 0, SHA256_DIGEST_LENGTH);
-
-    while (iterations--) {
-        sha256_context_t inner_copy = inner, outer_copy = outer;
-
-        if (first_iter) {
-            sha256_update(&inner_copy, salt, salt_len);
-            sha256_update(&inner_copy, "\x00\x00\x00\x01", 4);
-            first_iter = 0;
-        } else {
-            sha256_update(&inner_copy, tmp_digest, sizeof(tmp_digest));
-        }
-
-        sha256_final(&inner_copy, tmp_digest);
+    /* U_1 = HMAC(password, salt || INT(1)) */
+    sha256_context_t ctx = inner;
+    sha256_update(&ctx, salt, salt_len);
+    sha256_update(&ctx, "\x00\x00\x00\x01", 4);
+    sha256_final(&ctx, tmp_digest);
+    ctx = outer;
+    sha256_update(&ctx, tmp_digest, sizeof(tmp_digest));
+    sha256_final(&ctx, tmp_digest);
+
+    uint32_t u[8];
+    uint32_t res[8];
+    uint32_t state[8];
+    uint32_t block[16];
+
+    for (unsigned i = 0; i < 8; i++) {
+        u[i] = res[i] = byteorder_bebuftohl(&tmp_digest[4 * i]);
+    }
 
-        sha256_update(&outer_copy, tmp_digest, sizeof(tmp_digest));
-        sha256_final(&outer_copy, tmp_digest);
+    /* U_n = HMAC(password, U_n-1), the message of both hashes is a digest,
+     * so each is a single compression of a block known in advance. The
+     * states after the key pads are kept, not recalculated. */
+    while (--iterations) {
+        _digest_block(block, u);
+        memcpy(state, inner.state, sizeof(state));
+        sha2xx_compress(state, block);
 
-        inplace_xor_digests(output, tmp_digest);
+        _digest_block(block, state);
+        memcpy(u, outer.state, sizeof(u));
+        sha2xx_compress(u, block);
 
-        if (iterations == 0) {
-            crypto_secure_wipe(&inner_copy, sizeof(inner_copy));
-            crypto_secure_wipe(&outer_copy, sizeof(outer_copy));
+        for (unsigned i = 0; i < 8; i++) {
+            res[i] ^= u[i];
         }
     }
 
+    for (unsigned i = 0; i < 8; i++) {
+        byteorder_htobebufl(&output[4 * i], res[i]);
+    }
+
+    crypto_secure_wipe(&ctx, sizeof(ctx));
+    crypto_secure_wipe(u, sizeof(u));
+    crypto_secure_wipe(res, sizeof(res));
+    crypto_secure_wipe(state, sizeof(state));
+    crypto_secure_wipe(block, sizeof(block));
     crypto_secure_wipe(&inner, sizeof(inner));
     crypto_secure_wipe(&outer, sizeof(outer));
     crypto_secure_wipe(&tmp_digest, sizeof(tmp_digest));
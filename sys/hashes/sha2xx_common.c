@@ -107,42 +107,63 @@ static const uint32_t K[64] = {
     0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
 };
 
+/* One round, the callers rotate the roles of the working variables instead
+ * of moving them. */
+#define ROUND(a, b, c, d, e, f, g, h, i) do {                   \
+        uint32_t t0 = h + S1(e) + Ch(e, f, g) + K[i] + W[(i) & 15]; \
+        d += t0;                                                \
+        h = t0 + S0(a) + Maj(a, b, c);                          \
+    } while (0)
+
+/* Extends the message schedule in place, only 16 words are kept */
+#define SCHEDULE(i)                                             \
+    (W[(i) & 15] += s1(W[((i) - 2) & 15]) + W[((i) - 7) & 15] + \
+                    s0(W[((i) - 15) & 15]))
+
+#define EIGHT_ROUNDS(i) do {                                    \
+        ROUND(a, b, c, d, e, f, g, h, (i) + 0);                 \
+        ROUND(h, a, b, c, d, e, f, g, (i) + 1);                 \
+        ROUND(g, h, a, b, c, d, e, f, (i) + 2);                 \
+        ROUND(f, g, h, a, b, c, d, e, (i) + 3);                 \
+        ROUND(e, f, g, h, a, b, c, d, (i) + 4);                 \
+        ROUND(d, e, f, g, h, a, b, c, (i) + 5);                 \
+        ROUND(c, d, e, f, g, h, a, b, (i) + 6);                 \
+        ROUND(b, c, d, e, f, g, h, a, (i) + 7);                 \
+    } while (0)
+
+void sha2xx_compress(uint32_t *state, uint32_t W[16])
+{
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+    for (unsigned i = 0; i < 64; i += 8) {
+        if (i >= 16) {
+            SCHEDULE(i + 0); SCHEDULE(i + 1); SCHEDULE(i + 2); SCHEDULE(i + 3);
+            SCHEDULE(i + 4); SCHEDULE(i + 5); SCHEDULE(i + 6); SCHEDULE(i + 7);
+        }
+        EIGHT_ROUNDS(i);
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
 /*
  * SHA256 block compression function.  The 256-bit state is transformed via
  * the 512-bit input block to produce a new state.
  */
 static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
 {
-    uint32_t W[64];
-    uint32_t S[8];
+    uint32_t W[16];
 
-    /* 1. Prepare message schedule W. */
     be32dec_vect(W, block, 64);
-    for (int i = 16; i < 64; i++) {
-        W[i] = s1(W[i - 2]) + W[i - 7] + s0(W[i - 15]) + W[i - 16];
-    }
-
-    /* 2. Initialize working variables. */
-    memcpy(S, state, 32);
-
-    /* 3. Mix. */
-    for (int i = 0; i < 64; ++i) {
-        uint32_t e = S[(68 - i) % 8], f = S[(69 - i) % 8];
-        uint32_t g = S[(70 - i) % 8], h = S[(71 - i) % 8];
-        uint32_t t0 = h + S1(e) + Ch(e, f, g) + W[i] + K[i];
-
-        uint32_t a = S[(64 - i) % 8], b = S[(65 - i) % 8];
-        uint32_t c = S[(66 - i) % 8], d = S[(67 - i) % 8];
-        uint32_t t1 = S0(a) + Maj(a, b, c);
-
-        S[(67 - i) % 8] = d + t0;
-        S[(71 - i) % 8] = t0 + t1;
-    }
-
-    /* 4. Mix local working variables into global state */
-    for (int i = 0; i < 8; i++) {
-        state[i] += S[i];
-    }
+    sha2xx_compress(state, W);
 }
 
 static const unsigned char PAD[64] = {
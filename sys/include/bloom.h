@@ -111,6 +111,17 @@
  * @defgroup    sys_bloom Bloom filter
  * @ingroup     sys
  * @brief       Bloom filter library
+ *
+ * The classic filter @ref bloom_t calls each of its k hash functions and
+ * accesses k random positions of the bit array per element. Two variants use
+ * a single 64-bit hash (@ref bloom_hash64) per element instead:
+ *
+ * - @ref sys_bloom_blocked keeps all bits of an element in one 64-bit word,
+ *   a check is a single memory access. The false positive rate is somewhat
+ *   higher than that of a classic filter of the same size.
+ * - @ref sys_bloom_counting uses 4-bit counters instead of bits, so elements
+ *   can be removed again. It needs four times the memory.
+ *
  * @{
  *
  * @file
@@ -220,6 +231,19 @@ void bloom_add(bloom_t *bloom, const uint8_t *buf, size_t len);
  */
 bool bloom_check(bloom_t *bloom, const uint8_t *buf, size_t len);
 
+/**
+ * @brief Hash a string for the Bloom filter variants
+ *
+ * 64-bit FNV-1a with a final bit mix, so that all bits of the result depend
+ * on all bits of the input.
+ *
+ * @param buf    string to hash
+ * @param len    the length of the string @p buf
+ *
+ * @return       the hash
+ */
+uint64_t bloom_hash64(const uint8_t *buf, size_t len);
+
 #ifdef __cplusplus
 }
 #endif
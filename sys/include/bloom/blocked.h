@@ -0,0 +1,132 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_bloom_blocked Blocked Bloom filter
+ * @ingroup     sys_bloom
+ * @brief       Bloom filter with all bits of an element in one word
+ *
+ * An element is hashed once with @ref bloom_hash64. One part of the hash
+ * selects a block of the filter, the rest selects the k bits within that
+ * block by double hashing. Adding and checking an element thus takes one hash
+ * and touches one block, independent of k. By default, a block is a single
+ * 64-bit word. On an MCU with a data cache, a block can be made as large as a
+ * cache line with @ref CONFIG_BLOOM_BLOCKED_WORDS.
+ *
+ * As the bits of an element are not spread over the whole filter, the false
+ * positive rate is higher than that of a classic @ref bloom_t, and the best k
+ * is lower. Simulated rates with the best k for each:
+ *
+ * | bits per element | classic        | 1 word       | 8 words (64 bytes) |
+ * |------------------|----------------|--------------|--------------------|
+ * | 8                | 2.2 % (k=6)    | 3.9 % (k=3)  | 2.5 % (k=5)        |
+ * | 16               | 0.05 % (k=11)  | 0.9 % (k=4)  | 0.18 % (k=6)       |
+ *
+ * @{
+ *
+ * @file
+ * @brief       Blocked Bloom filter API
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of 64-bit words per block
+ *
+ * Must be a power of two. Set it to the size of a cache line, e.g. 4 for
+ * 32 byte lines, to trade some speed for a lower false positive rate.
+ */
+#ifndef CONFIG_BLOOM_BLOCKED_WORDS
+#define CONFIG_BLOOM_BLOCKED_WORDS  (1U)
+#endif
+
+/**
+ * @brief   Blocked Bloom filter
+ */
+typedef struct {
+    uint64_t *words;        /**< the blocks of the filter */
+    size_t blocks_numof;    /**< number of blocks */
+    uint8_t k;              /**< number of bits per element */
+} bloom_blocked_t;
+
+/**
+ * @brief   Number of words needed for a filter of at least @p bits bits
+ */
+#define BLOOM_BLOCKED_WORDS(bits) \
+    ((((bits) + 64 * CONFIG_BLOOM_BLOCKED_WORDS - 1) / \
+      (64 * CONFIG_BLOOM_BLOCKED_WORDS)) * CONFIG_BLOOM_BLOCKED_WORDS)
+
+/**
+ * @brief   Initialize a blocked Bloom filter
+ *
+ * The words are cleared.
+ *
+ * @param[out] bloom        filter to initialize
+ * @param[in]  words        memory of the filter
+ * @param[in]  words_numof  number of words in @p words, a multiple of
+ *                          @ref CONFIG_BLOOM_BLOCKED_WORDS, see
+ *                          @ref BLOOM_BLOCKED_WORDS
+ * @param[in]  k            number of bits per element, 1 to 16
+ */
+void bloom_blocked_init(bloom_blocked_t *bloom, uint64_t *words,
+                        size_t words_numof, unsigned k);
+
+/**
+ * @brief   Remove all elements from a blocked Bloom filter
+ *
+ * @param[in,out] bloom     the filter
+ */
+void bloom_blocked_clear(bloom_blocked_t *bloom);
+
+/**
+ * @brief   Add a string to a blocked Bloom filter
+ *
+ * @param[in,out] bloom     the filter
+ * @param[in]     buf       string to add
+ * @param[in]     len       the length of the string @p buf
+ */
+void bloom_blocked_add(bloom_blocked_t *bloom, const uint8_t *buf, size_t len);
+
+/**
+ * @brief   Determine if a string is in a blocked Bloom filter
+ *
+ * @param[in] bloom     the filter
+ * @param[in] buf       string to check
+ * @param[in] len       the length of the string @p buf
+ *
+ * @return  false if the string is not in the filter
+ * @return  true if the string may be in the filter
+ */
+bool bloom_blocked_check(const bloom_blocked_t *bloom, const uint8_t *buf,
+                         size_t len);
+
+/**
+ * @brief   Add a string to a blocked Bloom filter unless it is in already
+ *
+ * Useful for duplicate detection, checks and adds with a single hash.
+ *
+ * @param[in,out] bloom     the filter
+ * @param[in]     buf       string to add
+ * @param[in]     len       the length of the string @p buf
+ *
+ * @return  false if the string was not in the filter and has been added
+ * @return  true if the string may have been in the filter already
+ */
+bool bloom_blocked_check_add(bloom_blocked_t *bloom, const uint8_t *buf,
+                             size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
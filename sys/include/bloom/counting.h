@@ -0,0 +1,116 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_bloom_counting Counting Bloom filter
+ * @ingroup     sys_bloom
+ * @brief       Bloom filter that supports removing elements
+ *
+ * Instead of a bit, each position of the filter is a 4-bit counter that is
+ * incremented when an element is added and decremented when it is removed.
+ * The k positions of an element are derived from a single @ref bloom_hash64
+ * by double hashing.
+ *
+ * A counter that reaches 15 sticks there, as it can no longer tell how many
+ * elements share it. With the number of positions chosen for a reasonable
+ * false positive rate, this practically never happens.
+ *
+ * Only remove elements that have been added: removing an element that is
+ * just a false positive decrements counters of other elements, which then may
+ * no longer be found.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Counting Bloom filter API
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Counting Bloom filter
+ */
+typedef struct {
+    uint8_t *counters;      /**< the counters, two per byte */
+    size_t m;               /**< number of counters */
+    uint8_t k;              /**< number of counters per element */
+} bloom_counting_t;
+
+/**
+ * @brief   Number of bytes needed for @p m counters
+ */
+#define BLOOM_COUNTING_BYTES(m)     (((m) + 1) / 2)
+
+/**
+ * @brief   Initialize a counting Bloom filter
+ *
+ * The counters are cleared.
+ *
+ * @param[out] bloom    filter to initialize
+ * @param[in]  m        number of counters, at least 1
+ * @param[in]  counters memory of @ref BLOOM_COUNTING_BYTES(m) bytes
+ * @param[in]  k        number of counters per element, at least 1
+ */
+void bloom_counting_init(bloom_counting_t *bloom, size_t m, uint8_t *counters,
+                         unsigned k);
+
+/**
+ * @brief   Remove all elements from a counting Bloom filter
+ *
+ * @param[in,out] bloom     the filter
+ */
+void bloom_counting_clear(bloom_counting_t *bloom);
+
+/**
+ * @brief   Add a string to a counting Bloom filter
+ *
+ * @param[in,out] bloom     the filter
+ * @param[in]     buf       string to add
+ * @param[in]     len       the length of the string @p buf
+ */
+void bloom_counting_add(bloom_counting_t *bloom, const uint8_t *buf,
+                        size_t len);
+
+/**
+ * @brief   Remove a string from a counting Bloom filter
+ *
+ * @pre     The string has been added to the filter
+ *
+ * @param[in,out] bloom     the filter
+ * @param[in]     buf       string to remove
+ * @param[in]     len       the length of the string @p buf
+ *
+ * @return  true if the string has been removed
+ * @return  false if the string is not in the filter, nothing is changed then
+ */
+bool bloom_counting_remove(bloom_counting_t *bloom, const uint8_t *buf,
+                           size_t len);
+
+/**
+ * @brief   Determine if a string is in a counting Bloom filter
+ *
+ * @param[in] bloom     the filter
+ * @param[in] buf       string to check
+ * @param[in] len       the length of the string @p buf
+ *
+ * @return  false if the string is not in the filter
+ * @return  true if the string may be in the filter
+ */
+bool bloom_counting_check(const bloom_counting_t *bloom, const uint8_t *buf,
+                          size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -0,0 +1,295 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_chan Ownership-transfer channels
+ * @ingroup     sys
+ * @brief       Typed channels that pass reference counted buffers between
+ *              threads without copying them
+ *
+ * A channel is a @ref core_mbox that only carries pointers to buffers with an
+ * embedded @ref chan_buf_t header. Sending a buffer passes one reference to
+ * the buffer to the channel; receiving a buffer passes that reference on to
+ * the receiver, which releases it with @ref chan_buf_release once it is done.
+ * The buffer is freed by its @ref chan_buf_t::free callback when the last
+ * reference is released, so the same buffer can be handed to several
+ * receivers at once (see @ref chan_dispatch) without any of them copying it.
+ *
+ * Every channel carries a type tag that is checked on reception, so a
+ * receiver can safely convert the buffer to the type it expects with
+ * @ref CHAN_BUF_CONTAINER.
+ *
+ * Any number of threads (or interrupt handlers, using @ref chan_try_send) may
+ * send to a channel. Senders and receivers can block on a full or empty
+ * channel, optionally with a ztimer timeout. A receiver may take out all
+ * pending buffers in one go with @ref chan_recv_many, which requires a single
+ * critical section and wakes all blocked senders at once.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.c}
+ * typedef struct {
+ *     chan_buf_t buf;
+ *     uint8_t data[128];
+ * } frame_t;
+ *
+ * static msg_t _queue[8];
+ * static chan_t _chan = CHAN_INIT(_queue, ARRAY_SIZE(_queue), FRAME_TYPE);
+ *
+ * // producer
+ * frame_t *frame = frame_alloc();
+ * chan_buf_init(&frame->buf, frame_free);
+ * fill(frame->data);
+ * chan_send(&_chan, &frame->buf);      // frame now belongs to the channel
+ *
+ * // consumer
+ * frame_t *frame = CHAN_BUF_CONTAINER(chan_recv(&_chan), frame_t, buf);
+ * process(frame->data);
+ * chan_buf_release(&frame->buf);       // frees the frame
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Ownership-transfer channel definitions
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "container.h"
+#include "mbox.h"
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Buffer header type
+ */
+typedef struct chan_buf chan_buf_t;
+
+/**
+ * @brief   Frees a buffer once its last reference was released
+ *
+ * @param[in] buf   The buffer to free.
+ */
+typedef void (*chan_buf_free_t)(chan_buf_t *buf);
+
+/**
+ * @brief   Header of a buffer passed through a channel
+ *
+ * Embed this into the buffer type that is passed through a channel.
+ */
+struct chan_buf {
+    chan_buf_free_t free;   /**< called when the last reference is released.
+                             *   May be NULL for statically allocated
+                             *   buffers. */
+    uint16_t refs;          /**< number of references to the buffer */
+};
+
+/**
+ * @brief   A channel
+ */
+typedef struct {
+    mbox_t mbox;            /**< mailbox carrying the buffers */
+    uint16_t type;          /**< type tag of the buffers in the channel */
+} chan_t;
+
+/**
+ * @brief   Static initializer for a channel
+ *
+ * @param[in] queue         Array of @ref msg_t used as queue.
+ * @param[in] queue_size    Number of elements in @p queue. Must be a power
+ *                          of two.
+ * @param[in] type          Type tag of the buffers in the channel.
+ */
+#define CHAN_INIT(queue, queue_size, type) { \
+        MBOX_INIT(queue, queue_size), type \
+}
+
+/**
+ * @brief   Gets the buffer type a buffer header is embedded in
+ *
+ * @param[in] buf       Pointer to a @ref chan_buf_t.
+ * @param[in] type      Type of the buffer.
+ * @param[in] member    Name of the @ref chan_buf_t member in @p type.
+ */
+#define CHAN_BUF_CONTAINER(buf, type, member) container_of(buf, type, member)
+
+/**
+ * @brief   Initializes a channel
+ *
+ * @param[out] chan         The channel to initialize.
+ * @param[in] queue         Array of @ref msg_t used as queue.
+ * @param[in] queue_size    Number of elements in @p queue. Must be a power
+ *                          of two.
+ * @param[in] type          Type tag of the buffers in the channel.
+ */
+static inline void chan_init(chan_t *chan, msg_t *queue,
+                             unsigned int queue_size, uint16_t type)
+{
+    mbox_init(&chan->mbox, queue, queue_size);
+    chan->type = type;
+}
+
+/**
+ * @brief   Initializes a buffer header with one reference, owned by the caller
+ *
+ * @param[out] buf  The buffer header to initialize.
+ * @param[in] free  Called when the last reference is released. May be NULL.
+ */
+static inline void chan_buf_init(chan_buf_t *buf, chan_buf_free_t free)
+{
+    buf->free = free;
+    buf->refs = 1;
+}
+
+/**
+ * @brief   Adds references to a buffer
+ *
+ * @param[in] buf   A buffer.
+ * @param[in] num   Number of references to add.
+ */
+void chan_buf_hold(chan_buf_t *buf, unsigned num);
+
+/**
+ * @brief   Releases a reference to a buffer
+ *
+ * Frees the buffer if this was the last reference.
+ *
+ * @param[in] buf   A buffer.
+ */
+void chan_buf_release(chan_buf_t *buf);
+
+/**
+ * @brief   Sends a buffer, blocking until there is space in the channel
+ *
+ * The reference of the caller is passed to the channel.
+ *
+ * @param[in] chan  A channel.
+ * @param[in] buf   The buffer to send.
+ */
+void chan_send(chan_t *chan, chan_buf_t *buf);
+
+/**
+ * @brief   Sends a buffer if there is space in the channel
+ *
+ * @note    Safe to call from interrupt context.
+ *
+ * @param[in] chan  A channel.
+ * @param[in] buf   The buffer to send.
+ *
+ * @return  0, if the reference of the caller was passed to the channel.
+ * @return  -EAGAIN, if the channel is full. The caller keeps its reference.
+ */
+int chan_try_send(chan_t *chan, chan_buf_t *buf);
+
+/**
+ * @brief   Sends a buffer, blocking with a timeout
+ *
+ * @param[in] chan      A channel.
+ * @param[in] buf       The buffer to send.
+ * @param[in] clock     The ztimer clock of @p timeout.
+ * @param[in] timeout   Timeout in ticks of @p clock.
+ *
+ * @return  0, if the reference of the caller was passed to the channel.
+ * @return  -ETIMEDOUT, if the channel stayed full. The caller keeps its
+ *          reference.
+ */
+int chan_send_timeout(chan_t *chan, chan_buf_t *buf,
+                      ztimer_clock_t *clock, uint32_t timeout);
+
+/**
+ * @brief   Sends a buffer to several channels
+ *
+ * Each channel that is not full gets a reference to @p buf. The reference of
+ * the caller is consumed in any case, so the buffer is freed right away if no
+ * channel took it.
+ *
+ * @note    Safe to call from interrupt context.
+ *
+ * @param[in] chans     The channels.
+ * @param[in] num       Number of channels in @p chans.
+ * @param[in] buf       The buffer to send.
+ *
+ * @return  The number of channels that received @p buf.
+ */
+unsigned chan_dispatch(chan_t *const *chans, unsigned num, chan_buf_t *buf);
+
+/**
+ * @brief   Receives a buffer, blocking until there is one
+ *
+ * @param[in] chan  A channel.
+ *
+ * @return  The received buffer. The caller owns the reference.
+ */
+chan_buf_t *chan_recv(chan_t *chan);
+
+/**
+ * @brief   Receives a buffer if there is one
+ *
+ * @param[in] chan  A channel.
+ *
+ * @return  The received buffer. The caller owns the reference.
+ * @return  NULL, if the channel is empty.
+ */
+chan_buf_t *chan_try_recv(chan_t *chan);
+
+/**
+ * @brief   Receives a buffer, blocking with a timeout
+ *
+ * @param[in] chan      A channel.
+ * @param[out] buf      The received buffer. The caller owns the reference.
+ * @param[in] clock     The ztimer clock of @p timeout.
+ * @param[in] timeout   Timeout in ticks of @p clock.
+ *
+ * @return  0 on success.
+ * @return  -ETIMEDOUT, if the channel stayed empty.
+ */
+int chan_recv_timeout(chan_t *chan, chan_buf_t **buf,
+                      ztimer_clock_t *clock, uint32_t timeout);
+
+/**
+ * @brief   Receives as many buffers as there are pending, blocking until
+ *          there is at least one
+ *
+ * @param[in] chan  A channel.
+ * @param[out] bufs The received buffers. The caller owns their references.
+ * @param[in] num   Maximum number of buffers to receive.
+ *
+ * @return  The number of received buffers, at least 1.
+ */
+size_t chan_recv_many(chan_t *chan, chan_buf_t **bufs, size_t num);
+
+/**
+ * @brief   Receives as many buffers as there are pending
+ *
+ * @param[in] chan  A channel.
+ * @param[out] bufs The received buffers. The caller owns their references.
+ * @param[in] num   Maximum number of buffers to receive.
+ *
+ * @return  The number of received buffers.
+ */
+size_t chan_try_recv_many(chan_t *chan, chan_buf_t **bufs, size_t num);
+
+/**
+ * @brief   Gets the number of buffers pending in a channel
+ *
+ * @param[in] chan  A channel.
+ *
+ * @return  The number of buffers that can be received without blocking.
+ */
+static inline size_t chan_avail(chan_t *chan)
+{
+    return mbox_avail(&chan->mbox);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -0,0 +1,163 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_checksum_crc Generic CRC
+ * @ingroup     sys_checksum
+ *
+ * @brief       CRC engine for any CRC of up to 32 bits
+ *
+ * A CRC is described by its parameters in a @ref crc_params_t, using the
+ * naming of the "Catalogue of parametrised CRC algorithms". The parameters
+ * are constant and can be placed in flash. All CRCs share the same streaming
+ * API:
+ *
+ * ```c
+ * static const crc_params_t crc16_modbus =
+ *     CRC_PARAMS_INIT(16, 0x8005, 0xffff, 0x0000, true);
+ *
+ * uint32_t crc = crc_init(&crc16_modbus);
+ * crc = crc_update(&crc16_modbus, crc, part1, len1);
+ * crc = crc_update(&crc16_modbus, crc, part2, len2);
+ * uint16_t res = crc_finish(&crc16_modbus, crc);
+ * ```
+ *
+ * By default, the CRC is calculated bit by bit, which needs no memory but is
+ * the slowest. A look-up table speeds it up, see @ref CRC_PARAMS_INIT_TABLE:
+ *
+ * | table bits | table size | time per KiB (native64) |
+ * |------------|------------|-------------------------|
+ * | 0          | none       | 27 µs                   |
+ * | 4          | 64 bytes   | 9 µs                    |
+ * | 8          | 1 KiB      | 2.8 µs                  |
+ *
+ * The table can be generated with @ref crc_table_init, either into RAM on
+ * start up or once on the host to be stored in flash.
+ *
+ * @{
+ *
+ * @file
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "compiler_hints.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Parameters of a CRC
+ */
+typedef struct {
+    uint32_t poly;          /**< polynomial, not reflected, without the
+                                 highest bit */
+    uint32_t init;          /**< initial value, not reflected */
+    uint32_t xorout;        /**< value XORed to the result */
+    const uint32_t *table;  /**< look-up table, NULL for none */
+    uint8_t width;          /**< number of bits of the CRC, 1 to 32 */
+    uint8_t table_bits;     /**< bits per look-up, 0, 4 or 8 */
+    bool reflected;         /**< input and output are reflected */
+} crc_params_t;
+
+/**
+ * @brief   Static initializer for @ref crc_params_t without look-up table
+ *
+ * @param[in] width     number of bits of the CRC
+ * @param[in] poly      polynomial, not reflected
+ * @param[in] init      initial value, not reflected
+ * @param[in] xorout    value XORed to the result
+ * @param[in] reflected whether input and output are reflected
+ */
+#define CRC_PARAMS_INIT(width, poly, init, xorout, reflected) \
+    CRC_PARAMS_INIT_TABLE(width, poly, init, xorout, reflected, NULL, 0)
+
+/**
+ * @brief   Static initializer for @ref crc_params_t with look-up table
+ *
+ * @param[in] width     number of bits of the CRC
+ * @param[in] poly      polynomial, not reflected
+ * @param[in] init      initial value, not reflected
+ * @param[in] xorout    value XORed to the result
+ * @param[in] reflected whether input and output are reflected
+ * @param[in] table     look-up table with `1 << table_bits` entries, see
+ *                      @ref crc_table_init
+ * @param[in] table_bits 4 or 8
+ */
+#define CRC_PARAMS_INIT_TABLE(width, poly, init, xorout, reflected, table, \
+                              table_bits)                                  \
+    { (poly), (init), (xorout), (table), (width), (table_bits), (reflected) }
+
+/**
+ * @brief   Generate the look-up table for a CRC
+ *
+ * The table and the number of table bits in @p params are ignored.
+ *
+ * @param[in]  params   parameters of the CRC
+ * @param[out] table    table with `1 << table_bits` entries
+ * @param[in]  table_bits 4 or 8
+ */
+void crc_table_init(const crc_params_t *params, uint32_t *table,
+                    unsigned table_bits);
+
+/**
+ * @brief   Start a CRC calculation
+ *
+ * @param[in] params    parameters of the CRC
+ *
+ * @return  state of the calculation
+ */
+uint32_t crc_init(const crc_params_t *params);
+
+/**
+ * @brief   Add data to a CRC calculation
+ *
+ * @param[in] params    parameters of the CRC
+ * @param[in] crc       state from @ref crc_init or @ref crc_update
+ * @param[in] buf       data
+ * @param[in] len       length of the data in bytes
+ *
+ * @return  state of the calculation
+ */
+ACCESS(read_only, 3, 4)
+uint32_t crc_update(const crc_params_t *params, uint32_t crc,
+                    const void *buf, size_t len);
+
+/**
+ * @brief   Finish a CRC calculation
+ *
+ * @param[in] params    parameters of the CRC
+ * @param[in] crc       state from @ref crc_update
+ *
+ * @return  the CRC
+ */
+uint32_t crc_finish(const crc_params_t *params, uint32_t crc);
+
+/**
+ * @brief   Calculate the CRC of a buffer
+ *
+ * @param[in] params    parameters of the CRC
+ * @param[in] buf       data
+ * @param[in] len       length of the data in bytes
+ *
+ * @return  the CRC
+ */
+ACCESS(read_only, 2, 3)
+static inline uint32_t crc_calc(const crc_params_t *params,
+                                const void *buf, size_t len)
+{
+    return crc_finish(params, crc_update(params, crc_init(params), buf, len));
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -10,6 +10,20 @@
  * @ingroup     sys_checksum
  *
  * @brief       CRC32 checksum algorithm implementation according to IEEE standards
+ *
+ * The implementation is chosen by module, trading code size for speed:
+ *
+ * | module         | table size | time per KiB (native64) |
+ * |----------------|------------|-------------------------|
+ * | (none)         | none       | 30 µs                   |
+ * | `crc32_nibble` | 64 bytes   | 9 µs                    |
+ * | `crc32_fast`   | 1 KiB      | 2.9 µs                  |
+ * | `crc32_slice8` | 8 KiB      | 0.7 µs                  |
+ *
+ * `crc32_slice8` processes eight bytes per step, the others one. Use
+ * `tests/bench/sys_checksum` to compare them on a board. See
+ * @ref sys_checksum_crc for other CRCs.
+ *
  * @{
  *
  * @file
@@ -25,14 +39,45 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Start a CRC-32 calculation
+ *
+ * @return  state of the calculation
+ */
+static inline uint32_t crc32_init(void)
+{
+    return ~0U;
+}
+
+/**
+ * @brief   Add data to a CRC-32 calculation
+ *
+ * @param[in] crc   state from @ref crc32_init or @ref crc32_update
+ * @param[in] buf   The data to checksum
+ * @param[in] len   Length of the data in bytes
+ *
+ * @return  state of the calculation
+ */
+ACCESS(read_only, 2, 3)
+uint32_t crc32_update(uint32_t crc, const void *buf, size_t len);
+
+/**
+ * @brief   Finish a CRC-32 calculation
+ *
+ * @param[in] crc   state from @ref crc32_update
+ *
+ * @return  the CRC-32 of all data
+ */
+static inline uint32_t crc32_finish(uint32_t crc)
+{
+    return ~crc;
+}
+
 /**
  * @brief   CRC-32 checksum
  *
  * Uses the `0xedb88320` polynomial
  *
- * @note Enable the `crc32_fast` module for a look-up table based implementation
- *       that trades code size for speed.
- *
  * @param[in] buf   The data to checksum
  * @param[in] size  Length of the data in bytes
  *
@@ -0,0 +1,218 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_decompress Streaming decompression
+ * @ingroup     sys_compression
+ * @brief       Common streaming interface to the decompression packages
+ *
+ * This module decodes compressed data that arrives in chunks of any size,
+ * e.g. a firmware image received block by block, with a fixed amount of RAM.
+ * Decoded data is handed to a callback as soon as it is available.
+ *
+ * The codecs are selected with pseudomodules:
+ *
+ * | Module                    | Package           | Stream format          |
+ * |---------------------------|-------------------|------------------------|
+ * | `decompress_heatshrink`   | @ref pkg_heatshrink | raw heatshrink stream |
+ * | `decompress_lz4`          | @ref pkg_lz4      | length prefixed blocks |
+ *
+ * A heatshrink stream must have been created with the window and lookahead
+ * sizes the package is built with (`HEATSHRINK_STATIC_WINDOW_BITS` and
+ * `HEATSHRINK_STATIC_LOOKAHEAD_BITS`, 8 and 4 by default), e.g. with
+ * `heatshrink -e -w 8 -l 4`.
+ *
+ * An LZ4 stream is a sequence of blocks that were compressed independently
+ * (e.g. with `LZ4_compress_default()` or `lz4.block.compress(data,
+ * store_size=False)` in Python), each preceded by its compressed length as a
+ * 16 bit little endian integer. A block must not decompress to more than
+ * @ref CONFIG_DECOMPRESS_LZ4_BLOCKSIZE bytes.
+ *
+ * `pkg_uzlib` is not supported: its decoder pulls its input from a buffer
+ * holding the complete stream and needs a window of up to 32 KiB.
+ *
+ * ## Self describing streams
+ *
+ * Where compressed and uncompressed data have to be told apart, e.g. for
+ * firmware updates, the stream is preceded by a @ref decompress_hdr_t that
+ * names the codec and the size of the decoded data. @ref decompress_hdr_parse
+ * checks for it.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Streaming decompression interface
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(MODULE_DECOMPRESS_HEATSHRINK) || defined(DOXYGEN)
+#include "heatshrink_decoder.h"
+#endif
+#if defined(MODULE_DECOMPRESS_LZ4) || defined(DOXYGEN)
+#include "lz4.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the output buffer of the heatshrink decoder
+ */
+#ifndef CONFIG_DECOMPRESS_HEATSHRINK_OUTBUF
+#define CONFIG_DECOMPRESS_HEATSHRINK_OUTBUF     (64U)
+#endif
+
+/**
+ * @brief   Maximum decompressed size of an LZ4 block
+ */
+#ifndef CONFIG_DECOMPRESS_LZ4_BLOCKSIZE
+#define CONFIG_DECOMPRESS_LZ4_BLOCKSIZE         (512U)
+#endif
+
+/**
+ * @brief   Magic number at the start of a @ref decompress_hdr_t
+ */
+#define DECOMPRESS_HDR_MAGIC                    "RZIP"
+
+/**
+ * @brief   Supported codecs
+ */
+typedef enum {
+    DECOMPRESS_CODEC_HEATSHRINK = 1,    /**< heatshrink */
+    DECOMPRESS_CODEC_LZ4        = 2,    /**< LZ4 blocks */
+} decompress_codec_t;
+
+/**
+ * @brief   Header of a self describing compressed stream
+ *
+ * All fields are little endian.
+ */
+typedef struct __attribute__((packed)) {
+    char magic[4];          /**< @ref DECOMPRESS_HDR_MAGIC */
+    uint8_t codec;          /**< @ref decompress_codec_t */
+    /**
+     * @brief   Codec parameters
+     *
+     * heatshrink: window bits in the upper, lookahead bits in the lower
+     * nibble. LZ4: log2 of the maximum decompressed block size.
+     */
+    uint8_t param;
+    uint16_t reserved;      /**< must be 0 */
+    uint32_t size;          /**< size of the decoded data */
+} decompress_hdr_t;
+
+/**
+ * @brief   Callback receiving the decoded data
+ *
+ * @param[in]   arg     context passed to @ref decompress_init
+ * @param[in]   buf     decoded data
+ * @param[in]   len     length of @p buf
+ *
+ * @returns     0 on success
+ * @returns     negative errno on error, which is returned by
+ *              @ref decompress_feed or @ref decompress_finish
+ */
+typedef int (*decompress_write_cb_t)(void *arg, const uint8_t *buf, size_t len);
+
+/**
+ * @brief   Decompression context
+ */
+typedef struct {
+    decompress_write_cb_t write;    /**< output callback */
+    void *arg;                      /**< output callback context */
+    uint32_t in_bytes;              /**< compressed bytes consumed */
+    uint32_t out_bytes;             /**< decoded bytes produced */
+    uint8_t codec;                  /**< @ref decompress_codec_t in use */
+    /**
+     * @brief   Codec state
+     */
+    union {
+#if defined(MODULE_DECOMPRESS_HEATSHRINK) || defined(DOXYGEN)
+        /**
+         * @brief   heatshrink state
+         */
+        struct {
+            heatshrink_decoder hsd;     /**< decoder */
+            uint8_t out[CONFIG_DECOMPRESS_HEATSHRINK_OUTBUF]; /**< output buffer */
+        } heatshrink;
+#endif
+#if defined(MODULE_DECOMPRESS_LZ4) || defined(DOXYGEN)
+        /**
+         * @brief   LZ4 state
+         */
+        struct {
+            uint16_t fill;              /**< bytes of the current block received */
+            /** length prefix and compressed block */
+            uint8_t in[2 + LZ4_COMPRESSBOUND(CONFIG_DECOMPRESS_LZ4_BLOCKSIZE)];
+            uint8_t out[CONFIG_DECOMPRESS_LZ4_BLOCKSIZE]; /**< decoded block */
+        } lz4;
+#endif
+        uint8_t unused;                 /**< no codec selected */
+    } u;
+} decompress_t;
+
+/**
+ * @brief   Prepare decoding a new stream
+ *
+ * @param[out]  ctx     context to initialize
+ * @param[in]   codec   codec of the stream
+ * @param[in]   write   called with the decoded data
+ * @param[in]   arg     context passed to @p write
+ *
+ * @returns     0 on success
+ * @returns     -ENOTSUP if @p codec was not compiled in
+ */
+int decompress_init(decompress_t *ctx, decompress_codec_t codec,
+                    decompress_write_cb_t write, void *arg);
+
+/**
+ * @brief   Decode the next chunk of a stream
+ *
+ * @param[in,out]   ctx     decompression context
+ * @param[in]       data    compressed data
+ * @param[in]       len     length of @p data
+ *
+ * @returns     0 on success
+ * @returns     -EBADMSG if the stream is corrupt
+ * @returns     error returned by the write callback
+ */
+int decompress_feed(decompress_t *ctx, const void *data, size_t len);
+
+/**
+ * @brief   Decode the remaining data at the end of a stream
+ *
+ * @param[in,out]   ctx     decompression context
+ *
+ * @returns     0 on success
+ * @returns     -EBADMSG if the stream is truncated
+ * @returns     error returned by the write callback
+ */
+int decompress_finish(decompress_t *ctx);
+
+/**
+ * @brief   Check for a @ref decompress_hdr_t at the start of a buffer
+ *
+ * @param[in]   buf     start of the data
+ * @param[in]   len     length of @p buf
+ * @param[out]  codec   codec of the stream
+ * @param[out]  size    size of the decoded data
+ *
+ * @returns     size of the header, the compressed stream follows it
+ * @returns     -EINVAL if @p buf doesn't start with a header
+ * @returns     -ENOTSUP if the codec or its parameters are not supported
+ */
+int decompress_hdr_parse(const void *buf, size_t len,
+                         decompress_codec_t *codec, uint32_t *size);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -0,0 +1,96 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup  sys_fs_zconstfs Compressed ConstFS static file system
+ * @ingroup   sys_fs
+ * @brief     Read-only file system with compressed file contents in arrays
+ *
+ * Like @ref sys_fs_constfs, but the contents of the files are stored
+ * compressed with one of the codecs of @ref sys_decompress and are decoded on
+ * @ref vfs_read.
+ *
+ * Every file is split into blocks of @ref CONFIG_ZCONSTFS_BLOCKSIZE bytes
+ * (the last one may be shorter) that are compressed independently, so any
+ * position of a file can be read by decoding a single block.
+ * The compressed blocks are stored back to back in
+ * @ref zconstfs_file_t::data, their offsets in @ref zconstfs_file_t::blocks.
+ *
+ * Decoded blocks are kept in a cache of @ref CONFIG_ZCONSTFS_CACHE_BLOCKS
+ * entries shared by all zconstfs mounts, so reading a file sequentially in
+ * small chunks decodes every block only once.
+ *
+ * `dist/tools/decompress/mkzconstfs.py` creates the C source of a zconstfs
+ * image from a directory.
+ *
+ * @{
+ * @file
+ * @brief   ZConstFS public API
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "decompress.h"
+#include "vfs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Decoded size of a block
+ *
+ * Must match the block size the image was created with.
+ */
+#ifndef CONFIG_ZCONSTFS_BLOCKSIZE
+#define CONFIG_ZCONSTFS_BLOCKSIZE       (512U)
+#endif
+
+/**
+ * @brief   Number of decoded blocks kept in RAM
+ */
+#ifndef CONFIG_ZCONSTFS_CACHE_BLOCKS
+#define CONFIG_ZCONSTFS_CACHE_BLOCKS    (2U)
+#endif
+
+/**
+ * @brief A file in ZConstFS (file name + compressed contents)
+ */
+typedef struct {
+    const char *path;       /**< file system relative path to file */
+    const size_t size;      /**< decoded length of the file */
+    const void *data;       /**< compressed blocks */
+    /**
+     * @brief   Offsets of the compressed blocks in @ref data
+     *
+     * Holds one entry per block plus the total length of @ref data.
+     */
+    const uint32_t *blocks;
+} zconstfs_file_t;
+
+/**
+ * @brief ZConstFS file system superblock
+ */
+typedef struct {
+    const size_t nfiles;            /**< Number of files */
+    const zconstfs_file_t *files;   /**< Files array */
+    const decompress_codec_t codec; /**< codec of all blocks */
+} zconstfs_t;
+
+/**
+ * @brief ZConstFS file system driver
+ *
+ * For use with vfs_mount
+ */
+extern const vfs_file_system_t zconstfs_file_system;
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -138,6 +138,34 @@ uint32_t dek_hash(const uint8_t *buf, size_t len);
  */
 uint32_t fnv_hash(const uint8_t *buf, size_t len);
 
+/**
+ * @brief   Initial value of a 32-bit FNV-1a hash, see @ref fnv1a_32
+ */
+#define FNV1A_32_INIT   (2166136261U)
+
+/**
+ * @brief   32-bit FNV-1a hash
+ * @ingroup sys_hashes_fnv
+ *
+ * Unlike @ref fnv_hash, this is the FNV-1a variant with the offset basis and
+ * prime of the specification. Several buffers can be hashed as one by
+ * passing the result of one call as @p hash of the next call.
+ *
+ * @param hash  hash to continue, @ref FNV1A_32_INIT for a new hash
+ * @param buf   input buffer to hash
+ * @param len   length of buffer
+ * @return 32 bit sized hash
+ */
+static inline uint32_t fnv1a_32(uint32_t hash, const void *buf, size_t len)
+{
+    const uint8_t *bytes = (const uint8_t *)buf;
+
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ bytes[i]) * 16777619U;
+    }
+    return hash;
+}
+
 /**
  * @defgroup sys_hashes_rotating Rotating
  * @ingroup sys_hashes_non_crypto
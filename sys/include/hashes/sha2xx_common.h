@@ -44,6 +44,17 @@ typedef struct {
     unsigned char buf[64];
 } sha2xx_context_t;
 
+/**
+ * @brief SHA-2XX block compression function
+ *
+ * Processes one block that is already split into words, e.g. a block whose
+ * layout is known in advance. @ref sha2xx_update should be used otherwise.
+ *
+ * @param state    hash state to update
+ * @param block    the 16 words of the block in host byte order, overwritten
+ */
+void sha2xx_compress(uint32_t *state, uint32_t block[16]);
+
 /**
  * @brief SHA-2XX initialization.  Begins a SHA-2XX operation.
  *
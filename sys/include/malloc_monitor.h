@@ -41,10 +41,32 @@ size_t malloc_monitor_get_usage_high_watermark(void);
  *
  * After calling this function, @ref malloc_monitor_get_usage_high_watermark()
  * will return @ref malloc_monitor_get_usage_current() until further changes
- * to heap memory usage.
+ * to heap memory usage. The same applies to
+ * @ref malloc_monitor_get_fragmentation_high_watermark().
  */
 void malloc_monitor_reset_high_watermark(void);
 
+/**
+ * @brief Obtain current internal fragmentation of the heap memory.
+ *
+ * Allocations served by @ref sys_malloc_pool are rounded up to the block size
+ * of their size class. The internal fragmentation is the sum of the bytes
+ * by which the currently allocated memory was rounded up. It is not included
+ * in @ref malloc_monitor_get_usage_current().
+ *
+ * @return      current internal fragmentation in bytes, always 0 if
+ *              @ref sys_malloc_pool is not used
+ */
+size_t malloc_monitor_get_fragmentation_current(void);
+
+/**
+ * @brief Obtain maximum internal fragmentation of the heap memory since last
+ *        call to @ref malloc_monitor_reset_high_watermark().
+ *
+ * @return      maximum internal fragmentation in bytes
+ */
+size_t malloc_monitor_get_fragmentation_high_watermark(void);
+
 #ifdef __cplusplus
 }
 #endif
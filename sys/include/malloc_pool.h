@@ -0,0 +1,230 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_malloc_pool Size-class pool allocator
+ * @ingroup     sys_memory_management
+ * @brief       Serves small heap allocations from fixed-size block pools
+ *
+ * This module places a set of @ref sys_memarray pools in front of the C
+ * library's allocator. Each pool (a *size class*) holds
+ * @ref CONFIG_MALLOC_POOL_BLOCKS_NUMOF blocks. The block size of the smallest
+ * class is @ref CONFIG_MALLOC_POOL_BLOCK_SIZE_MIN and doubles with every
+ * further class.
+ *
+ * Calls to @ref malloc(), @ref calloc(), @ref realloc() and @ref free() are
+ * routed through the pools by the wrappers of @ref sys_malloc_ts (or the
+ * wrappers of `native`, respectively): A request is served from the smallest
+ * class whose blocks are large enough. If there is no such class or it has no
+ * free block left, the request falls back to the C library's allocator.
+ * Allocating and freeing a pool block are constant-time operations and the
+ * pools do not fragment the heap. The wrappers of @ref sys_malloc_ts still
+ * hold their lock while using the pools, so that the bookkeeping of
+ * @ref sys_malloc_monitor stays consistent with the allocator state, but the
+ * pools themselves only need a short critical section.
+ *
+ * With the `malloc_pool_tcache` module, every thread additionally keeps up to
+ * @ref CONFIG_MALLOC_POOL_TCACHE_SIZE freed blocks per class in a thread-local
+ * free list. Those blocks are handed out again to the same thread without
+ * entering a critical section. A thread that terminates should return its cached
+ * blocks with @ref malloc_pool_tcache_flush() first.
+ *
+ * The pools can be bypassed at runtime with @ref malloc_pool_enable(), e.g.
+ * to compare them with the C library's allocator. Blocks that were handed out
+ * while the pools were enabled can still be freed afterwards.
+ *
+ * Blocks are rounded up to the block size of their class. When
+ * @ref sys_malloc_monitor is used, the resulting internal fragmentation is
+ * reported by @ref malloc_monitor_get_fragmentation_current().
+ *
+ * @{
+ *
+ * @file
+ * @brief       Size-class pool allocator definitions
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sys_malloc_pool_conf  Size-class pool allocator compile configurations
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief   Number of size classes
+ */
+#ifndef CONFIG_MALLOC_POOL_CLASS_NUMOF
+#define CONFIG_MALLOC_POOL_CLASS_NUMOF      (4U)
+#endif
+
+/**
+ * @brief   Block size of the smallest size class in bytes
+ *
+ * @note    Must be a power of two and a multiple of the alignment `malloc()`
+ *          guarantees, i.e. `alignof(max_align_t)`.
+ */
+#ifndef CONFIG_MALLOC_POOL_BLOCK_SIZE_MIN
+#define CONFIG_MALLOC_POOL_BLOCK_SIZE_MIN   (16U)
+#endif
+
+/**
+ * @brief   Number of blocks per size class
+ */
+#ifndef CONFIG_MALLOC_POOL_BLOCKS_NUMOF
+#define CONFIG_MALLOC_POOL_BLOCKS_NUMOF     (16U)
+#endif
+
+/**
+ * @brief   Maximum number of blocks per size class a thread keeps in its cache
+ *
+ * @note    Only used with the `malloc_pool_tcache` module.
+ */
+#ifndef CONFIG_MALLOC_POOL_TCACHE_SIZE
+#define CONFIG_MALLOC_POOL_TCACHE_SIZE      (4U)
+#endif
+/** @} */
+
+/**
+ * @brief   Block size of the largest size class in bytes
+ */
+#define MALLOC_POOL_BLOCK_SIZE_MAX  (CONFIG_MALLOC_POOL_BLOCK_SIZE_MIN << \
+                                     (CONFIG_MALLOC_POOL_CLASS_NUMOF - 1))
+
+/**
+ * @brief   Statistics of a size class
+ */
+typedef struct {
+    size_t block_size;      /**< size of the blocks of the class */
+    uint16_t blocks;        /**< number of blocks of the class */
+    uint16_t used;          /**< number of blocks currently in use or held in
+                             *   a per-thread cache */
+    uint16_t peak;          /**< maximum of @ref malloc_pool_stats_t::used */
+    uint32_t allocs;        /**< number of blocks taken from the pool */
+    uint32_t cache_hits;    /**< number of blocks taken from a per-thread
+                             *   cache instead of the pool */
+    uint32_t exhausted;     /**< number of requests that fell back to the C
+                             *   library since the class had no free block */
+} malloc_pool_stats_t;
+
+/**
+ * @brief   Allocates a block from the pools
+ *
+ * @note    Usually called through @ref malloc().
+ *
+ * @param[in] size  Requested size in bytes.
+ *
+ * @return  A block of at least @p size bytes.
+ * @return  NULL, if the pools are disabled, @p size exceeds
+ *          @ref MALLOC_POOL_BLOCK_SIZE_MAX, or the matching size class has no
+ *          free block left.
+ */
+void *malloc_pool_alloc(size_t size);
+
+/**
+ * @brief   Frees a block allocated by @ref malloc_pool_alloc()
+ *
+ * @note    Usually called through @ref free().
+ *
+ * @param[in] ptr   A pointer. May be NULL.
+ *
+ * @return  true, if @p ptr was a pool block and has been freed.
+ * @return  false, if @p ptr is not a pool block.
+ */
+bool malloc_pool_free(void *ptr);
+
+/**
+ * @brief   Resizes a block allocated by @ref malloc_pool_alloc()
+ *
+ * If @p size still fits into the block, the block is returned unchanged.
+ * Otherwise the content is moved to a block of a larger class.
+ *
+ * @note    Usually called through @ref realloc().
+ *
+ * @pre     @p ptr is a pool block.
+ *
+ * @param[in] ptr   A pool block.
+ * @param[in] size  New size in bytes.
+ *
+ * @return  The resized block.
+ * @return  NULL, if no larger pool block is available. @p ptr is left
+ *          untouched in that case.
+ */
+void *malloc_pool_realloc(void *ptr, size_t size);
+
+/**
+ * @brief   Gets the block size of a pool block
+ *
+ * @param[in] ptr   A pointer.
+ *
+ * @return  The block size of the class @p ptr belongs to.
+ * @return  0, if @p ptr is not a pool block.
+ */
+size_t malloc_pool_block_size(const void *ptr);
+
+/**
+ * @brief   Enables or disables allocations from the pools
+ *
+ * The pools are enabled by default. While they are disabled, all allocations
+ * are served by the C library. Freeing pool blocks is always possible.
+ *
+ * @param[in] enable    true to enable, false to disable the pools.
+ */
+void malloc_pool_enable(bool enable);
+
+/**
+ * @brief   Checks if allocations are served from the pools
+ *
+ * @return  true, if the pools are enabled.
+ */
+bool malloc_pool_is_enabled(void);
+
+/**
+ * @brief   Returns the blocks in the cache of the calling thread to the pools
+ *
+ * @note    Only has an effect with the `malloc_pool_tcache` module.
+ */
+void malloc_pool_tcache_flush(void);
+
+/**
+ * @brief   Gets the statistics of a size class
+ *
+ * @param[in] cls       A size class, smaller than
+ *                      @ref CONFIG_MALLOC_POOL_CLASS_NUMOF.
+ * @param[out] stats    The statistics of @p cls.
+ *
+ * @return  0 on success.
+ * @return  -EINVAL, if @p cls does not exist.
+ */
+int malloc_pool_get_stats(unsigned cls, malloc_pool_stats_t *stats);
+
+/**
+ * @brief   Gets the number of requests larger than
+ *          @ref MALLOC_POOL_BLOCK_SIZE_MAX
+ *
+ * @return  The number of requests that were handed to the C library since
+ *          no size class is large enough.
+ */
+uint32_t malloc_pool_get_oversized(void);
+
+/**
+ * @brief   Resets the statistics of all size classes
+ *
+ * @ref malloc_pool_stats_t::peak is reset to @ref malloc_pool_stats_t::used.
+ */
+void malloc_pool_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -355,6 +355,11 @@
  * are available the server destroys the session that has not been used for the
  * longest time after CONFIG_GCOAP_DTLS_MINIMUM_AVAILABLE_SESSIONS_TIMEOUT_USEC.
  *
+ * With the pseudomodule `sock_dtls_session_cache`, the DTLS sock closes the least
+ * recently used session itself when a new client needs its slot, so sessions of
+ * clients that come back are kept as long as possible. GCoAP then doesn't free up
+ * sessions on a timeout.
+ *
  * ## Implementation Notes ##
  *
  * ### Waiting for a response ###
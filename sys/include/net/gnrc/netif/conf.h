@@ -76,6 +76,44 @@ extern "C" {
 #define CONFIG_GNRC_NETIF_PKTQ_TIMER_US       (5000U)
 #endif
 
+/**
+ * @brief       Number of flow queues of the fair queueing scheduler of each
+ *              network interface
+ *
+ * Flows are hashed onto the flow queues, so flows may share a queue if there
+ * are more flows than queues.
+ *
+ * @see         net_gnrc_netif_pktq_fq
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS
+#define CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS       (4U)
+#endif
+
+/**
+ * @brief       Number of bytes a flow queue of the fair queueing scheduler may
+ *              send per round
+ *
+ * The default fits one IEEE 802.15.4 frame.
+ *
+ * @see         net_gnrc_netif_pktq_fq
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTQ_FQ_QUANTUM
+#define CONFIG_GNRC_NETIF_PKTQ_FQ_QUANTUM     (127U)
+#endif
+
+/**
+ * @brief       Only drop packets that do not fit into the packet queue pool
+ *
+ * By default, when the packet queue pool is depleted, the fair queueing
+ * scheduler drops the oldest packet of the longest flow queue of the
+ * interface, unless the new packet belongs to that flow queue.
+ *
+ * @see         net_gnrc_netif_pktq_fq
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTQ_FQ_TAIL_DROP
+#define CONFIG_GNRC_NETIF_PKTQ_FQ_TAIL_DROP   0
+#endif
+
 /**
  * @brief   Number of multicast addresses needed for @ref net_gnrc_rpl "RPL".
  *
@@ -28,6 +28,35 @@
 extern "C" {
 #endif
 
+/**
+ * @defgroup    net_gnrc_netif_pktq_fq Fair queueing scheduler for @ref net_gnrc_netif_pktq
+ * @ingroup     net_gnrc_netif_pktq
+ * @brief       Priority and fairness among the queued packets of a network interface
+ *
+ * Without this module, the send queue of a network interface is a single
+ * FIFO. A bulk transfer can then fill the whole packet queue pool, so control
+ * traffic and other flows on the same interface have to wait behind it or
+ * are even dropped.
+ *
+ * With `USEMODULE += gnrc_netif_pktq_fq` the queued packets are scheduled as
+ * follows:
+ *
+ * - packets are classified by gnrc_netif_pktq_classify(). Packets of
+ *   @ref GNRC_NETIF_PKTQ_CLASS_CONTROL are always sent first, in FIFO order,
+ * - all other packets are hashed by their flow onto one of
+ *   @ref CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS flow queues, which are served by
+ *   deficit round robin with a quantum of
+ *   @ref CONFIG_GNRC_NETIF_PKTQ_FQ_QUANTUM bytes,
+ * - when the packet queue pool is depleted, the oldest packet of the longest
+ *   flow queue of the interface is dropped to make room for the new packet,
+ *   unless the new packet would be put into that flow queue itself (see
+ *   @ref CONFIG_GNRC_NETIF_PKTQ_FQ_TAIL_DROP). If that packet is a 6LoWPAN
+ *   fragment, the queued remainder of its datagram is dropped with it.
+ *
+ * The per-class statistics are available via gnrc_netif_pktq_stats() and
+ * are shown by `ifconfig`.
+ */
+
 /**
  * @brief   Puts a packet into the packet send queue of a network interface
  *
@@ -40,9 +69,72 @@ extern "C" {
  * @return  0 on success
  * @return  -1 when the pool of available gnrc_pktqueue_t entries (of size
  *          @ref CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE) is depleted
+ *
+ * @note    With @ref net_gnrc_netif_pktq_fq, another packet of @p netif may
+ *          be dropped instead, if the pool is depleted.
  */
 int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
 
+/**
+ * @brief   Classifies a packet for @ref net_gnrc_netif_pktq_fq
+ *
+ * Link-layer multicast and broadcast frames as well as neighbor discovery
+ * (including 6LoWPAN-ND) and RPL messages (also when 6LoWPAN compressed) are
+ * of @ref GNRC_NETIF_PKTQ_CLASS_CONTROL. All other ICMPv6 messages, e.g. echo
+ * requests, are of @ref GNRC_NETIF_PKTQ_CLASS_DEFAULT.
+ * Flows are distinguished by the link-layer destination, by the IPv6
+ * addresses of uncompressed IPv6 packets, and by whether the frame is a
+ * 6LoWPAN fragment.
+ *
+ * @pre `pkt != NULL` and `pkt` starts with a @ref gnrc_netif_hdr_t snip.
+ *
+ * @param[in] pkt   A packet to send.
+ * @param[out] flow A hash identifying the flow of @p pkt. May be NULL.
+ *
+ * @return  The traffic class of @p pkt.
+ */
+unsigned gnrc_netif_pktq_classify(const gnrc_pktsnip_t *pkt, uint32_t *flow);
+
+/**
+ * @brief   Gets the statistics of a traffic class of a network interface's
+ *          packet send queue
+ *
+ * @pre `netif != NULL`
+ * @pre `cls < GNRC_NETIF_PKTQ_CLASS_NUMOF`
+ *
+ * @param[in] netif A network interface. May not be NULL.
+ * @param[in] cls   A traffic class.
+ *
+ * @return  The statistics of @p cls.
+ * @return  NULL, if @ref net_gnrc_netif_pktq_fq is not used.
+ */
+static inline const gnrc_netif_pktq_stats_t *gnrc_netif_pktq_stats(
+        const gnrc_netif_t *netif, unsigned cls)
+{
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+    assert(netif != NULL);
+    assert(cls < GNRC_NETIF_PKTQ_CLASS_NUMOF);
+    return &netif->send_queue.stats[cls];
+#else
+    (void)netif;
+    (void)cls;
+    return NULL;
+#endif
+}
+
+/**
+ * @brief   Gets a packet from the fair queueing scheduler of a network
+ *          interface
+ *
+ * @note    Use gnrc_netif_pktq_get() instead.
+ *
+ * @param[in] netif A network interface. May not be NULL.
+ *
+ * @return  A packet on success
+ * @return  NULL when the queue is empty
+ */
+gnrc_pktsnip_t *gnrc_netif_pktq_fq_get(gnrc_netif_t *netif);
+
 /**
  * @brief   Returns the overall usage of the packet queue resources
  *
@@ -74,6 +166,11 @@ static inline gnrc_pktsnip_t *gnrc_netif_pktq_get(gnrc_netif_t *netif)
         pkt = entry->pkt;
         entry->pkt = NULL;
     }
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+    else {
+        pkt = gnrc_netif_pktq_fq_get(netif);
+    }
+#endif
     return pkt;
 #else   /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
     (void)netif;
@@ -127,6 +224,14 @@ static inline bool gnrc_netif_pktq_empty(gnrc_netif_t *netif)
 #if IS_USED(MODULE_GNRC_NETIF_PKTQ)
     assert(netif != NULL);
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+    const gnrc_netif_pktq_stats_t *stats = netif->send_queue.stats;
+
+    if ((stats[GNRC_NETIF_PKTQ_CLASS_CONTROL].backlog != 0) ||
+        (stats[GNRC_NETIF_PKTQ_CLASS_DEFAULT].backlog != 0)) {
+        return false;
+    }
+#endif
     return (netif->send_queue.queue == NULL);
 #else   /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
     (void)netif;
@@ -20,6 +20,9 @@
  * @author  Martine S. Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <stdint.h>
+
+#include "net/gnrc/netif/conf.h"
 #include "net/gnrc/pktqueue.h"
 #include "xtimer.h"
 
@@ -27,11 +30,78 @@
 extern "C" {
 #endif
 
+/**
+ * @name    Traffic classes of the fair queueing scheduler
+ *
+ * @see     net_gnrc_netif_pktq_fq
+ * @{
+ */
+/**
+ * @brief   Control traffic
+ *
+ * Link-layer multicast and broadcast frames (e.g. RPL DIOs), neighbor
+ * discovery and RPL messages. Always sent before
+ * @ref GNRC_NETIF_PKTQ_CLASS_DEFAULT.
+ */
+#define GNRC_NETIF_PKTQ_CLASS_CONTROL   (0U)
+/**
+ * @brief   All other traffic, scheduled by deficit round robin across flows
+ */
+#define GNRC_NETIF_PKTQ_CLASS_DEFAULT   (1U)
+#define GNRC_NETIF_PKTQ_CLASS_NUMOF     (2U)    /**< number of traffic classes */
+/** @} */
+
+/**
+ * @brief   Statistics of a traffic class of the fair queueing scheduler
+ *
+ * @see     net_gnrc_netif_pktq_fq
+ */
+typedef struct {
+    uint32_t queued;            /**< packets put into the queue */
+    uint32_t sent;              /**< packets taken from the queue for sending */
+    uint32_t dropped;           /**< packets dropped since the packet queue
+                                 *   pool was depleted */
+    uint16_t backlog;           /**< packets currently in the queue */
+    uint16_t backlog_max;       /**< maximum number of packets in the queue */
+} gnrc_netif_pktq_stats_t;
+
+/**
+ * @brief   A flow queue of the fair queueing scheduler
+ *
+ * @see     net_gnrc_netif_pktq_fq
+ */
+typedef struct {
+    gnrc_pktqueue_t *queue;     /**< packets of the flow queue */
+    int32_t deficit;            /**< bytes the flow queue may still send in
+                                 *   this round */
+    uint8_t len;                /**< number of packets in gnrc_netif_pktq_flow_t::queue,
+                                 *   hence @ref CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE
+                                 *   must not exceed 255 */
+} gnrc_netif_pktq_flow_t;
+
 /**
  * @brief   A packet queue for @ref net_gnrc_netif with a de-queue timer
  */
 typedef struct {
-    gnrc_pktqueue_t *queue;     /**< the actual packet queue class */
+    /**
+     * @brief   the actual packet queue class
+     *
+     * With @ref net_gnrc_netif_pktq_fq this only holds packets that were
+     * pushed back, which are always sent first.
+     */
+    gnrc_pktqueue_t *queue;
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ) || defined(DOXYGEN)
+    gnrc_pktqueue_t *control;   /**< queue of @ref GNRC_NETIF_PKTQ_CLASS_CONTROL */
+    /**
+     * @brief   flow queues of @ref GNRC_NETIF_PKTQ_CLASS_DEFAULT
+     */
+    gnrc_netif_pktq_flow_t flows[CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS];
+    /**
+     * @brief   statistics per traffic class
+     */
+    gnrc_netif_pktq_stats_t stats[GNRC_NETIF_PKTQ_CLASS_NUMOF];
+    uint8_t flow;               /**< current flow queue of the round robin */
+#endif
 #if CONFIG_GNRC_NETIF_PKTQ_TIMER_US >= 0
     msg_t dequeue_msg;          /**< message for gnrc_netif_pktq_t::dequeue_timer to send */
     xtimer_t dequeue_timer;     /**< timer to schedule next sending of
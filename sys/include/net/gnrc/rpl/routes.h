@@ -0,0 +1,209 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    net_gnrc_rpl_routes RPL storing mode route store
+ * @ingroup     net_gnrc_rpl
+ * @brief       Downward routes of a storing mode RPL router
+ *
+ * Keeps the DAO targets learned from the sub-DODAG in a table that is indexed
+ * by a hash over the target prefix, so a DAO target is matched to its route
+ * without walking the NIB's forwarding table. The route store decides which
+ * DAO targets actually change the forwarding table of the
+ * [NIB](@ref net_gnrc_ipv6_nib):
+ *
+ * - a DAO that only refreshes a target with the same next hop only refreshes
+ *   the lifetime of the corresponding forwarding table entry instead of
+ *   removing and re-adding it,
+ * - two targets of the same length that only differ in their last prefix bit
+ *   (e.g. `2001:db8::2/128` and `2001:db8::3/128`) and share the same next
+ *   hop are installed as one aggregated forwarding table entry (e.g.
+ *   `2001:db8::2/127`). Since DAOs are built from the forwarding table, the
+ *   aggregate is also what is advertised further up the DODAG. When an
+ *   aggregate is split again, it is withdrawn with a No-Path DAO before its
+ *   halves are advertised (see @ref gnrc_rpl_routes_pop_withdrawn()).
+ *
+ * Packets to a destination that has a host route (i.e. a `/128` target) in
+ * the route store are forwarded via the route store's hash table instead of
+ * walking the NIB's off-link entries: A host route is the longest possible
+ * match, so the NIB would not find a more specific route. All other
+ * destinations are still looked up in the NIB.
+ *
+ * When the module is used, a received DAO that did not add, move or remove any
+ * route does not trigger a (delayed) DAO of this node, so refreshes of the
+ * sub-DODAG do not cause route churn further up the DODAG.
+ *
+ * @{
+ *
+ * @file
+ * @brief       RPL storing mode route store definitions
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "net/ipv6/addr.h"
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup net_gnrc_rpl_routes_conf  RPL route store compile configurations
+ * @ingroup  net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Maximum number of routes in the route store
+ *
+ * @note    Must be smaller than 255.
+ */
+#ifndef CONFIG_GNRC_RPL_ROUTES_NUMOF
+#define CONFIG_GNRC_RPL_ROUTES_NUMOF            (32U)
+#endif
+
+/**
+ * @brief   Maximum number of distinct next hops (i.e. children) of the routes
+ *          in the route store
+ *
+ * @note    Must be smaller than 255.
+ */
+#ifndef CONFIG_GNRC_RPL_ROUTES_NEXT_HOP_NUMOF
+#define CONFIG_GNRC_RPL_ROUTES_NEXT_HOP_NUMOF   (16U)
+#endif
+
+/**
+ * @brief   Maximum number of split aggregates waiting to be withdrawn by a
+ *          No-Path DAO
+ *
+ * If there is no space left, the parent's route to a split aggregate only
+ * expires.
+ */
+#ifndef CONFIG_GNRC_RPL_ROUTES_WITHDRAWN_NUMOF
+#define CONFIG_GNRC_RPL_ROUTES_WITHDRAWN_NUMOF  (4U)
+#endif
+/** @} */
+
+/**
+ * @name    Results of @ref gnrc_rpl_routes_update()
+ * @{
+ */
+#define GNRC_RPL_ROUTES_REFRESHED   (0)     /**< lifetime of route was refreshed */
+#define GNRC_RPL_ROUTES_ADDED       (1)     /**< route was added */
+#define GNRC_RPL_ROUTES_MOVED       (2)     /**< route changed its next hop */
+#define GNRC_RPL_ROUTES_REMOVED     (3)     /**< route was removed */
+/** @} */
+
+/**
+ * @brief   Statistics of the route store
+ */
+typedef struct {
+    uint32_t lookups;       /**< number of route look-ups */
+    uint32_t probes;        /**< number of entries compared during look-ups */
+    uint32_t refreshes;     /**< number of updates only refreshing the lifetime */
+    uint32_t changes;       /**< number of updates adding, moving or removing
+                             *   a route */
+    uint32_t nib_ops;       /**< number of forwarding table additions and
+                             *   removals */
+    uint16_t routes;        /**< current number of routes */
+    uint16_t routes_max;    /**< maximum number of routes since the last reset */
+    uint16_t next_hops;     /**< current number of distinct next hops */
+    uint16_t aggregated;    /**< current number of routes installed as part of
+                             *   an aggregated forwarding table entry */
+    uint16_t full;          /**< number of routes dropped since the route
+                             *   store or the next hop table were full, and
+                             *   of split aggregates that could not be
+                             *   withdrawn */
+} gnrc_rpl_routes_stats_t;
+
+/**
+ * @brief   Adds, refreshes, moves or removes a route in the route store and
+ *          updates the forwarding table accordingly
+ *
+ * @param[in] target        A DAO target.
+ * @param[in] target_len    Prefix length of @p target in bits.
+ * @param[in] next_hop      The next hop towards @p target, i.e. the source of
+ *                          the DAO.
+ * @param[in] iface         The interface to @p next_hop.
+ * @param[in] lifetime      Lifetime of the route in seconds. A lifetime of 0
+ *                          (No-Path DAO) removes the route.
+ *
+ * @return  One of @ref GNRC_RPL_ROUTES_REFRESHED, @ref GNRC_RPL_ROUTES_ADDED,
+ *          @ref GNRC_RPL_ROUTES_MOVED, or @ref GNRC_RPL_ROUTES_REMOVED on
+ *          success.
+ * @return  -EINVAL, if @p target_len is 0 or greater than 128.
+ * @return  -ENOENT, if a route to be removed does not exist.
+ * @return  -ENOMEM, if there is no space left in the route store or its next
+ *          hop table. An existing route to @p target is removed from the
+ *          store and the forwarding table then, so the caller can install
+ *          the new route in the forwarding table directly.
+ */
+int gnrc_rpl_routes_update(const ipv6_addr_t *target, uint8_t target_len,
+                           const ipv6_addr_t *next_hop, kernel_pid_t iface,
+                           uint32_t lifetime);
+
+/**
+ * @brief   Gets the route with the longest matching target for a destination
+ *
+ * Called by the NIB when forwarding a packet, so this does not block if the
+ * route store is currently updated.
+ *
+ * @param[in] dst       A destination address.
+ * @param[out] next_hop The next hop towards @p dst. May be NULL.
+ * @param[out] iface    The interface to @p next_hop. May be NULL.
+ *
+ * @return  The prefix length of the matching target on success.
+ * @return  -ENOENT, if there is no route for @p dst.
+ * @return  -EBUSY, if the route store is currently updated by another thread.
+ */
+int gnrc_rpl_routes_get(const ipv6_addr_t *dst, ipv6_addr_t *next_hop,
+                        kernel_pid_t *iface);
+
+/**
+ * @brief   Gets and forgets an aggregate that was split since the last call
+ *
+ * The parent routes all of an aggregate's targets to this node, so RPL sends a
+ * No-Path DAO for every split aggregate before it advertises the remaining
+ * routes.
+ *
+ * @param[out] target   The target prefix of the split aggregate.
+ *
+ * @return  The prefix length of @p target on success.
+ * @return  -ENOENT, if no aggregate was split.
+ */
+int gnrc_rpl_routes_pop_withdrawn(ipv6_addr_t *target);
+
+/**
+ * @brief   Removes all expired routes
+ *
+ * Called periodically by RPL, so an aggregated forwarding table entry does not
+ * keep an expired route reachable.
+ *
+ * @return  The number of removed routes.
+ */
+unsigned gnrc_rpl_routes_gc(void);
+
+/**
+ * @brief   Removes all routes and resets the statistics
+ *
+ * @note    Routes are also removed from the forwarding table.
+ */
+void gnrc_rpl_routes_reset(void);
+
+/**
+ * @brief   Gets the statistics of the route store
+ *
+ * @return  The statistics of the route store.
+ */
+const gnrc_rpl_routes_stats_t *gnrc_rpl_routes_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
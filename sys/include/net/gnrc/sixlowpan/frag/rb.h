@@ -22,6 +22,7 @@
 #include <stdalign.h>
 
 #include "architecture.h"
+#include "hashes.h"
 #include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/pkt.h"
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
@@ -112,6 +113,30 @@ typedef struct {
 #endif /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) */
 } gnrc_sixlowpan_frag_rb_t;
 
+/**
+ * @brief   Hashes the identifying (source link-layer address, tag) pair of a
+ *          (virtual) reassembly buffer entry
+ *
+ * Used by the reassembly buffer and the virtual reassembly buffer to index
+ * their entries, so fragments can be matched to their entry without comparing
+ * the addresses of all entries.
+ *
+ * @param[in] src       The source link-layer address of the datagram.
+ * @param[in] src_len   Length of @p src.
+ * @param[in] tag       The tag of the datagram.
+ *
+ * @return  A hash value for (@p src, @p tag).
+ */
+static inline uint32_t gnrc_sixlowpan_frag_rb_hash(const uint8_t *src,
+                                                   size_t src_len,
+                                                   uint16_t tag)
+{
+    const uint8_t tag_bytes[] = { tag & 0xff, tag >> 8 };
+
+    return fnv1a_32(fnv1a_32(FNV1A_32_INIT, src, src_len),
+                    tag_bytes, sizeof(tag_bytes));
+}
+
 /**
  * @brief   Adds a new fragment to the reassembly buffer. If the packet is
  *          complete, dispatch the packet with the transmit information of
@@ -83,6 +83,7 @@
 #include "bitarithm.h"
 #include "bitfield.h"
 #include "byteorder.h"
+#include "compiler_hints.h"
 #include "iolist.h"
 #include "macros/utils.h"
 #include "modules.h"
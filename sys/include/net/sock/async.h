@@ -38,6 +38,10 @@ extern "C" {
  *       Should only be called within a DTLS event and session is only available
  *       for the event types @ref SOCK_ASYNC_CONN_RDY and @ref SOCK_ASYNC_CONN_FIN.
  *       For other event types use @ref sock_dtls_recv() to get the session.
+ *       With the pseudomodule `sock_dtls_session_cache`, a session closed by
+ *       the cache is returned once, even if other events came in after its
+ *       @ref SOCK_ASYNC_CONN_FIN. If several of them are pending, the sock
+ *       reports a new @ref SOCK_ASYNC_CONN_FIN for the next one.
  *
  * @param[in]  sock       The DTLS sock object of the current event.
  * @param[out] session    Session object of the current event.
@@ -516,6 +516,36 @@
  * the provided public key is in the list of public keys assigned to the specified sock. This only
  * applies when using ECC ciphersuites (i.e., not PSK).
  *
+ * ### Session cache
+ *
+ * A handshake is by far the most expensive part of a DTLS exchange, but an
+ * established session can be used for as long as both peers keep it. A client
+ * that calls @ref sock_dtls_session_init for a peer it still has a session
+ * with uses that session right away (the function returns 0).
+ *
+ * The number of sessions is limited by @ref CONFIG_DTLS_PEER_MAX. By default,
+ * a session is kept until it is destroyed, and new handshakes fail while all
+ * slots are in use. With the pseudomodule `sock_dtls_session_cache`, sessions
+ * are kept in a cache instead and the least recently used one is closed when
+ * a slot is needed:
+ *
+ * - a client closes the least recently used session before it starts a
+ *   handshake with a new peer. If a server sock is open as well, the slot the
+ *   server keeps free is not taken.
+ * - a server keeps one slot free for the next client. A handshake only
+ *   takes a slot once the client has returned the cookie of the server, so
+ *   spoofed ClientHellos can't take slots. When a handshake takes the last
+ *   free slot, the server reclaims the least recently used other handshake
+ *   of a client that is still pending. Established sessions are only closed
+ *   once a new handshake has completed.
+ * - pending handshakes of clients are closed before established sessions.
+ *
+ * When a session is closed to make room, the owner of the sock receives a
+ * @ref SOCK_ASYNC_CONN_FIN event for it (if @ref SOCK_HAS_ASYNC is used).
+ * Sending to or receiving from a session marks it as used.
+ * @ref sock_dtls_session_cache_stats returns the number of full handshakes,
+ * reused and evicted sessions.
+ *
  * @{
  *
  * @file
@@ -1115,6 +1145,28 @@ static inline ssize_t sock_dtls_sendv(sock_dtls_t *sock,
  */
 void sock_dtls_close(sock_dtls_t *sock);
 
+#if defined(MODULE_SOCK_DTLS_SESSION_CACHE) || defined(DOXYGEN)
+/**
+ * @brief   Statistics of the DTLS session cache
+ */
+typedef struct {
+    uint32_t handshakes;    /**< handshakes completed */
+    uint32_t reused;        /**< sessions reused by @ref sock_dtls_session_init */
+    uint32_t evicted;       /**< sessions closed to make room for a new one */
+} sock_dtls_session_cache_stats_t;
+
+/**
+ * @brief   Get the statistics of the DTLS session cache
+ *
+ * The statistics are shared by all DTLS socks.
+ *
+ * @note    Only available with the pseudomodule `sock_dtls_session_cache`
+ *
+ * @param[out] stats    statistics
+ */
+void sock_dtls_session_cache_stats(sock_dtls_session_cache_stats_t *stats);
+#endif
+
 #ifdef MODULE_SOCK_DTLS
 #include "sock_dtls_types.h"
 #endif
@@ -0,0 +1,133 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_profiler Sampling CPU profiler
+ * @ingroup     sys
+ * @brief       Statistical profiler sampling the program counter from a
+ *              timer interrupt
+ *
+ * While running, the profiler takes a sample from a periodic
+ * @ref ZTIMER_USEC interrupt: the program counter the interrupt returns to
+ * and the PID of the interrupted thread. Samples are counted in a hash table
+ * of @ref CONFIG_PROFILER_SLOTS entries, keyed by program counter and PID.
+ * When the table is full, samples of new locations are counted as dropped.
+ *
+ * @ref profiler_dump prints the table as text. `dist/tools/profiler/profiler.py`
+ * resolves the program counters to function names with `addr2line` and the
+ * ELF file of the application and writes folded stacks
+ * (`thread;function count`), the input format of `flamegraph.pl` and
+ * speedscope.
+ *
+ * Only the interrupted function is recorded, the profiler does not unwind the
+ * stack. The time a function spends in its callees is therefore attributed to
+ * the callees only.
+ *
+ * Supported platforms:
+ *
+ * - `native`: ztimer runs on the signal based timer of
+ *   `cpu/native/periph/timer.c`, the sample is the location the signal
+ *   interrupted. Signals that arrive while interrupts are disabled or during
+ *   a system call are delivered when interrupts are enabled again or the
+ *   system call returns, so time spent there is attributed to the location
+ *   that ends the critical section.
+ * - Cortex-M: the program counter is read from the exception frame on the
+ *   process stack. On ARMv7-M and ARMv8-M mainline, samples that
+ *   interrupted another ISR are counted with a program counter of 0.
+ *   ARMv6-M can't detect this, so such samples are attributed to the
+ *   location the preempted ISR will return to.
+ *
+ * Samples can't be taken while interrupts are disabled, the sampling interrupt
+ * is taken as soon as they are enabled again. Code running with interrupts
+ * disabled is attributed to the location that enables them.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Sampling CPU profiler API
+ */
+
+#include <stdint.h>
+
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of distinct (program counter, thread) pairs counted
+ *
+ * Must be a power of two.
+ */
+#ifndef CONFIG_PROFILER_SLOTS
+#define CONFIG_PROFILER_SLOTS           (256U)
+#endif
+
+/**
+ * @brief   Default sampling rate in Hz
+ */
+#ifndef CONFIG_PROFILER_RATE_HZ
+#define CONFIG_PROFILER_RATE_HZ         (1000U)
+#endif
+
+/**
+ * @brief   Program counter of samples that interrupted an ISR
+ */
+#define PROFILER_PC_ISR                 (0U)
+
+/**
+ * @brief   Profiler statistics
+ */
+typedef struct {
+    uint32_t samples;       /**< number of samples taken */
+    uint32_t dropped;       /**< samples not counted because the table was full */
+    unsigned used;          /**< number of used hash table slots */
+} profiler_stats_t;
+
+/**
+ * @brief   Start sampling
+ *
+ * Samples are added to the ones collected before, use @ref profiler_reset to
+ * start over.
+ *
+ * @param[in] rate_hz   sampling rate in Hz, @ref CONFIG_PROFILER_RATE_HZ if 0
+ */
+void profiler_start(uint32_t rate_hz);
+
+/**
+ * @brief   Stop sampling
+ */
+void profiler_stop(void);
+
+/**
+ * @brief   Discard all samples
+ */
+void profiler_reset(void);
+
+/**
+ * @brief   Get the profiler statistics
+ *
+ * @param[out] stats    statistics
+ */
+void profiler_stats(profiler_stats_t *stats);
+
+/**
+ * @brief   Print the samples
+ *
+ * The output consists of one line per thread
+ * (`profiler: thread <pid> <name>`), one line per sampled location
+ * (`profiler: sample <pid> 0x<pc> <count>`) and a final summary line
+ * (`profiler: total <samples> dropped <dropped>`).
+ */
+void profiler_dump(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
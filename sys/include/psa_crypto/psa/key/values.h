@@ -56,6 +56,27 @@ extern "C" {
 #endif
 #endif
 
+/**
+ * @brief   RAM in bytes for precomputed tables of SECP 256 R1 public keys
+ *
+ * @details Used by the module `psa_asymmetric_ecc_p256r1_precomp`, see
+ *          @ref sys_psa_crypto_ecc_precomp. Each key takes about 1 KiB, the
+ *          tables of the most recently used keys are kept.
+ */
+#ifndef CONFIG_PSA_ECC_PRECOMP_CACHE_SIZE
+#define CONFIG_PSA_ECC_PRECOMP_CACHE_SIZE  2048
+#endif
+
+/**
+ * @brief   Number of verifications with a key before its table is computed
+ *
+ * @details Computing the table costs about as much as a verification, so
+ *          keys used only once are verified without it.
+ */
+#ifndef CONFIG_PSA_ECC_PRECOMP_MIN_USES
+#define CONFIG_PSA_ECC_PRECOMP_MIN_USES  2
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -59,6 +59,8 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
+
 #include "riotboot/slot.h"
 #include "periph/flashpage.h"
 
@@ -0,0 +1,121 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_senml_gnrc SenML CBOR in GNRC packets
+ * @ingroup     sys_senml
+ * @brief       Encode SenML/CBOR directly into the GNRC packet buffer
+ *
+ * The `senml_gnrc` module encodes SenML values as CBOR into a packet snip of
+ * @ref net_gnrc_pktbuf instead of a buffer of the caller. The snip has
+ * exactly the size of the encoded data and can be used as payload of a GNRC
+ * packet, e.g. with @ref gnrc_udp_hdr_build, without any copy or intermediate
+ * buffer.
+ *
+ * The encoder is run twice: once to determine the size of the snip and once
+ * to fill it, so it must encode the same data both times. Read sensors before,
+ * not while encoding.
+ *
+ * With the `gnrc_udp` module, @ref senml_gnrc_send_udp() prepends the UDP and
+ * IPv6 headers to the snip and hands it to @ref net_gnrc_udp, so the encoded
+ * data is never copied on its way to the network interface. As a
+ * @ref gnrc_pktsnip_t starts like an @ref iolist_t, the snip can also be
+ * passed to @ref sock_udp_sendv, but that copies it into a new packet.
+ *
+ * @{
+ *
+ * @file
+ * @brief       SenML CBOR encoding into GNRC packet snips
+ */
+
+#include <stdint.h>
+
+#include "modules.h"
+
+#include "nanocbor/nanocbor.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/ipv6/addr.h"
+#include "phydat.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Encodes CBOR, called twice by @ref senml_gnrc_encode_cbor
+ *
+ * @param[in] enc   encoder to use
+ * @param[in] arg   argument passed to @ref senml_gnrc_encode_cbor
+ *
+ * @return  0 on success
+ * @return  <0 on error
+ */
+typedef int (*senml_gnrc_encode_t)(nanocbor_encoder_t *enc, void *arg);
+
+/**
+ * @brief   Encode CBOR into a new packet snip
+ *
+ * @param[in] next      snip following the new one, may be NULL
+ * @param[in] encode    encoder function, must produce the same output for
+ *                      both calls
+ * @param[in] arg       argument for @p encode
+ *
+ * @return  the snip with the encoded data, its type is
+ *          @ref GNRC_NETTYPE_UNDEF
+ * @return  NULL if the packet buffer is full or @p encode failed
+ */
+gnrc_pktsnip_t *senml_gnrc_encode_cbor(gnrc_pktsnip_t *next,
+                                       senml_gnrc_encode_t encode, void *arg);
+
+/**
+ * @brief   Encode all dimensions of a sensor reading as a SenML pack
+ *
+ * Each dimension becomes a record with @p name and the value as a decimal
+ * fraction, or a boolean for @ref UNIT_BOOL.
+ *
+ * @param[in] next      snip following the new one, may be NULL
+ * @param[in] name      name of the records, may be NULL
+ * @param[in] data      the reading
+ * @param[in] dim       number of dimensions of @p data
+ *
+ * @return  the snip with the encoded data
+ * @return  NULL if the packet buffer is full
+ */
+gnrc_pktsnip_t *senml_gnrc_encode_phydat(gnrc_pktsnip_t *next,
+                                         const char *name,
+                                         const phydat_t *data, uint8_t dim);
+
+#if IS_USED(MODULE_GNRC_UDP) || defined(DOXYGEN)
+/**
+ * @brief   Send encoded data as UDP datagram without copying it
+ *
+ * @pre     The `gnrc_udp` module is used.
+ *
+ * @param[in] payload   the encoded data, e.g. from
+ *                      @ref senml_gnrc_encode_cbor. Released on error,
+ *                      passed on to @ref net_gnrc_udp on success.
+ * @param[in] dst       destination address
+ * @param[in] dst_port  destination port
+ * @param[in] src_port  source port
+ * @param[in] netif     interface to send over, may be NULL to let
+ *                      @ref net_gnrc_ipv6 choose it
+ *
+ * @return  0 on success
+ * @return  -ENOMEM if the headers did not fit into the packet buffer
+ * @return  -ENOTCONN if there is no UDP thread
+ */
+int senml_gnrc_send_udp(gnrc_pktsnip_t *payload, const ipv6_addr_t *dst,
+                        uint16_t dst_port, uint16_t src_port,
+                        gnrc_netif_t *netif);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
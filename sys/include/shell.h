@@ -37,6 +37,23 @@
  * available, the latter requires module `shell_builtin_cmd_help_json` to be
  * used and will give the same info machine readable.
  *
+ * With module `shell_batch`, the builtin `batch` reads commands as
+ * netstrings (`<length>:<command>,`) from stdin until `0:,` or the end of
+ * input and runs them without echo or prompt. After each command, a line with
+ * @ref SHELL_BATCH_RESULT, the number of the command in the batch and its
+ * return value is printed, e.g. `"\x1e0 0\n"`. This lets scripts and test
+ * harnesses run many commands without waiting for a prompt and parsing
+ * human readable output. See @ref shell_run_batch.
+ *
+ * ## Command Lookup
+ *
+ * Commands are searched by comparing their names one after the other. With
+ * module `shell_lookup_hash`, the commands added with @ref SHELL_COMMAND are
+ * looked up in a hash table instead, which is built on the first lookup. It
+ * takes @ref CONFIG_SHELL_CMD_HASH_SLOTS bytes of RAM. This speeds up
+ * applications with many commands, especially when commands are run by
+ * scripts.
+ *
  * @{
  *
  * @file
@@ -94,6 +111,16 @@ extern "C" {
 #define CONFIG_SHELL_NO_PROMPT 0
 #endif
 
+/**
+ * @brief Number of slots in the command hash table of `shell_lookup_hash`
+ *
+ * Must be a power of two. If more than 3/4 of the slots would be used, the
+ * commands are searched linearly.
+ */
+#ifndef CONFIG_SHELL_CMD_HASH_SLOTS
+#define CONFIG_SHELL_CMD_HASH_SLOTS 128
+#endif
+
 /** @} */
 
 /**
@@ -114,6 +141,13 @@ extern "C" {
  */
 #define SHELL_DEFAULT_BUFSIZE   (128)
 
+/**
+ * @brief Start of the result line of a command run by @ref shell_run_batch
+ *
+ * The ASCII record separator, which isn't expected in regular output.
+ */
+#define SHELL_BATCH_RESULT      "\x1e"
+
 /**
  * @brief           Optional hook after readline has triggered.
  * @details         User implemented function gets called after the shell
@@ -252,6 +286,26 @@ static inline void shell_run(const shell_command_t *commands,
  */
 int shell_handle_input_line(const shell_command_t *commands, char *line);
 
+/**
+ * @brief           Run commands read as netstrings from stdin
+ *
+ * Commands are read as `<length>:<command>,` until `0:,` or the end of input.
+ * Line breaks between the commands are ignored.
+ * After each command, @ref SHELL_BATCH_RESULT followed by the number of the
+ * command (starting at 0), a space, its return value and a newline is
+ * printed. Commands longer than @ref SHELL_DEFAULT_BUFSIZE - 1 are skipped
+ * with the result `-ENOBUFS`, unknown commands have the result `-ENOEXEC`.
+ *
+ * @note            This requires the `shell_batch` module.
+ *
+ * @param[in]       commands    ptr to array of command structs
+ *
+ * @returns         0 at the end of the batch
+ * @returns         -EBADMSG if the input isn't a valid netstring, the rest
+ *                  of the line is discarded then
+ */
+int shell_run_batch(const shell_command_t *commands);
+
 /**
  * @brief           Read shell commands from a file and run them.
  *
@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_stdio_async Asynchronous STDIO output
+ * @ingroup     sys_stdio
+ * @brief       Buffers STDIO output and writes it from a low priority thread
+ *
+ * Most STDIO backends write synchronously: `stdio_uart` returns only after the
+ * last byte has been sent, so a burst of output stalls the writing thread
+ * even if it has a high priority.
+ *
+ * With the `stdio_async` module, @ref stdio_write only copies the output into
+ * a ring buffer of @ref CONFIG_STDIO_ASYNC_BUFSIZE bytes and returns. A thread
+ * with priority @ref STDIO_ASYNC_PRIO passes the buffered output to the
+ * backend, directly from the ring buffer. This works with all backends that
+ * use @ref STDIO_PROVIDER, including `stdio_uart`, `stdio_rtt`,
+ * `stdio_cdc_acm`, `stdio_native` and several of them with `stdio_dispatch`.
+ *
+ * When the buffer is full, a thread blocks until the output fits. With
+ * @ref CONFIG_STDIO_ASYNC_DROP, or when writing from an interrupt or with
+ * interrupts disabled, the output is dropped instead. Dropped bytes are
+ * counted, see @ref stdio_async_stats.
+ *
+ * As output is only written when the threads with a higher priority than
+ * @ref STDIO_ASYNC_PRIO are blocked, the output of a thread that never
+ * blocks is delayed until the buffer is full. Use @ref stdio_async_flush
+ * where output must be complete, e.g. before a reboot. On a kernel panic, the
+ * buffer is flushed and output is written synchronously from then on.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Asynchronous STDIO output API
+ */
+
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "sched.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the output buffer in bytes
+ *
+ * Must be a power of two.
+ */
+#ifndef CONFIG_STDIO_ASYNC_BUFSIZE
+#define CONFIG_STDIO_ASYNC_BUFSIZE      (256U)
+#endif
+
+/**
+ * @brief   Drop output that doesn't fit into the buffer instead of blocking
+ */
+#ifdef DOXYGEN
+#define CONFIG_STDIO_ASYNC_DROP
+#endif
+
+/**
+ * @brief   Stack size of the thread writing the output
+ */
+#ifndef STDIO_ASYNC_STACKSIZE
+#define STDIO_ASYNC_STACKSIZE           (THREAD_STACKSIZE_SMALL)
+#endif
+
+/**
+ * @brief   Priority of the thread writing the output
+ */
+#ifndef STDIO_ASYNC_PRIO
+#define STDIO_ASYNC_PRIO                (THREAD_PRIORITY_MIN - 1)
+#endif
+
+/**
+ * @brief   Statistics of the asynchronous output
+ */
+typedef struct {
+    uint32_t written;       /**< number of bytes added to the buffer */
+    uint32_t dropped;       /**< number of bytes dropped */
+    unsigned max_used;      /**< maximum number of bytes in the buffer */
+} stdio_async_stats_t;
+
+/**
+ * @brief   Write to the STDIO backend(s), bypassing the buffer
+ *
+ * Defined by @ref STDIO_PROVIDER or `stdio_dispatch`.
+ *
+ * @param[in]   buffer  buffer to read from
+ * @param[in]   len     nr of bytes to write
+ *
+ * @return  nr of bytes written
+ * @retval      <0      on error
+ */
+ssize_t stdio_async_sink(const void *buffer, size_t len);
+
+/**
+ * @brief   Write all buffered output from the calling thread
+ *
+ * Returns when the buffer is empty.
+ */
+void stdio_async_flush(void);
+
+/**
+ * @brief   Flush the buffer and write synchronously from now on
+ *
+ * Called on a kernel panic, when the writing thread won't run anymore.
+ * Takes no locks, so output written concurrently may be mangled.
+ */
+void stdio_async_sync(void);
+
+/**
+ * @brief   Get the statistics of the asynchronous output
+ *
+ * @param[out] stats    statistics
+ */
+void stdio_async_stats(stdio_async_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -158,6 +158,24 @@ void stdio_close(void);
         .close = _close,                                    \
         .write = _write,                                    \
     };
+#elif IS_USED(MODULE_STDIO_ASYNC)
+/* stdio_write() buffers the output, see @ref sys_stdio_async */
+#define STDIO_PROVIDER(_type, _open, _close, _write)        \
+    void stdio_init(void) {                                 \
+        void (*f)(void) = _open;                            \
+        if (f != NULL) {                                    \
+            f();                                            \
+        }                                                   \
+    }                                                       \
+    void stdio_close(void) {                                \
+        void (*f)(void) = _close;                           \
+        if (f != NULL) {                                    \
+            f();                                            \
+        }                                                   \
+    }                                                       \
+    ssize_t stdio_async_sink(const void* buffer, size_t len) { \
+        return _write(buffer, len);                         \
+    }
 #else
 #define STDIO_PROVIDER(_type, _open, _close, _write)        \
     void stdio_init(void) {                                 \
@@ -31,6 +31,7 @@
 #include <stdint.h>
 
 #include "cose/sign.h"
+#include "hashes/sha256.h"
 #include "nanocbor/nanocbor.h"
 #include "uuid.h"
 
@@ -195,6 +196,7 @@ typedef struct {
 #define SUIT_COMPONENT_STATE_VERIFIED      (1 << 2) /**< Component is verified */
 #define SUIT_COMPONENT_STATE_INSTALLED     (1 << 3) /**< Component is installed, but has not been verified */
 #define SUIT_COMPONENT_STATE_FINALIZED     (1 << 4) /**< Component successfully installed */
+#define SUIT_COMPONENT_STATE_DIGESTED      (1 << 5) /**< Digest computed while fetching */
 /** @} */
 
 /**
@@ -223,6 +225,12 @@ typedef struct {
      * @brief Component offset inside the device memory.
      */
     suit_param_ref_t param_component_offset;
+#if defined(MODULE_SUIT_PIPELINE) || defined(DOXYGEN)
+    /**
+     * @brief Payload digest computed by @ref sys_suit_pipeline while fetching
+     */
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+#endif
 } suit_component_t;
 
 /**
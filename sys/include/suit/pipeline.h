@@ -0,0 +1,167 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_suit_pipeline SUIT pipelined payload download
+ * @ingroup     sys_suit
+ * @brief       Overlaps fetching, storing and hashing of SUIT payloads
+ *
+ * Without this module, every payload block received by a SUIT transport is
+ * written to storage before the next block is requested, so the network sits
+ * idle while flash pages are erased and programmed.
+ *
+ * This module decouples the transport from the storage with two block
+ * buffers and a writer thread. @ref suit_pipeline_put copies a block into a
+ * free buffer and returns right away, so the transport can request the next
+ * block while the writer thread writes the previous one to storage and feeds
+ * it to a SHA-256 digest. The transport only blocks when both buffers are in
+ * use.
+ *
+ * As every block is hashed right after it has been written, the digest of the
+ * payload is available as soon as the download has finished.
+ * When this module is used, the SUIT image match condition compares against
+ * that digest first, so a corrupted download fails without reading the
+ * payload back. The image is still only accepted if the digest of the data
+ * read back from storage matches as well, as the storage may not hold what
+ * was written to it.
+ *
+ * Per stage timing is collected in @ref suit_pipeline_stats_t and logged at
+ * the end of every download.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += suit_pipeline
+ * ```
+ *
+ * The SUIT command sequence handlers use the pipeline for all block-wise
+ * transports (CoAP, VFS and the mock transport) once the module is
+ * selected.
+ *
+ * @{
+ *
+ * @file
+ * @brief       SUIT pipelined payload download
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hashes/sha256.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of each of the two pipeline buffers in bytes
+ *
+ * Larger blocks handed to @ref suit_pipeline_put are split.
+ */
+#ifndef CONFIG_SUIT_PIPELINE_BUFSIZE
+#define CONFIG_SUIT_PIPELINE_BUFSIZE    (512U)
+#endif
+
+/**
+ * @brief   Stack size of the writer thread
+ */
+#ifndef SUIT_PIPELINE_STACKSIZE
+#define SUIT_PIPELINE_STACKSIZE         (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   Priority of the writer thread
+ *
+ * The default equals the priority of the SUIT worker, so the writer runs
+ * whenever the worker waits for the network.
+ */
+#ifndef SUIT_PIPELINE_PRIO
+#define SUIT_PIPELINE_PRIO              (THREAD_PRIORITY_MAIN - 1)
+#endif
+
+/**
+ * @brief   Writer callback, signature compatible with `coap_blockwise_cb_t`
+ *
+ * @param[in]   arg     context passed to @ref suit_pipeline_start
+ * @param[in]   offset  offset of the block in the payload
+ * @param[in]   buf     block data
+ * @param[in]   len     length of the block
+ * @param[in]   more    0 for the last block of the payload
+ *
+ * @returns     >= 0 on success
+ * @returns     negative on error, which aborts the download
+ */
+typedef int (*suit_pipeline_write_cb_t)(void *arg, size_t offset,
+                                        uint8_t *buf, size_t len, int more);
+
+/**
+ * @brief   Timing of the pipeline stages of a download
+ *
+ * The receive time is the time the transport spent between two calls of
+ * @ref suit_pipeline_put, i.e. waiting for the network. The stall time is the
+ * time the transport was blocked because both buffers were in use.
+ */
+typedef struct {
+    uint32_t blocks;        /**< blocks passed to the writer */
+    uint32_t bytes;         /**< payload bytes */
+    uint32_t recv_us;       /**< time spent by the transport receiving */
+    uint32_t stall_us;      /**< time the transport waited for a buffer */
+    uint32_t write_us;      /**< time spent writing to storage */
+    uint32_t hash_us;       /**< time spent hashing */
+    uint32_t total_us;      /**< time from start to finish */
+} suit_pipeline_stats_t;
+
+/**
+ * @brief   Start a new download
+ *
+ * Creates the writer thread on first use.
+ *
+ * @param[in]   write   called by the writer thread for every block
+ * @param[in]   arg     context passed to @p write
+ *
+ * @returns     0 on success
+ * @returns     negative errno if the writer thread could not be created
+ */
+int suit_pipeline_start(suit_pipeline_write_cb_t write, void *arg);
+
+/**
+ * @brief   Queue a block for writing
+ *
+ * This function has the signature of `coap_blockwise_cb_t`, so it can be
+ * handed to block-wise transports directly. @p arg is unused. The block is
+ * copied, so @p buf may be reused as soon as the function returns.
+ *
+ * @param[in]   arg     unused
+ * @param[in]   offset  offset of the block in the payload
+ * @param[in]   buf     block data
+ * @param[in]   len     length of the block
+ * @param[in]   more    0 for the last block of the payload
+ *
+ * @returns     0 on success
+ * @returns     negative if writing a previous block failed
+ */
+int suit_pipeline_put(void *arg, size_t offset, uint8_t *buf, size_t len, int more);
+
+/**
+ * @brief   Wait for all queued blocks to be written
+ *
+ * @param[out]  digest  SHA-256 digest of the payload, may be NULL
+ * @param[out]  stats   timing of the download, may be NULL
+ *
+ * @returns     0 if all blocks including the last one were written
+ * @returns     -EIO if the last block was never queued
+ * @returns     first error returned by the writer callback otherwise
+ */
+int suit_pipeline_finish(uint8_t digest[SHA256_DIGEST_LENGTH],
+                         suit_pipeline_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -278,6 +278,22 @@ typedef struct suit_storage_driver {
      */
     int (*set_seq_no)(suit_storage_t *storage, uint32_t seq_no);
 
+    /**
+     * @brief Check if the payload written is encoded
+     *
+     * An encoded payload, e.g. a delta against the installed image, is
+     * decoded by the backend while it is written. Its size differs from the
+     * size of the image that ends up in storage.
+     *
+     * @note Optional to implement, only valid after the first write
+     *
+     * @param[in]   storage     Storage context
+     *
+     * @returns     True if the payload written is decoded by the backend
+     * @returns     False otherwise
+     */
+    bool (*is_encoded)(const suit_storage_t *storage);
+
     /**
      * @brief Component ID separator used by this storage driver.
      */
@@ -387,6 +403,21 @@ static inline bool suit_storage_has_offset(const suit_storage_t *storage)
     return (storage->driver->match_offset);
 }
 
+/**
+ * @brief Check if the payload written to the storage backend is encoded
+ *
+ * @see suit_storage_driver_t::is_encoded
+ *
+ * @param[in]   storage     Storage context
+ *
+ * @returns     True if the payload is decoded by the backend,
+ * @returns     False otherwise
+ */
+static inline bool suit_storage_is_encoded(const suit_storage_t *storage)
+{
+    return storage->driver->is_encoded && storage->driver->is_encoded(storage);
+}
+
 /**
  * @brief One-time initialization function. Called at boot.
  *
@@ -15,10 +15,29 @@
  *
  * @brief       riotboot Flashwrite storage backend functions for SUIT manifests
  * @author      Koen Zandberg <koen@bergzand.net>
+ *
+ * ## Delta updates
+ *
+ * With the `suit_storage_flashwrite_vcdiff` module, the backend also accepts
+ * payloads that are VCDIFF deltas (as generated by `open-vcdiff` in the
+ * interleaved format) against the image in the currently running slot. Such
+ * payloads are recognized by the VCDIFF magic number at their start and
+ * decoded with @ref pkg_tinyvcdiff while they are written, so only the
+ * reconstructed image reaches the flash. The running slot is read directly
+ * from flash and the image is written through @ref
+ * sys_riotboot_flashwrite, so apart from the small decoder state no RAM
+ * proportional to the image size is needed.
+ *
+ * The image size and digest of the manifest refer to the reconstructed
+ * image. The delta has to be created against the complete slot image the
+ * device is running, including the riotboot header.
  */
 
 #include "suit.h"
 #include "riotboot/flashwrite.h"
+#if defined(MODULE_SUIT_STORAGE_FLASHWRITE_VCDIFF) || defined(DOXYGEN)
+#include "vcdiff.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +49,12 @@ extern "C" {
 typedef struct {
     suit_storage_t storage;       /**< parent struct */
     riotboot_flashwrite_t writer; /**< Riotboot flashwriter */
+#if defined(MODULE_SUIT_STORAGE_FLASHWRITE_VCDIFF) || defined(DOXYGEN)
+    vcdiff_t vcdiff;              /**< Delta decoder */
+    size_t image_len;             /**< Expected size of the decoded image */
+    size_t delta_len;             /**< Delta bytes received so far */
+    bool delta;                   /**< Payload is a delta */
+#endif
 } suit_storage_flashwrite_t;
 
 #ifdef __cplusplus
@@ -29,6 +29,31 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Block size used when the mock transport emulates a block-wise fetch
+ */
+#ifndef CONFIG_SUIT_TRANSPORT_MOCK_BLOCKSIZE
+#define CONFIG_SUIT_TRANSPORT_MOCK_BLOCKSIZE    (64U)
+#endif
+
+/**
+ * @brief Callback for every block of a block-wise fetch
+ *
+ * Same signature as the block-wise callbacks of the network transports.
+ *
+ * @param[in]   arg     context passed to
+ *                      @ref suit_transport_mock_fetch_blockwise
+ * @param[in]   offset  offset of the block in the payload
+ * @param[in]   buf     block data
+ * @param[in]   len     length of the block
+ * @param[in]   more    1 if more blocks follow, 0 for the last block
+ *
+ * @returns     >= 0 on success
+ * @returns     negative on error, which aborts the fetch
+ */
+typedef int (*suit_transport_mock_cb_t)(void *arg, size_t offset,
+                                        uint8_t *buf, size_t len, int more);
+
 /**
  * @brief Mock payload.
  */
@@ -50,6 +75,24 @@ typedef struct {
  */
 int suit_transport_mock_fetch(const suit_manifest_t *manifest);
 
+/**
+ * @brief 'fetch' a payload block-wise
+ *
+ * Like @ref suit_transport_mock_fetch, but hands the payload to @p cb in
+ * blocks of at most @p blksize bytes, like the block-wise transports do.
+ *
+ * @param[in]   manifest    suit manifest context
+ * @param[in]   blksize     maximum size of a block
+ * @param[in]   cb          callback for every block
+ * @param[in]   ctx         context passed to @p cb
+ *
+ * @returns     0 on success
+ * @returns     negative value returned by @p cb otherwise
+ */
+int suit_transport_mock_fetch_blockwise(const suit_manifest_t *manifest,
+                                        size_t blksize,
+                                        suit_transport_mock_cb_t cb, void *ctx);
+
 #ifdef __cplusplus
 }
 #endif
@@ -17,6 +17,7 @@
  */
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -49,11 +50,43 @@ extern "C" {
  */
 #define BENCH_FLAG_CMD_PKT      (1 << 0)
 
+/**
+ * @brief   Flag indicating latency mode: every benchmark packet carries a
+ *          @ref benchmark_msg_latency_t at the start of its payload.
+ *          Set by the server in the configuration command.
+ */
+#define BENCH_FLAG_LATENCY      (1 << 1)
+
 /**
  * @brief   Configuration Cookie mask.
  */
 #define BENCH_MASK_COOKIE       (0xFFFFFF00)
 
+/**
+ * @brief   Number of linear sub-buckets per power of two in the latency
+ *          histogram, as a power of two.
+ *
+ * A value is recorded with a relative error of at most 2^-BENCH_HIST_SUB_BITS.
+ */
+#ifndef BENCH_HIST_SUB_BITS
+#define BENCH_HIST_SUB_BITS     (3)
+#endif
+
+/**
+ * @brief   Number of significant bits of values in the latency histogram.
+ *
+ * Larger values are counted in the last bucket.
+ */
+#ifndef BENCH_HIST_VALUE_BITS
+#define BENCH_HIST_VALUE_BITS   (24)
+#endif
+
+/**
+ * @brief   Number of buckets in the latency histogram
+ */
+#define BENCH_HIST_BUCKETS      ((BENCH_HIST_VALUE_BITS - BENCH_HIST_SUB_BITS + 1) \
+                                 << BENCH_HIST_SUB_BITS)
+
 /**
  * @brief   Benchmark message to the server
  * @note    Both server and client are assumed to be little endian machines
@@ -80,6 +113,112 @@ typedef struct {
 } benchmark_msg_cmd_t;
 /** @} */
 
+/**
+ * @brief   Latency header at the start of the payload in latency mode
+ * @note    Both server and client are assumed to be little endian machines
+ */
+typedef struct {
+    uint32_t time_tx_us;    /**< client time when the packet was sent       */
+    uint32_t rtt_seq_no;    /**< sequence number @p rtt_last belongs to     */
+} benchmark_msg_latency_t;
+
+/**
+ * @brief   Log-linear (HDR style) histogram of latency values in µs
+ */
+typedef struct {
+    uint32_t count;                         /**< number of values          */
+    uint32_t min;                           /**< smallest value            */
+    uint32_t max;                           /**< largest value             */
+    uint64_t sum;                           /**< sum of all values         */
+    uint32_t buckets[BENCH_HIST_BUCKETS];   /**< number of values per bucket */
+} benchmark_udp_hist_t;
+
+/**
+ * @brief   Latency statistics of a packet stream
+ */
+typedef struct {
+    benchmark_udp_hist_t rtt;   /**< round trip times                       */
+    uint32_t jitter;            /**< inter-arrival jitter in 1/16 µs (RFC 3550) */
+    uint32_t transit_last;      /**< transit time of the last packet        */
+    uint32_t seq_no_max;        /**< highest sequence number received       */
+    uint32_t received;          /**< number of packets received             */
+    uint32_t reordered;         /**< packets received after a later one     */
+} benchmark_udp_latency_t;
+
+/**
+ * @brief   Output format of latency statistics
+ */
+typedef enum {
+    BENCH_FORMAT_JSON,          /**< one JSON object                        */
+    BENCH_FORMAT_CSV,           /**< one CSV line                           */
+    BENCH_FORMAT_CSV_HEADER,    /**< header line of the CSV format          */
+} benchmark_udp_format_t;
+
+/**
+ * @brief   Reset latency statistics
+ *
+ * @param[out]  lat     latency statistics to reset
+ */
+void benchmark_udp_latency_reset(benchmark_udp_latency_t *lat);
+
+/**
+ * @brief   Account for a received packet
+ *
+ * Updates the jitter and reorder statistics. The transit time may contain a
+ * constant offset between sender and receiver clock.
+ *
+ * @param[in,out]   lat         latency statistics
+ * @param[in]       seq_no      sequence number of the packet
+ * @param[in]       transit_us  transit time of the packet in µs
+ */
+void benchmark_udp_latency_rx(benchmark_udp_latency_t *lat, uint32_t seq_no,
+                              uint32_t transit_us);
+
+/**
+ * @brief   Add a value to a latency histogram
+ *
+ * @param[in,out]   hist    histogram
+ * @param[in]       value   value in µs
+ */
+void benchmark_udp_hist_add(benchmark_udp_hist_t *hist, uint32_t value);
+
+/**
+ * @brief   Get a percentile of a latency histogram
+ *
+ * @param[in]   hist        histogram
+ * @param[in]   permille    percentile in 1/10 %, e.g. 990 for p99
+ *
+ * @return      the highest value that is equivalent to the percentile
+ * @return      0 if the histogram is empty
+ */
+uint32_t benchmark_udp_hist_percentile(const benchmark_udp_hist_t *hist,
+                                       unsigned permille);
+
+/**
+ * @brief   Format latency statistics as text
+ *
+ * @param[out]  buf     destination buffer
+ * @param[in]   len     size of @p buf
+ * @param[in]   lat     latency statistics, may be NULL for
+ *                      @ref BENCH_FORMAT_CSV_HEADER
+ * @param[in]   format  output format
+ *
+ * @return      number of characters that would have been written to @p buf,
+ *              as with snprintf()
+ */
+int benchmark_udp_latency_format(char *buf, size_t len,
+                                 const benchmark_udp_latency_t *lat,
+                                 benchmark_udp_format_t format);
+
+/**
+ * @brief   Get the round trip statistics of the running benchmark
+ *
+ * Only populated if the server enabled latency mode.
+ *
+ * @return      latency statistics of the packets echoed by the server
+ */
+const benchmark_udp_latency_t *benchmark_udp_get_latency(void);
+
 /**
  * @brief   This will start the benchmark process.
  *          Two threads will be spawned, one to send packets to the server
@@ -25,10 +25,63 @@
  * The trace buffer works like a ring-buffer. If it is full, it will start
  * overwriting from the beginning.
  *
- * Tracing is made thread safe by disabling interrupts for critical sections.
+ * Tracing is safe from any context without a critical section: a slot is
+ * reserved with an atomic increment of the write index
+ * (see @ref atomic_fetch_add_u32, which only falls back to disabling
+ * interrupts on CPUs without atomic read-modify-write instructions) and the
+ * sequence number of the record is stored once it has been filled. The
+ * exporter checks the sequence number before and after copying a record, so
+ * it never exports a record that is incomplete or from a previous lap.
+ * Records of events that preempted each other may therefore not be stored in
+ * the order of their timestamps.
  *
  * It does incur some overhead (at least a function call, getting the current
- * time, a pair of enable/disable interrupts and a couple of memory accesses).
+ * time, an atomic increment and a couple of memory accesses).
+ * `tests/sys/trace` measures it.
+ *
+ * ## Typed events
+ *
+ * Besides the user values recorded with `trace()`, RIOT can record events
+ * of its own. Every event source is enabled with a pseudomodule:
+ *
+ * | Module          | Events                                               |
+ * |-----------------|------------------------------------------------------|
+ * | `trace_sched`   | @ref TRACE_EVENT_THREAD_SWITCH                       |
+ * | `trace_isr`     | @ref TRACE_EVENT_ISR_ENTER, @ref TRACE_EVENT_ISR_EXIT |
+ * | `trace_msg`     | @ref TRACE_EVENT_MSG_SEND, @ref TRACE_EVENT_MSG_RECV |
+ * | `trace_pktbuf`  | @ref TRACE_EVENT_PKTBUF_ALLOC, @ref TRACE_EVENT_PKTBUF_FREE |
+ * | `trace_ztimer`  | @ref TRACE_EVENT_ZTIMER_FIRE                         |
+ *
+ * `trace_sched` uses the @ref sched_register_cb hook and can't be combined
+ * with `schedstatistics`. `trace_isr` is implemented by `native`; other CPUs
+ * or drivers can call @ref trace_isr_enter and @ref trace_isr_exit from their
+ * interrupt handlers.
+ *
+ * ## Binary export
+ *
+ * @ref trace_export writes the records that have not been exported yet to
+ * stdio in a compact binary format, so the trace can be transferred over any
+ * stdio backend (UART, USB CDC ACM, semihosting, ...). With the
+ * `trace_stream` module, a low priority thread does this periodically.
+ *
+ * `dist/tools/trace/riot_trace.py` extracts the binary frames from a capture
+ * of stdio (other output may be interleaved) and converts them to the
+ * Chrome trace event format, which can be opened with Perfetto
+ * (https://ui.perfetto.dev) or `chrome://tracing`.
+ *
+ * A frame starts with the 8 byte header
+ *
+ * | Offset | Size | Content                                             |
+ * |--------|------|-----------------------------------------------------|
+ * | 0      | 4    | @ref TRACE_FRAME_MAGIC                              |
+ * | 4      | 1    | @ref TRACE_FRAME_VERSION                            |
+ * | 5      | 1    | frame type, @ref trace_frame_type_t                 |
+ * | 6      | 2    | number of records or payload length, little endian  |
+ *
+ * A @ref TRACE_FRAME_RECORDS frame holds records of 12 bytes, each
+ * `time` (4), `type` (1), `flags` (1), `pid` (2), `arg` (4), all little
+ * endian. A @ref TRACE_FRAME_THREAD frame holds the pid (2) and the name of a
+ * thread.
  *
  * Example:
  *
@@ -51,10 +104,92 @@
 
 #include <stdint.h>
 
+#include "sched.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief   Number of records in the trace buffer
+ */
+#ifndef CONFIG_TRACE_BUFSIZE
+#define CONFIG_TRACE_BUFSIZE            512
+#endif
+
+/**
+ * @brief   Interval in which `trace_stream` exports the trace buffer
+ */
+#ifndef CONFIG_TRACE_STREAM_INTERVAL_MS
+#define CONFIG_TRACE_STREAM_INTERVAL_MS 100
+#endif
+
+/**
+ * @brief   Stack size of the `trace_stream` thread
+ */
+#ifndef TRACE_STREAM_STACKSIZE
+#define TRACE_STREAM_STACKSIZE          (THREAD_STACKSIZE_SMALL)
+#endif
+
+/**
+ * @brief   Priority of the `trace_stream` thread
+ */
+#ifndef TRACE_STREAM_PRIO
+#define TRACE_STREAM_PRIO               (THREAD_PRIORITY_MIN - 1)
+#endif
+
+/**
+ * @brief   Magic number at the start of an exported frame
+ */
+#define TRACE_FRAME_MAGIC               "RTRC"
+
+/**
+ * @brief   Version of the export format
+ */
+#define TRACE_FRAME_VERSION             (1U)
+
+/**
+ * @brief   Types of the exported frames
+ */
+typedef enum {
+    TRACE_FRAME_RECORDS = 0,    /**< trace records */
+    TRACE_FRAME_THREAD  = 1,    /**< pid and name of a thread */
+} trace_frame_type_t;
+
+/**
+ * @brief   Event types
+ */
+typedef enum {
+    TRACE_EVENT_INVALID = 0,    /**< slot was never written */
+    TRACE_EVENT_USER,           /**< `trace()`, arg: user value */
+    TRACE_EVENT_THREAD_SWITCH,  /**< pid: next thread, arg: previous thread */
+    TRACE_EVENT_ISR_ENTER,      /**< arg: interrupt number */
+    TRACE_EVENT_ISR_EXIT,       /**< arg: interrupt number */
+    TRACE_EVENT_MSG_SEND,       /**< arg: target pid << 16 | message type */
+    TRACE_EVENT_MSG_RECV,       /**< arg: sender pid << 16 | message type */
+    TRACE_EVENT_PKTBUF_ALLOC,   /**< arg: bytes allocated */
+    TRACE_EVENT_PKTBUF_FREE,    /**< arg: bytes freed */
+    TRACE_EVENT_ZTIMER_FIRE,    /**< arg: address of the timer */
+} trace_event_t;
+
+/**
+ * @brief   Record flag: the event was recorded in interrupt context
+ */
+#define TRACE_FLAG_ISR                  (0x01)
+
+/**
+ * @brief   A trace record
+ */
+typedef struct {
+    volatile uint32_t seq;      /**< inverted sequence number of the record,
+                                 *   set last */
+    uint32_t time;              /**< timestamp in microseconds */
+    uint8_t type;               /**< @ref trace_event_t */
+    uint8_t flags;              /**< TRACE_FLAG_* */
+    kernel_pid_t pid;           /**< active thread */
+    uint32_t arg;               /**< event specific argument */
+} trace_record_t;
+
 /**
  * @brief   Add entry to trace buffer
  *
@@ -69,6 +204,52 @@ extern "C" {
  */
 void trace(uint32_t val);
 
+/**
+ * @brief   Add a typed event to the trace buffer
+ *
+ * @param[in]   type    type of the event
+ * @param[in]   arg     event specific argument
+ */
+void trace_event(trace_event_t type, uint32_t arg);
+
+/**
+ * @brief   Record the start of an interrupt handler
+ *
+ * @param[in]   irq     interrupt number
+ */
+static inline void trace_isr_enter(unsigned irq)
+{
+    trace_event(TRACE_EVENT_ISR_ENTER, irq);
+}
+
+/**
+ * @brief   Record the end of an interrupt handler
+ *
+ * @param[in]   irq     interrupt number
+ */
+static inline void trace_isr_exit(unsigned irq)
+{
+    trace_event(TRACE_EVENT_ISR_EXIT, irq);
+}
+
+/**
+ * @brief   Write the records recorded since the last export to stdio
+ *
+ * The first export also writes the names of all threads. Records that were
+ * overwritten before they could be exported are lost; their number is
+ * returned by @ref trace_lost.
+ *
+ * @note    Only one thread may export the trace buffer.
+ *
+ * @returns number of exported records
+ */
+unsigned trace_export(void);
+
+/**
+ * @brief   Number of records that were overwritten before they were exported
+ */
+uint32_t trace_lost(void);
+
 /**
  * @brief   Print the current trace buffer
  *
@@ -80,6 +261,9 @@ void trace(uint32_t val);
  *
  *     n=   0 t=  1815312 v=0x00000000
  *     n=   1 t=+       3 v=0x00000001
+ *
+ * Typed events are printed with the name of the event, the active thread and
+ * the argument instead of the value.
  */
 void trace_dump(void);
 
@@ -234,6 +234,32 @@ extern "C" {
 #define VFS_MAX_OPEN_FILES (16)
 #endif
 
+#ifndef VFS_MOUNT_INDEX_SIZE
+/**
+ * @brief Number of mounts held in the lookup index
+ *
+ * Path lookups use a copy of the mount table that is sorted by mount point
+ * length and can be read without taking the mount mutex. If more file systems
+ * are mounted, lookups fall back to walking the mount list under the mutex.
+ */
+#define VFS_MOUNT_INDEX_SIZE (8)
+#endif
+
+#ifndef VFS_STAT_CACHE_SIZE
+/**
+ * @brief Number of paths remembered by the `vfs_stat_cache` module
+ */
+#define VFS_STAT_CACHE_SIZE (4)
+#endif
+
+#ifndef VFS_STAT_CACHE_PATH_MAX
+/**
+ * @brief Longest path (including the terminating zero) that the
+ *        `vfs_stat_cache` module stores, longer paths are never cached
+ */
+#define VFS_STAT_CACHE_PATH_MAX (32)
+#endif
+
 #ifndef VFS_DIR_BUFFER_SIZE
 /**
  * @brief Size of buffer space in vfs_DIR
@@ -1051,6 +1077,13 @@ int vfs_rename(const char *from_path, const char *to_path);
  *
  * This will fail if there are any open files or directories on the mounted file system
  *
+ * @warning Path lookups don't take a lock. A lookup of another thread that
+ *          started before the file system was unmounted may still read
+ *          @p mountp after this function returned, before it notices the
+ *          change and starts over. Don't free or reuse @p mountp, its mount
+ *          point or its private data while other threads may still be in a
+ *          VFS call, e.g. unmount only once they are done.
+ *
  * @param[in]  mountp    pointer to the mount structure of the file system to unmount
  * @param[in]  force    Unmount the filesystem even if there are still open files
  *
@@ -1095,6 +1128,12 @@ int vfs_rmdir(const char *name);
 /**
  * @brief Get file status
  *
+ * With the `vfs_stat_cache` module, the results of the last
+ * @ref VFS_STAT_CACHE_SIZE lookups are remembered. The cache is flushed by
+ * every operation that may modify a file system, so files that change without
+ * going through the VFS (e.g. a file system shared with a host) may be
+ * reported with stale data.
+ *
  * @param[in]  path    path to file being queried
  * @param[out] buf     pointer to stat struct to fill
  *
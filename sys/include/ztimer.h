@@ -544,6 +544,22 @@ int ztimer_msg_receive_timeout(ztimer_clock_t *clock, msg_t *msg,
  */
 int ztimer_mbox_get_timeout(ztimer_clock_t *clock, mbox_t *mbox, msg_t *msg, uint32_t timeout);
 
+/**
+ * @brief Put message into mailbox, blocking with a timeout
+ *
+ * If the mailbox is full, this function will block until space becomes
+ * available or the timeout triggers
+ *
+ * @param[in]   clock           ztimer clock to operate on
+ * @param[in]   mbox            ptr to mailbox to operate on
+ * @param[in]   msg             ptr to message that will be copied into mailbox
+ * @param[in]   timeout         relative timeout, in @p clock time units
+ *
+ * @retval  0           Message was delivered
+ * @retval -ETIMEDOUT   Timeout triggered before the message could be delivered
+ */
+int ztimer_mbox_put_timeout(ztimer_clock_t *clock, mbox_t *mbox, msg_t *msg, uint32_t timeout);
+
 /**
  * @brief ztimer_now() for extending timers
  *
@@ -0,0 +1,186 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_log_deferred log_deferred: Deferred binary log module
+ * @ingroup     sys
+ * @brief       Logging module that formats messages on the host
+ *
+ * With this module, @ref LOG_ERROR and friends neither format the message nor
+ * wait for stdio. They store the ID of the format string and the raw
+ * arguments in a ring buffer and return. A low priority thread writes the
+ * buffered messages to stdio as binary frames, which
+ * `dist/tools/log_deferred/log_deferred.py` turns back into text using the
+ * format strings from the ELF file of the application.
+ *
+ * The format strings are placed in the `.riot_log_fmt` section, the ID of a
+ * format string is its address. On `native` and Cortex-M, the linker script
+ * marks this section as not loaded: the format strings don't take any space
+ * on the device and their IDs are offsets into the section. On other
+ * platforms, the section ends up in flash like any other read-only data.
+ *
+ * Arguments are classified by their C type at compile time:
+ *
+ * - integers and pointers are stored with 4 or 8 bytes, depending on their
+ *   size
+ * - `float` and `double` are stored as `double`
+ * - `char *` arguments are expected to be strings (`%s`), their content is
+ *   copied as the pointer may not be valid anymore when the message is
+ *   written
+ *
+ * A message holds at most @ref LOG_DEFERRED_ARGS_MAX arguments and takes at
+ * most @ref CONFIG_LOG_DEFERRED_RECORD_MAX bytes, longer strings are
+ * truncated. The format string must be a string literal. Messages that don't
+ * fit into the ring buffer are dropped and counted, see
+ * @ref log_deferred_stats.
+ *
+ * The output of the module is not readable without the decoder:
+ *
+ *     make term | dist/tools/log_deferred/log_deferred.py bin/<board>/<app>.elf
+ *
+ * Other output is passed through. Frames written from the drain thread may be
+ * interleaved with output of higher priority threads on some stdio
+ * implementations; the decoder skips damaged frames.
+ *
+ * A frame starts with the 6 byte header
+ *
+ * | Offset | Size | Content                                             |
+ * |--------|------|-----------------------------------------------------|
+ * | 0      | 4    | @ref LOG_DEFERRED_FRAME_MAGIC                       |
+ * | 4      | 1    | @ref LOG_DEFERRED_FRAME_VERSION                     |
+ * | 5      | 1    | payload length                                      |
+ *
+ * followed by the log level (1), the format string ID (4, little endian) and
+ * the arguments. Each argument starts with its type,
+ * @ref log_deferred_arg_t, followed by the little endian value or, for
+ * strings, the length (1) and the characters. Bit 7 of the log level is set
+ * if arguments were cut off.
+ *
+ * C++ code does not support the required type classification and prints the
+ * message immediately.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Deferred binary log module API
+ */
+
+#include <stdint.h>
+
+#include "sched.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the ring buffer in bytes
+ *
+ * Must be a power of two.
+ */
+#ifndef CONFIG_LOG_DEFERRED_BUFSIZE
+#define CONFIG_LOG_DEFERRED_BUFSIZE     (512U)
+#endif
+
+/**
+ * @brief   Maximum size of a message in the ring buffer
+ *
+ * Must not exceed 255.
+ */
+#ifndef CONFIG_LOG_DEFERRED_RECORD_MAX
+#define CONFIG_LOG_DEFERRED_RECORD_MAX  (64U)
+#endif
+
+/**
+ * @brief   Stack size of the thread writing the messages
+ */
+#ifndef LOG_DEFERRED_STACKSIZE
+#define LOG_DEFERRED_STACKSIZE          (THREAD_STACKSIZE_SMALL)
+#endif
+
+/**
+ * @brief   Priority of the thread writing the messages
+ */
+#ifndef LOG_DEFERRED_PRIO
+#define LOG_DEFERRED_PRIO               (THREAD_PRIORITY_MIN - 1)
+#endif
+
+/**
+ * @brief   Maximum number of arguments of a message
+ */
+#define LOG_DEFERRED_ARGS_MAX           (8U)
+
+/**
+ * @brief   Magic number at the start of a frame
+ */
+#define LOG_DEFERRED_FRAME_MAGIC        "RLOG"
+
+/**
+ * @brief   Version of the frame format
+ */
+#define LOG_DEFERRED_FRAME_VERSION      (1U)
+
+/**
+ * @brief   Flag in the log level of a frame whose arguments were cut off
+ */
+#define LOG_DEFERRED_TRUNCATED          (0x80U)
+
+/**
+ * @brief   Argument types
+ */
+typedef enum {
+    LOG_DEFERRED_ARG_NONE   = 0,    /**< no more arguments */
+    LOG_DEFERRED_ARG_INT32  = 1,    /**< 32 bit integer or pointer */
+    LOG_DEFERRED_ARG_INT64  = 2,    /**< 64 bit integer or pointer */
+    LOG_DEFERRED_ARG_DOUBLE = 3,    /**< double, 8 bytes IEEE 754 */
+    LOG_DEFERRED_ARG_STR    = 4,    /**< string */
+    LOG_DEFERRED_ARG_FLOAT  = 5,    /**< double, 4 bytes IEEE 754 (AVR) */
+    LOG_DEFERRED_ARG_LONG32 = 6,    /**< 32 bit integer wider than `int`, only
+                                         passed to log_deferred_write(), it
+                                         is stored as @ref LOG_DEFERRED_ARG_INT32 */
+} log_deferred_arg_t;
+
+/**
+ * @brief   Statistics of the deferred log module
+ */
+typedef struct {
+    uint32_t written;       /**< number of messages stored in the buffer */
+    uint32_t dropped;       /**< number of messages dropped, buffer was full */
+} log_deferred_stats_t;
+
+/**
+ * @brief   Store a message in the ring buffer
+ *
+ * @note    Use @ref LOG_INFO and friends, which compute @p types.
+ *
+ * @param[in] level     log level
+ * @param[in] format    format string in the `.riot_log_fmt` section
+ * @param[in] types     types of the arguments, 4 bits per argument starting
+ *                      with the least significant bits
+ */
+void log_deferred_write(unsigned level, const char *format, uint32_t types, ...);
+
+/**
+ * @brief   Write all buffered messages to stdio in the calling thread
+ *
+ * Use this before a reboot or when the scheduler isn't running.
+ */
+void log_deferred_flush(void);
+
+/**
+ * @brief   Get the statistics of the deferred log module
+ *
+ * @param[out] stats    statistics
+ */
+void log_deferred_stats(log_deferred_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
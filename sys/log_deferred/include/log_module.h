@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @ingroup     sys_log_deferred
+ * @{
+ *
+ * @file
+ * @brief       log_module header
+ */
+
+#include "log_deferred.h"
+
+#ifdef __cplusplus
+#include <stdarg.h>
+#include <stdio.h>
+
+extern "C" {
+#endif
+
+#ifndef __cplusplus
+
+/**
+ * @brief   Type of a log argument, see @ref log_deferred_arg_t
+ */
+#define _LOG_DEFERRED_TYPE(x) _Generic((x),                                    \
+    char *: LOG_DEFERRED_ARG_STR,                                              \
+    const char *: LOG_DEFERRED_ARG_STR,                                        \
+    float: LOG_DEFERRED_ARG_DOUBLE,                                            \
+    double: LOG_DEFERRED_ARG_DOUBLE,                                           \
+    default: (sizeof((x) + 0) > 4 ? LOG_DEFERRED_ARG_INT64                     \
+              : sizeof((x) + 0) > sizeof(int) ? LOG_DEFERRED_ARG_LONG32        \
+              : LOG_DEFERRED_ARG_INT32))
+
+#define _LOG_DEFERRED_T0()          0
+#define _LOG_DEFERRED_T1(a)         (uint32_t)_LOG_DEFERRED_TYPE(a)
+#define _LOG_DEFERRED_T2(a, ...)    (_LOG_DEFERRED_T1(a) | (_LOG_DEFERRED_T1(__VA_ARGS__) << 4))
+#define _LOG_DEFERRED_T3(a, ...)    (_LOG_DEFERRED_T1(a) | (_LOG_DEFERRED_T2(__VA_ARGS__) << 4))
+#define _LOG_DEFERRED_T4(a, ...)    (_LOG_DEFERRED_T1(a) | (_LOG_DEFERRED_T3(__VA_ARGS__) << 4))
+#define _LOG_DEFERRED_T5(a, ...)    (_LOG_DEFERRED_T1(a) | (_LOG_DEFERRED_T4(__VA_ARGS__) << 4))
+#define _LOG_DEFERRED_T6(a, ...)    (_LOG_DEFERRED_T1(a) | (_LOG_DEFERRED_T5(__VA_ARGS__) << 4))
+#define _LOG_DEFERRED_T7(a, ...)    (_LOG_DEFERRED_T1(a) | (_LOG_DEFERRED_T6(__VA_ARGS__) << 4))
+#define _LOG_DEFERRED_T8(a, ...)    (_LOG_DEFERRED_T1(a) | (_LOG_DEFERRED_T7(__VA_ARGS__) << 4))
+
+#define _LOG_DEFERRED_NARGS_(_0, _1, _2, _3, _4, _5, _6, _7, _8, n, ...) n
+#define _LOG_DEFERRED_NARGS(...) \
+    _LOG_DEFERRED_NARGS_(0, ##__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define _LOG_DEFERRED_CAT_(a, b)    a ## b
+#define _LOG_DEFERRED_CAT(a, b)     _LOG_DEFERRED_CAT_(a, b)
+
+/**
+ * @brief   Types of all log arguments, 4 bits each
+ */
+#define _LOG_DEFERRED_TYPES(...) \
+    _LOG_DEFERRED_CAT(_LOG_DEFERRED_T, _LOG_DEFERRED_NARGS(__VA_ARGS__))(__VA_ARGS__)
+
+/**
+ * @brief   Never called, only lets the compiler check the format string
+ */
+__attribute__((format(printf, 1, 2)))
+static inline void _log_deferred_check(const char *format, ...)
+{
+    (void)format;
+}
+
+/**
+ * @brief   log_write overridden macro storing the message in the ring buffer
+ *
+ * The format string is moved to the `.riot_log_fmt` section, the arguments
+ * are classified at compile time.
+ *
+ * @param[in] level     log level
+ * @param[in] format    format string, must be a string literal
+ */
+#define log_write(level, format, ...) do {                                     \
+        static const char _log_deferred_fmt[]                                  \
+            __attribute__((section(".riot_log_fmt"), used)) = format;         \
+        if (0) {                                                               \
+            _log_deferred_check(format, ##__VA_ARGS__);                        \
+        }                                                                      \
+        log_deferred_write((level), _log_deferred_fmt,                         \
+                           _LOG_DEFERRED_TYPES(__VA_ARGS__), ##__VA_ARGS__);   \
+    } while (0)
+
+#else /* __cplusplus */
+
+/**
+ * @brief   log_write overridden function for C++, prints immediately
+ *
+ * @param[in] level     (unused)
+ * @param[in] format    format string
+ */
+static inline void log_write(unsigned level, const char *format, ...)
+{
+    (void)level;
+    va_list args;
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+}
+
+#endif /* __cplusplus */
+
+#ifdef __cplusplus
+}
+#endif
+/** @} */
@@ -0,0 +1,216 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_log_deferred
+ * @{
+ *
+ * @file
+ * @brief       Deferred binary log module implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdarg.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "irq.h"
+#include "log_deferred.h"
+#include "mutex.h"
+#include "stdio_base.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "tsrb.h"
+#include "turb.h"
+
+static_assert((CONFIG_LOG_DEFERRED_BUFSIZE & (CONFIG_LOG_DEFERRED_BUFSIZE - 1)) == 0,
+              "CONFIG_LOG_DEFERRED_BUFSIZE must be a power of two");
+static_assert(CONFIG_LOG_DEFERRED_RECORD_MAX <= UINT8_MAX,
+              "CONFIG_LOG_DEFERRED_RECORD_MAX must not exceed 255");
+
+/* size of the frame header */
+#define FRAME_HDR_SIZE          (6U)
+
+/* level and format string ID */
+#define RECORD_HDR_SIZE         (5U)
+
+#define LOG_DEFERRED_FLAG       (0x1)
+
+static uint8_t _buf[CONFIG_LOG_DEFERRED_BUFSIZE];
+static tsrb_t _rb = TSRB_INIT(_buf);
+static uint32_t _written;
+static uint32_t _dropped;
+
+/* serializes readers of the ring buffer, keeps the frames in order */
+static mutex_t _drain_lock = MUTEX_INIT;
+static kernel_pid_t _drain_pid = KERNEL_PID_UNDEF;
+static char _drain_stack[LOG_DEFERRED_STACKSIZE];
+
+void log_deferred_write(unsigned level, const char *format, uint32_t types, ...)
+{
+    /* a record is stored with its length in front */
+    uint8_t rec[1 + CONFIG_LOG_DEFERRED_RECORD_MAX];
+    uint8_t *pos = &rec[1 + RECORD_HDR_SIZE];
+    const uint8_t *end = &rec[sizeof(rec)];
+    va_list args;
+
+    rec[1] = level;
+    byteorder_htolebufl(&rec[2], (uint32_t)(uintptr_t)format);
+
+    va_start(args, types);
+    for (; types; types >>= 4) {
+        size_t space = end - pos;
+        switch (types & 0xf) {
+        case LOG_DEFERRED_ARG_INT32:
+        case LOG_DEFERRED_ARG_LONG32: {
+            /* types smaller than int were promoted to int */
+            uint32_t val = (types & 0xf) == LOG_DEFERRED_ARG_INT32
+                         ? va_arg(args, unsigned) : va_arg(args, uint32_t);
+            if (space < 1 + 4) {
+                goto truncated;
+            }
+            *pos++ = LOG_DEFERRED_ARG_INT32;
+            byteorder_htolebufl(pos, val);
+            pos += 4;
+            break;
+        }
+        case LOG_DEFERRED_ARG_INT64: {
+            uint64_t val = va_arg(args, uint64_t);
+            if (space < 1 + 8) {
+                goto truncated;
+            }
+            *pos++ = LOG_DEFERRED_ARG_INT64;
+            byteorder_htolebufll(pos, val);
+            pos += 8;
+            break;
+        }
+        case LOG_DEFERRED_ARG_DOUBLE: {
+            double val = va_arg(args, double);
+            if (space < 1 + sizeof(val)) {
+                goto truncated;
+            }
+            if (sizeof(val) == 8) {
+                uint64_t u;
+                memcpy(&u, &val, sizeof(u));
+                *pos++ = LOG_DEFERRED_ARG_DOUBLE;
+                byteorder_htolebufll(pos, u);
+            }
+            else {
+                uint32_t u;
+                memcpy(&u, &val, sizeof(u));
+                *pos++ = LOG_DEFERRED_ARG_FLOAT;
+                byteorder_htolebufl(pos, u);
+            }
+            pos += sizeof(val);
+            break;
+        }
+        case LOG_DEFERRED_ARG_STR: {
+            const char *str = va_arg(args, const char *);
+            if (space < 2) {
+                goto truncated;
+            }
+            if (str == NULL) {
+                str = "(null)";
+            }
+            size_t len = strnlen(str, space - 2);
+            *pos++ = LOG_DEFERRED_ARG_STR;
+            *pos++ = len;
+            memcpy(pos, str, len);
+            pos += len;
+            break;
+        }
+        default:
+            assert(0);
+            goto truncated;
+        }
+    }
+    if (0) {
+truncated:
+        rec[1] |= LOG_DEFERRED_TRUNCATED;
+    }
+    va_end(args);
+
+    size_t len = pos - rec;
+    rec[0] = len - 1;
+
+    /* the record must be added as a whole, turb_*() don't lock on their own */
+    unsigned state = irq_disable();
+    bool was_empty = turb_empty(&_rb);
+    bool added = turb_free(&_rb) >= len;
+    if (added) {
+        turb_add(&_rb, rec, len);
+        _written++;
+    }
+    else {
+        _dropped++;
+    }
+    irq_restore(state);
+
+    /* the drain thread empties the buffer before it waits again */
+    if (added && was_empty && _drain_pid != KERNEL_PID_UNDEF) {
+        thread_flags_set(thread_get(_drain_pid), LOG_DEFERRED_FLAG);
+    }
+}
+
+static bool _drain_one(void)
+{
+    uint8_t frame[FRAME_HDR_SIZE + CONFIG_LOG_DEFERRED_RECORD_MAX];
+    int len;
+
+    unsigned state = irq_disable();
+    len = turb_get_one(&_rb);
+    if (len > 0) {
+        turb_get(&_rb, &frame[FRAME_HDR_SIZE], len);
+    }
+    irq_restore(state);
+
+    if (len < 0) {
+        return false;
+    }
+
+    memcpy(frame, LOG_DEFERRED_FRAME_MAGIC, 4);
+    frame[4] = LOG_DEFERRED_FRAME_VERSION;
+    frame[5] = len;
+    stdio_write(frame, FRAME_HDR_SIZE + len);
+
+    return true;
+}
+
+void log_deferred_flush(void)
+{
+    mutex_lock(&_drain_lock);
+    while (_drain_one()) {}
+    mutex_unlock(&_drain_lock);
+}
+
+void log_deferred_stats(log_deferred_stats_t *stats)
+{
+    unsigned state = irq_disable();
+
+    stats->written = _written;
+    stats->dropped = _dropped;
+    irq_restore(state);
+}
+
+static void *_drain_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        log_deferred_flush();
+        thread_flags_wait_any(LOG_DEFERRED_FLAG);
+    }
+
+    return NULL;
+}
+
+void auto_init_log_deferred(void)
+{
+    _drain_pid = thread_create(_drain_stack, sizeof(_drain_stack),
+                               LOG_DEFERRED_PRIO, 0, _drain_thread, NULL,
+                               "log");
+}
@@ -21,10 +21,12 @@
 #include "assert.h"
 #include "cpu.h"
 #include "irq.h"
+#include "kernel_defines.h"
 #include "mutex.h"
 
 #include "malloc_monitor.h"
 #include "malloc_monitor_internal.h"
+#include "malloc_pool.h"
 
 #ifndef CONFIG_MODULE_SYS_MALLOC_MONITOR_SIZE
 #define CONFIG_MODULE_SYS_MALLOC_MONITOR_SIZE 100
@@ -39,6 +41,8 @@ static struct {
     size_t size[CONFIG_MODULE_SYS_MALLOC_MONITOR_SIZE];
     size_t current;
     size_t high_watermark;
+    size_t fragmentation;
+    size_t fragmentation_high_watermark;
 } malloc_monitor = {
     .addr = {NULL},
     .current = 0,
@@ -48,6 +52,26 @@ static struct {
 /* guards access to malloc_monitor */
 static mutex_t _lock;
 
+/* bytes by which an allocation of size bytes at ptr was rounded up */
+static size_t _slack(const void *ptr, size_t size)
+{
+    if (IS_USED(MODULE_MALLOC_POOL)) {
+        size_t block_size = malloc_pool_block_size(ptr);
+        if (block_size > size) {
+            return block_size - size;
+        }
+    }
+    return 0;
+}
+
+static void _fragmentation_add(size_t slack)
+{
+    malloc_monitor.fragmentation += slack;
+    if (malloc_monitor.fragmentation > malloc_monitor.fragmentation_high_watermark) {
+        malloc_monitor.fragmentation_high_watermark = malloc_monitor.fragmentation;
+    }
+}
+
 void malloc_monitor_add(void *ptr, size_t size, uinttxtptr_t pc, char *func_prefix)
 {
     if (ptr == NULL) {
@@ -67,6 +91,7 @@ void malloc_monitor_add(void *ptr, size_t size, uinttxtptr_t pc, char *func_pref
             if (malloc_monitor.current > malloc_monitor.high_watermark) {
                 malloc_monitor.high_watermark = malloc_monitor.current;
             }
+            _fragmentation_add(_slack(ptr, size));
             mutex_unlock(&_lock);
             return;
         }
@@ -92,6 +117,7 @@ void malloc_monitor_rm(void *ptr, uinttxtptr_t pc)
         if (malloc_monitor.addr[i] == ptr) {
             malloc_monitor.addr[i] = NULL;
             malloc_monitor.current -= malloc_monitor.size[i];
+            malloc_monitor.fragmentation -= _slack(ptr, malloc_monitor.size[i]);
             mutex_unlock(&_lock);
             return;
         }
@@ -133,6 +159,8 @@ void malloc_monitor_mv(void *ptr_old, void *ptr_new, size_t size_new, uinttxtptr
             else {
                 malloc_monitor.current -= size_old - size_new;
             }
+            malloc_monitor.fragmentation -= _slack(ptr_old, size_old);
+            _fragmentation_add(_slack(ptr_new, size_new));
             mutex_unlock(&_lock);
             return;
         }
@@ -164,7 +192,26 @@ void malloc_monitor_reset_high_watermark(void)
     assert(!irq_is_in());
     mutex_lock(&_lock);
     malloc_monitor.high_watermark = malloc_monitor.current;
+    malloc_monitor.fragmentation_high_watermark = malloc_monitor.fragmentation;
     mutex_unlock(&_lock);
 }
 
+size_t malloc_monitor_get_fragmentation_current(void)
+{
+    assert(!irq_is_in());
+    mutex_lock(&_lock);
+    size_t ret = malloc_monitor.fragmentation;
+    mutex_unlock(&_lock);
+    return ret;
+}
+
+size_t malloc_monitor_get_fragmentation_high_watermark(void)
+{
+    assert(!irq_is_in());
+    mutex_lock(&_lock);
+    size_t ret = malloc_monitor.fragmentation_high_watermark;
+    mutex_unlock(&_lock);
+    return ret;
+}
+
 /** @} */
@@ -0,0 +1,301 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief   Size-class pool allocator implementation
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdalign.h>
+#include <string.h>
+
+#include "atomic_utils.h"
+#include "irq.h"
+#include "kernel_defines.h"
+#include "memarray.h"
+#include "sched.h"
+#include "thread.h"
+
+#include "malloc_pool.h"
+
+#define BLOCK_SIZE_MIN      CONFIG_MALLOC_POOL_BLOCK_SIZE_MIN
+#define BLOCKS_NUMOF        CONFIG_MALLOC_POOL_BLOCKS_NUMOF
+#define CLASS_NUMOF         CONFIG_MALLOC_POOL_CLASS_NUMOF
+
+/* the classes are laid out back to back, so class cls starts after
+ * BLOCKS_NUMOF blocks of each smaller class */
+#define CLASS_OFFSET(cls)   (BLOCKS_NUMOF * BLOCK_SIZE_MIN * ((1U << (cls)) - 1))
+#define POOL_SIZE           CLASS_OFFSET(CLASS_NUMOF)
+
+static_assert((BLOCK_SIZE_MIN & (BLOCK_SIZE_MIN - 1)) == 0,
+              "CONFIG_MALLOC_POOL_BLOCK_SIZE_MIN must be a power of two");
+static_assert((BLOCK_SIZE_MIN % alignof(max_align_t)) == 0,
+              "CONFIG_MALLOC_POOL_BLOCK_SIZE_MIN must be a multiple of alignof(max_align_t)");
+static_assert((CLASS_NUMOF > 0) && (CLASS_NUMOF < 16),
+              "CONFIG_MALLOC_POOL_CLASS_NUMOF must be between 1 and 15");
+static_assert((BLOCKS_NUMOF > 0) && (BLOCKS_NUMOF <= UINT16_MAX),
+              "CONFIG_MALLOC_POOL_BLOCKS_NUMOF must fit into an uint16_t");
+
+typedef struct {
+    memarray_t mem;
+    uint16_t used;
+    uint16_t peak;
+    uint32_t allocs;
+    uint32_t exhausted;
+} _class_t;
+
+#if IS_USED(MODULE_MALLOC_POOL_TCACHE)
+typedef struct {
+    memarray_element_t *head;
+    uint16_t count;
+    uint32_t hits;
+} _tcache_t;
+
+/* only ever accessed by the owning thread, except for the hit counters
+ * that are summed up by malloc_pool_get_stats(), hence those are only
+ * accessed atomically */
+static _tcache_t _tcache[MAXTHREADS][CLASS_NUMOF];
+#endif
+
+static alignas(BLOCK_SIZE_MIN) uint8_t _pool[POOL_SIZE];
+static _class_t _classes[CLASS_NUMOF];
+static uint32_t _oversized;
+static bool _initialized;
+static bool _enabled = true;
+
+/* must be called with interrupts disabled. The pools are initialized lazily
+ * since the C library may allocate memory before auto_init ran. */
+static void _init(void)
+{
+    for (unsigned cls = 0; cls < CLASS_NUMOF; cls++) {
+        memarray_init(&_classes[cls].mem, &_pool[CLASS_OFFSET(cls)],
+                      BLOCK_SIZE_MIN << cls, BLOCKS_NUMOF);
+    }
+    _initialized = true;
+}
+
+static unsigned _class_of_size(size_t size)
+{
+    unsigned cls = 0;
+
+    while ((BLOCK_SIZE_MIN << cls) < size) {
+        cls++;
+    }
+    return cls;
+}
+
+static int _class_of_ptr(const void *ptr)
+{
+    uintptr_t addr = (uintptr_t)ptr;
+    uintptr_t base = (uintptr_t)_pool;
+
+    if ((addr < base) || (addr >= (base + POOL_SIZE))) {
+        return -1;
+    }
+    size_t offset = addr - base;
+    unsigned cls = 0;
+    while (offset >= CLASS_OFFSET(cls + 1)) {
+        cls++;
+    }
+    /* a pointer into the middle of a block is a bug of the caller */
+    assert(((offset - CLASS_OFFSET(cls)) & ((BLOCK_SIZE_MIN << cls) - 1)) == 0);
+    return cls;
+}
+
+#if IS_USED(MODULE_MALLOC_POOL_TCACHE)
+static _tcache_t *_tcache_get(unsigned cls)
+{
+    kernel_pid_t pid = thread_getpid();
+
+    /* no thread context before the scheduler runs and in ISRs */
+    if (!pid_is_valid(pid) || irq_is_in()) {
+        return NULL;
+    }
+    return &_tcache[pid - KERNEL_PID_FIRST][cls];
+}
+#endif
+
+void *malloc_pool_alloc(size_t size)
+{
+    if (!_enabled) {
+        return NULL;
+    }
+    if (size > MALLOC_POOL_BLOCK_SIZE_MAX) {
+        unsigned state = irq_disable();
+        _oversized++;
+        irq_restore(state);
+        return NULL;
+    }
+
+    unsigned cls = _class_of_size(size);
+
+#if IS_USED(MODULE_MALLOC_POOL_TCACHE)
+    _tcache_t *tcache = _tcache_get(cls);
+    if ((tcache != NULL) && (tcache->head != NULL)) {
+        memarray_element_t *block = tcache->head;
+        tcache->head = block->next;
+        tcache->count--;
+        atomic_fetch_add_u32(&tcache->hits, 1);
+        return block;
+    }
+#endif
+
+    _class_t *class = &_classes[cls];
+    unsigned state = irq_disable();
+    if (!_initialized) {
+        _init();
+    }
+    void *ptr = memarray_alloc(&class->mem);
+    if (ptr != NULL) {
+        class->allocs++;
+        if (++class->used > class->peak) {
+            class->peak = class->used;
+        }
+    }
+    else {
+        class->exhausted++;
+    }
+    irq_restore(state);
+    return ptr;
+}
+
+bool malloc_pool_free(void *ptr)
+{
+    int cls = _class_of_ptr(ptr);
+
+    if (cls < 0) {
+        return false;
+    }
+
+#if IS_USED(MODULE_MALLOC_POOL_TCACHE)
+    _tcache_t *tcache = _tcache_get(cls);
+    if ((tcache != NULL) && (tcache->count < CONFIG_MALLOC_POOL_TCACHE_SIZE)) {
+        memarray_element_t *block = ptr;
+        block->next = tcache->head;
+        tcache->head = block;
+        tcache->count++;
+        return true;
+    }
+#endif
+
+    _class_t *class = &_classes[cls];
+    unsigned state = irq_disable();
+    memarray_free(&class->mem, ptr);
+    class->used--;
+    irq_restore(state);
+    return true;
+}
+
+void *malloc_pool_realloc(void *ptr, size_t size)
+{
+    size_t block_size = malloc_pool_block_size(ptr);
+
+    assert(block_size > 0);
+    if (size <= block_size) {
+        return ptr;
+    }
+
+    void *new = malloc_pool_alloc(size);
+    if (new != NULL) {
+        memcpy(new, ptr, block_size);
+        malloc_pool_free(ptr);
+    }
+    return new;
+}
+
+size_t malloc_pool_block_size(const void *ptr)
+{
+    int cls = _class_of_ptr(ptr);
+
+    return (cls < 0) ? 0 : (BLOCK_SIZE_MIN << cls);
+}
+
+void malloc_pool_enable(bool enable)
+{
+    _enabled = enable;
+}
+
+bool malloc_pool_is_enabled(void)
+{
+    return _enabled;
+}
+
+void malloc_pool_tcache_flush(void)
+{
+#if IS_USED(MODULE_MALLOC_POOL_TCACHE)
+    for (unsigned cls = 0; cls < CLASS_NUMOF; cls++) {
+        _tcache_t *tcache = _tcache_get(cls);
+
+        if (tcache == NULL) {
+            return;
+        }
+
+        _class_t *class = &_classes[cls];
+        unsigned state = irq_disable();
+        while (tcache->head != NULL) {
+            memarray_element_t *block = tcache->head;
+            tcache->head = block->next;
+            memarray_free(&class->mem, block);
+            class->used--;
+        }
+        tcache->count = 0;
+        irq_restore(state);
+    }
+#endif
+}
+
+int malloc_pool_get_stats(unsigned cls, malloc_pool_stats_t *stats)
+{
+    if (cls >= CLASS_NUMOF) {
+        return -EINVAL;
+    }
+
+    _class_t *class = &_classes[cls];
+    unsigned state = irq_disable();
+    stats->block_size = BLOCK_SIZE_MIN << cls;
+    stats->blocks = BLOCKS_NUMOF;
+    stats->used = class->used;
+    stats->peak = class->peak;
+    stats->allocs = class->allocs;
+    stats->exhausted = class->exhausted;
+    stats->cache_hits = 0;
+#if IS_USED(MODULE_MALLOC_POOL_TCACHE)
+    for (unsigned i = 0; i < MAXTHREADS; i++) {
+        stats->cache_hits += atomic_load_u32(&_tcache[i][cls].hits);
+    }
+#endif
+    irq_restore(state);
+    return 0;
+}
+
+uint32_t malloc_pool_get_oversized(void)
+{
+    return _oversized;
+}
+
+void malloc_pool_reset_stats(void)
+{
+    unsigned state = irq_disable();
+    for (unsigned cls = 0; cls < CLASS_NUMOF; cls++) {
+        _class_t *class = &_classes[cls];
+
+        class->peak = class->used;
+        class->allocs = 0;
+        class->exhausted = 0;
+#if IS_USED(MODULE_MALLOC_POOL_TCACHE)
+        for (unsigned i = 0; i < MAXTHREADS; i++) {
+            atomic_store_u32(&_tcache[i][cls].hits, 0);
+        }
+#endif
+    }
+    _oversized = 0;
+    irq_restore(state);
+}
+
+/** @} */
@@ -25,6 +25,7 @@
 #include "irq.h"
 #include "kernel_defines.h"
 #include "malloc_monitor_internal.h"
+#include "malloc_pool.h"
 #include "mutex.h"
 
 extern void *__real_malloc(size_t size);
@@ -36,8 +37,14 @@ static mutex_t _lock;
 void __attribute__((used)) *__wrap_malloc(size_t size)
 {
     assert(!irq_is_in());
+    void *ptr = NULL;
     mutex_lock(&_lock);
-    void *ptr = __real_malloc(size);
+    if (IS_USED(MODULE_MALLOC_POOL)) {
+        ptr = malloc_pool_alloc(size);
+    }
+    if (ptr == NULL) {
+        ptr = __real_malloc(size);
+    }
     if (IS_USED(MODULE_MALLOC_MONITOR)) {
         malloc_monitor_add(ptr, size, cpu_get_caller_pc(), "m");
     }
@@ -49,7 +56,9 @@ void __attribute__((used)) __wrap_free(void *ptr)
 {
     assert(!irq_is_in());
     mutex_lock(&_lock);
-    __real_free(ptr);
+    if (!IS_USED(MODULE_MALLOC_POOL) || !malloc_pool_free(ptr)) {
+        __real_free(ptr);
+    }
     if (IS_USED(MODULE_MALLOC_MONITOR)) {
         malloc_monitor_rm(ptr, cpu_get_caller_pc());
     }
@@ -66,8 +75,14 @@ void * __attribute__((used)) __wrap_calloc(size_t nmemb, size_t size)
         return NULL;
     }
 
+    void *res = NULL;
     mutex_lock(&_lock);
-    void *res = __real_malloc(total_size);
+    if (IS_USED(MODULE_MALLOC_POOL)) {
+        res = malloc_pool_alloc(total_size);
+    }
+    if (res == NULL) {
+        res = __real_malloc(total_size);
+    }
     if (IS_USED(MODULE_MALLOC_MONITOR)) {
         malloc_monitor_add(res, total_size, cpu_get_caller_pc(), "c");
     }
@@ -82,8 +97,33 @@ void * __attribute__((used)) __wrap_calloc(size_t nmemb, size_t size)
 void * __attribute__((used))__wrap_realloc(void *ptr, size_t size)
 {
     assert(!irq_is_in());
+    void *new = NULL;
+    size_t block_size = 0;
     mutex_lock(&_lock);
-    void *new = __real_realloc(ptr, size);
+    if (IS_USED(MODULE_MALLOC_POOL)) {
+        block_size = malloc_pool_block_size(ptr);
+        if (ptr == NULL) {
+            new = malloc_pool_alloc(size);
+        }
+    }
+
+    if (block_size > 0) {
+        /* ptr is a pool block: grow it within the pools if possible, otherwise
+         * move it to the heap */
+        if (size == 0) {
+            malloc_pool_free(ptr);
+        }
+        else if ((new = malloc_pool_realloc(ptr, size)) == NULL) {
+            new = __real_malloc(size);
+            if (new) {
+                memcpy(new, ptr, block_size);
+                malloc_pool_free(ptr);
+            }
+        }
+    }
+    else if (new == NULL) {
+        new = __real_realloc(ptr, size);
+    }
     if (IS_USED(MODULE_MALLOC_MONITOR)) {
         malloc_monitor_mv(ptr, new, size, cpu_get_caller_pc());
     }
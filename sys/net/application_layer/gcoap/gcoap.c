@@ -254,9 +254,11 @@ static void _on_sock_dtls_evt(sock_dtls_t *sock, sock_async_flags_t type, void *
             sock_dtls_session_destroy(sock, &socket.ctx_dtls_session);
         }
 
-        /* If not enough session slots left: set timeout to free up session */
+        /* If not enough session slots left: set timeout to free up session.
+         * The session cache of the sock makes room on demand instead. */
         uint8_t minimum_free = CONFIG_GCOAP_DTLS_MINIMUM_AVAILABLE_SESSIONS;
-        if (dsm_get_num_available_slots() < minimum_free)
+        if (!IS_USED(MODULE_SOCK_DTLS_SESSION_CACHE) &&
+            dsm_get_num_available_slots() < minimum_free)
         {
             uint32_t timeout = CONFIG_GCOAP_DTLS_MINIMUM_AVAILABLE_SESSIONS_TIMEOUT_MSEC;
             event_callback_init(&_dtls_session_free_up_tmout_cb,
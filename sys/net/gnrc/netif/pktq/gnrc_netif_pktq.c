@@ -14,15 +14,29 @@
  */
 
 #include <assert.h>
+#include <errno.h>
 
+#include "hashes.h"
+#include "net/gnrc/pktbuf.h"
 #include "net/gnrc/pktqueue.h"
 #include "net/gnrc/netif/conf.h"
+#include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/netif/internal.h"
 #include "net/gnrc/netif/pktq.h"
+#include "net/icmpv6.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+#include "net/sixlowpan.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+/* gnrc_netif_pktq_flow_t::len counts packets of the pool in a uint8_t */
+static_assert(CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE <= UINT8_MAX,
+              "CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE must not exceed 255");
+#endif
+
 static mutex_t _pool_lock = MUTEX_INIT;
 static gnrc_pktqueue_t _pool[CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE];
 
@@ -55,11 +69,333 @@ unsigned gnrc_netif_pktq_usage(void)
     return res;
 }
 
+#if IS_USED(MODULE_GNRC_NETTYPE_IPV6) || IS_USED(MODULE_GNRC_NETTYPE_SIXLOWPAN)
+/* the byte at offset of the data of snip and its successors, -1 if there is
+ * none */
+static int _byte_at(const gnrc_pktsnip_t *snip, size_t offset)
+{
+    while ((snip != NULL) && (offset >= snip->size)) {
+        offset -= snip->size;
+        snip = snip->next;
+    }
+    return (snip != NULL) ? ((const uint8_t *)snip->data)[offset] : -1;
+}
+
+/* only routing and neighbor discovery messages are control traffic, so e.g.
+ * an echo request flood competes with the other flows */
+static unsigned _classify_icmpv6(int type)
+{
+    switch (type) {
+    case ICMPV6_RTR_SOL:
+    case ICMPV6_RTR_ADV:
+    case ICMPV6_NBR_SOL:
+    case ICMPV6_NBR_ADV:
+    case ICMPV6_REDIRECT:
+    case ICMPV6_RPL_CTRL:
+    case ICMPV6_DAR:
+    case ICMPV6_DAC:
+        return GNRC_NETIF_PKTQ_CLASS_CONTROL;
+    default:
+        return GNRC_NETIF_PKTQ_CLASS_DEFAULT;
+    }
+}
+
+/* the IPv6 header starts at offset of the data of snip */
+static unsigned _classify_ipv6(const gnrc_pktsnip_t *snip, size_t offset,
+                               uint32_t *hash)
+{
+    const ipv6_hdr_t *ipv6 = (const ipv6_hdr_t *)((uint8_t *)snip->data + offset);
+
+    if ((snip->size - offset) < sizeof(ipv6_hdr_t)) {
+        return GNRC_NETIF_PKTQ_CLASS_DEFAULT;
+    }
+    /* source and destination address are adjacent */
+    *hash = fnv1a_32(*hash, &ipv6->src, 2 * sizeof(ipv6_addr_t));
+    if (ipv6->nh != PROTNUM_ICMPV6) {
+        return GNRC_NETIF_PKTQ_CLASS_DEFAULT;
+    }
+    return _classify_icmpv6(_byte_at(snip, offset + sizeof(ipv6_hdr_t)));
+}
+#endif
+
+#if IS_USED(MODULE_GNRC_NETTYPE_SIXLOWPAN)
+static unsigned _classify_iphc(const gnrc_pktsnip_t *snip)
+{
+    /* length of the inline traffic class and flow label by IPHC TF field */
+    static const uint8_t tf_len[] = { 4, 3, 1, 0 };
+    /* length of inline addresses by SAM/DAM field, for stateless compression
+     * and unicast destinations */
+    static const uint8_t addr_len[] = { 16, 8, 2, 0 };
+    /* ... and for multicast destinations, without DAC */
+    static const uint8_t mcast_len[] = { 16, 6, 4, 1 };
+    const uint8_t *iphc = snip->data;
+    size_t offset = SIXLOWPAN_IPHC_HDR_LEN;
+    unsigned sam, dam;
+
+    /* ICMPv6 has no NHC encoding, so the next header is always inline */
+    if ((snip->size < SIXLOWPAN_IPHC_HDR_LEN) ||
+        (iphc[0] & SIXLOWPAN_IPHC1_NH)) {
+        return GNRC_NETIF_PKTQ_CLASS_DEFAULT;
+    }
+    if (iphc[1] & SIXLOWPAN_IPHC2_CID_EXT) {
+        offset += SIXLOWPAN_IPHC_CID_EXT_LEN;
+    }
+    offset += tf_len[(iphc[0] & SIXLOWPAN_IPHC1_TF) >> 3];
+    if (_byte_at(snip, offset++) != PROTNUM_ICMPV6) {
+        return GNRC_NETIF_PKTQ_CLASS_DEFAULT;
+    }
+    if ((iphc[0] & SIXLOWPAN_IPHC1_HL) == 0) {
+        /* inline hop limit */
+        offset++;
+    }
+    sam = (iphc[1] & SIXLOWPAN_IPHC2_SAM) >> 4;
+    dam = iphc[1] & SIXLOWPAN_IPHC2_DAM;
+    /* stateful SAM 0 is the unspecified address, the others are as for
+     * stateless compression */
+    if (!(iphc[1] & SIXLOWPAN_IPHC2_SAC) || (sam != 0)) {
+        offset += addr_len[sam];
+    }
+    if (iphc[1] & SIXLOWPAN_IPHC2_M) {
+        if (!(iphc[1] & SIXLOWPAN_IPHC2_DAC)) {
+            offset += mcast_len[dam];
+        }
+        else if (dam == 0) {
+            offset += 6;
+        }
+        else {
+            /* reserved */
+            return GNRC_NETIF_PKTQ_CLASS_DEFAULT;
+        }
+    }
+    else if (!(iphc[1] & SIXLOWPAN_IPHC2_DAC) || (dam != 0)) {
+        offset += addr_len[dam];
+    }
+    else {
+        /* reserved */
+        return GNRC_NETIF_PKTQ_CLASS_DEFAULT;
+    }
+    return _classify_icmpv6(_byte_at(snip, offset));
+}
+#endif
+
+unsigned gnrc_netif_pktq_classify(const gnrc_pktsnip_t *pkt, uint32_t *flow)
+{
+    assert((pkt != NULL) && (pkt->type == GNRC_NETTYPE_NETIF));
+
+    const gnrc_netif_hdr_t *hdr = pkt->data;
+    const gnrc_pktsnip_t *payload = pkt->next;
+    unsigned cls = GNRC_NETIF_PKTQ_CLASS_DEFAULT;
+    uint32_t hash = fnv1a_32(FNV1A_32_INIT, gnrc_netif_hdr_get_dst_addr(hdr),
+                             hdr->dst_l2addr_len);
+
+    if (hdr->flags & (GNRC_NETIF_HDR_FLAGS_BROADCAST |
+                      GNRC_NETIF_HDR_FLAGS_MULTICAST)) {
+        cls = GNRC_NETIF_PKTQ_CLASS_CONTROL;
+    }
+    else if (payload == NULL) {
+        /* nothing to classify by */
+    }
+#if IS_USED(MODULE_GNRC_NETTYPE_IPV6)
+    else if (payload->type == GNRC_NETTYPE_IPV6) {
+        cls = _classify_ipv6(payload, 0, &hash);
+    }
+#endif
+#if IS_USED(MODULE_GNRC_NETTYPE_SIXLOWPAN)
+    else if ((payload->type == GNRC_NETTYPE_SIXLOWPAN) && (payload->size > 0)) {
+        uint8_t *data = payload->data;
+
+        if (sixlowpan_frag_is((sixlowpan_frag_t *)data)) {
+            /* keep all fragments of a datagram in the same flow queue, but
+             * apart from the unfragmented packets to the same destination */
+            static const uint8_t frag = SIXLOWPAN_FRAG_1_DISP;
+
+            hash = fnv1a_32(hash, &frag, sizeof(frag));
+        }
+        else if (data[0] == SIXLOWPAN_UNCOMP) {
+            cls = _classify_ipv6(payload, 1, &hash);
+        }
+        else if (sixlowpan_iphc_is(data)) {
+            cls = _classify_iphc(payload);
+        }
+    }
+#endif
+    if (flow != NULL) {
+        *flow = hash;
+    }
+    return cls;
+}
+
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+static void _stats_put(gnrc_netif_pktq_stats_t *stats)
+{
+    stats->queued++;
+    if (++stats->backlog > stats->backlog_max) {
+        stats->backlog_max = stats->backlog;
+    }
+}
+
+static gnrc_pktqueue_t *_flow_remove_head(gnrc_netif_pktq_flow_t *flow)
+{
+    gnrc_pktqueue_t *entry = gnrc_pktqueue_remove_head(&flow->queue);
+
+    if (--flow->len == 0) {
+        /* an idle flow queue must not save up deficit */
+        flow->deficit = 0;
+    }
+    return entry;
+}
+
+/* the 6LoWPAN fragment header of a queued packet, NULL if it is none */
+static sixlowpan_frag_t *_frag_hdr(const gnrc_pktsnip_t *pkt)
+{
+#if IS_USED(MODULE_GNRC_NETTYPE_SIXLOWPAN)
+    const gnrc_pktsnip_t *payload = pkt->next;
+
+    if ((payload != NULL) && (payload->type == GNRC_NETTYPE_SIXLOWPAN) &&
+        (payload->size >= sizeof(sixlowpan_frag_t)) &&
+        sixlowpan_frag_is(payload->data)) {
+        return payload->data;
+    }
+#else
+    (void)pkt;
+#endif
+    return NULL;
+}
+
+static void _drop(gnrc_netif_pktq_t *q, gnrc_pktqueue_t *entry)
+{
+    DEBUG("gnrc_netif_pktq: dropping pkt %p of longest flow queue\n",
+          (void *)entry->pkt);
+    gnrc_pktbuf_release_error(entry->pkt, ENOMEM);
+    q->stats[GNRC_NETIF_PKTQ_CLASS_DEFAULT].dropped++;
+    q->stats[GNRC_NETIF_PKTQ_CLASS_DEFAULT].backlog--;
+}
+
+/* reuses the entry of the oldest packet of the longest flow queue of the
+ * interface, unless flow is the longest one. If that packet is a 6LoWPAN
+ * fragment, the following fragments of its datagram are dropped as well,
+ * since the datagram can't be reassembled anymore. */
+static gnrc_pktqueue_t *_drop_longest(gnrc_netif_pktq_t *q,
+                                      const gnrc_netif_pktq_flow_t *flow,
+                                      gnrc_pktsnip_t *pkt)
+{
+    gnrc_netif_pktq_flow_t *longest = NULL;
+    gnrc_pktqueue_t *entry;
+
+    if (IS_ACTIVE(CONFIG_GNRC_NETIF_PKTQ_FQ_TAIL_DROP)) {
+        return NULL;
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS; i++) {
+        if ((longest == NULL) || (q->flows[i].len > longest->len)) {
+            longest = &q->flows[i];
+        }
+    }
+    if ((longest->len == 0) ||
+        ((flow != NULL) && (flow->len >= longest->len))) {
+        return NULL;
+    }
+    entry = _flow_remove_head(longest);
+    sixlowpan_frag_t *frag = _frag_hdr(entry->pkt);
+    if (frag != NULL) {
+        uint16_t tag = sixlowpan_frag_datagram_tag(frag);
+        uint16_t size = sixlowpan_frag_datagram_size(frag);
+
+        while ((longest->queue != NULL) &&
+               ((frag = _frag_hdr(longest->queue->pkt)) != NULL) &&
+               sixlowpan_frag_n_is(frag) &&
+               (sixlowpan_frag_datagram_tag(frag) == tag) &&
+               (sixlowpan_frag_datagram_size(frag) == size)) {
+            gnrc_pktqueue_t *tail = _flow_remove_head(longest);
+
+            _drop(q, tail);
+            /* return the entry to the pool */
+            tail->pkt = NULL;
+        }
+    }
+    _drop(q, entry);
+    entry->pkt = pkt;
+    return entry;
+}
+
+static int _fq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    gnrc_netif_pktq_t *q = &netif->send_queue;
+    gnrc_netif_pktq_flow_t *flow = NULL;
+    gnrc_pktqueue_t *entry;
+    uint32_t hash;
+    unsigned cls = gnrc_netif_pktq_classify(pkt, &hash);
+
+    if (cls == GNRC_NETIF_PKTQ_CLASS_DEFAULT) {
+        flow = &q->flows[hash % CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS];
+    }
+    if (((entry = _get_free_entry(pkt)) == NULL) &&
+        ((entry = _drop_longest(q, flow, pkt)) == NULL)) {
+        q->stats[cls].dropped++;
+        return -1;
+    }
+    if (flow == NULL) {
+        gnrc_pktqueue_add(&q->control, entry);
+    }
+    else {
+        gnrc_pktqueue_add(&flow->queue, entry);
+        flow->len++;
+    }
+    _stats_put(&q->stats[cls]);
+    return 0;
+}
+
+gnrc_pktsnip_t *gnrc_netif_pktq_fq_get(gnrc_netif_t *netif)
+{
+    gnrc_netif_pktq_t *q = &netif->send_queue;
+    gnrc_netif_pktq_stats_t *stats;
+    gnrc_pktqueue_t *entry;
+    gnrc_pktsnip_t *pkt;
+
+    if (q->control != NULL) {
+        entry = gnrc_pktqueue_remove_head(&q->control);
+        stats = &q->stats[GNRC_NETIF_PKTQ_CLASS_CONTROL];
+    }
+    else if (q->stats[GNRC_NETIF_PKTQ_CLASS_DEFAULT].backlog == 0) {
+        return NULL;
+    }
+    else {
+        gnrc_netif_pktq_flow_t *flow;
+        size_t size = 0;
+
+        /* deficit round robin: terminates since there is a non-empty flow
+         * queue and its deficit grows with every round */
+        while (1) {
+            flow = &q->flows[q->flow];
+            if (flow->queue != NULL) {
+                /* only the payload is sent over the link */
+                size = gnrc_pkt_len(flow->queue->pkt->next);
+                if (flow->deficit >= (int32_t)size) {
+                    break;
+                }
+                flow->deficit += CONFIG_GNRC_NETIF_PKTQ_FQ_QUANTUM;
+            }
+            q->flow = (q->flow + 1) % CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS;
+        }
+        flow->deficit -= size;
+        entry = _flow_remove_head(flow);
+        stats = &q->stats[GNRC_NETIF_PKTQ_CLASS_DEFAULT];
+    }
+    stats->sent++;
+    stats->backlog--;
+    pkt = entry->pkt;
+    entry->pkt = NULL;
+    return pkt;
+}
+#endif  /* IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ) */
+
 int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 {
     assert(netif != NULL);
     assert(pkt != NULL);
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+    return _fq_put(netif, pkt);
+#else
     gnrc_pktqueue_t *entry = _get_free_entry(pkt);
 
     if (entry == NULL) {
@@ -67,6 +403,7 @@ int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     }
     gnrc_pktqueue_add(&netif->send_queue.queue, entry);
     return 0;
+#endif
 }
 
 void gnrc_netif_pktq_sched_get(gnrc_netif_t *netif)
@@ -27,6 +27,9 @@
 #include "net/gnrc/ndp.h"
 #include "net/gnrc/netreg.h"
 #include "net/gnrc/pktqueue.h"
+#if IS_USED(MODULE_GNRC_RPL_ROUTES)
+#include "net/gnrc/rpl/routes.h"
+#endif
 #include "net/gnrc/sixlowpan/nd.h"
 #include "net/ndp.h"
 #include "net/sixlowpan/nd.h"
@@ -327,6 +330,28 @@ static bool _on_link(const ipv6_addr_t *dst, unsigned *iface)
     return false;
 }
 
+/* a host route of the RPL route store is the longest possible match, so it
+ * is taken from the route store's hash table instead of walking the off-link
+ * entries */
+static bool _rpl_host_route(const ipv6_addr_t *dst, gnrc_ipv6_nib_ft_t *route)
+{
+#if IS_USED(MODULE_GNRC_RPL_ROUTES)
+    kernel_pid_t iface;
+
+    if (gnrc_rpl_routes_get(dst, &route->next_hop, &iface) == IPV6_ADDR_BIT_LEN) {
+        route->dst = *dst;
+        route->dst_len = IPV6_ADDR_BIT_LEN;
+        route->iface = iface;
+        route->primary = 0;
+        return true;
+    }
+#else
+    (void)dst;
+    (void)route;
+#endif
+    return false;
+}
+
 static gnrc_netif_t *_acquire_new_iface(unsigned iface)
 {
     gnrc_netif_t *netif = gnrc_netif_get_by_pid(iface);
@@ -355,8 +380,10 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
     _nib_onl_entry_t *node = _nib_onl_nc_get(dst, netif ? netif->pid : 0);
     /* consider neighbor cache entries first */
     unsigned iface = (node == NULL) ? 0 : _nib_onl_get_if(node);
+    gnrc_ipv6_nib_ft_t route;
+    bool host_route = (node == NULL) && _rpl_host_route(dst, &route);
 
-    if ((node != NULL) || _on_link(dst, &iface)) {
+    if ((node != NULL) || (!host_route && _on_link(dst, &iface))) {
         DEBUG("nib: %s is %s, start address resolution\n",
               ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)),
               node ? "in NC" : "on-link");
@@ -386,11 +413,11 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
         goto out;
     }
 
-    gnrc_ipv6_nib_ft_t route;
-
     DEBUG("nib: %s is off-link, resolve route\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
-    res = _nib_get_route(dst, pkt, &route);
+    if (!host_route) {
+        res = _nib_get_route(dst, pkt, &route);
+    }
 
    /* If ARSM is not active only use link-local as next hop */
    if (!IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM) &&
@@ -63,6 +63,24 @@ static gnrc_sixlowpan_frag_rb_int_t rbuf_int[RBUF_INT_SIZE];
 
 static gnrc_sixlowpan_frag_rb_t rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
 
+static_assert(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE < UINT8_MAX,
+              "reassembly buffer index only supports up to 254 entries");
+
+/* Index of reassembly buffer entries by the hash of (source address, tag),
+ * so a fragment finds its entry without comparing the addresses of all
+ * entries. The index consists of one chain per bucket, stored as entry
+ * index + 1, so 0 terminates a chain and a zeroed index is empty.
+ * Entries are only unlinked from their chain when the slot is reused for
+ * another datagram. Removed entries thus may still be in a chain, so look-ups
+ * always check for emptiness and the full identifying tuple. */
+static uint8_t _rbuf_idx_head[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+static uint8_t _rbuf_idx_next[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+/* bucket + 1 of each entry, 0 if the entry is not linked */
+static uint8_t _rbuf_idx_bucket[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+
+/* next-fit hint for _rbuf_int_get_free() */
+static unsigned _rbuf_int_hint;
+
 static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 
 static xtimer_t _gc_timer;
@@ -180,6 +198,49 @@ void gnrc_sixlowpan_frag_rb_rm_by_datagram(const gnrc_netif_hdr_t *netif_hdr,
     }
 }
 
+static inline unsigned _rbuf_idx_bucket_of(const void *src, size_t src_len,
+                                           uint16_t tag)
+{
+    return gnrc_sixlowpan_frag_rb_hash(src, src_len, tag) %
+           CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE;
+}
+
+static void _rbuf_idx_unlink(unsigned idx)
+{
+    if (_rbuf_idx_bucket[idx] == 0) {
+        return;
+    }
+    for (uint8_t *ptr = &_rbuf_idx_head[_rbuf_idx_bucket[idx] - 1];
+         *ptr != 0; ptr = &_rbuf_idx_next[*ptr - 1]) {
+        if (*ptr == (idx + 1)) {
+            *ptr = _rbuf_idx_next[idx];
+            break;
+        }
+    }
+    _rbuf_idx_next[idx] = 0;
+    _rbuf_idx_bucket[idx] = 0;
+}
+
+static void _rbuf_idx_link(unsigned idx, unsigned bucket)
+{
+    _rbuf_idx_unlink(idx);
+    _rbuf_idx_next[idx] = _rbuf_idx_head[bucket];
+    _rbuf_idx_head[bucket] = idx + 1;
+    _rbuf_idx_bucket[idx] = bucket + 1;
+}
+
+static inline bool _rbuf_equal_index(const gnrc_sixlowpan_frag_rb_t *e,
+                                     const void *src, size_t src_len,
+                                     const void *dst, size_t dst_len,
+                                     uint16_t tag)
+{
+    return (e->pkt != NULL) && (e->super.tag == tag) &&
+           (e->super.src_len == src_len) &&
+           (e->super.dst_len == dst_len) &&
+           (memcmp(e->super.src, src, src_len) == 0) &&
+           (memcmp(e->super.dst, dst, dst_len) == 0);
+}
+
 static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_hdr,
                                                   uint16_t tag)
 {
@@ -188,15 +249,12 @@ static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_
     const uint8_t *dst = gnrc_netif_hdr_get_dst_addr(netif_hdr);
     const uint8_t src_len = netif_hdr->src_l2addr_len;
     const uint8_t dst_len = netif_hdr->dst_l2addr_len;
+    unsigned bucket = _rbuf_idx_bucket_of(src, src_len, tag);
 
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i];
+    for (uint8_t i = _rbuf_idx_head[bucket]; i != 0; i = _rbuf_idx_next[i - 1]) {
+        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i - 1];
 
-        if ((e->pkt != NULL) && (e->super.tag == tag) &&
-            (e->super.src_len == src_len) &&
-            (e->super.dst_len == dst_len) &&
-            (memcmp(e->super.src, src, src_len) == 0) &&
-            (memcmp(e->super.dst, dst, dst_len) == 0)) {
+        if (_rbuf_equal_index(e, src, src_len, dst, dst_len, tag)) {
             return e;
         }
     }
@@ -514,8 +572,13 @@ static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_frag_rb_int_t *i,
 
 static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_get_free(void)
 {
-    for (unsigned int i = 0; i < RBUF_INT_SIZE; i++) {
+    /* intervals are usually freed in the order they were allocated, so
+     * continue searching after the last allocated interval */
+    for (unsigned int n = 0; n < RBUF_INT_SIZE; n++) {
+        unsigned int i = (_rbuf_int_hint + n) % RBUF_INT_SIZE;
+
         if (rbuf_int[i].end == 0) { /* start must be smaller than end anyways*/
+            _rbuf_int_hint = (i + 1) % RBUF_INT_SIZE;
             return rbuf_int + i;
         }
     }
@@ -619,20 +682,20 @@ static int _rbuf_get(const void *src, size_t src_len,
 {
     gnrc_sixlowpan_frag_rb_t *res = NULL, *oldest = NULL;
     uint32_t now_usec = xtimer_now_usec();
+    unsigned bucket = _rbuf_idx_bucket_of(src, src_len, tag);
 
-    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        /* check first if entry already available */
-        if ((rbuf[i].pkt != NULL) && (rbuf[i].super.tag == tag) &&
+    /* check first if entry already available */
+    for (uint8_t idx = _rbuf_idx_head[bucket]; idx != 0;
+         idx = _rbuf_idx_next[idx - 1]) {
+        unsigned i = idx - 1;
+
+        if (_rbuf_equal_index(&rbuf[i], src, src_len, dst, dst_len, tag) &&
             ((IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
               /* not all SFR fragments carry the datagram size, so make 0 a
                * legal value to not compare datagram size */
               ((size == 0) || (rbuf[i].super.datagram_size == size))) ||
              (!IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              (rbuf[i].super.datagram_size == size))) &&
-            (rbuf[i].super.src_len == src_len) &&
-            (rbuf[i].super.dst_len == dst_len) &&
-            (memcmp(rbuf[i].super.src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].super.dst, dst, dst_len) == 0)) {
+              (rbuf[i].super.datagram_size == size)))) {
             DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
                   gnrc_netif_addr_to_str(rbuf[i].super.src,
                                          rbuf[i].super.src_len,
@@ -654,7 +717,9 @@ static int _rbuf_get(const void *src, size_t src_len,
             _set_rbuf_timeout();
             return i;
         }
+    }
 
+    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         /* if there is a free spot: remember it */
         if ((res == NULL) && gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
             res = &(rbuf[i]);
@@ -742,6 +807,7 @@ static int _rbuf_get(const void *src, size_t src_len,
     res->super.dst_len = dst_len;
     res->super.tag = tag;
     res->super.current_size = 0;
+    _rbuf_idx_link(res - &(rbuf[0]), bucket);
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR)
     res->offset_diff = 0U;
     memset(res->received, 0U, sizeof(res->received));
@@ -765,6 +831,10 @@ void gnrc_sixlowpan_frag_rb_reset(void)
 {
     xtimer_remove(&_gc_timer);
     memset(rbuf_int, 0, sizeof(rbuf_int));
+    _rbuf_int_hint = 0;
+    memset(_rbuf_idx_head, 0, sizeof(_rbuf_idx_head));
+    memset(_rbuf_idx_next, 0, sizeof(_rbuf_idx_next));
+    memset(_rbuf_idx_bucket, 0, sizeof(_rbuf_idx_bucket));
     for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         if ((rbuf[i].pkt != NULL) &&
             (rbuf[i].pkt->users > 0)) {
@@ -31,6 +31,17 @@
 #include "debug.h"
 
 static gnrc_sixlowpan_frag_vrb_t _vrb[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+
+static_assert(CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE < UINT8_MAX,
+              "VRB index only supports up to 254 entries");
+
+/* Index of VRB entries by the hash of (source address, tag). Works the same as
+ * the index of the reassembly buffer: chains of entry index + 1 per bucket,
+ * with entries being unlinked only when their slot is reused. */
+static uint8_t _vrb_idx_head[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+static uint8_t _vrb_idx_next[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+/* bucket + 1 of each entry, 0 if the entry is not linked */
+static uint8_t _vrb_idx_bucket[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
 #ifdef MODULE_GNRC_IPV6_NIB
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 #else   /* MODULE_GNRC_IPV6_NIB */
@@ -46,6 +57,53 @@ static inline bool _equal_index(const gnrc_sixlowpan_frag_vrb_t *vrbe,
             (memcmp(vrbe->super.src, src, src_len) == 0));
 }
 
+static inline unsigned _vrb_idx_bucket_of(const uint8_t *src, size_t src_len,
+                                          unsigned tag)
+{
+    return gnrc_sixlowpan_frag_rb_hash(src, src_len, tag) %
+           CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE;
+}
+
+static void _vrb_idx_unlink(unsigned idx)
+{
+    if (_vrb_idx_bucket[idx] == 0) {
+        return;
+    }
+    for (uint8_t *ptr = &_vrb_idx_head[_vrb_idx_bucket[idx] - 1];
+         *ptr != 0; ptr = &_vrb_idx_next[*ptr - 1]) {
+        if (*ptr == (idx + 1)) {
+            *ptr = _vrb_idx_next[idx];
+            break;
+        }
+    }
+    _vrb_idx_next[idx] = 0;
+    _vrb_idx_bucket[idx] = 0;
+}
+
+static void _vrb_idx_link(unsigned idx, unsigned bucket)
+{
+    _vrb_idx_unlink(idx);
+    _vrb_idx_next[idx] = _vrb_idx_head[bucket];
+    _vrb_idx_head[bucket] = idx + 1;
+    _vrb_idx_bucket[idx] = bucket + 1;
+}
+
+static gnrc_sixlowpan_frag_vrb_t *_vrb_lookup(const uint8_t *src,
+                                              size_t src_len, unsigned tag)
+{
+    unsigned bucket = _vrb_idx_bucket_of(src, src_len, tag);
+
+    for (uint8_t i = _vrb_idx_head[bucket]; i != 0; i = _vrb_idx_next[i - 1]) {
+        gnrc_sixlowpan_frag_vrb_t *vrbe = &_vrb[i - 1];
+
+        if (!gnrc_sixlowpan_frag_vrb_entry_empty(vrbe) &&
+            _equal_index(vrbe, src, src_len, tag)) {
+            return vrbe;
+        }
+    }
+    return NULL;
+}
+
 gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_add(
         const gnrc_sixlowpan_frag_rb_base_t *base,
         gnrc_netif_t *out_netif, const uint8_t *out_dst, size_t out_dst_len)
@@ -57,59 +115,63 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_add(
     assert(out_netif != NULL);
     assert(out_dst != NULL);
     assert(out_dst_len > 0);
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
-        gnrc_sixlowpan_frag_vrb_t *ptr = &_vrb[i];
-
-        if (gnrc_sixlowpan_frag_vrb_entry_empty(ptr) ||
-            _equal_index(ptr, base->src, base->src_len, base->tag)) {
-            vrbe = ptr;
-            if (gnrc_sixlowpan_frag_vrb_entry_empty(vrbe)) {
-                vrbe->super = *base;
-                vrbe->out_netif = out_netif;
-                memcpy(vrbe->super.dst, out_dst, out_dst_len);
-                vrbe->out_tag = gnrc_sixlowpan_frag_fb_next_tag();
-                vrbe->super.dst_len = out_dst_len;
-                DEBUG("6lo vrb: creating entry (%s, ",
-                      gnrc_netif_addr_to_str(vrbe->super.src,
+    vrbe = _vrb_lookup(base->src, base->src_len, base->tag);
+    for (unsigned i = 0; (vrbe == NULL) &&
+                         (i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE); i++) {
+        if (gnrc_sixlowpan_frag_vrb_entry_empty(&_vrb[i])) {
+            vrbe = &_vrb[i];
+        }
+    }
+    if (vrbe != NULL) {
+        if (gnrc_sixlowpan_frag_vrb_entry_empty(vrbe)) {
+            vrbe->super = *base;
+            vrbe->out_netif = out_netif;
+            memcpy(vrbe->super.dst, out_dst, out_dst_len);
+            vrbe->out_tag = gnrc_sixlowpan_frag_fb_next_tag();
+            vrbe->super.dst_len = out_dst_len;
+            _vrb_idx_link(vrbe - &_vrb[0],
+                          _vrb_idx_bucket_of(vrbe->super.src,
                                              vrbe->super.src_len,
-                                             addr_str));
-                DEBUG("%s, %u, %u) => ",
-                      gnrc_netif_addr_to_str(vrbe->super.dst,
-                                             vrbe->super.dst_len,
-                                             addr_str),
-                      (unsigned)vrbe->super.datagram_size, vrbe->super.tag);
-                DEBUG("(%s, %u)\n",
-                      gnrc_netif_addr_to_str(vrbe->super.dst,
-                                             vrbe->super.dst_len,
-                                             addr_str), vrbe->out_tag);
-            }
-            /* _equal_index() => append intervals of `base`, so they don't get
-             * lost. We use append, so we don't need to change base! */
-            else if (base->ints != NULL) {
-                gnrc_sixlowpan_frag_rb_int_t *tmp = vrbe->super.ints;
+                                             vrbe->super.tag));
+            DEBUG("6lo vrb: creating entry (%s, ",
+                  gnrc_netif_addr_to_str(vrbe->super.src,
+                                         vrbe->super.src_len,
+                                         addr_str));
+            DEBUG("%s, %u, %u) => ",
+                  gnrc_netif_addr_to_str(vrbe->super.dst,
+                                         vrbe->super.dst_len,
+                                         addr_str),
+                  (unsigned)vrbe->super.datagram_size, vrbe->super.tag);
+            DEBUG("(%s, %u)\n",
+                  gnrc_netif_addr_to_str(vrbe->super.dst,
+                                         vrbe->super.dst_len,
+                                         addr_str), vrbe->out_tag);
+        }
+        /* _equal_index() => append intervals of `base`, so they don't get
+         * lost. We use append, so we don't need to change base! */
+        else if (base->ints != NULL) {
+            gnrc_sixlowpan_frag_rb_int_t *tmp = vrbe->super.ints;
 
-                if (tmp != base->ints) {
-                    /* base->ints is not already vrbe->super.ints */
-                    if (tmp != NULL) {
-                        /* iterate before appending and check if `base->ints` is
-                         * not already part of list */
-                        while (tmp->next != NULL) {
-                            if (tmp == base->ints) {
-                                tmp = NULL;
-                                break;
-                            }
-                            tmp = tmp->next;
-                        }
-                        if (tmp != NULL) {
-                            tmp->next = base->ints;
+            if (tmp != base->ints) {
+                /* base->ints is not already vrbe->super.ints */
+                if (tmp != NULL) {
+                    /* iterate before appending and check if `base->ints` is
+                     * not already part of list */
+                    while (tmp->next != NULL) {
+                        if (tmp == base->ints) {
+                            tmp = NULL;
+                            break;
                         }
+                        tmp = tmp->next;
                     }
-                    else {
-                        vrbe->super.ints = base->ints;
+                    if (tmp != NULL) {
+                        tmp->next = base->ints;
                     }
                 }
+                else {
+                    vrbe->super.ints = base->ints;
+                }
             }
-            break;
         }
     }
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
@@ -170,16 +232,14 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_get(
     DEBUG("6lo vrb: trying to get entry for (%s, %u)\n",
           gnrc_netif_addr_to_str(src, src_len, addr_str), src_tag);
     assert(src_len != 0);
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
-        gnrc_sixlowpan_frag_vrb_t *vrbe = &_vrb[i];
+    gnrc_sixlowpan_frag_vrb_t *vrbe = _vrb_lookup(src, src_len, src_tag);
 
-        if (_equal_index(vrbe, src, src_len, src_tag)) {
-            DEBUG("6lo vrb: got VRB to (%s, %u)\n",
-                  gnrc_netif_addr_to_str(vrbe->super.dst,
-                                         vrbe->super.dst_len,
-                                         addr_str), vrbe->out_tag);
-            return vrbe;
-        }
+    if (vrbe != NULL) {
+        DEBUG("6lo vrb: got VRB to (%s, %u)\n",
+              gnrc_netif_addr_to_str(vrbe->super.dst,
+                                     vrbe->super.dst_len,
+                                     addr_str), vrbe->out_tag);
+        return vrbe;
     }
     DEBUG("6lo vrb: no entry found\n");
     return NULL;
@@ -234,6 +294,9 @@ void gnrc_sixlowpan_frag_vrb_gc(void)
 void gnrc_sixlowpan_frag_vrb_reset(void)
 {
     memset(_vrb, 0, sizeof(_vrb));
+    memset(_vrb_idx_head, 0, sizeof(_vrb_idx_head));
+    memset(_vrb_idx_next, 0, sizeof(_vrb_idx_next));
+    memset(_vrb_idx_bucket, 0, sizeof(_vrb_idx_bucket));
 }
 #endif
 
@@ -31,6 +31,7 @@
 #include "net/gnrc/nettype.h"
 #include "net/gnrc/pkt.h"
 #include "string_utils.h"
+#include "trace.h"
 
 #include "pktbuf_internal.h"
 #include "pktbuf_static.h"
@@ -437,6 +438,9 @@ static void *_pktbuf_alloc(size_t size)
         /* clear out canary */
         memset(ptr, ~GNRC_PKTBUF_CANARY, size);
     }
+#if IS_USED(MODULE_TRACE_PKTBUF)
+    trace_event(TRACE_EVENT_PKTBUF_ALLOC, size);
+#endif
 
     return (void *)ptr;
 }
@@ -471,6 +475,9 @@ void gnrc_pktbuf_free_internal(void *data, size_t size)
         assert(0);
         return;
     }
+#if IS_USED(MODULE_TRACE_PKTBUF)
+    trace_event(TRACE_EVENT_PKTBUF_FREE, _align(size));
+#endif
 
     if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
         /* check if the data has already been marked as free */
@@ -42,6 +42,9 @@
 #include "net/gnrc/rpl/p2p.h"
 #include "net/gnrc/rpl/p2p_dodag.h"
 #endif
+#ifdef MODULE_GNRC_RPL_ROUTES
+#include "net/gnrc/rpl/routes.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -49,7 +52,7 @@
 static char _stack[GNRC_RPL_STACK_SIZE];
 kernel_pid_t gnrc_rpl_pid = KERNEL_PID_UNDEF;
 const ipv6_addr_t ipv6_addr_all_rpl_nodes = GNRC_RPL_ALL_NODES_ADDR;
-#ifdef MODULE_GNRC_RPL_P2P
+#if defined(MODULE_GNRC_RPL_P2P) || defined(MODULE_GNRC_RPL_ROUTES)
 #if IS_USED(MODULE_ZTIMER_MSEC)
 static uint32_t _lt_time = GNRC_RPL_LIFETIME_UPDATE_STEP * MS_PER_SEC;
 static ztimer_t _lt_timer;
@@ -76,7 +79,7 @@ gnrc_rpl_parent_t gnrc_rpl_parents[GNRC_RPL_PARENTS_NUMOF];
 netstats_rpl_t gnrc_rpl_netstats;
 #endif
 
-#ifdef MODULE_GNRC_RPL_P2P
+#if defined(MODULE_GNRC_RPL_P2P) || defined(MODULE_GNRC_RPL_ROUTES)
 static void _update_lifetime(void);
 #endif
 static void _dao_handle_send(gnrc_rpl_dodag_t *dodag);
@@ -121,7 +124,7 @@ kernel_pid_t gnrc_rpl_init(kernel_pid_t if_pid)
 
         gnrc_rpl_of_manager_init();
         evtimer_init_msg(&gnrc_rpl_evtimer);
-#ifdef MODULE_GNRC_RPL_P2P
+#if defined(MODULE_GNRC_RPL_P2P) || defined(MODULE_GNRC_RPL_ROUTES)
 #if IS_USED(MODULE_ZTIMER_MSEC)
         ztimer_set_msg(ZTIMER_MSEC, &_lt_timer, _lt_time,
                        &_lt_msg, gnrc_rpl_pid);
@@ -366,7 +369,7 @@ static void *_event_loop(void *args)
         msg_receive(&msg);
 
         switch (msg.type) {
-#ifdef MODULE_GNRC_RPL_P2P
+#if defined(MODULE_GNRC_RPL_P2P) || defined(MODULE_GNRC_RPL_ROUTES)
             case GNRC_RPL_MSG_TYPE_LIFETIME_UPDATE:
                 DEBUG("RPL: GNRC_RPL_MSG_TYPE_LIFETIME_UPDATE received\n");
                 _update_lifetime();
@@ -425,10 +428,27 @@ static void *_event_loop(void *args)
     return NULL;
 }
 
-#ifdef MODULE_GNRC_RPL_P2P
+#if defined(MODULE_GNRC_RPL_P2P) || defined(MODULE_GNRC_RPL_ROUTES)
 void _update_lifetime(void)
 {
+#ifdef MODULE_GNRC_RPL_P2P
     gnrc_rpl_p2p_update();
+#endif
+#ifdef MODULE_GNRC_RPL_ROUTES
+    /* an aggregated forwarding table entry lives as long as its longest-lived
+     * route, so expired routes must be split off before the next DAO */
+    if (gnrc_rpl_routes_gc() > 0) {
+        for (uint8_t i = 0; i < GNRC_RPL_INSTANCES_NUMOF; i++) {
+            gnrc_rpl_dodag_t *dodag = &gnrc_rpl_instances[i].dodag;
+
+            if ((gnrc_rpl_instances[i].state != 0) &&
+                (dodag->node_status != GNRC_RPL_LEAF_NODE) &&
+                (dodag->node_status != GNRC_RPL_ROOT_NODE)) {
+                gnrc_rpl_delay_dao(dodag);
+            }
+        }
+    }
+#endif
 
 #if IS_USED(MODULE_ZTIMER_MSEC)
     ztimer_set_msg(ZTIMER_MSEC, &_lt_timer, _lt_time, &_lt_msg, gnrc_rpl_pid);
@@ -17,6 +17,7 @@
  */
 
 #include <assert.h>
+#include <errno.h>
 #include <string.h>
 #include "kernel_defines.h"
 #if IS_USED(MODULE_ZTIMER_MSEC)
@@ -44,6 +45,10 @@
 #include "net/gnrc/rpl.h"
 #include "gnrc_rpl_internal/validation.h"
 
+#ifdef MODULE_GNRC_RPL_ROUTES
+#include "net/gnrc/rpl/routes.h"
+#endif
+
 #ifdef MODULE_GNRC_RPL_P2P
 #include "net/gnrc/rpl/p2p_structs.h"
 #include "net/gnrc/rpl/p2p_dodag.h"
@@ -55,6 +60,11 @@
 
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
+#ifdef MODULE_GNRC_RPL_ROUTES
+/* set when a parsed DAO added, moved, or removed a route */
+static bool _dao_routes_changed;
+#endif
+
 /**
  * @brief   Checks validity of DIO control messages
  *
@@ -510,6 +520,33 @@ static inline char *_ip_addr_str(ipv6_addr_t *addr)
     return ipv6_addr_to_str(addr_str, addr, sizeof(addr_str));
 }
 
+static void _update_route(ipv6_addr_t *target, uint8_t target_len,
+                          ipv6_addr_t *next_hop, kernel_pid_t iface,
+                          uint32_t lifetime)
+{
+#ifdef MODULE_GNRC_RPL_ROUTES
+    int res = gnrc_rpl_routes_update(target, target_len, next_hop, iface,
+                                     lifetime);
+
+    if (res == GNRC_RPL_ROUTES_REFRESHED) {
+        return;
+    }
+    /* every other result adds or removes a forwarding table entry */
+    _dao_routes_changed = true;
+    if (res == -ENOENT) {
+        /* the route may have been installed while the route store was full */
+        gnrc_ipv6_nib_ft_del(target, target_len);
+        return;
+    }
+    if (res >= 0) {
+        return;
+    }
+    /* route store is full, fall back to the forwarding table only */
+#endif
+    gnrc_ipv6_nib_ft_del(target, target_len);
+    gnrc_ipv6_nib_ft_add(target, target_len, next_hop, iface, lifetime);
+}
+
 /** @todo allow target prefixes in target options to be of variable length */
 static bool _parse_options(int msg_type, gnrc_rpl_instance_t *inst, gnrc_rpl_opt_t *opt,
                            uint16_t len,
@@ -639,10 +676,9 @@ static bool _parse_options(int msg_type, gnrc_rpl_instance_t *inst, gnrc_rpl_opt
             DEBUG("RPL: adding FT entry %s/%d\n", _ip_addr_str(&(target->target)),
                   target->prefix_length);
 
-            gnrc_ipv6_nib_ft_del(&(target->target), target->prefix_length);
-            gnrc_ipv6_nib_ft_add(&(target->target), target->prefix_length, src,
-                                 dodag->iface,
-                                 dodag->default_lifetime * dodag->lifetime_unit);
+            _update_route(&(target->target), target->prefix_length, src,
+                          dodag->iface,
+                          dodag->default_lifetime * dodag->lifetime_unit);
             break;
 
         case (GNRC_RPL_OPT_TRANSIT):
@@ -660,12 +696,9 @@ static bool _parse_options(int msg_type, gnrc_rpl_instance_t *inst, gnrc_rpl_opt
                 DEBUG("RPL: updating FT entry %s/%d\n", _ip_addr_str(&(first_target->target)),
                       first_target->prefix_length);
 
-                gnrc_ipv6_nib_ft_del(&(first_target->target),
-                                     first_target->prefix_length);
-                gnrc_ipv6_nib_ft_add(&(first_target->target),
-                                     first_target->prefix_length, src,
-                                     dodag->iface,
-                                     transit->path_lifetime * dodag->lifetime_unit);
+                _update_route(&(first_target->target),
+                              first_target->prefix_length, src, dodag->iface,
+                              transit->path_lifetime * dodag->lifetime_unit);
 
                 first_target = (gnrc_rpl_opt_target_t *)(((uint8_t *)(first_target)) +
                                                          sizeof(gnrc_rpl_opt_t) +
@@ -1057,6 +1090,89 @@ static gnrc_pktsnip_t *_dao_transit_build(gnrc_pktsnip_t *pkt, uint8_t lifetime,
     return opt_snip;
 }
 
+/* adds the DAO base object to the options in pkt and sends it */
+static void _dao_send(gnrc_rpl_instance_t *inst, gnrc_pktsnip_t *pkt,
+                      ipv6_addr_t *destination)
+{
+    gnrc_rpl_dodag_t *dodag = &inst->dodag;
+    gnrc_pktsnip_t *tmp;
+    gnrc_rpl_dao_t *dao;
+
+    bool local_instance = (inst->id & GNRC_RPL_INSTANCE_ID_MSB) ? true : false;
+
+    if (local_instance) {
+        if ((tmp = gnrc_pktbuf_add(pkt, &dodag->dodag_id, sizeof(ipv6_addr_t),
+                                   GNRC_NETTYPE_UNDEF)) == NULL) {
+            DEBUG("RPL: Send DAO - no space left in packet buffer\n");
+            gnrc_pktbuf_release(pkt);
+            return;
+        }
+        pkt = tmp;
+    }
+
+    if ((tmp = gnrc_pktbuf_add(pkt, NULL, sizeof(gnrc_rpl_dao_t), GNRC_NETTYPE_UNDEF)) == NULL) {
+        DEBUG("RPL: Send DAO - no space left in packet buffer\n");
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    pkt = tmp;
+    dao = pkt->data;
+    dao->instance_id = inst->id;
+    if (local_instance) {
+        /* set the D flag to indicate that a DODAG id is present */
+        dao->k_d_flags = GNRC_RPL_DAO_D_BIT;
+    }
+    else {
+        dao->k_d_flags = 0;
+    }
+
+    /* set the K flag to indicate that ACKs are required */
+    dao->k_d_flags |= GNRC_RPL_DAO_K_BIT;
+    dao->dao_sequence = dodag->dao_seq;
+    dao->reserved = 0;
+
+    if ((tmp = gnrc_icmpv6_build(pkt, ICMPV6_RPL_CTRL, GNRC_RPL_ICMPV6_CODE_DAO,
+                                 sizeof(icmpv6_hdr_t))) == NULL) {
+        DEBUG("RPL: Send DAO - no space left in packet buffer\n");
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    pkt = tmp;
+
+#ifdef MODULE_NETSTATS_RPL
+    gnrc_rpl_netstats_tx_DAO(&gnrc_rpl_netstats, gnrc_pkt_len(pkt),
+                             (destination && !ipv6_addr_is_multicast(destination)));
+#endif
+
+    gnrc_rpl_send(pkt, dodag->iface, NULL, destination, &dodag->dodag_id);
+
+    dodag->dao_seq = GNRC_RPL_COUNTER_INCREMENT(dodag->dao_seq);
+}
+
+#ifdef MODULE_GNRC_RPL_ROUTES
+/* withdraws the aggregates that were split since the last DAO */
+static void _send_DAO_withdrawn(gnrc_rpl_instance_t *inst,
+                                ipv6_addr_t *destination)
+{
+    gnrc_pktsnip_t *pkt = NULL;
+    ipv6_addr_t target;
+    int target_len;
+
+    while ((target_len = gnrc_rpl_routes_pop_withdrawn(&target)) > 0) {
+        DEBUG("RPL: Send No-Path DAO - withdrawing %s/%d\n",
+              _ip_addr_str(&target), target_len);
+        if (((pkt = _dao_transit_build(pkt, 0, false)) == NULL) ||
+            ((pkt = _dao_target_build(pkt, &target, target_len)) == NULL)) {
+            DEBUG("RPL: Send No-Path DAO - no space left in packet buffer\n");
+            return;
+        }
+    }
+    if (pkt != NULL) {
+        _dao_send(inst, pkt, destination);
+    }
+}
+#endif
+
 void gnrc_rpl_send_DAO(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination, uint8_t lifetime)
 {
     gnrc_rpl_dodag_t *dodag;
@@ -1087,8 +1203,7 @@ void gnrc_rpl_send_DAO(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination, uint
         destination = &(dodag->parents->addr);
     }
 
-    gnrc_pktsnip_t *pkt = NULL, *tmp = NULL;
-    gnrc_rpl_dao_t *dao;
+    gnrc_pktsnip_t *pkt = NULL;
 
     /* find my address */
     ipv6_addr_t *me = NULL;
@@ -1106,6 +1221,12 @@ void gnrc_rpl_send_DAO(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination, uint
     }
     me = &netif->ipv6.addrs[idx];
 
+#ifdef MODULE_GNRC_RPL_ROUTES
+    /* the parent must not route a split aggregate to this node if only one of
+     * its halves is still advertised below */
+    _send_DAO_withdrawn(inst, destination);
+#endif
+
     /* add external and RPL FT entries */
     /* TODO: nib: dropped support for external transit options for now */
     void *ft_state = NULL;
@@ -1136,55 +1257,7 @@ void gnrc_rpl_send_DAO(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination, uint
         return;
     }
 
-    bool local_instance = (inst->id & GNRC_RPL_INSTANCE_ID_MSB) ? true : false;
-
-    if (local_instance) {
-        if ((tmp = gnrc_pktbuf_add(pkt, &dodag->dodag_id, sizeof(ipv6_addr_t),
-                                   GNRC_NETTYPE_UNDEF)) == NULL) {
-            DEBUG("RPL: Send DAO - no space left in packet buffer\n");
-            gnrc_pktbuf_release(pkt);
-            return;
-        }
-        pkt = tmp;
-    }
-
-    if ((tmp = gnrc_pktbuf_add(pkt, NULL, sizeof(gnrc_rpl_dao_t), GNRC_NETTYPE_UNDEF)) == NULL) {
-        DEBUG("RPL: Send DAO - no space left in packet buffer\n");
-        gnrc_pktbuf_release(pkt);
-        return;
-    }
-    pkt = tmp;
-    dao = pkt->data;
-    dao->instance_id = inst->id;
-    if (local_instance) {
-        /* set the D flag to indicate that a DODAG id is present */
-        dao->k_d_flags = GNRC_RPL_DAO_D_BIT;
-    }
-    else {
-        dao->k_d_flags = 0;
-    }
-
-    /* set the K flag to indicate that ACKs are required */
-    dao->k_d_flags |= GNRC_RPL_DAO_K_BIT;
-    dao->dao_sequence = dodag->dao_seq;
-    dao->reserved = 0;
-
-    if ((tmp = gnrc_icmpv6_build(pkt, ICMPV6_RPL_CTRL, GNRC_RPL_ICMPV6_CODE_DAO,
-                                 sizeof(icmpv6_hdr_t))) == NULL) {
-        DEBUG("RPL: Send DAO - no space left in packet buffer\n");
-        gnrc_pktbuf_release(pkt);
-        return;
-    }
-    pkt = tmp;
-
-#ifdef MODULE_NETSTATS_RPL
-    gnrc_rpl_netstats_tx_DAO(&gnrc_rpl_netstats, gnrc_pkt_len(pkt),
-                             (destination && !ipv6_addr_is_multicast(destination)));
-#endif
-
-    gnrc_rpl_send(pkt, dodag->iface, NULL, destination, &dodag->dodag_id);
-
-    dodag->dao_seq = GNRC_RPL_COUNTER_INCREMENT(dodag->dao_seq);
+    _dao_send(inst, pkt, destination);
 }
 
 void gnrc_rpl_send_DAO_ACK(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination, uint8_t seq)
@@ -1289,6 +1362,10 @@ void gnrc_rpl_recv_DAO(gnrc_rpl_dao_t *dao, kernel_pid_t iface, ipv6_addr_t *src
 #endif
 
     uint32_t included_opts = 0;
+#ifdef MODULE_GNRC_RPL_ROUTES
+    gnrc_rpl_routes_gc();
+    _dao_routes_changed = false;
+#endif
     if (!_parse_options(GNRC_RPL_ICMPV6_CODE_DAO, inst, opts, len, src, &included_opts)) {
         DEBUG("RPL: Error encountered during DAO option parsing - ignore DAO\n");
         return;
@@ -1299,6 +1376,13 @@ void gnrc_rpl_recv_DAO(gnrc_rpl_dao_t *dao, kernel_pid_t iface, ipv6_addr_t *src
         gnrc_rpl_send_DAO_ACK(inst, src, dao->dao_sequence);
     }
 
+#ifdef MODULE_GNRC_RPL_ROUTES
+    /* a DAO that only refreshed routes does not change what this node
+     * advertises, so leave it to the regular DAO refresh */
+    if (!_dao_routes_changed) {
+        return;
+    }
+#endif
     gnrc_rpl_delay_dao(dodag);
 }
 
@@ -0,0 +1,535 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+#include "evtimer.h"
+#include "hashes.h"
+#include "mutex.h"
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "timex.h"
+
+#include "net/gnrc/rpl/routes.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static_assert(CONFIG_GNRC_RPL_ROUTES_NUMOF < UINT8_MAX,
+              "CONFIG_GNRC_RPL_ROUTES_NUMOF must be smaller than 255");
+static_assert(CONFIG_GNRC_RPL_ROUTES_NEXT_HOP_NUMOF < UINT8_MAX,
+              "CONFIG_GNRC_RPL_ROUTES_NEXT_HOP_NUMOF must be smaller than 255");
+
+/* route is installed as part of an aggregated forwarding table entry */
+#define _AGGREGATED             (0x01U)
+
+/* lifetimes are clamped, so expiry times can be compared across wrap-around
+ * of the millisecond clock */
+#define _LIFETIME_MAX_MS        (UINT32_MAX / 2)
+
+typedef struct {
+    ipv6_addr_t target;     /* target prefix, all bits beyond target_len unset */
+    uint32_t expires;       /* expiry time in ms of evtimer_now_msec() */
+    uint8_t target_len;     /* 0 marks an unused entry */
+    uint8_t next_hop;       /* index + 1 into _next_hops */
+    uint8_t chain;          /* index + 1 of next entry in the same bucket */
+    uint8_t flags;
+} _route_t;
+
+typedef struct {
+    ipv6_addr_t addr;
+    kernel_pid_t iface;
+    uint8_t routes;         /* number of routes via this next hop, 0 if unused */
+} _next_hop_t;
+
+static _route_t _routes[CONFIG_GNRC_RPL_ROUTES_NUMOF];
+/* index + 1 of first entry of each bucket, 0 if bucket is empty */
+static uint8_t _buckets[CONFIG_GNRC_RPL_ROUTES_NUMOF];
+static _next_hop_t _next_hops[CONFIG_GNRC_RPL_ROUTES_NEXT_HOP_NUMOF];
+/* number of routes per target length, to only look up lengths in use */
+static uint8_t _len_count[IPV6_ADDR_BIT_LEN + 1];
+/* aggregates that were split since they were last popped for a No-Path DAO */
+static struct {
+    ipv6_addr_t target;
+    uint8_t target_len;     /* 0 marks an unused entry */
+} _withdrawn[CONFIG_GNRC_RPL_ROUTES_WITHDRAWN_NUMOF];
+static gnrc_rpl_routes_stats_t _stats;
+/* the store is updated by the RPL thread, but also queried when forwarding */
+static mutex_t _lock = MUTEX_INIT;
+
+static char addr_str[IPV6_ADDR_MAX_STR_LEN];
+
+static inline _next_hop_t *_nh(const _route_t *route)
+{
+    return &_next_hops[route->next_hop - 1];
+}
+
+static void _mask(ipv6_addr_t *out, const ipv6_addr_t *addr, uint8_t len)
+{
+    memset(out, 0, sizeof(*out));
+    ipv6_addr_init_prefix(out, addr, len);
+}
+
+static unsigned _bucket(const ipv6_addr_t *pfx, uint8_t len)
+{
+    /* all bytes containing prefix bits */
+    uint32_t hash = fnv1a_32(FNV1A_32_INIT, pfx, (len + 7U) / 8U);
+
+    return fnv1a_32(hash, &len, sizeof(len)) % CONFIG_GNRC_RPL_ROUTES_NUMOF;
+}
+
+/* pfx must be masked to len */
+static _route_t *_find_counted(const ipv6_addr_t *pfx, uint8_t len,
+                               uint32_t *probes)
+{
+    for (uint8_t i = _buckets[_bucket(pfx, len)]; i != 0;
+         i = _routes[i - 1].chain) {
+        _route_t *route = &_routes[i - 1];
+
+        (*probes)++;
+        if ((route->target_len == len) &&
+            ipv6_addr_equal(&route->target, pfx)) {
+            return route;
+        }
+    }
+    return NULL;
+}
+
+static _route_t *_find(const ipv6_addr_t *pfx, uint8_t len)
+{
+    uint32_t probes = 0;
+
+    return _find_counted(pfx, len, &probes);
+}
+
+static void _withdraw(const ipv6_addr_t *pfx, uint8_t len, bool withdraw)
+{
+    unsigned free = CONFIG_GNRC_RPL_ROUTES_WITHDRAWN_NUMOF;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_RPL_ROUTES_WITHDRAWN_NUMOF; i++) {
+        if (_withdrawn[i].target_len == 0) {
+            free = i;
+        }
+        else if ((_withdrawn[i].target_len == len) &&
+                 ipv6_addr_equal(&_withdrawn[i].target, pfx)) {
+            if (!withdraw) {
+                /* the aggregate is advertised again */
+                _withdrawn[i].target_len = 0;
+            }
+            return;
+        }
+    }
+    if (!withdraw) {
+        return;
+    }
+    if (free == CONFIG_GNRC_RPL_ROUTES_WITHDRAWN_NUMOF) {
+        /* the parent's route then only expires */
+        DEBUG("RPL routes: no space to withdraw %s/%u\n",
+              ipv6_addr_to_str(addr_str, pfx, sizeof(addr_str)), len);
+        _stats.full++;
+        return;
+    }
+    _withdrawn[free].target = *pfx;
+    _withdrawn[free].target_len = len;
+}
+
+static void _link(_route_t *route)
+{
+    unsigned bucket = _bucket(&route->target, route->target_len);
+
+    route->chain = _buckets[bucket];
+    _buckets[bucket] = (route - _routes) + 1;
+}
+
+static void _unlink(_route_t *route)
+{
+    uint8_t idx = (route - _routes) + 1;
+
+    for (uint8_t *ptr = &_buckets[_bucket(&route->target, route->target_len)];
+         *ptr != 0; ptr = &_routes[*ptr - 1].chain) {
+        if (*ptr == idx) {
+            *ptr = route->chain;
+            break;
+        }
+    }
+    route->chain = 0;
+}
+
+static uint32_t _remaining(const _route_t *route, uint32_t now)
+{
+    uint32_t remaining = route->expires - now;
+
+    if (remaining > _LIFETIME_MAX_MS) {
+        /* already expired */
+        return 1;
+    }
+    /* round up, so the forwarding table entry does not expire early */
+    return (remaining + MS_PER_SEC - 1) / MS_PER_SEC;
+}
+
+static void _nib_add(const ipv6_addr_t *pfx, uint8_t len,
+                     const _next_hop_t *nh, uint32_t lifetime)
+{
+    DEBUG("RPL routes: add FT entry %s/%u\n",
+          ipv6_addr_to_str(addr_str, pfx, sizeof(addr_str)), len);
+    gnrc_ipv6_nib_ft_add(pfx, len, &nh->addr, nh->iface, lifetime);
+    _stats.nib_ops++;
+}
+
+static void _nib_del(const ipv6_addr_t *pfx, uint8_t len)
+{
+    DEBUG("RPL routes: delete FT entry %s/%u\n",
+          ipv6_addr_to_str(addr_str, pfx, sizeof(addr_str)), len);
+    gnrc_ipv6_nib_ft_del(pfx, len);
+    _stats.nib_ops++;
+}
+
+/* the route that only differs from route in the last bit of the target
+ * prefix, if it exists with the same next hop */
+static _route_t *_buddy(const _route_t *route)
+{
+    ipv6_addr_t pfx = route->target;
+    uint8_t bit = route->target_len - 1;
+    _route_t *buddy;
+
+    if (route->target_len <= 1) {
+        return NULL;
+    }
+    pfx.u8[bit / 8] ^= 0x80U >> (bit % 8);
+    buddy = _find(&pfx, route->target_len);
+    if ((buddy != NULL) && (buddy->next_hop == route->next_hop)) {
+        return buddy;
+    }
+    return NULL;
+}
+
+static void _install_aggregate(_route_t *a, _route_t *b, uint32_t now)
+{
+    ipv6_addr_t agg;
+    uint32_t lifetime_a = _remaining(a, now);
+    uint32_t lifetime_b = _remaining(b, now);
+
+    _mask(&agg, &a->target, a->target_len - 1);
+    /* use the longer lifetime, the aggregate is split when the shorter-lived
+     * route is removed by gnrc_rpl_routes_gc() */
+    _nib_add(&agg, a->target_len - 1, _nh(a),
+             (lifetime_a > lifetime_b) ? lifetime_a : lifetime_b);
+}
+
+static void _install(_route_t *route, uint32_t now)
+{
+    _route_t *buddy = _buddy(route);
+
+    if (buddy != NULL) {
+        ipv6_addr_t agg;
+
+        assert(!(buddy->flags & _AGGREGATED));
+        _mask(&agg, &route->target, route->target_len - 1);
+        /* do not hide a route of the aggregate's length */
+        if (_find(&agg, route->target_len - 1) == NULL) {
+            DEBUG("RPL routes: aggregating %s/%u with its buddy\n",
+                  ipv6_addr_to_str(addr_str, &route->target, sizeof(addr_str)),
+                  route->target_len);
+            _nib_del(&buddy->target, buddy->target_len);
+            _install_aggregate(route, buddy, now);
+            _withdraw(&agg, route->target_len - 1, false);
+            route->flags |= _AGGREGATED;
+            buddy->flags |= _AGGREGATED;
+            _stats.aggregated += 2;
+            return;
+        }
+    }
+    _nib_add(&route->target, route->target_len, _nh(route),
+             _remaining(route, now));
+}
+
+static void _uninstall(_route_t *route, uint32_t now)
+{
+    if (route->flags & _AGGREGATED) {
+        _route_t *buddy = _buddy(route);
+        ipv6_addr_t agg;
+
+        assert((buddy != NULL) && (buddy->flags & _AGGREGATED));
+        _mask(&agg, &route->target, route->target_len - 1);
+        _nib_del(&agg, route->target_len - 1);
+        /* the parent routes the whole aggregate to this node, so it needs to
+         * be withdrawn before its halves are advertised */
+        _withdraw(&agg, route->target_len - 1, true);
+        route->flags &= ~_AGGREGATED;
+        buddy->flags &= ~_AGGREGATED;
+        _stats.aggregated -= 2;
+        _nib_add(&buddy->target, buddy->target_len, _nh(buddy),
+                 _remaining(buddy, now));
+    }
+    else {
+        _nib_del(&route->target, route->target_len);
+    }
+}
+
+/* splits an aggregate that has the same prefix as a new route */
+static void _split_aggregate(const ipv6_addr_t *pfx, uint8_t len, uint32_t now)
+{
+    _route_t *route;
+
+    if ((len >= IPV6_ADDR_BIT_LEN) ||
+        ((route = _find(pfx, len + 1)) == NULL) ||
+        !(route->flags & _AGGREGATED)) {
+        return;
+    }
+    _uninstall(route, now);
+    _install(route, now);
+}
+
+static void _next_hop_ref(uint8_t next_hop)
+{
+    if (_next_hops[next_hop - 1].routes++ == 0) {
+        _stats.next_hops++;
+    }
+}
+
+static void _next_hop_unref(uint8_t next_hop)
+{
+    assert(_next_hops[next_hop - 1].routes > 0);
+    if (--_next_hops[next_hop - 1].routes == 0) {
+        _stats.next_hops--;
+    }
+}
+
+/* returns index + 1 of the next hop, 0 if the next hop table is full */
+static uint8_t _next_hop_get(const ipv6_addr_t *addr, kernel_pid_t iface)
+{
+    uint8_t res = 0;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_RPL_ROUTES_NEXT_HOP_NUMOF; i++) {
+        _next_hop_t *nh = &_next_hops[i];
+
+        if (nh->routes == 0) {
+            if (res == 0) {
+                res = i + 1;
+            }
+        }
+        else if ((nh->iface == iface) && ipv6_addr_equal(&nh->addr, addr)) {
+            return i + 1;
+        }
+    }
+    if (res != 0) {
+        /* unused entries are only claimed by _next_hop_ref() */
+        _next_hops[res - 1].addr = *addr;
+        _next_hops[res - 1].iface = iface;
+    }
+    return res;
+}
+
+static void _remove(_route_t *route, uint32_t now)
+{
+    DEBUG("RPL routes: removing %s/%u\n",
+          ipv6_addr_to_str(addr_str, &route->target, sizeof(addr_str)),
+          route->target_len);
+    _uninstall(route, now);
+    _unlink(route);
+    _next_hop_unref(route->next_hop);
+    _len_count[route->target_len]--;
+    _stats.routes--;
+    memset(route, 0, sizeof(*route));
+}
+
+static int _update(const ipv6_addr_t *target, uint8_t target_len,
+                   const ipv6_addr_t *next_hop, kernel_pid_t iface,
+                   uint32_t lifetime)
+{
+    uint32_t now = evtimer_now_msec();
+    ipv6_addr_t pfx;
+    _route_t *route;
+    uint8_t nh;
+
+    _mask(&pfx, target, target_len);
+    route = _find(&pfx, target_len);
+    if (lifetime == 0) {
+        if (route == NULL) {
+            return -ENOENT;
+        }
+        _remove(route, now);
+        _stats.changes++;
+        return GNRC_RPL_ROUTES_REMOVED;
+    }
+    if ((nh = _next_hop_get(next_hop, iface)) == 0) {
+        DEBUG("RPL routes: next hop table full\n");
+        _stats.full++;
+        if (route != NULL) {
+            /* the caller installs the route via the new next hop directly,
+             * so don't keep the old one */
+            _remove(route, now);
+            _stats.changes++;
+        }
+        return -ENOMEM;
+    }
+    lifetime = (lifetime > (_LIFETIME_MAX_MS / MS_PER_SEC))
+             ? _LIFETIME_MAX_MS : (lifetime * MS_PER_SEC);
+    if (route == NULL) {
+        for (unsigned i = 0; i < CONFIG_GNRC_RPL_ROUTES_NUMOF; i++) {
+            if (_routes[i].target_len == 0) {
+                route = &_routes[i];
+                break;
+            }
+        }
+        if (route == NULL) {
+            DEBUG("RPL routes: route store full\n");
+            _stats.full++;
+            return -ENOMEM;
+        }
+        route->target = pfx;
+        route->target_len = target_len;
+        route->next_hop = nh;
+        route->expires = now + lifetime;
+        _link(route);
+        _next_hop_ref(nh);
+        _len_count[target_len]++;
+        if (++_stats.routes > _stats.routes_max) {
+            _stats.routes_max = _stats.routes;
+        }
+        _split_aggregate(&pfx, target_len, now);
+        _install(route, now);
+        _stats.changes++;
+        return GNRC_RPL_ROUTES_ADDED;
+    }
+    route->expires = now + lifetime;
+    if (route->next_hop == nh) {
+        if (route->flags & _AGGREGATED) {
+            _install_aggregate(route, _buddy(route), now);
+        }
+        else {
+            _nib_add(&route->target, route->target_len, _nh(route),
+                     _remaining(route, now));
+        }
+        _stats.refreshes++;
+        return GNRC_RPL_ROUTES_REFRESHED;
+    }
+    DEBUG("RPL routes: moving %s/%u to next hop %s\n",
+          ipv6_addr_to_str(addr_str, &route->target, sizeof(addr_str)),
+          route->target_len, ipv6_addr_to_str(addr_str, next_hop,
+                                              sizeof(addr_str)));
+    _uninstall(route, now);
+    _next_hop_unref(route->next_hop);
+    route->next_hop = nh;
+    _next_hop_ref(nh);
+    _install(route, now);
+    _stats.changes++;
+    return GNRC_RPL_ROUTES_MOVED;
+}
+
+int gnrc_rpl_routes_update(const ipv6_addr_t *target, uint8_t target_len,
+                           const ipv6_addr_t *next_hop, kernel_pid_t iface,
+                           uint32_t lifetime)
+{
+    assert((target != NULL) && (next_hop != NULL));
+    if ((target_len == 0) || (target_len > IPV6_ADDR_BIT_LEN)) {
+        return -EINVAL;
+    }
+    mutex_lock(&_lock);
+    int res = _update(target, target_len, next_hop, iface, lifetime);
+    mutex_unlock(&_lock);
+    return res;
+}
+
+int gnrc_rpl_routes_get(const ipv6_addr_t *dst, ipv6_addr_t *next_hop,
+                        kernel_pid_t *iface)
+{
+    uint32_t now = evtimer_now_msec();
+    int res = -ENOENT;
+
+    /* don't wait for the RPL thread, it may in turn wait for the NIB */
+    if (!mutex_trylock(&_lock)) {
+        return -EBUSY;
+    }
+    _stats.lookups++;
+    for (int len = IPV6_ADDR_BIT_LEN; len > 0; len--) {
+        ipv6_addr_t pfx;
+        _route_t *route;
+
+        if (_len_count[len] == 0) {
+            continue;
+        }
+        _mask(&pfx, dst, len);
+        route = _find_counted(&pfx, len, &_stats.probes);
+        if ((route != NULL) && ((route->expires - now) <= _LIFETIME_MAX_MS)) {
+            if (next_hop != NULL) {
+                *next_hop = _nh(route)->addr;
+            }
+            if (iface != NULL) {
+                *iface = _nh(route)->iface;
+            }
+            res = len;
+            break;
+        }
+    }
+    mutex_unlock(&_lock);
+    return res;
+}
+
+int gnrc_rpl_routes_pop_withdrawn(ipv6_addr_t *target)
+{
+    int res = -ENOENT;
+
+    mutex_lock(&_lock);
+    for (unsigned i = 0; i < CONFIG_GNRC_RPL_ROUTES_WITHDRAWN_NUMOF; i++) {
+        if (_withdrawn[i].target_len != 0) {
+            *target = _withdrawn[i].target;
+            res = _withdrawn[i].target_len;
+            _withdrawn[i].target_len = 0;
+            break;
+        }
+    }
+    mutex_unlock(&_lock);
+    return res;
+}
+
+unsigned gnrc_rpl_routes_gc(void)
+{
+    uint32_t now = evtimer_now_msec();
+    unsigned removed = 0;
+
+    mutex_lock(&_lock);
+    for (unsigned i = 0; i < CONFIG_GNRC_RPL_ROUTES_NUMOF; i++) {
+        _route_t *route = &_routes[i];
+
+        if ((route->target_len != 0) &&
+            ((route->expires - now) > _LIFETIME_MAX_MS)) {
+            _remove(route, now);
+            _stats.changes++;
+            removed++;
+        }
+    }
+    mutex_unlock(&_lock);
+    return removed;
+}
+
+void gnrc_rpl_routes_reset(void)
+{
+    uint32_t now = evtimer_now_msec();
+
+    mutex_lock(&_lock);
+    for (unsigned i = 0; i < CONFIG_GNRC_RPL_ROUTES_NUMOF; i++) {
+        if (_routes[i].target_len != 0) {
+            _remove(&_routes[i], now);
+        }
+    }
+    memset(_withdrawn, 0, sizeof(_withdrawn));
+    memset(&_stats, 0, sizeof(_stats));
+    mutex_unlock(&_lock);
+}
+
+const gnrc_rpl_routes_stats_t *gnrc_rpl_routes_stats(void)
+{
+    return &_stats;
+}
+
+/** @} */
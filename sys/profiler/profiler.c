@@ -0,0 +1,177 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_profiler
+ * @{
+ *
+ * @file
+ * @brief       Sampling CPU profiler implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "irq.h"
+#include "profiler.h"
+#include "thread.h"
+#include "ztimer.h"
+#include "ztimer/periodic.h"
+
+#ifdef CPU_NATIVE
+#include "native_internal.h"
+#else
+#include "cpu.h"
+#endif
+
+/* slots are picked by masking the hash */
+static_assert((CONFIG_PROFILER_SLOTS & (CONFIG_PROFILER_SLOTS - 1)) == 0,
+              "CONFIG_PROFILER_SLOTS must be a power of two");
+
+/* give up looking for a free slot after this many probes */
+#define PROFILER_PROBES_MAX     (8U)
+
+typedef struct {
+    uintptr_t pc;
+    uint32_t count;         /**< number of samples, 0 if the slot is unused */
+    kernel_pid_t pid;
+} _slot_t;
+
+static _slot_t _slots[CONFIG_PROFILER_SLOTS];
+static ztimer_periodic_t _timer;
+static uint32_t _samples;
+static uint32_t _dropped;
+static unsigned _used;
+
+static uintptr_t _interrupted_pc(void)
+{
+#if defined(CPU_NATIVE)
+    return _native_user_fptr;
+#elif defined(MODULE_CORTEXM_COMMON)
+#ifdef SCB_ICSR_RETTOBASE_Msk
+    /* another exception has been preempted, the frame on the process stack
+     * isn't the one of the sampled code */
+    if (!(SCB->ICSR & SCB_ICSR_RETTOBASE_Msk)) {
+        return PROFILER_PC_ISR;
+    }
+#endif
+    /* r0, r1, r2, r3, r12, lr, pc, xpsr */
+    return ((uint32_t *)__get_PSP())[6];
+#endif
+}
+
+static unsigned _hash(uintptr_t pc, kernel_pid_t pid)
+{
+    /* Fibonacci hashing, instructions are at least two bytes apart */
+    uint32_t key = (uint32_t)(pc >> 1) ^ ((uint32_t)pid << 24);
+
+    return (key * 2654435769U) >> (32 - 16);
+}
+
+static void _count(uintptr_t pc, kernel_pid_t pid)
+{
+    unsigned idx = _hash(pc, pid);
+
+    _samples++;
+    for (unsigned i = 0; i < PROFILER_PROBES_MAX; i++, idx++) {
+        _slot_t *slot = &_slots[idx % CONFIG_PROFILER_SLOTS];
+        if (slot->count == 0) {
+            slot->pc = pc;
+            slot->pid = pid;
+            slot->count = 1;
+            _used++;
+            return;
+        }
+        if (slot->pc == pc && slot->pid == pid) {
+            slot->count++;
+            return;
+        }
+    }
+    _dropped++;
+}
+
+static bool _sample(void *arg)
+{
+    (void)arg;
+
+    _count(_interrupted_pc(), thread_getpid());
+
+    return ZTIMER_PERIODIC_KEEP_GOING;
+}
+
+void profiler_start(uint32_t rate_hz)
+{
+    if (rate_hz == 0) {
+        rate_hz = CONFIG_PROFILER_RATE_HZ;
+    }
+    assert(rate_hz <= 1000000LU);
+
+    profiler_stop();
+    ztimer_periodic_init(ZTIMER_USEC, &_timer, _sample, NULL,
+                         1000000LU / rate_hz);
+    ztimer_periodic_start(&_timer);
+}
+
+void profiler_stop(void)
+{
+    /* not initialized before the first start */
+    if (_timer.clock) {
+        ztimer_periodic_stop(&_timer);
+    }
+}
+
+void profiler_reset(void)
+{
+    unsigned state = irq_disable();
+
+    memset(_slots, 0, sizeof(_slots));
+    _samples = 0;
+    _dropped = 0;
+    _used = 0;
+    irq_restore(state);
+}
+
+void profiler_stats(profiler_stats_t *stats)
+{
+    unsigned state = irq_disable();
+
+    stats->samples = _samples;
+    stats->dropped = _dropped;
+    stats->used = _used;
+    irq_restore(state);
+}
+
+void profiler_dump(void)
+{
+    profiler_stats_t stats;
+
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        thread_t *thread = thread_get(pid);
+        if (thread) {
+            const char *name = thread_get_name(thread);
+            printf("profiler: thread %" PRIkernel_pid " %s\n", pid,
+                   name ? name : "-");
+        }
+    }
+
+    for (unsigned i = 0; i < CONFIG_PROFILER_SLOTS; i++) {
+        unsigned state = irq_disable();
+        _slot_t slot = _slots[i];
+        irq_restore(state);
+
+        if (slot.count) {
+            printf("profiler: sample %" PRIkernel_pid " 0x%" PRIxPTR " %" PRIu32 "\n",
+                   slot.pid, slot.pc, slot.count);
+        }
+    }
+
+    profiler_stats(&stats);
+    printf("profiler: total %" PRIu32 " dropped %" PRIu32 "\n",
+           stats.samples, stats.dropped);
+}
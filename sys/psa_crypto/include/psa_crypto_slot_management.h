@@ -27,6 +27,9 @@ extern "C" {
 #include "clist.h"
 #include "psa/crypto.h"
 #include "psa_crypto_se_management.h"
+#if IS_USED(MODULE_PSA_ASYMMETRIC_ECC_P256R1_PRECOMP)
+#include "psa_ecc_precomp.h"
+#endif
 
 /**
  * @brief   Number of allocated slots for keys in protected memory or secure elements.
@@ -130,6 +133,16 @@ typedef struct {
 } psa_key_pair_slot_t;
 #endif /* PSA_ASYMMETRIC_KEYPAIR_COUNT */
 
+/**
+ * @brief   Key slot statistics
+ */
+typedef struct {
+    uint32_t lookups;           /**< Keys looked up by ID */
+    uint32_t hits;              /**< Lookups that found the key in a key slot */
+    uint32_t storage_reads;     /**< Persistent keys read from storage */
+    uint32_t evictions;         /**< Persistent keys wiped from memory to make room */
+} psa_key_slot_stats_t;
+
 /**
  * @brief   Initializes the allocated key slots and prepares the internal key slot lists.
  */
@@ -308,6 +321,45 @@ void psa_get_public_key_data_from_key_slot( const psa_key_slot_t *slot,
                                             uint8_t **pubkey_data,
                                             size_t **pubkey_data_len);
 
+/**
+ * @brief   Get the key slot statistics
+ *
+ * @param   stats   Statistics since @ref psa_init_key_slots
+ */
+void psa_get_key_slot_stats(psa_key_slot_stats_t *stats);
+
+#if IS_USED(MODULE_PSA_ASYMMETRIC_ECC_P256R1_PRECOMP) || defined(DOXYGEN)
+/**
+ * @brief   Get the precomputed table of a SECP 256 R1 public key
+ *
+ *          Counts a use of the key. Once the key has been used
+ *          @ref CONFIG_PSA_ECC_PRECOMP_MIN_USES times, its table is computed
+ *          and kept in a cache of @ref CONFIG_PSA_ECC_PRECOMP_CACHE_SIZE bytes,
+ *          replacing the table of the least recently used key if needed. The
+ *          uses are counted outside of the cache, so keys used only a few
+ *          times don't evict tables.
+ *
+ *          If a table is returned, the cache stays locked until
+ *          @ref psa_key_slot_release_precomp is called.
+ *
+ * @param   slot            Slot the key is stored in
+ * @param   pubkey_data     Public key of @p slot
+ * @param   pubkey_data_len Size of @p pubkey_data in bytes
+ *
+ * @return  Table of the key
+ * @return  NULL if the key doesn't have a table (yet)
+ */
+const psa_ecc_p256r1_precomp_t *psa_key_slot_get_precomp(const psa_key_slot_t *slot,
+                                                         const uint8_t *pubkey_data,
+                                                         size_t pubkey_data_len);
+
+/**
+ * @brief   Unlock the cache after a table returned by
+ *          @ref psa_key_slot_get_precomp is no longer used
+ */
+void psa_key_slot_release_precomp(void);
+#endif /* MODULE_PSA_ASYMMETRIC_ECC_P256R1_PRECOMP */
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,101 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @ingroup     sys_psa_crypto
+ * @defgroup    sys_psa_crypto_ecc_precomp  PSA ECC verification with precomputed tables
+ * @{
+ *
+ * @file        psa_ecc_precomp.h
+ * @brief       SECP 256 R1 ECDSA verification with fixed-base comb tables
+ *
+ * ECDSA verification computes `u1 * G + u2 * Q` for the base point `G` and the
+ * public key `Q`. With the comb method, a table of the 15 non-trivial sums
+ * of `P`, `2^64 P`, `2^128 P` and `2^192 P` turns a 256 bit scalar
+ * multiplication of `P` into 64 point doublings and at most 64 point
+ * additions. Both multiplications share the doublings, so a verification
+ * takes 64 doublings and up to 128 additions instead of the 256 doublings
+ * of a plain double-and-add.
+ *
+ * The table of `G` is constant and stored in ROM. The table of a public key
+ * takes @ref PSA_ECC_P256R1_PRECOMP_TABLE_SIZE bytes of RAM and costs
+ * about as much as one verification to compute, so it only pays off for keys
+ * used repeatedly. The key slot management keeps the tables of the most
+ * recently used keys in a cache, see @ref CONFIG_PSA_ECC_PRECOMP_CACHE_SIZE.
+ *
+ * Signature verification only works on public data, so this implementation
+ * does not need to run in constant time. It must not be used for signing.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#include "psa/crypto.h"
+
+/**
+ * @brief   Number of table entries, the point at infinity is not stored
+ */
+#define PSA_ECC_P256R1_PRECOMP_ENTRIES  (15U)
+
+/**
+ * @brief   Comb table of a SECP 256 R1 point
+ *
+ * Entry `i - 1` holds the affine coordinates of the sum of the points
+ * `2^(64 * j) P` for all bits `j` set in `i`, in Montgomery representation.
+ */
+typedef struct {
+    struct {
+        uint32_t x[8];  /**< x coordinate, least significant word first */
+        uint32_t y[8];  /**< y coordinate, least significant word first */
+    } p[PSA_ECC_P256R1_PRECOMP_ENTRIES];    /**< table entries */
+} psa_ecc_p256r1_precomp_t;
+
+/**
+ * @brief   RAM needed for the table of one public key
+ */
+#define PSA_ECC_P256R1_PRECOMP_TABLE_SIZE   (sizeof(psa_ecc_p256r1_precomp_t))
+
+/**
+ * @brief   Compute the comb table of a SECP 256 R1 public key
+ *
+ * @param[out]  table       table to fill
+ * @param[in]   pubkey      uncompressed public key (`0x04 || X || Y`)
+ * @param[in]   pubkey_len  length of @p pubkey
+ *
+ * @return  @ref PSA_SUCCESS
+ * @return  @ref PSA_ERROR_INVALID_ARGUMENT if @p pubkey is not a point on the curve
+ */
+psa_status_t psa_ecc_p256r1_precomp_init(psa_ecc_p256r1_precomp_t *table,
+                                         const uint8_t *pubkey, size_t pubkey_len);
+
+/**
+ * @brief   Verify an ECDSA signature using the comb table of the public key
+ *
+ *          See @ref psa_verify_hash()
+ *
+ * @param[in]   table               table of the public key
+ * @param[in]   hash                hash of the signed message
+ * @param[in]   hash_length         length of @p hash
+ * @param[in]   signature           signature (`r || s`)
+ * @param[in]   signature_length    length of @p signature
+ *
+ * @return  @ref PSA_SUCCESS
+ * @return  @ref PSA_ERROR_INVALID_SIGNATURE
+ */
+psa_status_t psa_ecc_p256r1_precomp_verify_hash(const psa_ecc_p256r1_precomp_t *table,
+                                                const uint8_t *hash, size_t hash_length,
+                                                const uint8_t *signature,
+                                                size_t signature_length);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
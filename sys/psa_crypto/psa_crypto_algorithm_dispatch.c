@@ -389,6 +389,36 @@ psa_status_t psa_algorithm_dispatch_sign_message(const psa_key_attributes_t *att
     }
 }
 
+#if IS_USED(MODULE_PSA_ASYMMETRIC_ECC_P256R1_PRECOMP)
+/**
+ * @brief   Verify with the precomputed table of the key if it has one,
+ *          with the backend otherwise
+ */
+static psa_status_t psa_ecc_p256r1_verify_hash_cached(const psa_key_attributes_t *attributes,
+                                                      psa_algorithm_t alg,
+                                                      const psa_key_slot_t *slot,
+                                                      uint8_t *pubkey_data,
+                                                      size_t pubkey_data_len,
+                                                      const uint8_t *hash,
+                                                      size_t hash_length,
+                                                      const uint8_t *signature,
+                                                      size_t signature_length)
+{
+    const psa_ecc_p256r1_precomp_t *table = psa_key_slot_get_precomp(slot, pubkey_data,
+                                                                     pubkey_data_len);
+
+    if (table == NULL) {
+        return psa_ecc_p256r1_verify_hash(attributes, alg, pubkey_data, pubkey_data_len, hash,
+                                          hash_length, signature, signature_length);
+    }
+
+    psa_status_t status = psa_ecc_p256r1_precomp_verify_hash(table, hash, hash_length,
+                                                             signature, signature_length);
+    psa_key_slot_release_precomp();
+    return status;
+}
+#endif /* MODULE_PSA_ASYMMETRIC_ECC_P256R1_PRECOMP */
+
 psa_status_t psa_algorithm_dispatch_verify_hash(  const psa_key_attributes_t *attributes,
                                                   psa_algorithm_t alg,
                                                   const psa_key_slot_t *slot,
@@ -421,8 +451,14 @@ psa_status_t psa_algorithm_dispatch_verify_hash(  const psa_key_attributes_t *at
 #endif
 #if IS_USED(MODULE_PSA_ASYMMETRIC_ECC_P256R1)
     case PSA_ECC_P256_R1:
+#if IS_USED(MODULE_PSA_ASYMMETRIC_ECC_P256R1_PRECOMP)
+        return psa_ecc_p256r1_verify_hash_cached(attributes, alg, slot, pubkey_data,
+                                                 *pubkey_data_len, hash, hash_length,
+                                                 signature, signature_length);
+#else
         return psa_ecc_p256r1_verify_hash(attributes, alg, pubkey_data, *pubkey_data_len, hash,
                                           hash_length, signature, signature_length);
+#endif
 #endif
     default:
         (void)alg;
@@ -467,9 +503,24 @@ psa_status_t psa_algorithm_dispatch_verify_message(const psa_key_attributes_t *a
 #endif
 #if IS_USED(MODULE_PSA_ASYMMETRIC_ECC_P256R1)
     case PSA_ECC_P256_R1:
+#if IS_USED(MODULE_PSA_ASYMMETRIC_ECC_P256R1_PRECOMP)
+    {
+        uint8_t hash[PSA_HASH_MAX_SIZE];
+        size_t hash_length;
+        psa_status_t status = psa_hash_compute(PSA_ALG_GET_HASH(alg), input, input_length,
+                                               hash, sizeof(hash), &hash_length);
+        if (status != PSA_SUCCESS) {
+            return status;
+        }
+        return psa_ecc_p256r1_verify_hash_cached(attributes, alg, slot, pubkey_data,
+                                                 *pubkey_data_len, hash, hash_length,
+                                                 signature, signature_length);
+    }
+#else
         return psa_ecc_p256r1_verify_message(attributes, alg, pubkey_data, *pubkey_data_len, input,
                                         input_length, signature, signature_length);
 #endif
+#endif
 #if IS_USED(MODULE_PSA_ASYMMETRIC_ECC_ED25519)
     case PSA_ECC_ED25519:
         assert(*pubkey_data_len == 32);
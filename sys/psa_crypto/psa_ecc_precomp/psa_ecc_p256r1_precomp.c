@@ -0,0 +1,599 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_psa_crypto_ecc_precomp
+ * @{
+ *
+ * @file
+ * @brief       SECP 256 R1 ECDSA verification with fixed-base comb tables
+ *
+ * Field and scalar elements are stored as eight 32 bit words, least
+ * significant word first, and multiplied in Montgomery representation.
+ * Points are kept in Jacobian coordinates, a point with Z = 0 is the point
+ * at infinity.
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "psa_ecc_precomp.h"
+
+#define WORDS           (8U)
+/* number of columns of the comb, 256 bits / 4 teeth */
+#define COMB_COLUMNS    (64U)
+
+typedef struct {
+    uint32_t x[WORDS];
+    uint32_t y[WORDS];
+    uint32_t z[WORDS];
+} _point_t;
+
+typedef struct {
+    const uint32_t *m;      /**< modulus */
+    const uint32_t *r2;     /**< R^2 mod m, R = 2^256 */
+    const uint32_t *one;    /**< R mod m */
+    const uint32_t *exp;    /**< m - 2 for inversion */
+    uint32_t m0inv;         /**< -m^-1 mod 2^32 */
+} _mod_t;
+
+static const uint32_t _p[WORDS] = {
+    0xffffffff, 0xffffffff, 0xffffffff, 0x00000000,
+    0x00000000, 0x00000000, 0x00000001, 0xffffffff
+};
+static const uint32_t _p_r2[WORDS] = {
+    0x00000003, 0x00000000, 0xffffffff, 0xfffffffb,
+    0xfffffffe, 0xffffffff, 0xfffffffd, 0x00000004
+};
+static const uint32_t _p_one[WORDS] = {
+    0x00000001, 0x00000000, 0x00000000, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xfffffffe, 0x00000000
+};
+static const uint32_t _p_exp[WORDS] = {
+    0xfffffffd, 0xffffffff, 0xffffffff, 0x00000000,
+    0x00000000, 0x00000000, 0x00000001, 0xffffffff
+};
+/* curve parameter b in Montgomery representation, a is -3 */
+static const uint32_t _b[WORDS] = {
+    0x29c4bddf, 0xd89cdf62, 0x78843090, 0xacf005cd,
+    0xf7212ed6, 0xe5a220ab, 0x04874834, 0xdc30061d
+};
+
+static const uint32_t _n[WORDS] = {
+    0xfc632551, 0xf3b9cac2, 0xa7179e84, 0xbce6faad,
+    0xffffffff, 0xffffffff, 0x00000000, 0xffffffff
+};
+static const uint32_t _n_r2[WORDS] = {
+    0xbe79eea2, 0x83244c95, 0x49bd6fa6, 0x4699799c,
+    0x2b6bec59, 0x2845b239, 0xf3d95620, 0x66e12d94
+};
+static const uint32_t _n_one[WORDS] = {
+    0x039cdaaf, 0x0c46353d, 0x58e8617b, 0x43190552,
+    0x00000000, 0x00000000, 0xffffffff, 0x00000000
+};
+static const uint32_t _n_exp[WORDS] = {
+    0xfc63254f, 0xf3b9cac2, 0xa7179e84, 0xbce6faad,
+    0xffffffff, 0xffffffff, 0x00000000, 0xffffffff
+};
+
+static const _mod_t _mod_p = {
+    .m = _p, .r2 = _p_r2, .one = _p_one, .exp = _p_exp, .m0inv = 0x00000001,
+};
+
+static const _mod_t _mod_n = {
+    .m = _n, .r2 = _n_r2, .one = _n_one, .exp = _n_exp, .m0inv = 0xee00bc4f,
+};
+
+/* comb table of the base point */
+static const psa_ecc_p256r1_precomp_t _g_table = {
+    .p = {
+        {   /* G */
+            .x = { 0x18a9143c, 0x79e730d4, 0x5fedb601, 0x75ba95fc,
+                   0x77622510, 0x79fb732b, 0xa53755c6, 0x18905f76 },
+            .y = { 0xce95560a, 0xddf25357, 0xba19e45c, 0x8b4ab8e4,
+                   0xdd21f325, 0xd2e88688, 0x25885d85, 0x8571ff18 },
+        },
+        {   /* 2^64 G */
+            .x = { 0x16a0d2bb, 0x4f922fc5, 0x1a623499, 0x0d5cc16c,
+                   0x57c62c8b, 0x9241cf3a, 0xfd1b667f, 0x2f5e6961 },
+            .y = { 0xf5a01797, 0x5c15c70b, 0x60956192, 0x3d20b44d,
+                   0x071fdb52, 0x04911b37, 0x8d6f0f7b, 0xf648f916 },
+        },
+        {   /* G + 2^64 G */
+            .x = { 0xe137bbbc, 0x9e566847, 0x8a6a0bec, 0xe434469e,
+                   0x79d73463, 0xb1c42761, 0x133d0015, 0x5abe0285 },
+            .y = { 0xc04c7dab, 0x92aa837c, 0x43260c07, 0x573d9f4c,
+                   0x78e6cc37, 0x0c931562, 0x6b6f7383, 0x94bb725b },
+        },
+        {   /* 2^128 G */
+            .x = { 0xbfe20925, 0x62a8c244, 0x8fdce867, 0x91c19ac3,
+                   0xdd387063, 0x5a96a5d5, 0x21d324f6, 0x61d587d4 },
+            .y = { 0xa37173ea, 0xe87673a2, 0x53778b65, 0x23848008,
+                   0x05bab43e, 0x10f8441e, 0x4621efbe, 0xfa11fe12 },
+        },
+        {   /* G + 2^128 G */
+            .x = { 0x2cb19ffd, 0x1c891f2b, 0xb1923c23, 0x01ba8d5b,
+                   0x8ac5ca8e, 0xb6d03d67, 0x1f13bedc, 0x586eb04c },
+            .y = { 0x27e8ed09, 0x0c35c6e5, 0x1819ede2, 0x1e81a33c,
+                   0x56c652fa, 0x278fd6c0, 0x70864f11, 0x19d5ac08 },
+        },
+        {   /* 2^64 G + 2^128 G */
+            .x = { 0xd2b533d5, 0x62577734, 0xa1bdddc0, 0x673b8af6,
+                   0xa79ec293, 0x577e7c9a, 0xc3b266b1, 0xbb6de651 },
+            .y = { 0xb65259b3, 0xe7e9303a, 0xd03a7480, 0xd6a0afd3,
+                   0x9b3cfc27, 0xc5ac83d1, 0x5d18b99b, 0x60b4619a },
+        },
+        {   /* G + 2^64 G + 2^128 G */
+            .x = { 0x1ae5aa1c, 0xbd6a38e1, 0x49e73658, 0xb8b7652b,
+                   0xee5f87ed, 0x0b130014, 0xaeebffcd, 0x9d0f27b2 },
+            .y = { 0x7a730a55, 0xca924631, 0xddbbc83a, 0x9c955b2f,
+                   0xac019a71, 0x07c1dfe0, 0x356ec48d, 0x244a566d },
+        },
+        {   /* 2^192 G */
+            .x = { 0xf4f8b16a, 0x56f8410e, 0xc47b266a, 0x97241afe,
+                   0x6d9c87c1, 0x0a406b8e, 0xcd42ab1b, 0x803f3e02 },
+            .y = { 0x04dbec69, 0x7f0309a8, 0x3bbad05f, 0xa83b85f7,
+                   0xad8e197f, 0xc6097273, 0x5067adc1, 0xc097440e },
+        },
+        {   /* G + 2^192 G */
+            .x = { 0xc379ab34, 0x846a56f2, 0x841df8d1, 0xa8ee068b,
+                   0x176c68ef, 0x20314459, 0x915f1f30, 0xf1af32d5 },
+            .y = { 0x5d75bd50, 0x99c37531, 0xf72f67bc, 0x837cffba,
+                   0x48d7723f, 0x0613a418, 0xe2d41c8b, 0x23d0f130 },
+        },
+        {   /* 2^64 G + 2^192 G */
+            .x = { 0xd5be5a2b, 0xed93e225, 0x5934f3c6, 0x6fe79983,
+                   0x22626ffc, 0x43140926, 0x7990216a, 0x50bbb4d9 },
+            .y = { 0xe57ec63e, 0x378191c6, 0x181dcdb2, 0x65422c40,
+                   0x0236e0f6, 0x41a8099b, 0x01fe49c3, 0x2b100118 },
+        },
+        {   /* G + 2^64 G + 2^192 G */
+            .x = { 0x9b391593, 0xfc68b5c5, 0x598270fc, 0xc385f5a2,
+                   0xd19adcbb, 0x7144f3aa, 0x83fbae0c, 0xdd558999 },
+            .y = { 0x74b82ff4, 0x93b88b8e, 0x71e734c9, 0xd2e03c40,
+                   0x43c0322a, 0x9a7a9eaf, 0x149d6041, 0xe6e4c551 },
+        },
+        {   /* 2^128 G + 2^192 G */
+            .x = { 0x80ec21fe, 0x5fe14bfe, 0xc255be82, 0xf6ce116a,
+                   0x2f4a5d67, 0x98bc5a07, 0xdb7e63af, 0xfad27148 },
+            .y = { 0x29ab05b3, 0x90c0b6ac, 0x4e251ae6, 0x37a9a83c,
+                   0xc2aade7d, 0x0a7dc875, 0x9f0e1a84, 0x77387de3 },
+        },
+        {   /* G + 2^128 G + 2^192 G */
+            .x = { 0xa56c0dd7, 0x1e9ecc49, 0x46086c74, 0xa5cffcd8,
+                   0xf505aece, 0x8f7a1408, 0xbef0c47e, 0xb37b85c0 },
+            .y = { 0xcc0e6a8f, 0x3596b6e4, 0x6b388f23, 0xfd6d4bbf,
+                   0xc39cef4e, 0xaba453fa, 0xf9f628d5, 0x9c135ac8 },
+        },
+        {   /* 2^64 G + 2^128 G + 2^192 G */
+            .x = { 0x95c8f8be, 0x0a1c7294, 0x3bf362bf, 0x2961c480,
+                   0xdf63d4ac, 0x9e418403, 0x91ece900, 0xc109f9cb },
+            .y = { 0x58945705, 0xc2d095d0, 0xddeb85c0, 0xb9083d96,
+                   0x7a40449b, 0x84692b8d, 0x2eee1ee1, 0x9bc3344f },
+        },
+        {   /* G + 2^64 G + 2^128 G + 2^192 G */
+            .x = { 0x42913074, 0x0d5ae356, 0x48a542b1, 0x55491b27,
+                   0xb310732a, 0x469ca665, 0x5f1a4cc1, 0x29591d52 },
+            .y = { 0xb84f983f, 0xe76f5b6b, 0x9f5f84e1, 0xbe7eef41,
+                   0x80baa189, 0x1200d496, 0x18ef332c, 0x6376551f },
+        },
+    },
+};
+
+static int _cmp(const uint32_t *a, const uint32_t *b)
+{
+    for (unsigned i = WORDS; i-- > 0;) {
+        if (a[i] != b[i]) {
+            return a[i] > b[i] ? 1 : -1;
+        }
+    }
+    return 0;
+}
+
+static bool _is_zero(const uint32_t *a)
+{
+    uint32_t acc = 0;
+
+    for (unsigned i = 0; i < WORDS; i++) {
+        acc |= a[i];
+    }
+    return acc == 0;
+}
+
+static uint32_t _add(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+    uint64_t c = 0;
+
+    for (unsigned i = 0; i < WORDS; i++) {
+        c += (uint64_t)a[i] + b[i];
+        r[i] = c;
+        c >>= 32;
+    }
+    return c;
+}
+
+static uint32_t _sub(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+    int64_t c = 0;
+
+    for (unsigned i = 0; i < WORDS; i++) {
+        c += (int64_t)a[i] - b[i];
+        r[i] = c;
+        c >>= 32;
+    }
+    return c ? 1 : 0;
+}
+
+static void _load_be(uint32_t *r, const uint8_t *buf)
+{
+    for (unsigned i = 0; i < WORDS; i++) {
+        r[WORDS - 1 - i] = byteorder_bebuftohl(&buf[4 * i]);
+    }
+}
+
+static void _mod_add(uint32_t *r, const uint32_t *a, const uint32_t *b,
+                     const _mod_t *mod)
+{
+    if (_add(r, a, b) || _cmp(r, mod->m) >= 0) {
+        _sub(r, r, mod->m);
+    }
+}
+
+static void _mod_sub(uint32_t *r, const uint32_t *a, const uint32_t *b,
+                     const _mod_t *mod)
+{
+    if (_sub(r, a, b)) {
+        _add(r, r, mod->m);
+    }
+}
+
+/* r = a * b / R mod m (CIOS), a and b must be reduced */
+static void _mont_mul(uint32_t *r, const uint32_t *a, const uint32_t *b,
+                      const _mod_t *mod)
+{
+    uint32_t t[WORDS + 2] = { 0 };
+
+    for (unsigned i = 0; i < WORDS; i++) {
+        uint64_t c = 0;
+        for (unsigned j = 0; j < WORDS; j++) {
+            c += (uint64_t)a[j] * b[i] + t[j];
+            t[j] = c;
+            c >>= 32;
+        }
+        c += t[WORDS];
+        t[WORDS] = c;
+        t[WORDS + 1] = c >> 32;
+
+        uint32_t q = t[0] * mod->m0inv;
+        c = ((uint64_t)q * mod->m[0] + t[0]) >> 32;
+        for (unsigned j = 1; j < WORDS; j++) {
+            c += (uint64_t)q * mod->m[j] + t[j];
+            t[j - 1] = c;
+            c >>= 32;
+        }
+        c += t[WORDS];
+        t[WORDS - 1] = c;
+        t[WORDS] = t[WORDS + 1] + (c >> 32);
+    }
+
+    if (t[WORDS] || _cmp(t, mod->m) >= 0) {
+        _sub(t, t, mod->m);
+    }
+    memcpy(r, t, WORDS * sizeof(uint32_t));
+}
+
+/* r = a^-1, a in Montgomery representation, by Fermat's little theorem */
+static void _mont_inv(uint32_t *r, const uint32_t *a, const _mod_t *mod)
+{
+    uint32_t t[WORDS];
+
+    memcpy(t, mod->one, sizeof(t));
+    for (unsigned i = 256; i-- > 0;) {
+        _mont_mul(t, t, t, mod);
+        if ((mod->exp[i / 32] >> (i % 32)) & 1) {
+            _mont_mul(t, t, a, mod);
+        }
+    }
+    memcpy(r, t, sizeof(t));
+}
+
+static void _fmul(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+    _mont_mul(r, a, b, &_mod_p);
+}
+
+static void _fsqr(uint32_t *r, const uint32_t *a)
+{
+    _mont_mul(r, a, a, &_mod_p);
+}
+
+static void _fadd(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+    _mod_add(r, a, b, &_mod_p);
+}
+
+static void _fsub(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+    _mod_sub(r, a, b, &_mod_p);
+}
+
+/* r = 2 * a, "dbl-2001-b" for a = -3, r may be a */
+static void _double(_point_t *r, const _point_t *a)
+{
+    uint32_t delta[WORDS], gamma[WORDS], beta[WORDS], alpha[WORDS], t[WORDS];
+
+    _fsqr(delta, a->z);
+    _fsqr(gamma, a->y);
+    _fmul(beta, a->x, gamma);
+
+    /* alpha = 3 * (x - delta) * (x + delta) */
+    _fsub(t, a->x, delta);
+    _fadd(alpha, a->x, delta);
+    _fmul(alpha, alpha, t);
+    _fadd(t, alpha, alpha);
+    _fadd(alpha, alpha, t);
+
+    /* z3 = (y + z)^2 - gamma - delta */
+    _fadd(t, a->y, a->z);
+    _fsqr(t, t);
+    _fsub(t, t, gamma);
+    _fsub(r->z, t, delta);
+
+    /* x3 = alpha^2 - 8 * beta */
+    _fadd(beta, beta, beta);
+    _fadd(beta, beta, beta);
+    _fsqr(t, alpha);
+    _fsub(t, t, beta);
+    _fsub(r->x, t, beta);
+
+    /* y3 = alpha * (4 * beta - x3) - 8 * gamma^2 */
+    _fsub(t, beta, r->x);
+    _fmul(t, alpha, t);
+    _fsqr(gamma, gamma);
+    _fadd(gamma, gamma, gamma);
+    _fadd(gamma, gamma, gamma);
+    _fadd(gamma, gamma, gamma);
+    _fsub(r->y, t, gamma);
+}
+
+/* r += (x2, y2), "madd-2007-bl" */
+static void _add_affine(_point_t *r, const uint32_t *x2, const uint32_t *y2)
+{
+    uint32_t z1z1[WORDS], u2[WORDS], s2[WORDS], h[WORDS], hh[WORDS];
+    uint32_t i[WORDS], j[WORDS], rr[WORDS], v[WORDS];
+
+    if (_is_zero(r->z)) {
+        memcpy(r->x, x2, sizeof(r->x));
+        memcpy(r->y, y2, sizeof(r->y));
+        memcpy(r->z, _p_one, sizeof(r->z));
+        return;
+    }
+
+    _fsqr(z1z1, r->z);
+    _fmul(u2, x2, z1z1);
+    _fmul(s2, y2, r->z);
+    _fmul(s2, s2, z1z1);
+    _fsub(h, u2, r->x);
+    _fsub(rr, s2, r->y);
+
+    if (_is_zero(h)) {
+        if (_is_zero(rr)) {
+            _double(r, r);
+        }
+        else {
+            memset(r->z, 0, sizeof(r->z));
+        }
+        return;
+    }
+
+    _fadd(rr, rr, rr);
+    _fsqr(hh, h);
+    _fadd(i, hh, hh);
+    _fadd(i, i, i);
+    _fmul(j, h, i);
+    _fmul(v, r->x, i);
+
+    /* z3 = (z1 + h)^2 - z1z1 - hh */
+    _fadd(r->z, r->z, h);
+    _fsqr(r->z, r->z);
+    _fsub(r->z, r->z, z1z1);
+    _fsub(r->z, r->z, hh);
+
+    /* x3 = rr^2 - j - 2 * v */
+    _fsqr(r->x, rr);
+    _fsub(r->x, r->x, j);
+    _fsub(r->x, r->x, v);
+    _fsub(r->x, r->x, v);
+
+    /* y3 = rr * (v - x3) - 2 * y1 * j */
+    _fsub(v, v, r->x);
+    _fmul(v, rr, v);
+    _fmul(j, r->y, j);
+    _fadd(j, j, j);
+    _fsub(r->y, v, j);
+}
+
+static void _to_affine(uint32_t *x, uint32_t *y, const _point_t *a)
+{
+    uint32_t zinv[WORDS], t[WORDS];
+
+    _mont_inv(zinv, a->z, &_mod_p);
+    _fsqr(t, zinv);
+    _fmul(x, a->x, t);
+    _fmul(t, t, zinv);
+    _fmul(y, a->y, t);
+}
+
+static unsigned _comb_index(const uint32_t *k, unsigned col)
+{
+    unsigned idx = 0;
+
+    for (unsigned tooth = 0; tooth < 4; tooth++) {
+        unsigned bit = col + tooth * COMB_COLUMNS;
+        idx |= ((k[bit / 32] >> (bit % 32)) & 1) << tooth;
+    }
+    return idx;
+}
+
+psa_status_t psa_ecc_p256r1_precomp_init(psa_ecc_p256r1_precomp_t *table,
+                                         const uint8_t *pubkey, size_t pubkey_len)
+{
+    /* Z coordinates of the entries and their running products for the
+     * simultaneous inversion */
+    uint32_t z[PSA_ECC_P256R1_PRECOMP_ENTRIES][WORDS];
+    uint32_t prod[PSA_ECC_P256R1_PRECOMP_ENTRIES][WORDS];
+    uint32_t x[WORDS], y[WORDS], t[WORDS];
+    _point_t acc;
+
+    if (pubkey_len != 65 || pubkey[0] != 0x04) {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    _load_be(x, &pubkey[1]);
+    _load_be(y, &pubkey[33]);
+    if (_cmp(x, _p) >= 0 || _cmp(y, _p) >= 0) {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    _fmul(x, x, _p_r2);
+    _fmul(y, y, _p_r2);
+
+    /* y^2 = x^3 - 3 * x + b */
+    _fsqr(t, x);
+    _fmul(t, t, x);
+    _fsub(t, t, x);
+    _fsub(t, t, x);
+    _fsub(t, t, x);
+    _fadd(t, t, _b);
+    _fsqr(acc.y, y);
+    if (_cmp(t, acc.y) != 0) {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    /* the teeth 2^(64 * j) P go to entry 2^j - 1, they are added to the
+     * other entries and therefore converted to affine coordinates first */
+    memcpy(table->p[0].x, x, sizeof(x));
+    memcpy(table->p[0].y, y, sizeof(y));
+    memcpy(acc.x, x, sizeof(x));
+    memcpy(acc.y, y, sizeof(y));
+    memcpy(acc.z, _p_one, sizeof(acc.z));
+    for (unsigned tooth = 1; tooth < 4; tooth++) {
+        for (unsigned i = 0; i < COMB_COLUMNS; i++) {
+            _double(&acc, &acc);
+        }
+        _to_affine(table->p[(1U << tooth) - 1].x, table->p[(1U << tooth) - 1].y, &acc);
+    }
+
+    /* every other entry adds its highest tooth to the entry without it,
+     * the results stay in Jacobian coordinates until all are done */
+    for (unsigned i = 1; i <= PSA_ECC_P256R1_PRECOMP_ENTRIES; i++) {
+        unsigned top = 1U << (31 - __builtin_clz(i));
+        if (i == top) {
+            memcpy(z[i - 1], _p_one, sizeof(z[i - 1]));
+            continue;
+        }
+        memcpy(acc.x, table->p[i - top - 1].x, sizeof(acc.x));
+        memcpy(acc.y, table->p[i - top - 1].y, sizeof(acc.y));
+        memcpy(acc.z, z[i - top - 1], sizeof(acc.z));
+        _add_affine(&acc, table->p[top - 1].x, table->p[top - 1].y);
+        memcpy(table->p[i - 1].x, acc.x, sizeof(acc.x));
+        memcpy(table->p[i - 1].y, acc.y, sizeof(acc.y));
+        memcpy(z[i - 1], acc.z, sizeof(acc.z));
+    }
+
+    /* Montgomery's trick: a single inversion for all entries */
+    memcpy(prod[0], z[0], sizeof(prod[0]));
+    for (unsigned i = 1; i < PSA_ECC_P256R1_PRECOMP_ENTRIES; i++) {
+        _fmul(prod[i], prod[i - 1], z[i]);
+    }
+    _mont_inv(t, prod[PSA_ECC_P256R1_PRECOMP_ENTRIES - 1], &_mod_p);
+    for (unsigned i = PSA_ECC_P256R1_PRECOMP_ENTRIES; i-- > 0;) {
+        /* t = 1 / (z[0] * ... * z[i]) */
+        if (i) {
+            _fmul(x, t, prod[i - 1]);
+            _fmul(t, t, z[i]);
+        }
+        else {
+            memcpy(x, t, sizeof(x));
+        }
+        _fsqr(y, x);
+        _fmul(table->p[i].x, table->p[i].x, y);
+        _fmul(y, y, x);
+        _fmul(table->p[i].y, table->p[i].y, y);
+    }
+
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_ecc_p256r1_precomp_verify_hash(const psa_ecc_p256r1_precomp_t *table,
+                                                const uint8_t *hash, size_t hash_length,
+                                                const uint8_t *signature,
+                                                size_t signature_length)
+{
+    uint32_t r[WORDS], s[WORDS], e[WORDS], w[WORDS], u1[WORDS], u2[WORDS];
+    uint8_t buf[32] = { 0 };
+    _point_t acc;
+
+    if (signature_length != 64) {
+        return PSA_ERROR_INVALID_SIGNATURE;
+    }
+    _load_be(r, signature);
+    _load_be(s, &signature[32]);
+    if (_is_zero(r) || _is_zero(s) || _cmp(r, _n) >= 0 || _cmp(s, _n) >= 0) {
+        return PSA_ERROR_INVALID_SIGNATURE;
+    }
+
+    /* the leftmost 256 bits of the hash */
+    if (hash_length > sizeof(buf)) {
+        hash_length = sizeof(buf);
+    }
+    memcpy(&buf[sizeof(buf) - hash_length], hash, hash_length);
+    _load_be(e, buf);
+    if (_cmp(e, _n) >= 0) {
+        _sub(e, e, _n);
+    }
+
+    /* u1 = e / s, u2 = r / s */
+    _mont_mul(w, s, _n_r2, &_mod_n);
+    _mont_inv(w, w, &_mod_n);
+    _mont_mul(u1, e, w, &_mod_n);
+    _mont_mul(u2, r, w, &_mod_n);
+
+    /* u1 * G + u2 * Q */
+    memset(&acc, 0, sizeof(acc));
+    for (unsigned col = COMB_COLUMNS; col-- > 0;) {
+        _double(&acc, &acc);
+        unsigned idx = _comb_index(u1, col);
+        if (idx) {
+            _add_affine(&acc, _g_table.p[idx - 1].x, _g_table.p[idx - 1].y);
+        }
+        idx = _comb_index(u2, col);
+        if (idx) {
+            _add_affine(&acc, table->p[idx - 1].x, table->p[idx - 1].y);
+        }
+    }
+    if (_is_zero(acc.z)) {
+        return PSA_ERROR_INVALID_SIGNATURE;
+    }
+
+    /* x = X / Z^2 < p < 2 * n, so x mod n = r means x = r or x = r + n,
+     * compare without inverting Z */
+    _fsqr(acc.z, acc.z);
+    _fmul(w, r, _p_r2);
+    _fmul(w, w, acc.z);
+    if (_cmp(w, acc.x) == 0) {
+        return PSA_SUCCESS;
+    }
+    if (_add(r, r, _n) == 0 && _cmp(r, _p) < 0) {
+        _fmul(w, r, _p_r2);
+        _fmul(w, w, acc.z);
+        if (_cmp(w, acc.x) == 0) {
+            return PSA_SUCCESS;
+        }
+    }
+
+    return PSA_ERROR_INVALID_SIGNATURE;
+}
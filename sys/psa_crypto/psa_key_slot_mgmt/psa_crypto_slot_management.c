@@ -18,6 +18,9 @@
  * @}
  */
 
+#include <inttypes.h>
+#include <stdbool.h>
+
 #include "clist.h"
 #include "psa_crypto_slot_management.h"
 #include "architecture.h"
@@ -47,6 +50,90 @@
 #endif
 #endif /* MODULE_PSA_PERSISTENT_STORAGE */
 
+#if IS_USED(MODULE_PSA_ASYMMETRIC_ECC_P256R1_PRECOMP)
+#include <assert.h>
+
+#include "mutex.h"
+
+/**
+ * @brief   Cached precomputed table of a public key
+ */
+typedef struct {
+    const psa_key_slot_t *slot;         /**< Slot of the key, NULL if unused */
+    psa_key_id_t id;                    /**< ID of the key */
+    uint32_t last_use;                  /**< Value of @ref precomp_clock at the last use */
+    psa_ecc_p256r1_precomp_t table;     /**< Precomputed table */
+} psa_precomp_entry_t;
+
+/**
+ * @brief   Use count of a public key without a cached table
+ */
+typedef struct {
+    const psa_key_slot_t *slot;         /**< Slot of the key, NULL if unused */
+    psa_key_id_t id;                    /**< ID of the key */
+    uint32_t last_use;                  /**< Value of @ref precomp_clock at the last use */
+    uint16_t uses;                      /**< Number of uses */
+} psa_precomp_count_t;
+
+/**
+ * @brief   Number of keys fitting into the RAM budget
+ */
+#define PSA_ECC_PRECOMP_KEY_COUNT \
+    (CONFIG_PSA_ECC_PRECOMP_CACHE_SIZE / sizeof(psa_precomp_entry_t))
+
+static_assert(PSA_ECC_PRECOMP_KEY_COUNT > 0,
+              "CONFIG_PSA_ECC_PRECOMP_CACHE_SIZE is too small for a single key");
+
+/**
+ * @brief   Number of keys whose uses are counted until they get a table
+ *
+ * Counting in a separate small array keeps keys that are only used once or
+ * twice from evicting the tables of frequently used keys.
+ */
+#define PSA_ECC_PRECOMP_COUNT_COUNT (2 * PSA_ECC_PRECOMP_KEY_COUNT)
+
+/**
+ * @brief   Cache of precomputed tables
+ */
+static psa_precomp_entry_t precomp_cache[PSA_ECC_PRECOMP_KEY_COUNT];
+
+/**
+ * @brief   Use counts of keys without a cached table
+ */
+static psa_precomp_count_t precomp_counts[PSA_ECC_PRECOMP_COUNT_COUNT];
+
+/**
+ * @brief   Counter to find the least recently used entry
+ */
+static uint32_t precomp_clock;
+
+/**
+ * @brief   Lock of @ref precomp_cache
+ */
+static mutex_t precomp_lock = MUTEX_INIT;
+
+/**
+ * @brief   Drop the cached table of a key slot that is wiped
+ *
+ * @param   slot    Key slot
+ */
+static void psa_precomp_invalidate(const psa_key_slot_t *slot)
+{
+    mutex_lock(&precomp_lock);
+    for (size_t i = 0; i < PSA_ECC_PRECOMP_KEY_COUNT; i++) {
+        if (precomp_cache[i].slot == slot) {
+            precomp_cache[i].slot = NULL;
+        }
+    }
+    for (size_t i = 0; i < PSA_ECC_PRECOMP_COUNT_COUNT; i++) {
+        if (precomp_counts[i].slot == slot) {
+            precomp_counts[i].slot = NULL;
+        }
+    }
+    mutex_unlock(&precomp_lock);
+}
+#endif /* MODULE_PSA_ASYMMETRIC_ECC_P256R1_PRECOMP */
+
 #if PSA_PROTECTED_KEY_COUNT
 /**
  * @brief   Array containing the protected key slots
@@ -93,6 +180,135 @@ static clist_node_t key_slot_list;
  */
 static psa_key_id_t key_id_count = PSA_KEY_ID_VOLATILE_MIN;
 
+/**
+ * @brief   Number of entries of the key ID index, at least twice the number of
+ *          key slots to keep the probe sequences short
+ */
+#define PSA_KEY_INDEX_SIZE      (2 * PSA_KEY_SLOT_COUNT + 1)
+
+/**
+ * @brief   Entry of the key ID index
+ */
+typedef struct {
+    psa_key_slot_t *slot;       /**< Slot containing the key, NULL if the entry is unused */
+    psa_key_id_t id;            /**< ID of the key */
+    uint32_t last_use;          /**< Value of @ref key_index_clock at the last lookup */
+} psa_key_index_entry_t;
+
+/**
+ * @brief   Index of the used key slots by key ID
+ *
+ *          Open addressing with linear probing, the home position of a key is its
+ *          ID modulo @ref PSA_KEY_INDEX_SIZE. Consecutive IDs, as assigned to
+ *          volatile keys, therefore never collide.
+ */
+static psa_key_index_entry_t key_index[PSA_KEY_INDEX_SIZE];
+
+/**
+ * @brief   Counter to find the least recently used persistent key
+ */
+static uint32_t key_index_clock;
+
+/**
+ * @brief   Key slot statistics
+ */
+static psa_key_slot_stats_t key_slot_stats;
+
+/**
+ * @brief   Get the home position of a key ID in @ref key_index
+ */
+static size_t psa_key_index_home(psa_key_id_t id)
+{
+    return id % PSA_KEY_INDEX_SIZE;
+}
+
+/**
+ * @brief   Find the index entry of a key ID
+ *
+ * @param   id  Key ID
+ *
+ * @return  Index entry of the key, NULL if no slot contains the key
+ */
+static psa_key_index_entry_t *psa_key_index_find(psa_key_id_t id)
+{
+    size_t pos = psa_key_index_home(id);
+
+    for (size_t i = 0; i < PSA_KEY_INDEX_SIZE; i++) {
+        psa_key_index_entry_t *entry = &key_index[pos];
+        if (entry->slot == NULL) {
+            return NULL;
+        }
+        if (entry->id == id) {
+            return entry;
+        }
+        pos = (pos + 1) % PSA_KEY_INDEX_SIZE;
+    }
+    return NULL;
+}
+
+/**
+ * @brief   Add a key slot to the index
+ *
+ *          There are more index entries than key slots, so there always is a
+ *          free entry.
+ *
+ * @param   id      ID of the key in @p slot
+ * @param   slot    Key slot
+ */
+static void psa_key_index_add(psa_key_id_t id, psa_key_slot_t *slot)
+{
+    size_t pos = psa_key_index_home(id);
+
+    while (key_index[pos].slot != NULL) {
+        pos = (pos + 1) % PSA_KEY_INDEX_SIZE;
+    }
+    key_index[pos].slot = slot;
+    key_index[pos].id = id;
+    key_index[pos].last_use = ++key_index_clock;
+}
+
+/**
+ * @brief   Remove a key slot from the index
+ *
+ *          Entries following the removed one are moved back, so lookups never
+ *          need to skip deleted entries.
+ *
+ * @param   slot    Key slot
+ */
+static void psa_key_index_remove(const psa_key_slot_t *slot)
+{
+    size_t pos;
+
+    for (pos = 0; pos < PSA_KEY_INDEX_SIZE; pos++) {
+        if (key_index[pos].slot == slot) {
+            break;
+        }
+    }
+    if (pos == PSA_KEY_INDEX_SIZE) {
+        return;
+    }
+
+    size_t next = pos;
+    while (1) {
+        key_index[pos].slot = NULL;
+        do {
+            next = (next + 1) % PSA_KEY_INDEX_SIZE;
+            if (key_index[next].slot == NULL) {
+                return;
+            }
+            /* an entry can't move in front of its home position */
+            size_t home = psa_key_index_home(key_index[next].id);
+            bool stays = (pos <= next) ? (pos < home && home <= next)
+                                       : (pos < home || home <= next);
+            if (!stays) {
+                break;
+            }
+        } while (1);
+        key_index[pos] = key_index[next];
+        pos = next;
+    }
+}
+
 /**
  * @brief   Get the correct empty slot list, depending on the key type
  *
@@ -120,6 +336,9 @@ static clist_node_t * psa_get_empty_key_slot_list(const psa_key_attributes_t *at
 
 void psa_init_key_slots(void)
 {
+    memset(key_index, 0, sizeof(key_index));
+    memset(&key_slot_stats, 0, sizeof(key_slot_stats));
+
 #if PSA_PROTECTED_KEY_COUNT
     memset(protected_key_slots, 0, sizeof(protected_key_slots));
 
@@ -169,6 +388,10 @@ static void psa_wipe_real_slot_type(psa_key_slot_t *slot)
 {
     psa_key_attributes_t attr = slot->attr;
 
+#if IS_USED(MODULE_PSA_ASYMMETRIC_ECC_P256R1_PRECOMP)
+    psa_precomp_invalidate(slot);
+#endif
+
     if (!psa_key_lifetime_is_external(attr.lifetime)) {
         if (!PSA_KEY_TYPE_IS_KEY_PAIR(attr.type)) {
             memset(slot, 0, sizeof(psa_key_slot_t));
@@ -205,6 +428,8 @@ psa_status_t psa_wipe_key_slot(psa_key_slot_t *slot)
 
     psa_key_slot_t *tmp = container_of(n, psa_key_slot_t, node);
 
+    psa_key_index_remove(tmp);
+
     /* Wipe slot associated with node */
     psa_wipe_real_slot_type(tmp);
 
@@ -215,6 +440,8 @@ psa_status_t psa_wipe_key_slot(psa_key_slot_t *slot)
 
 void psa_wipe_all_key_slots(void)
 {
+    memset(key_index, 0, sizeof(key_index));
+
     /* Move all list items to empty lists */
     while (!clist_is_empty(&key_slot_list)) {
         clist_node_t *to_remove = clist_rpop(&key_slot_list);
@@ -226,49 +453,6 @@ void psa_wipe_all_key_slots(void)
     }
 }
 
-/**
- * @brief   Check whether a given key ID equals the ID of the given node.
- *
- *          This is the break condition of the @ref clist_foreach function used
- *          in @ref psa_get_and_lock_key_slot_in_memory.
- *          clist_foreach iterates over all key slots and calls this function
- *          to compare each slot's key ID to the given input key ID.
- *          If they are equal, this function returns True and breaks the foreach
- *          loop.
- *
- *          For more information see core/lib/include/clist.h.
- *
- * @param   n   Pointer to clist node referencing a key slot
- * @param   arg Pointer to required key ID
- * @return  int
- *          1 if input ID equals node ID
- *          0 otherwise
- */
-static int node_id_equals_key_id(clist_node_t *n, void *arg)
-{
-    psa_key_slot_t *slot = container_of(n, psa_key_slot_t, node);
-    psa_key_id_t id = *((psa_key_id_t *)arg);
-
-    if (slot->attr.id == id) {
-        return 1;
-    }
-
-    return 0;
-}
-
-#if IS_USED(MODULE_PSA_PERSISTENT_STORAGE)
-static int node_lifetime_is_persistent(clist_node_t *n, void *arg)
-{
-    psa_key_slot_t *slot = container_of(n, psa_key_slot_t, node);
-    if (!PSA_KEY_LIFETIME_IS_VOLATILE(slot->attr.lifetime)) {
-        return 1;
-    }
-
-    (void) arg;
-    return 0;
-}
-#endif /* MODULE_PSA_PERSISTENT_STORAGE */
-
 /**
  * @brief   Find the key slot containing the key with a specified ID
  *
@@ -284,12 +468,15 @@ static psa_status_t psa_get_and_lock_key_slot_in_memory(psa_key_id_t id, psa_key
 {
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
 
-    clist_node_t *slot_node = clist_foreach(&key_slot_list, node_id_equals_key_id, &id);
-    if (slot_node == NULL) {
+    psa_key_index_entry_t *entry = psa_key_index_find(id);
+    if (entry == NULL) {
         return PSA_ERROR_DOES_NOT_EXIST;
     }
 
-    psa_key_slot_t *slot = container_of(slot_node, psa_key_slot_t, node);
+    entry->last_use = ++key_index_clock;
+    key_slot_stats.hits++;
+
+    psa_key_slot_t *slot = entry->slot;
     status = psa_lock_key_slot(slot);
     if (status == PSA_SUCCESS) {
         *p_slot = slot;
@@ -312,6 +499,7 @@ static psa_status_t psa_get_persisted_key_slot_from_storage(psa_key_id_t id,
     size_t cbor_encoded_len;
     psa_key_attributes_t attr = psa_key_attributes_init();
 
+    key_slot_stats.storage_reads++;
     psa_status_t status = psa_read_encoded_key_slot_from_file(id, cbor_buf, sizeof(cbor_buf),
                                                               &cbor_encoded_len);
     if (status != PSA_SUCCESS) {
@@ -356,18 +544,41 @@ psa_status_t psa_persist_key_slot_in_storage(psa_key_slot_t *slot)
 /**
  * @brief   Find and wipe a persistent key slot in local storage to make room for a new key
  *
+ *          The least recently used persistent key that is stored in the same type of key
+ *          slot and that is not in use is wiped. It is read from storage again when needed.
+ *
+ * @param   empty_list  List of empty slots the slot is supposed to be appended to
+ *
  * @return  PSA_SUCCESS
  * @return  PSA_ERROR_INSUFFICIENT_STORAGE  No persistent key found in local storage
  *          PSA_ERROR_DOES_NOT_EXIST
  */
-static psa_status_t psa_find_and_wipe_persistent_key_from_local_storage(void)
+static psa_status_t psa_find_and_wipe_persistent_key_from_local_storage(clist_node_t *empty_list)
 {
-    clist_node_t *slot_node = clist_foreach(&key_slot_list, node_lifetime_is_persistent, NULL);
-    if (slot_node == NULL) {
+    psa_key_index_entry_t *lru = NULL;
+
+    for (size_t i = 0; i < PSA_KEY_INDEX_SIZE; i++) {
+        psa_key_index_entry_t *entry = &key_index[i];
+        psa_key_slot_t *slot = entry->slot;
+
+        if (slot == NULL ||
+            PSA_KEY_LIFETIME_IS_VOLATILE(slot->attr.lifetime) ||
+            psa_is_key_slot_locked(slot) ||
+            psa_get_empty_key_slot_list(&slot->attr) != empty_list) {
+            continue;
+        }
+        if (lru == NULL ||
+            key_index_clock - entry->last_use > key_index_clock - lru->last_use) {
+            lru = entry;
+        }
+    }
+    if (lru == NULL) {
         return PSA_ERROR_INSUFFICIENT_STORAGE;
     }
 
-    return psa_wipe_key_slot(container_of(slot_node, psa_key_slot_t, node));
+    DEBUG("Key Slot MGMT: Evicting persistent key %" PRIu32 "\n", (uint32_t)lru->id);
+    key_slot_stats.evictions++;
+    return psa_wipe_key_slot(lru->slot);
 }
 #endif /* MODULE_PSA_PERSISTENT_STORAGE */
 
@@ -377,6 +588,7 @@ psa_status_t psa_get_and_lock_key_slot(psa_key_id_t id, psa_key_slot_t **p_slot)
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
 
     *p_slot = NULL;
+    key_slot_stats.lookups++;
 
     /* Try to find key in volatile key slot list */
     status = psa_get_and_lock_key_slot_in_memory(id, p_slot);
@@ -414,7 +626,7 @@ static psa_status_t psa_allocate_key_slot_in_list(psa_key_slot_t **p_slot,
 #if IS_USED(MODULE_PSA_PERSISTENT_STORAGE)
         /* If no slots left: Look for slot in list with persistent key
            (key will be stored in persistent memory and slot can be reused) */
-        psa_status_t status = psa_find_and_wipe_persistent_key_from_local_storage();
+        psa_status_t status = psa_find_and_wipe_persistent_key_from_local_storage(empty_list);
         if (status != PSA_SUCCESS) {
             DEBUG("Key Slot MGMT: No PSA Key Slot available\n");
             return status;
@@ -476,6 +688,7 @@ psa_status_t psa_allocate_empty_key_slot(psa_key_id_t *id,
             DEBUG("Key Slot MGMT: invalid lifetime or ID\n");
             return PSA_ERROR_INVALID_ARGUMENT;
         }
+        psa_key_index_add(*id, new_slot);
         *p_slot = new_slot;
 
         return PSA_SUCCESS;
@@ -633,3 +846,106 @@ void psa_get_public_key_data_from_key_slot(const psa_key_slot_t *slot, uint8_t *
     *pubkey_data_len = &((psa_prot_key_slot_t *)slot)->key.pubkey_data_len;
 #endif
 }
+
+#if IS_USED(MODULE_PSA_ASYMMETRIC_ECC_P256R1_PRECOMP)
+/**
+ * @brief   Count a use of a key without a cached table
+ *
+ * @param   slot    Key slot
+ *
+ * @return  Number of uses of the key, including this one
+ */
+static uint16_t psa_precomp_count_use(const psa_key_slot_t *slot)
+{
+    psa_precomp_count_t *count = NULL;
+
+    for (size_t i = 0; i < PSA_ECC_PRECOMP_COUNT_COUNT; i++) {
+        if (precomp_counts[i].slot == slot && precomp_counts[i].id == slot->attr.id) {
+            count = &precomp_counts[i];
+            break;
+        }
+    }
+
+    if (count == NULL) {
+        /* replace an unused or the least recently used counter */
+        count = &precomp_counts[0];
+        for (size_t i = 0; i < PSA_ECC_PRECOMP_COUNT_COUNT && count->slot; i++) {
+            if (precomp_counts[i].slot == NULL ||
+                precomp_clock - precomp_counts[i].last_use >
+                precomp_clock - count->last_use) {
+                count = &precomp_counts[i];
+            }
+        }
+        count->slot = slot;
+        count->id = slot->attr.id;
+        count->uses = 0;
+    }
+
+    count->last_use = precomp_clock;
+    count->uses++;
+
+    if (count->uses >= CONFIG_PSA_ECC_PRECOMP_MIN_USES) {
+        /* the key gets a table now, or never if its public key is invalid */
+        count->slot = NULL;
+    }
+    return count->uses;
+}
+
+const psa_ecc_p256r1_precomp_t *psa_key_slot_get_precomp(const psa_key_slot_t *slot,
+                                                         const uint8_t *pubkey_data,
+                                                         size_t pubkey_data_len)
+{
+    psa_precomp_entry_t *entry = NULL;
+
+    mutex_lock(&precomp_lock);
+    ++precomp_clock;
+
+    for (size_t i = 0; i < PSA_ECC_PRECOMP_KEY_COUNT; i++) {
+        if (precomp_cache[i].slot == slot && precomp_cache[i].id == slot->attr.id) {
+            entry = &precomp_cache[i];
+            break;
+        }
+    }
+
+    if (entry == NULL) {
+        if (psa_precomp_count_use(slot) < CONFIG_PSA_ECC_PRECOMP_MIN_USES) {
+            mutex_unlock(&precomp_lock);
+            return NULL;
+        }
+
+        /* replace an unused or the least recently used entry */
+        entry = &precomp_cache[0];
+        for (size_t i = 0; i < PSA_ECC_PRECOMP_KEY_COUNT && entry->slot; i++) {
+            if (precomp_cache[i].slot == NULL ||
+                precomp_clock - precomp_cache[i].last_use >
+                precomp_clock - entry->last_use) {
+                entry = &precomp_cache[i];
+            }
+        }
+        entry->slot = NULL;
+        if (psa_ecc_p256r1_precomp_init(&entry->table, pubkey_data,
+                                        pubkey_data_len) != PSA_SUCCESS) {
+            /* let the backend reject the key */
+            mutex_unlock(&precomp_lock);
+            return NULL;
+        }
+        DEBUG("PSA Precomp: computed table of key %" PRIu32 "\n",
+              (uint32_t)slot->attr.id);
+        entry->slot = slot;
+        entry->id = slot->attr.id;
+    }
+
+    entry->last_use = precomp_clock;
+    return &entry->table;
+}
+
+void psa_key_slot_release_precomp(void)
+{
+    mutex_unlock(&precomp_lock);
+}
+#endif /* MODULE_PSA_ASYMMETRIC_ECC_P256R1_PRECOMP */
+
+void psa_get_key_slot_stats(psa_key_slot_stats_t *stats)
+{
+    *stats = key_slot_stats;
+}
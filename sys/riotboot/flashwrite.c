@@ -24,6 +24,7 @@
 #include <string.h>
 
 #include "architecture.h"
+#include "kernel_defines.h"
 #include "riotboot/flashwrite.h"
 #include "riotboot/slot.h"
 #include "od.h"
@@ -154,7 +155,10 @@ int riotboot_flashwrite_putbytes(riotboot_flashwrite_t *state,
                        state->flashpage_buf, RIOTBOOT_FLASHPAGE_BUFFER_SIZE);
             }
             else {
-                flashpage_write((uint8_t *)addr + flashpage_pos,
+                /* The buffer holds the whole write block, which starts
+                 * flashwrite_buffer_pos bytes before the position of this
+                 * chunk if the chunk started in the middle of the block. */
+                flashpage_write((uint8_t *)addr + flashpage_pos - flashwrite_buffer_pos,
                                 state->flashpage_buf,
                                 RIOTBOOT_FLASHPAGE_BUFFER_SIZE);
             }
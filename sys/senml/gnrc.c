@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_senml_gnrc
+ * @{
+ *
+ * @file
+ * @brief       SenML CBOR encoding into GNRC packet snips
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+
+#include "senml/cbor.h"
+#include "senml/gnrc.h"
+#include "senml/phydat.h"
+
+#if IS_USED(MODULE_GNRC_UDP)
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/udp.h"
+#endif
+
+gnrc_pktsnip_t *senml_gnrc_encode_cbor(gnrc_pktsnip_t *next,
+                                       senml_gnrc_encode_t encode, void *arg)
+{
+    nanocbor_encoder_t enc;
+
+    /* without a buffer, nanocbor only counts the bytes */
+    nanocbor_encoder_init(&enc, NULL, 0);
+    if (encode(&enc, arg) < 0) {
+        return NULL;
+    }
+    size_t len = nanocbor_encoded_len(&enc);
+
+    gnrc_pktsnip_t *snip = gnrc_pktbuf_add(next, NULL, len, GNRC_NETTYPE_UNDEF);
+    if (snip == NULL) {
+        return NULL;
+    }
+
+    nanocbor_encoder_init(&enc, snip->data, snip->size);
+    if ((encode(&enc, arg) < 0) || (nanocbor_encoded_len(&enc) != len)) {
+        /* the encoder isn't deterministic */
+        assert(0);
+        gnrc_pktbuf_remove_snip(snip, snip);
+        return NULL;
+    }
+
+    return snip;
+}
+
+typedef struct {
+    const char *name;
+    const phydat_t *data;
+    uint8_t dim;
+} _phydat_arg_t;
+
+static int _encode_phydat(nanocbor_encoder_t *enc, void *arg)
+{
+    const _phydat_arg_t *p = arg;
+
+    nanocbor_fmt_array(enc, p->dim);
+    for (uint8_t i = 0; i < p->dim; i++) {
+        if (p->data->unit == UNIT_BOOL) {
+            senml_bool_value_t val = { .attr = { .name = p->name } };
+            phydat_to_senml_bool(&val, p->data, i);
+            senml_encode_bool_cbor(enc, &val);
+        }
+        else {
+            senml_value_t val = { .attr = { .name = p->name } };
+            phydat_to_senml_decimal(&val, p->data, i);
+            senml_encode_value_cbor(enc, &val);
+        }
+    }
+
+    return 0;
+}
+
+gnrc_pktsnip_t *senml_gnrc_encode_phydat(gnrc_pktsnip_t *next,
+                                         const char *name,
+                                         const phydat_t *data, uint8_t dim)
+{
+    _phydat_arg_t arg = { .name = name, .data = data, .dim = dim };
+
+    return senml_gnrc_encode_cbor(next, _encode_phydat, &arg);
+}
+
+#if IS_USED(MODULE_GNRC_UDP)
+int senml_gnrc_send_udp(gnrc_pktsnip_t *payload, const ipv6_addr_t *dst,
+                        uint16_t dst_port, uint16_t src_port,
+                        gnrc_netif_t *netif)
+{
+    gnrc_pktsnip_t *pkt;
+
+    assert((payload != NULL) && (dst != NULL));
+    if ((pkt = gnrc_udp_hdr_build(payload, src_port, dst_port)) == NULL) {
+        gnrc_pktbuf_release(payload);
+        return -ENOMEM;
+    }
+    payload = pkt;
+    if ((pkt = gnrc_ipv6_hdr_build(payload, NULL, dst)) == NULL) {
+        gnrc_pktbuf_release(payload);
+        return -ENOMEM;
+    }
+    if (netif != NULL) {
+        gnrc_pktsnip_t *netif_hdr = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+
+        if (netif_hdr == NULL) {
+            gnrc_pktbuf_release(pkt);
+            return -ENOMEM;
+        }
+        gnrc_netif_hdr_set_netif(netif_hdr->data, netif);
+        pkt = gnrc_pkt_prepend(pkt, netif_hdr);
+    }
+    if (!gnrc_netapi_dispatch_send(GNRC_NETTYPE_UDP, GNRC_NETREG_DEMUX_CTX_ALL,
+                                   pkt)) {
+        gnrc_pktbuf_release(pkt);
+        return -ENOTCONN;
+    }
+    return 0;
+}
+#endif
@@ -50,6 +50,21 @@ static int _benchmark_udp_handler(int argc, char **argv)
             bench_port = atoi(argv[3]);
         }
     }
+    if (strcmp(argv[1], "stats") == 0) {
+        char line[192];
+        benchmark_udp_format_t format = BENCH_FORMAT_JSON;
+
+        if (argc > 2 && strcmp(argv[2], "csv") == 0) {
+            benchmark_udp_latency_format(line, sizeof(line), NULL,
+                                         BENCH_FORMAT_CSV_HEADER);
+            puts(line);
+            format = BENCH_FORMAT_CSV;
+        }
+        benchmark_udp_latency_format(line, sizeof(line),
+                                     benchmark_udp_get_latency(), format);
+        puts(line);
+        return 0;
+    }
     if (strcmp(argv[1], "stop") == 0) {
         if (benchmark_udp_stop()) {
             puts("benchmark process stopped");
@@ -61,6 +76,7 @@ static int _benchmark_udp_handler(int argc, char **argv)
 
 usage:
     printf("usage: %s [start|stop|config] <server> <port>\n", argv[0]);
+    printf("       %s stats [json|csv]\n", argv[0]);
     return -1;
 }
 
@@ -41,6 +41,10 @@
 #ifdef MODULE_L2FILTER
 #include "net/l2filter.h"
 #endif
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+#include "container.h"
+#include "net/gnrc/netif/pktq.h"
+#endif
 
 /**
  * @brief   The default IPv6 prefix length if not specified.
@@ -189,6 +193,25 @@ static int _netif_stats(netif_t *iface, unsigned module, bool reset)
 }
 #endif /* MODULE_NETSTATS */
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+static void _netif_pktq_stats(const gnrc_netif_t *netif)
+{
+    static const char *names[] = { "control", "default" };
+
+    printf("          Send queue\n");
+    for (unsigned cls = 0; cls < GNRC_NETIF_PKTQ_CLASS_NUMOF; cls++) {
+        const gnrc_netif_pktq_stats_t *stats = gnrc_netif_pktq_stats(netif,
+                                                                      cls);
+
+        printf("            %-7s queued %u  sent %u  dropped %u  "
+               "backlog %u (max %u)\n", names[cls],
+               (unsigned)stats->queued, (unsigned)stats->sent,
+               (unsigned)stats->dropped, (unsigned)stats->backlog,
+               (unsigned)stats->backlog_max);
+    }
+}
+#endif
+
 static void _link_usage(char *cmd_name)
 {
     printf("usage: %s <if_id> [up|down]\n", cmd_name);
@@ -964,6 +987,9 @@ static void _netif_list(netif_t *iface)
 #endif
 #ifdef MODULE_NETSTATS_IPV6
     _netif_stats(iface, NETSTATS_IPV6, false);
+#endif
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+    _netif_pktq_stats(container_of(iface, gnrc_netif_t, netif));
 #endif
     puts("");
 }
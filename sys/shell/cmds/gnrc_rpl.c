@@ -31,6 +31,9 @@
 #include "net/gnrc/rpl/p2p_dodag.h"
 #include "net/gnrc/rpl/p2p_structs.h"
 #endif
+#ifdef MODULE_GNRC_RPL_ROUTES
+#include "net/gnrc/rpl/routes.h"
+#endif
 
 int _gnrc_rpl_init(char *arg)
 {
@@ -248,6 +251,29 @@ int _stats(void)
 }
 #endif
 
+#ifdef MODULE_GNRC_RPL_ROUTES
+int _routes(void)
+{
+    /* the stats are small, so copy them with IRQs disabled to not print
+     * values that are updated by the RPL thread in between */
+    unsigned irq_state = irq_disable();
+    gnrc_rpl_routes_stats_t stats = *gnrc_rpl_routes_stats();
+    irq_restore(irq_state);
+
+    printf("routes: %u (max: %u, limit: %u), next hops: %u (limit: %u)\n",
+           stats.routes, stats.routes_max, CONFIG_GNRC_RPL_ROUTES_NUMOF,
+           stats.next_hops, CONFIG_GNRC_RPL_ROUTES_NEXT_HOP_NUMOF);
+    printf("aggregated: %u, dropped (full): %u\n", stats.aggregated,
+           stats.full);
+    printf("updates: %" PRIu32 " refreshes, %" PRIu32 " changes, "
+           "%" PRIu32 " FT operations\n",
+           stats.refreshes, stats.changes, stats.nib_ops);
+    printf("forwarding: %" PRIu32 " lookups, %" PRIu32 " probes\n",
+           stats.lookups, stats.probes);
+    return 0;
+}
+#endif
+
 int _gnrc_rpl_dodag_show(void)
 {
     if (gnrc_rpl_pid == KERNEL_PID_UNDEF) {
@@ -445,6 +471,11 @@ static int _gnrc_rpl(int argc, char **argv)
         return _stats();
     }
 #endif
+#ifdef MODULE_GNRC_RPL_ROUTES
+    else if (strcmp(argv[1], "routes") == 0) {
+        return _routes();
+    }
+#endif
 
 #ifdef MODULE_GNRC_RPL_P2P
     printf("* find <dodag_id> <target>\t\t\t- initiate a P2P-RPL route discovery\n");
@@ -458,6 +489,9 @@ static int _gnrc_rpl(int argc, char **argv)
     printf("* rm <instance_id>\t\t\t- delete the given instance and related dodag\n");
     printf("* root <inst_id> <dodag_id>\t\t- add a dodag to a new or existing instance\n");
     printf("* router <instance_id>\t\t\t- operate as router in the instance\n");
+#ifdef MODULE_GNRC_RPL_ROUTES
+    printf("* routes\t\t\t\t- show statistics of the downward route store\n");
+#endif
     printf("* send dis\t\t\t\t- send a multicast DIS\n");
     printf("* send dis <VID_flags> <version> <instance_id> <dodag_id> - send a multicast DIS with SOL option\n");
 
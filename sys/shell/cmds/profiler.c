@@ -0,0 +1,45 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command for the sampling profiler
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "profiler.h"
+#include "shell.h"
+
+static int _sc_profiler(int argc, char **argv)
+{
+    if (argc >= 2 && !strcmp(argv[1], "start")) {
+        profiler_start(argc > 2 ? strtoul(argv[2], NULL, 0) : 0);
+    }
+    else if (argc == 2 && !strcmp(argv[1], "stop")) {
+        profiler_stop();
+    }
+    else if (argc == 2 && !strcmp(argv[1], "reset")) {
+        profiler_reset();
+    }
+    else if (argc == 2 && !strcmp(argv[1], "dump")) {
+        profiler_dump();
+    }
+    else {
+        printf("Usage: %s start [<rate in Hz>]|stop|reset|dump\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+SHELL_COMMAND(profiler, "Sampling CPU profiler", _sc_profiler);
@@ -36,6 +36,8 @@
 #include <assert.h>
 #include <errno.h>
 
+#include "hashes.h"
+#include "mutex.h"
 #include "xfa.h"
 #include "shell.h"
 #include "shell_lock.h"
@@ -99,8 +101,74 @@ static shell_command_handler_t search_commands(const shell_command_t *entry,
     return NULL;
 }
 
+#if IS_USED(MODULE_SHELL_LOOKUP_HASH)
+static_assert((CONFIG_SHELL_CMD_HASH_SLOTS & (CONFIG_SHELL_CMD_HASH_SLOTS - 1)) == 0,
+              "CONFIG_SHELL_CMD_HASH_SLOTS must be a power of two");
+
+/* only this many characters of a name are hashed */
+#define CMD_HASH_NAME_LEN   (32U)
+
+/* XFA index + 1 of the commands, 0 if the slot is unused */
+static uint8_t _cmd_slots[CONFIG_SHELL_CMD_HASH_SLOTS];
+static volatile bool _cmd_slots_valid;
+/* taken by the first lookup and never released */
+static mutex_t _cmd_slots_lock = MUTEX_INIT;
+
+static unsigned _cmd_hash(const char *name)
+{
+    return fnv1a_32(FNV1A_32_INIT, name, strnlen(name, CMD_HASH_NAME_LEN))
+           & (CONFIG_SHELL_CMD_HASH_SLOTS - 1);
+}
+
+/* Builds the hash table on first use, the order of the XFA is only known
+ * after linking. Lookups in other threads search linearly meanwhile. */
+static bool _cmd_slots_build(void)
+{
+    unsigned n = XFA_LEN(shell_command_xfa_t, shell_commands_xfa_v2);
+    char name[CMD_HASH_NAME_LEN + 1];
+
+    if (!mutex_trylock(&_cmd_slots_lock)) {
+        return false;
+    }
+    /* keep the probe sequences short, too many commands are searched
+     * linearly */
+    if (n >= UINT8_MAX || n > CONFIG_SHELL_CMD_HASH_SLOTS * 3 / 4) {
+        return false;
+    }
+
+    for (unsigned i = 0; i < n; i++) {
+        flash_strncpy(name, shell_commands_xfa_v2[i].name, CMD_HASH_NAME_LEN);
+        name[CMD_HASH_NAME_LEN] = '\0';
+        unsigned slot = _cmd_hash(name);
+        while (_cmd_slots[slot]) {
+            slot = (slot + 1) & (CONFIG_SHELL_CMD_HASH_SLOTS - 1);
+        }
+        _cmd_slots[slot] = i + 1;
+    }
+    _cmd_slots_valid = true;
+
+    return true;
+}
+#endif
+
 static shell_command_handler_t search_commands_xfa(char *command)
 {
+#if IS_USED(MODULE_SHELL_LOOKUP_HASH)
+    if (_cmd_slots_valid || _cmd_slots_build()) {
+        /* commands were added in XFA order, so the first one of several with
+         * the same name is found first */
+        for (unsigned slot = _cmd_hash(command); _cmd_slots[slot];
+             slot = (slot + 1) & (CONFIG_SHELL_CMD_HASH_SLOTS - 1)) {
+            const volatile shell_command_xfa_t *entry =
+                &shell_commands_xfa_v2[_cmd_slots[slot] - 1];
+            if (flash_strcmp(command, entry->name) == 0) {
+                return entry->handler;
+            }
+        }
+        return NULL;
+    }
+#endif
+
     unsigned n = XFA_LEN(shell_command_t, shell_commands_xfa_v2);
 
     for (unsigned i = 0; i < n; i++) {
@@ -378,6 +446,11 @@ int shell_handle_input_line(const shell_command_t *command_list, char *line)
                  && !strcmp("help_json", argv[0])) {
             print_commands_json(command_list);
         }
+#if IS_USED(MODULE_SHELL_BATCH)
+        else if (!strcmp("batch", argv[0])) {
+            return shell_run_batch(command_list);
+        }
+#endif
         else {
             printf("shell: command not found: %s\n", argv[0]);
         }
@@ -547,6 +620,88 @@ void shell_run_once(const shell_command_t *shell_commands,
     }
 }
 
+#if IS_USED(MODULE_SHELL_BATCH)
+/* reads the length of a netstring, -1 at the end of the input, -2 if it
+ * isn't a number */
+static int _batch_read_len(void)
+{
+    int len = 0;
+    int c;
+
+    /* line breaks between the netstrings are allowed, line buffered
+     * terminals don't pass on the input otherwise */
+    do {
+        c = getchar();
+    } while (c == '\r' || c == '\n');
+
+    for (; c != ':'; c = getchar()) {
+        if (c == EOF) {
+            return -1;
+        }
+        if (c < '0' || c > '9' || len > (INT16_MAX / 10)) {
+            return -2;
+        }
+        len = len * 10 + (c - '0');
+    }
+    return len;
+}
+
+/* discards the rest of the line after a protocol error */
+static int _batch_error(void)
+{
+    int c;
+
+    do {
+        c = getchar();
+    } while (c != EOF && c != '\n');
+
+    return -EBADMSG;
+}
+
+int shell_run_batch(const shell_command_t *command_list)
+{
+    char buf[SHELL_DEFAULT_BUFSIZE];
+    unsigned seq = 0;
+
+    while (1) {
+        int res;
+        int len = _batch_read_len();
+
+        if (len == 0) {
+            /* end of the batch */
+            return (getchar() == ',') ? 0 : _batch_error();
+        }
+        if (len < 0) {
+            return (len == -1) ? 0 : _batch_error();
+        }
+
+        /* a command that doesn't fit is skipped, the next one may fit */
+        res = ((size_t)len < sizeof(buf)) ? 0 : -ENOBUFS;
+        for (int i = 0; i < len; i++) {
+            int c = getchar();
+            if (c == EOF) {
+                return 0;
+            }
+            if (res == 0) {
+                buf[i] = c;
+            }
+        }
+        if (res == 0) {
+            buf[len] = '\0';
+        }
+        if (getchar() != ',') {
+            return _batch_error();
+        }
+
+        if (res == 0) {
+            res = shell_handle_input_line(command_list, buf);
+        }
+        printf(SHELL_BATCH_RESULT "%u %d\n", seq++, res);
+        flush_if_needed();
+    }
+}
+#endif /* MODULE_SHELL_BATCH */
+
 #ifdef MODULE_VFS
 int shell_parse_file(const shell_command_t *shell_commands,
                      const char *filename, unsigned *line_nr)
@@ -20,6 +20,7 @@
 
 #include "errno.h"
 #include "isrpipe.h"
+#include "stdio_async.h"
 #include "stdio_base.h"
 #include "macros/utils.h"
 #include "xfa.h"
@@ -39,7 +40,12 @@ void stdio_init(void)
     }
 }
 
+#if IS_USED(MODULE_STDIO_ASYNC)
+/* stdio_write() buffers the output, see @ref sys_stdio_async */
+ssize_t stdio_async_sink(const void* buffer, size_t len)
+#else
 ssize_t stdio_write(const void* buffer, size_t len)
+#endif
 {
     for (unsigned i = 0; i < XFA_LEN(stdio_provider_t, stdio_provider_xfa); ++i) {
         stdio_provider_xfa[i].write(buffer, len);
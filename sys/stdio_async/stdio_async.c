@@ -0,0 +1,203 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_stdio_async
+ * @{
+ *
+ * @file
+ * @brief       Asynchronous STDIO output implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+
+#include "cond.h"
+#include "irq.h"
+#include "kernel_defines.h"
+#include "mutex.h"
+#include "stdio_async.h"
+#include "stdio_base.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "tsrb.h"
+#include "turb.h"
+
+static_assert((CONFIG_STDIO_ASYNC_BUFSIZE & (CONFIG_STDIO_ASYNC_BUFSIZE - 1)) == 0,
+              "CONFIG_STDIO_ASYNC_BUFSIZE must be a power of two");
+
+#define STDIO_ASYNC_FLAG        (0x1)
+
+static uint8_t _buf[CONFIG_STDIO_ASYNC_BUFSIZE];
+static tsrb_t _rb = TSRB_INIT(_buf);
+static stdio_async_stats_t _stats;
+static bool _sync;
+
+/* serializes readers of the ring buffer */
+static mutex_t _drain_lock = MUTEX_INIT;
+static kernel_pid_t _drain_pid = KERNEL_PID_UNDEF;
+static char _drain_stack[STDIO_ASYNC_STACKSIZE];
+
+/* threads waiting for space hold _block_lock while they add their output */
+static mutex_t _block_lock = MUTEX_INIT;
+static cond_t _space = COND_INIT;
+static volatile unsigned _blocked;
+
+/* returns the number of bytes added, all or nothing if !partial */
+static size_t _add(const uint8_t *buf, size_t len, bool partial)
+{
+    unsigned state = irq_disable();
+    size_t space = turb_free(&_rb);
+    bool was_empty = turb_empty(&_rb);
+
+    if (len > space) {
+        len = partial ? space : 0;
+    }
+    turb_add(&_rb, buf, len);
+    _stats.written += len;
+    if (turb_avail(&_rb) > _stats.max_used) {
+        _stats.max_used = turb_avail(&_rb);
+    }
+    irq_restore(state);
+
+    /* the drain thread empties the buffer before it waits again */
+    if (len && was_empty && _drain_pid != KERNEL_PID_UNDEF) {
+        thread_flags_set(thread_get(_drain_pid), STDIO_ASYNC_FLAG);
+    }
+
+    return len;
+}
+
+static void _drop(size_t len)
+{
+    unsigned state = irq_disable();
+    _stats.dropped += len;
+    irq_restore(state);
+}
+
+/* writes the buffered output, the caller must be the only reader */
+static void _drain(void)
+{
+    while (1) {
+        /* the bytes stay in the buffer while they are written, writers
+         * only touch the free part */
+        unsigned state = irq_disable();
+        unsigned avail = turb_avail(&_rb);
+        unsigned pos = _rb.reads & (_rb.size - 1);
+        irq_restore(state);
+
+        if (avail == 0) {
+            return;
+        }
+        if (avail > _rb.size - pos) {
+            avail = _rb.size - pos;
+        }
+
+        ssize_t res = stdio_async_sink(&_rb.buf[pos], avail);
+        if (res <= 0) {
+            /* don't get stuck on a broken backend */
+            res = avail;
+            _drop(avail);
+        }
+
+        state = irq_disable();
+        turb_drop(&_rb, res);
+        irq_restore(state);
+
+        if (_blocked) {
+            mutex_lock(&_block_lock);
+            cond_broadcast(&_space);
+            mutex_unlock(&_block_lock);
+        }
+    }
+}
+
+ssize_t stdio_write(const void *buffer, size_t len)
+{
+    const uint8_t *buf = buffer;
+
+    if (_sync) {
+        return stdio_async_sink(buffer, len);
+    }
+
+    if (_add(buf, len, false) == len) {
+        return len;
+    }
+
+    /* buffer full */
+    if (_drain_pid == KERNEL_PID_UNDEF) {
+        /* no threads yet, nothing can interfere */
+        _drain();
+        return stdio_async_sink(buffer, len);
+    }
+    if (IS_ACTIVE(CONFIG_STDIO_ASYNC_DROP) || irq_is_in() || !irq_is_enabled()) {
+        _drop(len);
+        return len;
+    }
+
+    mutex_lock(&_block_lock);
+    _blocked++;
+    size_t left = len;
+    while (1) {
+        size_t n = _add(buf, left, true);
+        buf += n;
+        left -= n;
+        if (left == 0) {
+            break;
+        }
+        cond_wait(&_space, &_block_lock);
+    }
+    _blocked--;
+    mutex_unlock(&_block_lock);
+
+    return len;
+}
+
+void stdio_async_flush(void)
+{
+    if (_sync) {
+        return;
+    }
+    mutex_lock(&_drain_lock);
+    _drain();
+    mutex_unlock(&_drain_lock);
+}
+
+void stdio_async_sync(void)
+{
+    if (!_sync) {
+        _drain();
+        _sync = true;
+    }
+}
+
+void stdio_async_stats(stdio_async_stats_t *stats)
+{
+    unsigned state = irq_disable();
+
+    *stats = _stats;
+    irq_restore(state);
+}
+
+static void *_drain_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        stdio_async_flush();
+        thread_flags_wait_any(STDIO_ASYNC_FLAG);
+    }
+
+    return NULL;
+}
+
+void auto_init_stdio_async(void)
+{
+    _drain_pid = thread_create(_drain_stack, sizeof(_drain_stack),
+                               STDIO_ASYNC_PRIO, 0, _drain_thread, NULL,
+                               "stdio");
+}
@@ -22,16 +22,19 @@
  * @}
  */
 
+#include <errno.h>
 #include <inttypes.h>
 #include <nanocbor/nanocbor.h>
 #include <assert.h>
 
 #include "architecture.h"
+#include "decompress.h"
 #include "hashes/sha256.h"
 
 #include "kernel_defines.h"
 #include "suit/conditions.h"
 #include "suit/handlers.h"
+#include "suit/pipeline.h"
 #include "suit/policy.h"
 #include "suit/storage.h"
 #include "suit.h"
@@ -351,7 +354,10 @@ static inline void _print_download_progress(suit_manifest_t *manifest,
 #endif
 }
 
-#if defined(MODULE_SUIT_TRANSPORT_COAP) || defined(MODULE_SUIT_TRANSPORT_VFS)
+#if defined(MODULE_SUIT_TRANSPORT_COAP) || defined(MODULE_SUIT_TRANSPORT_VFS) || \
+    defined(MODULE_SUIT_PIPELINE) || defined(MODULE_SUIT_DECOMPRESS)
+#define _HAVE_STORAGE_HELPER
+
 static int _storage_helper(void *arg, size_t offset, uint8_t *buf, size_t len,
                            int more)
 {
@@ -370,32 +376,165 @@ static int _storage_helper(void *arg, size_t offset, uint8_t *buf, size_t len,
         return -1;
     }
 
-    if (image_size < offset + len) {
-        /* Extra newline at the start to compensate for the progress bar */
-        LOG_ERROR(
-            "\n_suit_coap(): Image beyond size, offset + len=%" PRIuSIZE ", "
-            "image_size=%" PRIu32 "\n", total, image_size);
-        return -1;
-    }
+    suit_storage_t *storage = comp->storage_backend;
+    int res = 0;
+    bool written = false;
 
-    if (!more && image_size != total) {
-        LOG_INFO("Incorrect size received, got %" PRIuSIZE ", expected %" PRIu32 "\n",
-                 total, image_size);
-        return -1;
+    /* Whether the payload is encoded is only known after its first chunk
+     * was written. The size of encoded payloads is checked by the storage
+     * backend against the decoded image. */
+    if (offset == 0 && len) {
+        res = suit_storage_write(storage, manifest, buf, offset, len);
+        if (res < 0) {
+            return res;
+        }
+        written = true;
     }
 
-    _print_download_progress(manifest, offset, len, image_size);
+    if (!suit_storage_is_encoded(storage)) {
+        if (image_size < offset + len) {
+            /* Extra newline at the start to compensate for the progress bar */
+            LOG_ERROR(
+                "\n_suit_coap(): Image beyond size, offset + len=%" PRIuSIZE ", "
+                "image_size=%" PRIu32 "\n", total, image_size);
+            return -1;
+        }
+
+        if (!more && image_size != total) {
+            LOG_INFO("Incorrect size received, got %" PRIuSIZE ", expected %" PRIu32 "\n",
+                     total, image_size);
+            return -1;
+        }
 
-    int res = suit_storage_write(comp->storage_backend, manifest, buf, offset, len);
-    if (!more) {
+        _print_download_progress(manifest, offset, len, image_size);
+    }
+
+    /* the final call of a decoded payload only finalizes the store and has
+     * no buffer */
+    if (!written && len) {
+        res = suit_storage_write(storage, manifest, buf, offset, len);
+    }
+    if (res >= 0 && !more) {
         LOG_INFO("Finalizing payload store\n");
         /* Finalize the write if no more data available */
-        res = suit_storage_finish(comp->storage_backend, manifest);
+        res = suit_storage_finish(storage, manifest);
     }
     return res;
 }
 #endif
 
+#ifdef MODULE_SUIT_DECOMPRESS
+static struct {
+    decompress_t ctx;
+    suit_manifest_t *manifest;
+    uint32_t size;              /* decoded size announced by the header */
+    bool active;                /* payload is being decoded */
+} _dec;
+
+static int _decompress_write(void *arg, const uint8_t *buf, size_t len)
+{
+    (void)arg;
+    /* the storage helper takes a non-const buffer but only reads from it */
+    int res = _storage_helper(_dec.manifest, _dec.ctx.out_bytes - len,
+                              (uint8_t *)buf, len, 1);
+    return res < 0 ? res : 0;
+}
+
+/* Payloads starting with a decompress_hdr_t are decoded before they are
+ * passed on to _storage_helper(), all others are stored as they are */
+static int _payload_helper(void *arg, size_t offset, uint8_t *buf, size_t len,
+                           int more)
+{
+    suit_manifest_t *manifest = arg;
+
+    if (offset == 0) {
+        decompress_codec_t codec;
+        int hdr_len = decompress_hdr_parse(buf, len, &codec, &_dec.size);
+
+        _dec.active = false;
+        if (hdr_len == -ENOTSUP) {
+            LOG_ERROR("suit: unsupported payload compression\n");
+            return hdr_len;
+        }
+        if (hdr_len > 0) {
+            LOG_INFO("suit: decompressing payload to %" PRIu32 " bytes\n",
+                     _dec.size);
+            _dec.manifest = manifest;
+            _dec.active = true;
+            decompress_init(&_dec.ctx, codec, _decompress_write, NULL);
+            buf += hdr_len;
+            len -= hdr_len;
+        }
+    }
+
+    if (!_dec.active) {
+        return _storage_helper(manifest, offset, buf, len, more);
+    }
+
+    int res = decompress_feed(&_dec.ctx, buf, len);
+    if (res < 0 || more) {
+        return res;
+    }
+
+    res = decompress_finish(&_dec.ctx);
+    if (res < 0) {
+        return res;
+    }
+    if (_dec.ctx.out_bytes != _dec.size) {
+        LOG_ERROR("suit: decompressed %" PRIu32 " bytes, expected %" PRIu32 "\n",
+                  _dec.ctx.out_bytes, _dec.size);
+        return -1;
+    }
+    LOG_INFO("suit: decompressed %" PRIu32 " to %" PRIu32 " bytes\n",
+             _dec.ctx.in_bytes, _dec.ctx.out_bytes);
+
+    return _storage_helper(manifest, _dec.ctx.out_bytes, NULL, 0, 0);
+}
+
+static inline bool _payload_decoded(void)
+{
+    return _dec.active;
+}
+#elif defined(_HAVE_STORAGE_HELPER)
+#define _payload_helper     _storage_helper
+
+static inline bool _payload_decoded(void)
+{
+    return false;
+}
+#endif
+
+#ifdef MODULE_SUIT_PIPELINE
+/* Transports hand their blocks to the pipeline, whose writer thread passes
+ * them on to _storage_helper() */
+#define _fetch_cb   suit_pipeline_put
+
+static int _pipeline_finish(suit_component_t *comp, int res)
+{
+    suit_pipeline_stats_t stats;
+    int pipe_res = suit_pipeline_finish(comp->digest, &stats);
+
+    LOG_INFO("suit: fetched %" PRIu32 " bytes in %" PRIu32 " blocks, "
+             "total %" PRIu32 " us (recv %" PRIu32 ", stall %" PRIu32 ", "
+             "write %" PRIu32 ", hash %" PRIu32 ")\n",
+             stats.bytes, stats.blocks, stats.total_us, stats.recv_us,
+             stats.stall_us, stats.write_us, stats.hash_us);
+
+    if (res == 0) {
+        res = pipe_res;
+    }
+    /* the digest covers the fetched payload, which is only the image if
+     * neither the payload was decompressed nor the storage backend decoded it */
+    if (res == 0 && !_payload_decoded() &&
+        !suit_storage_is_encoded(comp->storage_backend)) {
+        suit_component_set_flag(comp, SUIT_COMPONENT_STATE_DIGESTED);
+    }
+    return res;
+}
+#else
+#define _fetch_cb   _payload_helper
+#endif
+
 static int _dtv_fetch(suit_manifest_t *manifest, int key,
                       nanocbor_value_t *_it)
 {
@@ -443,6 +582,13 @@ static int _dtv_fetch(suit_manifest_t *manifest, int key,
         return SUIT_ERR_STORAGE;
     }
 
+#ifdef MODULE_SUIT_PIPELINE
+    if (suit_pipeline_start(_payload_helper, manifest) < 0) {
+        LOG_ERROR("Unable to start the download pipeline\n");
+        return SUIT_ERR_NO_MEM;
+    }
+#endif
+
     res = -1;
 
     if (0) {}
@@ -450,25 +596,38 @@ static int _dtv_fetch(suit_manifest_t *manifest, int key,
     else if ((strncmp(manifest->urlbuf, "coap://", 7) == 0) ||
              (IS_USED(MODULE_NANOCOAP_DTLS) && strncmp(manifest->urlbuf, "coaps://", 8) == 0)) {
         res = nanocoap_get_blockwise_url(manifest->urlbuf, CONFIG_SUIT_COAP_BLOCKSIZE,
-                                         _storage_helper,
+                                         _fetch_cb,
                                          manifest);
     }
 #endif
 #ifdef MODULE_SUIT_TRANSPORT_MOCK
     else if (strncmp(manifest->urlbuf, "test://", 7) == 0) {
+#if defined(MODULE_SUIT_PIPELINE) || defined(MODULE_SUIT_DECOMPRESS)
+        res = suit_transport_mock_fetch_blockwise(manifest,
+                                                  CONFIG_SUIT_TRANSPORT_MOCK_BLOCKSIZE,
+                                                  _fetch_cb, manifest);
+#else
         res = suit_transport_mock_fetch(manifest);
+#endif
     }
 #endif
 #ifdef MODULE_SUIT_TRANSPORT_VFS
     else if (strncmp(manifest->urlbuf, "file://", 7) == 0) {
-        res = suit_transport_vfs_fetch(manifest, _storage_helper, manifest);
+        res = suit_transport_vfs_fetch(manifest, _fetch_cb, manifest);
     }
 #endif
     else {
         LOG_WARNING("suit: unsupported URL scheme!\n)");
+#ifdef MODULE_SUIT_PIPELINE
+        suit_pipeline_finish(NULL, NULL);
+#endif
         return res;
     }
 
+#ifdef MODULE_SUIT_PIPELINE
+    res = _pipeline_finish(comp, res);
+#endif
+
     suit_component_set_flag(comp, SUIT_COMPONENT_STATE_FETCHED);
 
     if (res) {
@@ -509,6 +668,14 @@ static int _validate_payload(suit_component_t *component, const uint8_t *digest,
     uint8_t payload_digest[SHA256_DIGEST_LENGTH];
     suit_storage_t *storage = component->storage_backend;
 
+#ifdef MODULE_SUIT_PIPELINE
+    /* Digest was computed from the blocks written while fetching, reject a
+     * corrupted download without reading it back */
+    if (suit_component_check_flag(component, SUIT_COMPONENT_STATE_DIGESTED) &&
+        memcmp(digest, component->digest, SHA256_DIGEST_LENGTH) != 0) {
+        return SUIT_ERR_DIGEST_MISMATCH;
+    }
+#endif
     if (suit_storage_has_readptr(storage)) {
         /* Direct read possible */
         const uint8_t *payload = NULL;
@@ -0,0 +1,189 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_suit_pipeline
+ * @{
+ *
+ * @file
+ * @brief       SUIT pipelined payload download
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "architecture.h"
+#include "macros/utils.h"
+#include "sema.h"
+#include "suit/pipeline.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define SUIT_PIPELINE_BUFFERS   (2)
+
+typedef struct {
+    size_t offset;
+    size_t len;
+    bool more;
+    uint8_t data[CONFIG_SUIT_PIPELINE_BUFSIZE];
+} _block_t;
+
+static struct {
+    suit_pipeline_write_cb_t write;
+    void *arg;
+    sha256_context_t sha;
+    sema_t free;                /* buffers the transport can fill */
+    sema_t ready;               /* buffers the writer has to write */
+    _block_t blocks[SUIT_PIPELINE_BUFFERS];
+    uint8_t head;               /* next buffer to fill, transport only */
+    uint8_t tail;               /* next buffer to write, writer only */
+    bool done;                  /* last block was written */
+    int res;                    /* first error of the writer callback */
+    uint32_t start;
+    uint32_t last;              /* end of the previous suit_pipeline_put() */
+    suit_pipeline_stats_t stats;
+} _pipe;
+
+static char _stack[SUIT_PIPELINE_STACKSIZE];
+static kernel_pid_t _pid = KERNEL_PID_UNDEF;
+
+static void *_writer(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        sema_wait(&_pipe.ready);
+
+        _block_t *block = &_pipe.blocks[_pipe.tail];
+        _pipe.tail = (_pipe.tail + 1) % SUIT_PIPELINE_BUFFERS;
+
+        /* after an error, blocks are only handed back to the transport */
+        if (_pipe.res == 0) {
+            DEBUG("suit_pipeline: writing %" PRIuSIZE " bytes at %" PRIuSIZE "\n",
+                  block->len, block->offset);
+
+            uint32_t t0 = ztimer_now(ZTIMER_USEC);
+            int res = _pipe.write(_pipe.arg, block->offset, block->data,
+                                  block->len, block->more);
+            uint32_t t1 = ztimer_now(ZTIMER_USEC);
+
+            if (res < 0) {
+                _pipe.res = res;
+            }
+            else {
+                sha256_update(&_pipe.sha, block->data, block->len);
+                _pipe.done = !block->more;
+                _pipe.stats.blocks++;
+            }
+
+            _pipe.stats.write_us += t1 - t0;
+            _pipe.stats.hash_us += ztimer_now(ZTIMER_USEC) - t1;
+        }
+
+        sema_post(&_pipe.free);
+    }
+
+    return NULL;
+}
+
+int suit_pipeline_start(suit_pipeline_write_cb_t write, void *arg)
+{
+    if (_pid == KERNEL_PID_UNDEF) {
+        sema_create(&_pipe.free, SUIT_PIPELINE_BUFFERS);
+        sema_create(&_pipe.ready, 0);
+
+        _pid = thread_create(_stack, sizeof(_stack), SUIT_PIPELINE_PRIO,
+                             0, _writer, NULL, "suit pipeline");
+        if (_pid < 0) {
+            _pid = KERNEL_PID_UNDEF;
+            return -ENOMEM;
+        }
+    }
+
+    _pipe.write = write;
+    _pipe.arg = arg;
+    _pipe.done = false;
+    _pipe.res = 0;
+    sha256_init(&_pipe.sha);
+    memset(&_pipe.stats, 0, sizeof(_pipe.stats));
+    _pipe.start = ztimer_now(ZTIMER_USEC);
+    _pipe.last = _pipe.start;
+
+    return 0;
+}
+
+int suit_pipeline_put(void *arg, size_t offset, uint8_t *buf, size_t len, int more)
+{
+    (void)arg;
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+
+    _pipe.stats.recv_us += now - _pipe.last;
+
+    /* runs once for the empty last block some transports emit */
+    do {
+        size_t chunk = MIN(len, CONFIG_SUIT_PIPELINE_BUFSIZE);
+
+        uint32_t t0 = ztimer_now(ZTIMER_USEC);
+        sema_wait(&_pipe.free);
+        _pipe.stats.stall_us += ztimer_now(ZTIMER_USEC) - t0;
+
+        if (_pipe.res < 0) {
+            sema_post(&_pipe.free);
+            break;
+        }
+
+        _block_t *block = &_pipe.blocks[_pipe.head];
+        _pipe.head = (_pipe.head + 1) % SUIT_PIPELINE_BUFFERS;
+
+        memcpy(block->data, buf, chunk);
+        block->offset = offset;
+        block->len = chunk;
+        block->more = more || (len > chunk);
+        _pipe.stats.bytes += chunk;
+
+        buf += chunk;
+        offset += chunk;
+        len -= chunk;
+
+        sema_post(&_pipe.ready);
+    } while (len);
+
+    _pipe.last = ztimer_now(ZTIMER_USEC);
+
+    return _pipe.res;
+}
+
+int suit_pipeline_finish(uint8_t digest[SHA256_DIGEST_LENGTH],
+                         suit_pipeline_stats_t *stats)
+{
+    /* the writer is done once it handed back all buffers */
+    for (unsigned i = 0; i < SUIT_PIPELINE_BUFFERS; i++) {
+        sema_wait(&_pipe.free);
+    }
+    for (unsigned i = 0; i < SUIT_PIPELINE_BUFFERS; i++) {
+        sema_post(&_pipe.free);
+    }
+
+    _pipe.stats.total_us = ztimer_now(ZTIMER_USEC) - _pipe.start;
+
+    int res = _pipe.res;
+    if (res == 0 && !_pipe.done) {
+        res = -EIO;
+    }
+    if (res == 0 && digest) {
+        sha256_final(&_pipe.sha, digest);
+    }
+    if (stats) {
+        *stats = _pipe.stats;
+    }
+
+    return res;
+}
@@ -18,11 +18,13 @@
  *
  * @}
  */
+#include <errno.h>
 #include <string.h>
 
 #include "architecture.h"
 #include "kernel_defines.h"
 #include "log.h"
+#include "macros/utils.h"
 #include "xfa.h"
 
 #include "suit.h"
@@ -56,9 +58,197 @@ static int _flashwrite_start(suit_storage_t *storage,
     suit_storage_flashwrite_t *fw = _get_fw(storage);
     int target_slot = riotboot_slot_other();
 
+#ifdef MODULE_SUIT_STORAGE_FLASHWRITE_VCDIFF
+    fw->delta = false;
+    fw->delta_len = 0;
+    fw->image_len = len;
+#endif
+
     return riotboot_flashwrite_init(&fw->writer, target_slot);
 }
 
+#ifdef MODULE_SUIT_STORAGE_FLASHWRITE_VCDIFF
+/* VCDIFF header: "VCD" with the upper bits set. The version byte that
+ * follows is 0x00 for RFC 3284 and 'S' for the interleaved format of
+ * open-vcdiff, so it is not part of the match. */
+static const uint8_t _vcdiff_magic[] = { 0xd6, 0xc3, 0xc4 };
+
+/* The source of the delta is the image in the running slot */
+static int _vcdiff_source_read(void *dev, uint8_t *dest, size_t offset,
+                               size_t len)
+{
+    (void)dev;
+    int slot = riotboot_slot_current();
+
+    if (offset + len > riotboot_slot_size(slot)) {
+        return -EINVAL;
+    }
+
+    memcpy(dest, (const uint8_t *)riotboot_slot_get_hdr(slot) + offset, len);
+    return 0;
+}
+
+static const vcdiff_driver_t _vcdiff_source_driver = {
+    .read = _vcdiff_source_read,
+};
+
+/* riotboot_flashwrite erases flash pages on its own */
+static int _vcdiff_target_erase(void *dev, size_t offset, size_t len)
+{
+    (void)dev;
+    (void)offset;
+    (void)len;
+    return 0;
+}
+
+/* Start of the part of the image that is still in the flashwrite buffer */
+static size_t _vcdiff_pending_start(const suit_storage_flashwrite_t *fw)
+{
+#if CONFIG_RIOTBOOT_FLASHWRITE_RAW
+    return fw->writer.offset - (fw->writer.offset % RIOTBOOT_FLASHPAGE_BUFFER_SIZE);
+#else
+    return (uintptr_t)flashpage_addr(fw->writer.flashpage) -
+           (uintptr_t)riotboot_slot_get_hdr(fw->writer.target_slot);
+#endif
+}
+
+/* Read back reconstructed data, used for copies within the target window */
+static int _vcdiff_target_read(void *dev, uint8_t *dest, size_t offset,
+                               size_t len)
+{
+    static const char _prefix[] = "RIOT";
+    suit_storage_flashwrite_t *fw = dev;
+    const uint8_t *slot = (const uint8_t *)riotboot_slot_get_hdr(fw->writer.target_slot);
+    size_t pending = _vcdiff_pending_start(fw);
+
+    if (offset + len > fw->writer.offset) {
+        return -EINVAL;
+    }
+
+    /* the magic number is written last, see _vcdiff_target_write() */
+    while (len && offset < RIOTBOOT_FLASHWRITE_SKIPLEN) {
+        *dest++ = _prefix[offset++];
+        len--;
+    }
+
+#if CONFIG_RIOTBOOT_FLASHWRITE_RAW
+    /* the first block is held back until the image is installed */
+    if (len && pending && offset < RIOTBOOT_FLASHPAGE_BUFFER_SIZE) {
+        size_t chunk = MIN(len, RIOTBOOT_FLASHPAGE_BUFFER_SIZE - offset);
+        memcpy(dest, fw->writer.firstblock_buf + offset, chunk);
+        dest += chunk;
+        offset += chunk;
+        len -= chunk;
+    }
+#endif
+
+    if (len && offset < pending) {
+        size_t chunk = MIN(len, pending - offset);
+        memcpy(dest, slot + offset, chunk);
+        dest += chunk;
+        offset += chunk;
+        len -= chunk;
+    }
+
+    memcpy(dest, fw->writer.flashpage_buf + (offset - pending), len);
+    return 0;
+}
+
+static int _vcdiff_target_write(void *dev, uint8_t *src, size_t offset,
+                                size_t len)
+{
+    suit_storage_flashwrite_t *fw = dev;
+
+    if (offset + len > fw->image_len) {
+        LOG_ERROR("suit_flashwrite: delta exceeds image size %" PRIuSIZE "\n",
+                  fw->image_len);
+        return -EOVERFLOW;
+    }
+
+    /* The magic number is restored by riotboot_flashwrite_finish(), so the
+     * slot stays invalid until the image has been installed */
+    if (offset < RIOTBOOT_FLASHWRITE_SKIPLEN) {
+        size_t skip = MIN(len, RIOTBOOT_FLASHWRITE_SKIPLEN - offset);
+        src += skip;
+        offset += skip;
+        len -= skip;
+    }
+
+    if (len == 0) {
+        return 0;
+    }
+    if (offset != fw->writer.offset) {
+        return -EINVAL;
+    }
+
+    return riotboot_flashwrite_putbytes(&fw->writer, src, len, true);
+}
+
+static int _vcdiff_target_flush(void *dev)
+{
+    (void)dev;
+    return 0;
+}
+
+static const vcdiff_driver_t _vcdiff_target_driver = {
+    .erase = _vcdiff_target_erase,
+    .read = _vcdiff_target_read,
+    .write = _vcdiff_target_write,
+    .flush = _vcdiff_target_flush,
+};
+
+static int _flashwrite_write_delta(suit_storage_flashwrite_t *fw,
+                                   const uint8_t *buf, size_t offset,
+                                   size_t len)
+{
+    if (offset == 0) {
+        LOG_INFO("suit_flashwrite: applying delta against slot %d\n",
+                 riotboot_slot_current());
+        vcdiff_init(&fw->vcdiff);
+        vcdiff_set_source_driver(&fw->vcdiff, &_vcdiff_source_driver, NULL);
+        vcdiff_set_target_driver(&fw->vcdiff, &_vcdiff_target_driver, fw);
+    }
+
+    if (offset != fw->delta_len) {
+        LOG_ERROR("Unexpected delta offset: %u - expected: %u\n",
+                  (unsigned)offset, (unsigned)fw->delta_len);
+        return SUIT_ERR_STORAGE;
+    }
+    fw->delta_len += len;
+
+    int res = vcdiff_apply_delta(&fw->vcdiff, buf, len);
+    if (res < 0) {
+        LOG_ERROR("suit_flashwrite: applying delta failed: %d\n", res);
+        return SUIT_ERR_STORAGE;
+    }
+    return SUIT_OK;
+}
+
+static int _flashwrite_finish_delta(suit_storage_flashwrite_t *fw)
+{
+    int res = vcdiff_finish(&fw->vcdiff);
+    if (res < 0) {
+        LOG_ERROR("suit_flashwrite: incomplete delta: %d\n", res);
+        return SUIT_ERR_STORAGE;
+    }
+
+    LOG_INFO("suit_flashwrite: %" PRIuSIZE " delta bytes produced %" PRIuSIZE
+             " image bytes\n", fw->delta_len, fw->writer.offset);
+
+    if (fw->writer.offset != fw->image_len) {
+        LOG_ERROR("suit_flashwrite: delta produced %" PRIuSIZE " bytes, "
+                  "expected %" PRIuSIZE "\n", fw->writer.offset, fw->image_len);
+        return SUIT_ERR_STORAGE;
+    }
+    return SUIT_OK;
+}
+
+static bool _flashwrite_is_encoded(const suit_storage_t *storage)
+{
+    return container_of(storage, suit_storage_flashwrite_t, storage)->delta;
+}
+#endif /* MODULE_SUIT_STORAGE_FLASHWRITE_VCDIFF */
+
 static int _flashwrite_write(suit_storage_t *storage,
                              const suit_manifest_t *manifest,
                              const uint8_t *buf, size_t offset, size_t len)
@@ -66,6 +256,16 @@ static int _flashwrite_write(suit_storage_t *storage,
     (void)manifest;
     suit_storage_flashwrite_t *fw = _get_fw(storage);
 
+#ifdef MODULE_SUIT_STORAGE_FLASHWRITE_VCDIFF
+    if (offset == 0 && len >= sizeof(_vcdiff_magic) &&
+        memcmp(buf, _vcdiff_magic, sizeof(_vcdiff_magic)) == 0) {
+        fw->delta = true;
+    }
+    if (fw->delta) {
+        return _flashwrite_write_delta(fw, buf, offset, len);
+    }
+#endif
+
     if (offset == 0) {
         if (len < RIOTBOOT_FLASHWRITE_SKIPLEN) {
             LOG_WARNING("_suit_flashwrite(): offset==0, len<4. aborting\n");
@@ -91,6 +291,15 @@ static int _flashwrite_finish(suit_storage_t *storage,
     (void)manifest;
     suit_storage_flashwrite_t *fw = _get_fw(storage);
 
+#ifdef MODULE_SUIT_STORAGE_FLASHWRITE_VCDIFF
+    if (fw->delta) {
+        int res = _flashwrite_finish_delta(fw);
+        if (res != SUIT_OK) {
+            return res;
+        }
+    }
+#endif
+
     return riotboot_flashwrite_flush(&fw->writer) <
            0 ? SUIT_ERR_STORAGE : SUIT_OK;
 }
@@ -235,6 +444,9 @@ static const suit_storage_driver_t suit_storage_flashwrite_driver = {
     .match_offset = _flashwrite_match_offset,
     .get_seq_no = _flashwrite_get_seq_no,
     .set_seq_no = _flashwrite_set_seq_no,
+#ifdef MODULE_SUIT_STORAGE_FLASHWRITE_VCDIFF
+    .is_encoded = _flashwrite_is_encoded,
+#endif
     .separator = '\0',
 };
 
@@ -40,3 +40,33 @@ int suit_transport_mock_fetch(const suit_manifest_t *manifest)
                        payloads[file].len);
     return 0;
 }
+
+int suit_transport_mock_fetch_blockwise(const suit_manifest_t *manifest,
+                                        size_t blksize,
+                                        suit_transport_mock_cb_t cb, void *ctx)
+{
+    size_t file = manifest->component_current;
+
+    assert(file < num_payloads);
+    assert(blksize > 0);
+
+    LOG_INFO("Mock fetching payload %d in blocks of %u bytes\n",
+             (unsigned)file, (unsigned)blksize);
+
+    size_t offset = 0;
+    do {
+        size_t len = payloads[file].len - offset;
+        if (len > blksize) {
+            len = blksize;
+        }
+        int more = (offset + len) < payloads[file].len;
+
+        int res = cb(ctx, offset, (uint8_t *)&payloads[file].buf[offset], len, more);
+        if (res < 0) {
+            return res;
+        }
+        offset += len;
+    } while (offset < payloads[file].len);
+
+    return 0;
+}
@@ -44,6 +44,10 @@ static benchmark_msg_ping_t *ping = (void *)buf_tx;
 static bool running;
 static sema_inv_t thread_sync;
 
+static bool latency_mode;
+static uint32_t rtt_seq_no;
+static benchmark_udp_latency_t latency;
+
 struct {
     uint32_t seq_no;
     uint32_t time_tx_us;
@@ -96,6 +100,23 @@ static void *_listen_thread(void *ctx)
             ping->flags   = cmd->flags & BENCH_MASK_COOKIE;
             delay_us      = cmd->delay_us;
             payload_size  = MIN(cmd->payload_len, BENCH_PAYLOAD_SIZE_MAX);
+            latency_mode  = cmd->flags & BENCH_FLAG_LATENCY;
+            if (latency_mode) {
+                payload_size = MAX(payload_size, sizeof(benchmark_msg_latency_t));
+                benchmark_udp_latency_reset(&latency);
+            }
+        } else if (latency_mode &&
+                   (size_t)res >= sizeof(*ping) + sizeof(benchmark_msg_latency_t)) {
+            benchmark_msg_ping_t *pong = (void *)buf;
+            benchmark_msg_latency_t *hdr = (void *)pong->payload;
+            uint32_t rtt = xtimer_now_usec() - hdr->time_tx_us;
+
+            ping->replies++;
+            ping->rtt_last = rtt;
+            rtt_seq_no = pong->seq_no;
+
+            benchmark_udp_latency_rx(&latency, pong->seq_no, rtt);
+            benchmark_udp_hist_add(&latency.rtt, rtt);
         } else {
             benchmark_msg_ping_t *pong = (void *)buf;
 
@@ -120,6 +141,14 @@ static void *_send_thread(void *ctx)
     while (running) {
         _put_rtt(ping->seq_no);
 
+        if (latency_mode) {
+            benchmark_msg_latency_t *hdr = (void *)ping->payload;
+            unsigned state = irq_disable();
+            hdr->rtt_seq_no = rtt_seq_no;
+            hdr->time_tx_us = xtimer_now_usec();
+            irq_restore(state);
+        }
+
         if (sock_udp_send(&sock, ping, sizeof(*ping) + payload_size, &remote) < 0) {
             puts("Error sending message");
             continue;
@@ -201,6 +230,11 @@ bool benchmark_udp_stop(void)
     return true;
 }
 
+const benchmark_udp_latency_t *benchmark_udp_get_latency(void)
+{
+    return &latency;
+}
+
 void benchmark_udp_auto_init(void)
 {
     benchmark_udp_start(BENCH_SERVER_DEFAULT, BENCH_PORT_DEFAULT);
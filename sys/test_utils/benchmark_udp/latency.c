@@ -0,0 +1,147 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     test_utils_benchmark_udp
+ * @{
+ *
+ * @file
+ * @brief       Latency statistics, shared with the benchmark server
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test_utils/benchmark_udp.h"
+
+#define SUB_BUCKETS         (1UL << BENCH_HIST_SUB_BITS)
+
+static unsigned _msb(uint32_t v)
+{
+    return 8 * sizeof(unsigned long) - 1 - __builtin_clzl(v);
+}
+
+static unsigned _bucket(uint32_t value)
+{
+    if (value < SUB_BUCKETS) {
+        return value;
+    }
+
+    unsigned shift = _msb(value) - BENCH_HIST_SUB_BITS;
+    unsigned idx = ((shift + 1) << BENCH_HIST_SUB_BITS)
+                 + ((value >> shift) & (SUB_BUCKETS - 1));
+
+    return idx < BENCH_HIST_BUCKETS ? idx : BENCH_HIST_BUCKETS - 1;
+}
+
+/* highest value that falls into a bucket */
+static uint32_t _bucket_max(unsigned idx)
+{
+    if (idx < SUB_BUCKETS) {
+        return idx;
+    }
+
+    unsigned shift = (idx >> BENCH_HIST_SUB_BITS) - 1;
+    uint32_t lower = (SUB_BUCKETS + (idx & (SUB_BUCKETS - 1))) << shift;
+
+    return lower + (1UL << shift) - 1;
+}
+
+void benchmark_udp_latency_reset(benchmark_udp_latency_t *lat)
+{
+    memset(lat, 0, sizeof(*lat));
+}
+
+void benchmark_udp_latency_rx(benchmark_udp_latency_t *lat, uint32_t seq_no,
+                              uint32_t transit_us)
+{
+    if (lat->received && (int32_t)(seq_no - lat->seq_no_max) < 0) {
+        lat->reordered++;
+    }
+    else {
+        lat->seq_no_max = seq_no;
+    }
+
+    /* J = J + (|D| - J) / 16, see RFC 3550, section 6.4.1 and A.8 */
+    if (lat->received) {
+        int32_t d = transit_us - lat->transit_last;
+        lat->jitter += (d < 0 ? -d : d) - ((lat->jitter + 8) >> 4);
+    }
+
+    lat->transit_last = transit_us;
+    lat->received++;
+}
+
+void benchmark_udp_hist_add(benchmark_udp_hist_t *hist, uint32_t value)
+{
+    if (hist->count == 0 || value < hist->min) {
+        hist->min = value;
+    }
+    if (value > hist->max) {
+        hist->max = value;
+    }
+
+    hist->count++;
+    hist->sum += value;
+    hist->buckets[_bucket(value)]++;
+}
+
+uint32_t benchmark_udp_hist_percentile(const benchmark_udp_hist_t *hist,
+                                       unsigned permille)
+{
+    /* rank of the value we are looking for, rounded up */
+    uint64_t rank = ((uint64_t)hist->count * permille + 999) / 1000;
+    uint64_t seen = 0;
+
+    if (rank == 0) {
+        return hist->count ? hist->min : 0;
+    }
+
+    for (unsigned i = 0; i < BENCH_HIST_BUCKETS; i++) {
+        seen += hist->buckets[i];
+        if (seen >= rank) {
+            uint32_t value = _bucket_max(i);
+            return value < hist->max ? value : hist->max;
+        }
+    }
+
+    return hist->max;
+}
+
+int benchmark_udp_latency_format(char *buf, size_t len,
+                                 const benchmark_udp_latency_t *lat,
+                                 benchmark_udp_format_t format)
+{
+    if (format == BENCH_FORMAT_CSV_HEADER) {
+        return snprintf(buf, len, "count,min_us,p50_us,p90_us,p99_us,max_us,"
+                                  "mean_us,jitter_us,received,reordered");
+    }
+
+    const benchmark_udp_hist_t *rtt = &lat->rtt;
+    uint32_t mean = rtt->count ? rtt->sum / rtt->count : 0;
+    uint32_t p50 = benchmark_udp_hist_percentile(rtt, 500);
+    uint32_t p90 = benchmark_udp_hist_percentile(rtt, 900);
+    uint32_t p99 = benchmark_udp_hist_percentile(rtt, 990);
+
+    if (format == BENCH_FORMAT_JSON) {
+        return snprintf(buf, len,
+                        "{ \"count\": %" PRIu32 ", \"min_us\": %" PRIu32
+                        ", \"p50_us\": %" PRIu32 ", \"p90_us\": %" PRIu32
+                        ", \"p99_us\": %" PRIu32 ", \"max_us\": %" PRIu32
+                        ", \"mean_us\": %" PRIu32 ", \"jitter_us\": %" PRIu32
+                        ", \"received\": %" PRIu32 ", \"reordered\": %" PRIu32 " }",
+                        rtt->count, rtt->min, p50, p90, p99, rtt->max, mean,
+                        lat->jitter >> 4, lat->received, lat->reordered);
+    }
+
+    return snprintf(buf, len,
+                    "%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32
+                    ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32,
+                    rtt->count, rtt->min, p50, p90, p99, rtt->max, mean,
+                    lat->jitter >> 4, lat->received, lat->reordered);
+}
@@ -20,45 +20,111 @@
  * @}
  */
 
+#include <assert.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "architecture.h"
+#include "atomic_utils.h"
+#include "byteorder.h"
 #include "irq.h"
+#include "stdio_base.h"
+#include "thread.h"
+#include "trace.h"
 #include "ztimer.h"
 
-#ifndef CONFIG_TRACE_BUFSIZE
-#define CONFIG_TRACE_BUFSIZE 512
-#endif
+/* size of a record in the export format */
+#define TRACE_RECORD_SIZE   (12U)
+/* records per frame, bounded by the size of the export buffer */
+#define TRACE_FRAME_RECORDS_MAX (16U)
+
+/* sequence numbers wrap around, which only keeps their mapping to buffer
+ * slots intact for powers of two */
+static_assert((CONFIG_TRACE_BUFSIZE & (CONFIG_TRACE_BUFSIZE - 1)) == 0,
+              "CONFIG_TRACE_BUFSIZE must be a power of two");
+
+/* sequence numbers are stored inverted, so a zeroed slot only matches the
+ * sequence number UINT32_MAX */
+#define _SEQ(seq)           (~(uint32_t)(seq))
+
+static trace_record_t tracebuf[CONFIG_TRACE_BUFSIZE];
+/* sequence number of the next record to write */
+static volatile uint32_t tracebuf_head;
+/* sequence number of the next record to export */
+static uint32_t tracebuf_tail;
+static uint32_t tracebuf_lost;
+static bool threads_exported;
 
-typedef struct {
-    uint32_t time;
-    uint32_t val;
-} tracebuf_entry_t;
+static const char *_names[] = {
+    [TRACE_EVENT_INVALID] = "?",
+    [TRACE_EVENT_USER] = "user",
+    [TRACE_EVENT_THREAD_SWITCH] = "switch",
+    [TRACE_EVENT_ISR_ENTER] = "isr_enter",
+    [TRACE_EVENT_ISR_EXIT] = "isr_exit",
+    [TRACE_EVENT_MSG_SEND] = "msg_send",
+    [TRACE_EVENT_MSG_RECV] = "msg_recv",
+    [TRACE_EVENT_PKTBUF_ALLOC] = "pkt_alloc",
+    [TRACE_EVENT_PKTBUF_FREE] = "pkt_free",
+    [TRACE_EVENT_ZTIMER_FIRE] = "ztimer",
+};
 
-static tracebuf_entry_t tracebuf[CONFIG_TRACE_BUFSIZE];
-static size_t tracebuf_pos;
+static void _record(trace_event_t type, kernel_pid_t pid, uint32_t arg)
+{
+    uint32_t seq = atomic_fetch_add_u32(&tracebuf_head, 1);
+    trace_record_t *rec = &tracebuf[seq % CONFIG_TRACE_BUFSIZE];
+
+    /* mark the slot as incomplete until all fields are written, seq - 1
+     * belongs to another slot and never matches */
+    atomic_store_u32(&rec->seq, _SEQ(seq - 1));
+    __asm__ volatile ("" : : : "memory");
+    rec->time = ztimer_now(ZTIMER_USEC);
+    rec->type = type;
+    rec->flags = irq_is_in() ? TRACE_FLAG_ISR : 0;
+    rec->pid = pid;
+    rec->arg = arg;
+    __asm__ volatile ("" : : : "memory");
+    atomic_store_u32(&rec->seq, _SEQ(seq));
+}
 
 void trace(uint32_t val)
 {
-    unsigned state = irq_disable();
+    _record(TRACE_EVENT_USER, thread_getpid(), val);
+}
 
-    tracebuf[tracebuf_pos % CONFIG_TRACE_BUFSIZE] =
-        (tracebuf_entry_t){ .time = ztimer_now(ZTIMER_USEC), .val = val };
-    tracebuf_pos++;
-    irq_restore(state);
+void trace_event(trace_event_t type, uint32_t arg)
+{
+    _record(type, thread_getpid(), arg);
+}
+
+#if IS_USED(MODULE_TRACE_SCHED)
+static void _sched_cb(kernel_pid_t active, kernel_pid_t next)
+{
+    _record(TRACE_EVENT_THREAD_SWITCH, next, (uint16_t)active);
 }
+#endif
 
 void trace_dump(void)
 {
-    size_t n = tracebuf_pos >
-               CONFIG_TRACE_BUFSIZE ? CONFIG_TRACE_BUFSIZE : tracebuf_pos;
+    uint32_t head = atomic_load_u32(&tracebuf_head);
+    size_t n = head > CONFIG_TRACE_BUFSIZE ? CONFIG_TRACE_BUFSIZE : head;
+    uint32_t first = head - n;
     uint32_t t_last = 0;
 
     for (size_t i = 0; i < n; i++) {
-        printf("n=%4" PRIuSIZE " t=%s%8" PRIu32 " v=0x%08" PRIx32 "\n", i,
-               i ? "+" : " ",
-               tracebuf[i].time - t_last, tracebuf[i].val);
-        t_last = tracebuf[i].time;
+        const trace_record_t *rec = &tracebuf[(first + i) % CONFIG_TRACE_BUFSIZE];
+        uint8_t type = rec->type;
+
+        printf("n=%4" PRIuSIZE " t=%s%8" PRIu32, i, i ? "+" : " ",
+               rec->time - t_last);
+        if (type == TRACE_EVENT_USER) {
+            printf(" v=0x%08" PRIx32 "\n", rec->arg);
+        }
+        else {
+            printf(" %-9s pid=%" PRIkernel_pid "%s arg=0x%08" PRIx32 "\n",
+                   type < ARRAY_SIZE(_names) ? _names[type] : "?", rec->pid,
+                   (rec->flags & TRACE_FLAG_ISR) ? " isr" : "", rec->arg);
+        }
+        t_last = rec->time;
     }
 }
 
@@ -66,6 +132,136 @@ void trace_reset(void)
 {
     unsigned state = irq_disable();
 
-    tracebuf_pos = 0;
+    /* old records must not match the restarted sequence numbers */
+    memset(tracebuf, 0, sizeof(tracebuf));
+    tracebuf_head = 0;
+    tracebuf_tail = 0;
+    tracebuf_lost = 0;
     irq_restore(state);
 }
+
+static void _write_frame_hdr(uint8_t *buf, trace_frame_type_t type, uint16_t len)
+{
+    memcpy(buf, TRACE_FRAME_MAGIC, 4);
+    buf[4] = TRACE_FRAME_VERSION;
+    buf[5] = type;
+    byteorder_htolebufs(&buf[6], len);
+}
+
+static void _export_threads(void)
+{
+    uint8_t buf[8 + 2 + 16];
+
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        thread_t *thread = thread_get(pid);
+        if (thread == NULL) {
+            continue;
+        }
+        const char *name = thread_get_name(thread);
+        size_t len = 0;
+        if (name) {
+            len = strnlen(name, sizeof(buf) - 10);
+            memcpy(&buf[10], name, len);
+        }
+
+        _write_frame_hdr(buf, TRACE_FRAME_THREAD, 2 + len);
+        byteorder_htolebufs(&buf[8], pid);
+        stdio_write(buf, 10 + len);
+    }
+}
+
+unsigned trace_export(void)
+{
+    uint8_t buf[8 + TRACE_FRAME_RECORDS_MAX * TRACE_RECORD_SIZE];
+    unsigned exported = 0;
+
+    if (!threads_exported) {
+        _export_threads();
+        threads_exported = true;
+    }
+
+    while (1) {
+        uint32_t head = atomic_load_u32(&tracebuf_head);
+
+        /* skip records that have been overwritten already */
+        if (head - tracebuf_tail > CONFIG_TRACE_BUFSIZE) {
+            tracebuf_lost += head - tracebuf_tail - CONFIG_TRACE_BUFSIZE;
+            tracebuf_tail = head - CONFIG_TRACE_BUFSIZE;
+        }
+
+        unsigned n = 0;
+        uint8_t *pos = &buf[8];
+        bool lapped = false;
+        while (tracebuf_tail != head && n < TRACE_FRAME_RECORDS_MAX) {
+            const trace_record_t *rec = &tracebuf[tracebuf_tail % CONFIG_TRACE_BUFSIZE];
+            if (atomic_load_u32(&rec->seq) != _SEQ(tracebuf_tail)) {
+                /* still being written, or already overwritten */
+                lapped = atomic_load_u32(&tracebuf_head) - tracebuf_tail
+                         > CONFIG_TRACE_BUFSIZE;
+                break;
+            }
+            __asm__ volatile ("" : : : "memory");
+            byteorder_htolebufl(&pos[0], rec->time);
+            pos[4] = rec->type;
+            pos[5] = rec->flags;
+            byteorder_htolebufs(&pos[6], rec->pid);
+            byteorder_htolebufl(&pos[8], rec->arg);
+            __asm__ volatile ("" : : : "memory");
+            if (atomic_load_u32(&rec->seq) != _SEQ(tracebuf_tail)) {
+                /* overwritten while copying, the copy may be torn */
+                tracebuf_lost++;
+                tracebuf_tail++;
+                lapped = true;
+                break;
+            }
+            pos += TRACE_RECORD_SIZE;
+            tracebuf_tail++;
+            n++;
+        }
+        if (n == 0 && !lapped) {
+            break;
+        }
+        if (n == 0) {
+            /* skip the overwritten records and try again */
+            continue;
+        }
+
+        _write_frame_hdr(buf, TRACE_FRAME_RECORDS, n);
+        stdio_write(buf, pos - buf);
+        exported += n;
+    }
+
+    return exported;
+}
+
+uint32_t trace_lost(void)
+{
+    return tracebuf_lost;
+}
+
+#if IS_USED(MODULE_TRACE_STREAM)
+static char _stream_stack[TRACE_STREAM_STACKSIZE];
+
+static void *_stream_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        ztimer_sleep(ZTIMER_MSEC, CONFIG_TRACE_STREAM_INTERVAL_MS);
+        trace_export();
+    }
+
+    return NULL;
+}
+#endif
+
+void auto_init_trace(void)
+{
+#if IS_USED(MODULE_TRACE_SCHED)
+    sched_register_cb(_sched_cb);
+#endif
+#if IS_USED(MODULE_TRACE_STREAM)
+    thread_create(_stream_stack, sizeof(_stream_stack), TRACE_STREAM_PRIO, 0,
+                  _stream_thread, NULL, "trace");
+#endif
+}
@@ -14,6 +14,7 @@
  * @author  Joakim Nohlgård <joakim.nohlgard@eistec.se>
  */
 
+#include <assert.h> /* for static_assert */
 #include <errno.h> /* for error codes */
 #include <string.h> /* for strncmp */
 #include <stddef.h> /* for NULL */
@@ -134,6 +135,16 @@ static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *moun
  */
 static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const char **rel_path);
 
+/**
+ * @internal
+ * @brief Rebuild the mount lookup index from the list of mounts and publish it
+ *
+ * Must be called with _mount_mutex held.
+ *
+ * @param[in]  skip     mount to leave out of the index, may be NULL
+ */
+static void _mount_index_update(const vfs_mount_t *skip);
+
 /**
  * @internal
  * @brief Check that a given fd number is valid
@@ -148,6 +159,102 @@ static inline int _fd_is_valid(int fd);
 static mutex_t _mount_mutex = MUTEX_INIT;
 static mutex_t _open_mutex = MUTEX_INIT;
 
+/**
+ * @internal
+ * @brief Lookup index of the mounted file systems
+ *
+ * Two copies of the mount table, sorted by descending mount point length so
+ * that the first match is the longest one. Writers hold _mount_mutex, rebuild
+ * the copy that is not in use and then switch readers over by incrementing
+ * _mount_index_gen. Readers don't take any lock, but start over if the
+ * generation changed while they were looking at the index. A reader may thus
+ * still dereference a mount shortly after vfs_umount() returned, which is why
+ * the caller must not reuse it while other threads are in the VFS.
+ *
+ * A number of entries larger than VFS_MOUNT_INDEX_SIZE means that not all
+ * mounts fit into the index and lookups have to walk _vfs_mounts_list.
+ */
+static vfs_mount_t *_mount_index[2][VFS_MOUNT_INDEX_SIZE];
+static uint8_t _mount_index_numof[2];
+static uint32_t _mount_index_gen;
+
+static_assert(VFS_MOUNT_INDEX_SIZE < UINT8_MAX, "VFS_MOUNT_INDEX_SIZE too large");
+
+/**
+ * @internal
+ * @brief Results of recent vfs_stat() calls
+ *
+ * Entries are only valid if they were created in the current generation,
+ * incrementing _stat_cache_gen thus invalidates all of them at once.
+ */
+typedef struct {
+    uint32_t gen;                           /**< generation of the entry */
+    int res;                                /**< return value of vfs_stat() */
+    struct stat st;                         /**< file status */
+    char path[VFS_STAT_CACHE_PATH_MAX];     /**< path passed to vfs_stat() */
+} _stat_cache_entry_t;
+
+static _stat_cache_entry_t _stat_cache[VFS_STAT_CACHE_SIZE];
+static mutex_t _stat_cache_mutex = MUTEX_INIT;
+static uint8_t _stat_cache_next;
+/* starts at 1, so the zero initialized entries are invalid */
+static uint32_t _stat_cache_gen = 1;
+
+/**
+ * @internal
+ * @brief Invalidate all entries of the stat cache
+ *
+ * This has to be called *after* every operation that may modify a file system.
+ */
+static inline void _stat_cache_flush(void)
+{
+    if (IS_USED(MODULE_VFS_STAT_CACHE)) {
+        atomic_fetch_add_u32(&_stat_cache_gen, 1);
+    }
+}
+
+static bool _stat_cache_get(const char *path, struct stat *buf, int *res, uint32_t gen)
+{
+    bool found = false;
+
+    mutex_lock(&_stat_cache_mutex);
+    for (unsigned i = 0; i < VFS_STAT_CACHE_SIZE; i++) {
+        _stat_cache_entry_t *entry = &_stat_cache[i];
+        if ((entry->gen == gen) && (strcmp(entry->path, path) == 0)) {
+            *buf = entry->st;
+            *res = entry->res;
+            found = true;
+            break;
+        }
+    }
+    mutex_unlock(&_stat_cache_mutex);
+
+    return found;
+}
+
+static void _stat_cache_put(const char *path, const struct stat *buf, int res, uint32_t gen)
+{
+    mutex_lock(&_stat_cache_mutex);
+    _stat_cache_entry_t *entry = NULL;
+    for (unsigned i = 0; i < VFS_STAT_CACHE_SIZE; i++) {
+        if (strcmp(_stat_cache[i].path, path) == 0) {
+            entry = &_stat_cache[i];
+            break;
+        }
+    }
+    if (entry == NULL) {
+        entry = &_stat_cache[_stat_cache_next];
+        _stat_cache_next = (_stat_cache_next + 1) % VFS_STAT_CACHE_SIZE;
+    }
+    /* if the cache was flushed since the file system was asked, gen is
+     * already outdated and the entry will never be used */
+    entry->gen = gen;
+    entry->res = res;
+    entry->st = *buf;
+    strcpy(entry->path, path);
+    mutex_unlock(&_stat_cache_mutex);
+}
+
 int vfs_close(int fd)
 {
     DEBUG("vfs_close: %d\n", fd);
@@ -156,12 +263,17 @@ int vfs_close(int fd)
         return res;
     }
     vfs_file_t *filp = &_vfs_open_files[fd];
+    bool modified = (filp->mp != NULL) && ((filp->flags & O_ACCMODE) != O_RDONLY);
     if (filp->f_op->close != NULL) {
         /* We will invalidate the fd regardless of the outcome of the file
          * system driver close() call below */
         res = filp->f_op->close(filp);
     }
     _free_fd(fd);
+    if (modified) {
+        /* file systems may only update the file size on close */
+        _stat_cache_flush();
+    }
     return res;
 }
 
@@ -313,6 +425,9 @@ int vfs_open(const char *name, int flags, mode_t mode)
             return res;
         }
     }
+    if (((flags & O_ACCMODE) != O_RDONLY) || (flags & (O_CREAT | O_TRUNC))) {
+        _stat_cache_flush();
+    }
     DEBUG("vfs_open: opened %d\n", fd);
     return fd;
 }
@@ -410,7 +525,11 @@ ssize_t vfs_write(int fd, const void *src, size_t count)
         /* driver does not implement write() */
         return -EINVAL;
     }
-    return filp->f_op->write(filp, src, count);
+    ssize_t written = filp->f_op->write(filp, src, count);
+    if (filp->mp != NULL) {
+        _stat_cache_flush();
+    }
+    return written;
 }
 
 ssize_t vfs_write_iol(int fd, const iolist_t *snips)
@@ -445,7 +564,9 @@ int vfs_fsync(int fd)
         /* driver does not implement fsync() */
         return -EINVAL;
     }
-    return filp->f_op->fsync(filp);
+    res = filp->f_op->fsync(filp);
+    _stat_cache_flush();
+    return res;
 }
 
 int vfs_opendir(vfs_DIR *dirp, const char *dirname)
@@ -571,7 +692,9 @@ int vfs_format(vfs_mount_t *mountp)
 
     if (mountp->fs->fs_op != NULL) {
         if (mountp->fs->fs_op->format != NULL) {
-            return mountp->fs->fs_op->format(mountp);
+            ret = mountp->fs->fs_op->format(mountp);
+            _stat_cache_flush();
+            return ret;
         }
     }
 
@@ -600,7 +723,9 @@ int vfs_mount(vfs_mount_t *mountp)
     }
     /* Insert last in list. This property is relied on by vfs_iterate_mount_dirs. */
     clist_rpush(&_vfs_mounts_list, &mountp->list_entry);
+    _mount_index_update(NULL);
     mutex_unlock(&_mount_mutex);
+    _stat_cache_flush();
     DEBUG("vfs_mount: mount done\n");
     return 0;
 }
@@ -627,12 +752,21 @@ int vfs_umount(vfs_mount_t *mountp, bool force)
         mutex_unlock(&_mount_mutex);
         return -EBUSY;
     }
+    /* Hide the mount from lookups before the file system goes away. A lookup
+     * that found it just before holds an open_files count by now. */
+    _mount_index_update(mountp);
+    if (atomic_load_u16(&mountp->open_files) > 0 && !force) {
+        _mount_index_update(NULL);
+        mutex_unlock(&_mount_mutex);
+        return -EBUSY;
+    }
     if (mountp->fs->fs_op != NULL) {
         if (mountp->fs->fs_op->umount != NULL) {
             int res = mountp->fs->fs_op->umount(mountp);
             if (res < 0) {
                 /* umount failed */
                 DEBUG("vfs_umount: ERR %d!\n", res);
+                _mount_index_update(NULL);
                 mutex_unlock(&_mount_mutex);
                 return res;
             }
@@ -647,6 +781,7 @@ int vfs_umount(vfs_mount_t *mountp, bool force)
         return -EINVAL;
     }
     mutex_unlock(&_mount_mutex);
+    _stat_cache_flush();
     return 0;
 }
 
@@ -696,6 +831,7 @@ int vfs_rename(const char *from_path, const char *to_path)
         return -EXDEV;
     }
     res = mountp->fs->fs_op->rename(mountp, rel_from, rel_to);
+    _stat_cache_flush();
     DEBUG("vfs_rename: rename %p, \"%s\" -> \"%s\"", (void *)mountp, rel_from, rel_to);
     if (res < 0) {
         /* something went wrong during rename */
@@ -739,6 +875,7 @@ int vfs_unlink(const char *name)
         return -EROFS;
     }
     res = mountp->fs->fs_op->unlink(mountp, rel_path);
+    _stat_cache_flush();
     DEBUG("vfs_unlink: unlink %p, \"%s\"", (void *)mountp, rel_path);
     if (res < 0) {
         /* something went wrong during unlink */
@@ -778,6 +915,7 @@ int vfs_mkdir(const char *name, mode_t mode)
         return -EROFS;
     }
     res = mountp->fs->fs_op->mkdir(mountp, rel_path, mode);
+    _stat_cache_flush();
     DEBUG("vfs_mkdir: mkdir %p, \"%s\"", (void *)mountp, rel_path);
     if (res < 0) {
         /* something went wrong during mkdir */
@@ -817,6 +955,7 @@ int vfs_rmdir(const char *name)
         return -EROFS;
     }
     res = mountp->fs->fs_op->rmdir(mountp, rel_path);
+    _stat_cache_flush();
     DEBUG("vfs_rmdir: rmdir %p, \"%s\"", (void *)mountp, rel_path);
     if (res < 0) {
         /* something went wrong during rmdir */
@@ -840,6 +979,16 @@ int vfs_stat(const char *restrict path, struct stat *restrict buf)
     const char *rel_path;
     vfs_mount_t *mountp;
     int res;
+    uint32_t cache_gen = 0;
+    bool cacheable = IS_USED(MODULE_VFS_STAT_CACHE)
+                  && (strlen(path) < VFS_STAT_CACHE_PATH_MAX);
+    if (cacheable) {
+        cache_gen = atomic_load_u32(&_stat_cache_gen);
+        if (_stat_cache_get(path, buf, &res, cache_gen)) {
+            DEBUG("vfs_stat: cached\n");
+            return res;
+        }
+    }
     res = _find_mount(&mountp, path, &rel_path);
     /* _find_mount implicitly increments the open_files count on success */
     if (res < 0) {
@@ -860,6 +1009,9 @@ int vfs_stat(const char *restrict path, struct stat *restrict buf)
     /* remember to decrement the open_files count */
     uint16_t before = atomic_fetch_sub_u16(&mountp->open_files, 1);
     assume(before > 0);
+    if (cacheable && ((res == 0) || (res == -ENOENT))) {
+        _stat_cache_put(path, buf, res, cache_gen);
+    }
     return res;
 }
 
@@ -1134,64 +1286,156 @@ static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *moun
     return fd;
 }
 
-static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const char **rel_path)
+static void _mount_index_update(const vfs_mount_t *skip)
+{
+    unsigned buf = (atomic_load_u32(&_mount_index_gen) + 1) & 1;
+    vfs_mount_t **index = _mount_index[buf];
+    unsigned numof = 0;
+
+    clist_node_t *node = _vfs_mounts_list.next;
+    if (node != NULL) {
+        do {
+            node = node->next;
+            vfs_mount_t *it = container_of(node, vfs_mount_t, list_entry);
+            if (it == skip) {
+                continue;
+            }
+            if (numof == VFS_MOUNT_INDEX_SIZE) {
+                numof = UINT8_MAX;
+                break;
+            }
+            /* Sort in after all longer mount points. Mounts with a mount point
+             * of equal length are placed before those mounted earlier, the
+             * last mount shadows previous ones. */
+            unsigned i = numof++;
+            while ((i > 0) && (index[i - 1]->mount_point_len <= it->mount_point_len)) {
+                atomic_store_ptr((void **)&index[i], index[i - 1]);
+                i--;
+            }
+            atomic_store_ptr((void **)&index[i], it);
+        } while (node != _vfs_mounts_list.next);
+    }
+
+    atomic_store_u8(&_mount_index_numof[buf], numof);
+    atomic_fetch_add_u32(&_mount_index_gen, 1);
+}
+
+static inline bool _mount_matches(const vfs_mount_t *mountp, const char *name, size_t name_len)
+{
+    size_t len = mountp->mount_point_len;
+    if (len > name_len) {
+        /* path name is shorter than the mount point name */
+        return false;
+    }
+    if ((len > 1) && (name[len] != '/') && (name[len] != '\0')) {
+        /* name does not have a directory separator where mount point name ends */
+        return false;
+    }
+    return strncmp(name, mountp->mount_point, len) == 0;
+}
+
+static inline void _mount_hold(vfs_mount_t *mountp)
+{
+    /* Increment open files counter for this mount */
+    uint16_t before = atomic_fetch_add_u16(&mountp->open_files, 1);
+    /* We cannot use assume() here, an overflow could occur in absence of
+     * any bugs and should also be checked for in production code. We use
+     * expect() here, which was actually written for unit tests but works
+     * here as well */
+    expect(before < UINT16_MAX);
+}
+
+/* slow path if the mounts don't fit into the lookup index */
+static vfs_mount_t *_find_mount_locked(const char *name, size_t name_len)
 {
     size_t longest_match = 0;
-    size_t name_len = strlen(name);
+    vfs_mount_t *mountp = NULL;
     mutex_lock(&_mount_mutex);
 
     clist_node_t *node = _vfs_mounts_list.next;
-    if (node == NULL) {
-        /* list empty */
-        mutex_unlock(&_mount_mutex);
-        return -ENOENT;
+    if (node != NULL) {
+        do {
+            node = node->next;
+            vfs_mount_t *it = container_of(node, vfs_mount_t, list_entry);
+            if (it->mount_point_len < longest_match) {
+                /* Already found a longer prefix */
+                continue;
+            }
+            if (_mount_matches(it, name, name_len)) {
+                /* special check for mount_point == "/" */
+                if (it->mount_point_len > 1) {
+                    longest_match = it->mount_point_len;
+                }
+                mountp = it;
+            }
+        } while (node != _vfs_mounts_list.next);
     }
-    vfs_mount_t *mountp = NULL;
-    do {
-        node = node->next;
-        vfs_mount_t *it = container_of(node, vfs_mount_t, list_entry);
-        size_t len = it->mount_point_len;
-        if (len < longest_match) {
-            /* Already found a longer prefix */
-            continue;
+    if (mountp != NULL) {
+        _mount_hold(mountp);
+    }
+
+    mutex_unlock(&_mount_mutex);
+    return mountp;
+}
+
+static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const char **rel_path)
+{
+    size_t name_len = strlen(name);
+    vfs_mount_t *mountp;
+
+    while (1) {
+        uint32_t gen = atomic_load_u32(&_mount_index_gen);
+        unsigned buf = gen & 1;
+        unsigned numof = atomic_load_u8(&_mount_index_numof[buf]);
+
+        if (numof > VFS_MOUNT_INDEX_SIZE) {
+            mountp = _find_mount_locked(name, name_len);
+            break;
         }
-        if (len > name_len) {
-            /* path name is shorter than the mount point name */
-            continue;
+
+        /* the index is sorted by length, the first match is the longest */
+        mountp = NULL;
+        for (unsigned i = 0; i < numof; i++) {
+            vfs_mount_t *it = atomic_load_ptr((void **)&_mount_index[buf][i]);
+            if (_mount_matches(it, name, name_len)) {
+                mountp = it;
+                break;
+            }
         }
-        if ((len > 1) && (name[len] != '/') && (name[len] != '\0')) {
-            /* name does not have a directory separator where mount point name ends */
+
+        if (atomic_load_u32(&_mount_index_gen) != gen) {
+            /* index was rebuilt while we were reading it */
             continue;
         }
-        if (strncmp(name, it->mount_point, len) == 0) {
-            /* mount_point is a prefix of name */
-            /* special check for mount_point == "/" */
-            if (len > 1) {
-                longest_match = len;
-            }
-            mountp = it;
+        if (mountp == NULL) {
+            break;
+        }
+
+        _mount_hold(mountp);
+        if (atomic_load_u32(&_mount_index_gen) == gen) {
+            /* vfs_umount() hides a mount before checking open_files, so
+             * the mount can not go away any more */
+            break;
         }
-    } while (node != _vfs_mounts_list.next);
+        /* mount may be about to be unmounted, try again */
+        uint16_t before = atomic_fetch_sub_u16(&mountp->open_files, 1);
+        assume(before > 0);
+    }
+
     if (mountp == NULL) {
         /* not found */
-        mutex_unlock(&_mount_mutex);
         return -ENOENT;
     }
-    /* Increment open files counter for this mount */
-    uint16_t before = atomic_fetch_add_u16(&mountp->open_files, 1);
-    /* We cannot use assume() here, an overflow could occur in absence of
-     * any bugs and should also be checked for in production code. We use
-     * expect() here, which was actually written for unit tests but works
-     * here as well */
-    expect(before < UINT16_MAX);
-    mutex_unlock(&_mount_mutex);
     *mountpp = mountp;
 
     if (rel_path != NULL) {
         if (mountp->fs->flags & VFS_FS_FLAG_WANT_ABS_PATH) {
             *rel_path = name;
+        } else if (mountp->mount_point_len > 1) {
+            *rel_path = name + mountp->mount_point_len;
         } else {
-            *rel_path = name + longest_match;
+            /* special case for mount_point == "/" */
+            *rel_path = name;
         }
     }
     return 0;
@@ -31,6 +31,7 @@
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
 #include "pm_layered.h"
 #endif
+#include "trace.h"
 #include "ztimer.h"
 #include "log.h"
 
@@ -470,6 +471,9 @@ void ztimer_handler(ztimer_clock_t *clock)
             DEBUG("ztimer_handler(): trigger %p->%p at %" PRIu32 "\n",
                   (void *)entry, (void *)entry->base.next, clock->ops->now(
                       clock));
+#if IS_USED(MODULE_TRACE_ZTIMER)
+            trace_event(TRACE_EVENT_ZTIMER_FIRE, (uintptr_t)entry);
+#endif
             entry->callback(entry->arg);
 #if MODULE_ZTIMER_ONDEMAND
             no_clock_user_left = ztimer_release(clock);
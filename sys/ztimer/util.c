@@ -172,6 +172,29 @@ int ztimer_mbox_get_timeout(ztimer_clock_t *clock, mbox_t *mbox, msg_t *msg, uin
     ztimer_remove(clock, &data.timer);
     return data.status;
 }
+
+static void _ztimer_mbox_put_timeout(void *arg)
+{
+    mbox_cancel(arg);
+}
+
+int ztimer_mbox_put_timeout(ztimer_clock_t *clock, mbox_t *mbox, msg_t *msg, uint32_t timeout)
+{
+    if (mbox_try_put(mbox, msg)) {
+        return 0;
+    }
+
+    mbox_cancel_t mc = mbox_cancel_init(mbox);
+    ztimer_t t = { .callback = _ztimer_mbox_put_timeout, .arg = &mc };
+
+    ztimer_set(clock, &t, timeout);
+    if (mbox_put_cancelable(&mc, msg)) {
+        return -ETIMEDOUT;
+    }
+
+    ztimer_remove(clock, &t);
+    return 0;
+}
 #endif
 
 #ifdef MODULE_CORE_THREAD_FLAGS
@@ -0,0 +1,154 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Ownership-transfer channel vs. mailbox benchmark
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "chan.h"
+#include "mbox.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef BENCH_ITEMS
+#define BENCH_ITEMS         (60000U)
+#endif
+
+#ifndef BENCH_PRODUCERS
+#define BENCH_PRODUCERS     (2U)
+#endif
+
+#ifndef BENCH_QUEUE_SIZE
+#define BENCH_QUEUE_SIZE    (16U)
+#endif
+
+#ifndef BENCH_PAYLOAD_SIZE
+#define BENCH_PAYLOAD_SIZE  (128U)
+#endif
+
+/* number of buffers the consumer takes per wakeup in the chan_many variant */
+#define DRAIN_MAX           BENCH_QUEUE_SIZE
+
+#define BUF_TYPE            (0x4243)
+#define BUFS_NUMOF          (BENCH_QUEUE_SIZE + BENCH_PRODUCERS)
+
+enum {
+    VARIANT_MBOX,
+    VARIANT_CHAN,
+    VARIANT_CHAN_MANY,
+};
+
+typedef struct {
+    chan_buf_t buf;
+    uint8_t payload[BENCH_PAYLOAD_SIZE];
+} bench_buf_t;
+
+static char _stacks[BENCH_PRODUCERS + 1][THREAD_STACKSIZE_DEFAULT];
+static msg_t _queue[BENCH_QUEUE_SIZE];
+static mbox_t _mbox;
+static chan_t _chan;
+static bench_buf_t _bufs[BUFS_NUMOF];
+static unsigned _variant;
+static uint32_t _received;
+
+static void *_producer(void *arg)
+{
+    unsigned id = (uintptr_t)arg;
+
+    for (unsigned i = id; i < BENCH_ITEMS; i += BENCH_PRODUCERS) {
+        bench_buf_t *buf = &_bufs[i % BUFS_NUMOF];
+        buf->payload[0] = i;
+        if (_variant == VARIANT_MBOX) {
+            msg_t msg = { .content = { .ptr = buf } };
+            mbox_put(&_mbox, &msg);
+        }
+        else {
+            chan_buf_hold(&buf->buf, 1);
+            chan_send(&_chan, &buf->buf);
+        }
+    }
+    return NULL;
+}
+
+static void *_consumer(void *arg)
+{
+    (void)arg;
+    chan_buf_t *bufs[DRAIN_MAX];
+
+    while (_received < BENCH_ITEMS) {
+        if (_variant == VARIANT_MBOX) {
+            msg_t msg;
+            mbox_get(&_mbox, &msg);
+            _received++;
+        }
+        else {
+            size_t num = (_variant == VARIANT_CHAN)
+                       ? (bufs[0] = chan_recv(&_chan), 1)
+                       : chan_recv_many(&_chan, bufs, ARRAY_SIZE(bufs));
+            for (size_t i = 0; i < num; i++) {
+                chan_buf_release(bufs[i]);
+            }
+            _received += num;
+        }
+    }
+    return NULL;
+}
+
+static void _run(unsigned variant, const char *name)
+{
+    _variant = variant;
+    _received = 0;
+    mbox_init(&_mbox, _queue, ARRAY_SIZE(_queue));
+    chan_init(&_chan, _queue, ARRAY_SIZE(_queue), BUF_TYPE);
+    for (unsigned i = 0; i < BUFS_NUMOF; i++) {
+        chan_buf_init(&_bufs[i].buf, NULL);
+    }
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    /* main only continues once all threads are done */
+    thread_create(_stacks[0], sizeof(_stacks[0]), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_WOUT_YIELD, _consumer, NULL, "consumer");
+    for (unsigned i = 0; i < BENCH_PRODUCERS; i++) {
+        thread_create(_stacks[i + 1], sizeof(_stacks[i + 1]),
+                      THREAD_PRIORITY_MAIN - 2, THREAD_CREATE_WOUT_YIELD,
+                      _producer, (void *)(uintptr_t)i, "producer");
+    }
+    thread_yield_higher();
+
+    uint32_t duration = ztimer_now(ZTIMER_USEC) - start;
+
+    expect(_received == BENCH_ITEMS);
+    for (unsigned i = 0; i < BUFS_NUMOF; i++) {
+        expect(_bufs[i].buf.refs == 1);
+    }
+
+    printf("{ \"variant\" : \"%s\", \"duration_us\" : %" PRIu32
+           ", \"ns_per_item\" : %" PRIu32 " }\n", name, duration,
+           (uint32_t)((uint64_t)duration * 1000 / BENCH_ITEMS));
+}
+
+int main(void)
+{
+    printf("items: %u, producers: %u, queue size: %u\n",
+           BENCH_ITEMS, BENCH_PRODUCERS, BENCH_QUEUE_SIZE);
+
+    _run(VARIANT_MBOX, "mbox");
+    _run(VARIANT_CHAN, "chan");
+    _run(VARIANT_CHAN_MANY, "chan_many");
+
+    puts("[SUCCESS]");
+    return 0;
+}
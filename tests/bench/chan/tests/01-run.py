@@ -0,0 +1,18 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 The RIOT authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for name in ("mbox", "chan", "chan_many"):
+        child.expect(r"{ \"variant\" : \"%s\", \"duration_us\" : \d+, "
+                     r"\"ns_per_item\" : \d+ }" % name)
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,345 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Streaming decompression benchmark
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "container.h"
+#include "decompress.h"
+#include "fs/zconstfs.h"
+#include "heatshrink_encoder.h"
+#include "lz4.h"
+#include "macros/math.h"
+#include "random.h"
+#include "vfs.h"
+#include "ztimer.h"
+
+#define PAYLOAD_SIZE    (8 * 1024U)
+#define CHUNK_SIZE      (64U)
+#define NUM_BLOCKS      DIV_ROUND_UP(PAYLOAD_SIZE, CONFIG_ZCONSTFS_BLOCKSIZE)
+/* heatshrink expands incompressible data by 1/8 at most */
+#define STREAM_SIZE     (PAYLOAD_SIZE + PAYLOAD_SIZE / 8 + NUM_BLOCKS * 16)
+
+typedef struct {
+    const char *name;
+    decompress_codec_t codec;
+    size_t state_size;
+} _codec_t;
+
+static const _codec_t _codecs[] = {
+    { "heatshrink", DECOMPRESS_CODEC_HEATSHRINK,
+      sizeof(((decompress_t *)0)->u.heatshrink) },
+    { "lz4", DECOMPRESS_CODEC_LZ4, sizeof(((decompress_t *)0)->u.lz4) },
+};
+
+static const char *_payload_names[] = { "text", "firmware" };
+
+static const char *_words[] = {
+    "the", "riot", "thread", "packet", "buffer", "of", "and", "network",
+    "interrupt", "a", "to", "timer", "is", "in", "device", "driver",
+};
+
+static uint8_t _payload[ARRAY_SIZE(_payload_names)][PAYLOAD_SIZE];
+static uint8_t _stream[STREAM_SIZE];
+static uint8_t _out[PAYLOAD_SIZE];
+static decompress_t _ctx;
+static heatshrink_encoder _hse;
+static LZ4_stream_t _lz4;
+
+/* zconstfs images, one mount per codec */
+static uint8_t _zdata[ARRAY_SIZE(_codecs)][ARRAY_SIZE(_payload)][STREAM_SIZE];
+static uint32_t _zblocks[ARRAY_SIZE(_codecs)][ARRAY_SIZE(_payload)][NUM_BLOCKS + 1];
+
+#define ZFILE(c, p) { \
+    .path = "/" #p, .size = PAYLOAD_SIZE, .data = _zdata[c][p], .blocks = _zblocks[c][p] }
+
+static const zconstfs_file_t _zfiles[ARRAY_SIZE(_codecs)][ARRAY_SIZE(_payload)] = {
+    { ZFILE(0, 0), ZFILE(0, 1) },
+    { ZFILE(1, 0), ZFILE(1, 1) },
+};
+
+static const zconstfs_t _zfs[ARRAY_SIZE(_codecs)] = {
+    { .nfiles = ARRAY_SIZE(_payload), .files = _zfiles[0],
+      .codec = DECOMPRESS_CODEC_HEATSHRINK },
+    { .nfiles = ARRAY_SIZE(_payload), .files = _zfiles[1],
+      .codec = DECOMPRESS_CODEC_LZ4 },
+};
+
+static vfs_mount_t _mounts[ARRAY_SIZE(_codecs)] = {
+    { .fs = &zconstfs_file_system, .mount_point = "/hs",
+      .private_data = (void *)&_zfs[0] },
+    { .fs = &zconstfs_file_system, .mount_point = "/lz4",
+      .private_data = (void *)&_zfs[1] },
+};
+
+static void _text(uint8_t *buf, size_t len)
+{
+    size_t pos = 0;
+    size_t line = 0;
+
+    while (pos < len) {
+        const char *word = _words[random_uint32_range(0, ARRAY_SIZE(_words))];
+        size_t wlen = strlen(word);
+        line += wlen + 1;
+        for (size_t i = 0; i < wlen && pos < len; i++) {
+            buf[pos++] = word[i];
+        }
+        if (pos < len) {
+            buf[pos++] = line > 72 ? '\n' : ' ';
+        }
+        if (line > 72) {
+            line = 0;
+        }
+    }
+}
+
+/* instructions from a small set of encodings, strings and padding */
+static void _firmware(uint8_t *buf, size_t len)
+{
+    uint16_t ops[32];
+    random_bytes((uint8_t *)ops, sizeof(ops));
+
+    size_t pos = 0;
+    while (pos < len) {
+        size_t n = MIN(random_uint32_range(16, 256), len - pos);
+        switch (random_uint32_range(0, 4)) {
+        case 0:
+            _text(&buf[pos], n);
+            break;
+        case 1:
+            memset(&buf[pos], random_uint32_range(0, 2) ? 0xff : 0x00, n);
+            break;
+        default:
+            for (size_t i = 0; i + 1 < n; i += 2) {
+                memcpy(&buf[pos + i], &ops[random_uint32_range(0, ARRAY_SIZE(ops))], 2);
+            }
+            break;
+        }
+        pos += n;
+    }
+}
+
+static size_t _compress_heatshrink(const uint8_t *in, size_t len,
+                                   uint8_t *out, size_t out_len)
+{
+    size_t pos = 0;
+
+    heatshrink_encoder_reset(&_hse);
+    while (len) {
+        size_t sunk = 0;
+        heatshrink_encoder_sink(&_hse, (uint8_t *)in, len, &sunk);
+        in += sunk;
+        len -= sunk;
+
+        HSE_poll_res res;
+        do {
+            size_t written = 0;
+            res = heatshrink_encoder_poll(&_hse, &out[pos], out_len - pos, &written);
+            pos += written;
+        } while (res == HSER_POLL_MORE);
+    }
+    while (heatshrink_encoder_finish(&_hse) == HSER_FINISH_MORE) {
+        size_t written = 0;
+        heatshrink_encoder_poll(&_hse, &out[pos], out_len - pos, &written);
+        pos += written;
+    }
+
+    return pos;
+}
+
+/* LZ4 blocks of CONFIG_ZCONSTFS_BLOCKSIZE, each with its length prefix */
+static size_t _compress_lz4(const uint8_t *in, size_t len,
+                            uint8_t *out, size_t out_len)
+{
+    size_t pos = 0;
+
+    for (size_t off = 0; off < len; off += CONFIG_ZCONSTFS_BLOCKSIZE) {
+        int n = LZ4_compress_fast_extState(&_lz4, (const char *)&in[off],
+                                           (char *)&out[pos + 2],
+                                           MIN(len - off, CONFIG_ZCONSTFS_BLOCKSIZE),
+                                           out_len - pos - 2, 1);
+        if (n <= 0) {
+            return 0;
+        }
+        byteorder_htolebufs(&out[pos], n);
+        pos += 2 + n;
+    }
+
+    return pos;
+}
+
+static size_t _compress(decompress_codec_t codec, const uint8_t *in, size_t len,
+                        uint8_t *out, size_t out_len)
+{
+    if (codec == DECOMPRESS_CODEC_HEATSHRINK) {
+        return _compress_heatshrink(in, len, out, out_len);
+    }
+    return _compress_lz4(in, len, out, out_len);
+}
+
+static int _write(void *arg, const uint8_t *buf, size_t len)
+{
+    size_t *pos = arg;
+
+    if (*pos + len > sizeof(_out)) {
+        return -EOVERFLOW;
+    }
+    memcpy(&_out[*pos], buf, len);
+    *pos += len;
+
+    return 0;
+}
+
+/* returns the decoding throughput in KiB/s */
+static unsigned _bench_codec(const _codec_t *codec, const uint8_t *payload)
+{
+    size_t len = _compress(codec->codec, payload, PAYLOAD_SIZE, _stream, sizeof(_stream));
+    size_t pos = 0;
+
+    if (len == 0) {
+        return 0;
+    }
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    decompress_init(&_ctx, codec->codec, _write, &pos);
+    for (size_t off = 0; off < len; off += CHUNK_SIZE) {
+        if (decompress_feed(&_ctx, &_stream[off], MIN(CHUNK_SIZE, len - off)) < 0) {
+            return 0;
+        }
+    }
+    if (decompress_finish(&_ctx) < 0) {
+        return 0;
+    }
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+
+    if (pos != PAYLOAD_SIZE || memcmp(_out, payload, PAYLOAD_SIZE)) {
+        puts("decoded data mismatch");
+        return 0;
+    }
+
+    unsigned kibps = ((uint64_t)PAYLOAD_SIZE * 1000000 / 1024) / MAX(time, 1);
+    printf("  %-10s %5u -> %5u bytes (%3u%%), %6" PRIu32 " us, %5u KiB/s, "
+           "%4u bytes state\n", codec->name, PAYLOAD_SIZE, (unsigned)len,
+           (unsigned)(100 * len / PAYLOAD_SIZE), time, kibps,
+           (unsigned)codec->state_size);
+
+    return kibps;
+}
+
+static int _mkzconstfs(unsigned c)
+{
+    for (unsigned p = 0; p < ARRAY_SIZE(_payload); p++) {
+        size_t pos = 0;
+
+        for (unsigned b = 0; b < NUM_BLOCKS; b++) {
+            size_t off = b * CONFIG_ZCONSTFS_BLOCKSIZE;
+            size_t len = _compress(_codecs[c].codec, &_payload[p][off],
+                                   MIN(CONFIG_ZCONSTFS_BLOCKSIZE, PAYLOAD_SIZE - off),
+                                   &_zdata[c][p][pos], STREAM_SIZE - pos);
+            if (len == 0) {
+                return -1;
+            }
+            _zblocks[c][p][b] = pos;
+            pos += len;
+        }
+        _zblocks[c][p][NUM_BLOCKS] = pos;
+    }
+
+    return vfs_mount(&_mounts[c]);
+}
+
+/* reads a file in chunks, in order or in a random order of chunks,
+ * returns 0 on error */
+static uint32_t _bench_vfs(const char *path, const uint8_t *payload, bool shuffle)
+{
+    uint8_t buf[CHUNK_SIZE];
+    int fd = vfs_open(path, O_RDONLY, 0);
+    if (fd < 0) {
+        return 0;
+    }
+
+    uint32_t time = 0;
+    for (unsigned i = 0; i < PAYLOAD_SIZE / CHUNK_SIZE; i++) {
+        unsigned chunk = shuffle ? random_uint32_range(0, PAYLOAD_SIZE / CHUNK_SIZE) : i;
+
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        vfs_lseek(fd, chunk * CHUNK_SIZE, SEEK_SET);
+        ssize_t res = vfs_read(fd, buf, sizeof(buf));
+        time += ztimer_now(ZTIMER_USEC) - start;
+
+        if (res != sizeof(buf) || memcmp(buf, &payload[chunk * CHUNK_SIZE], sizeof(buf))) {
+            vfs_close(fd);
+            return 0;
+        }
+    }
+    vfs_close(fd);
+
+    return MAX(time, 1);
+}
+
+int main(void)
+{
+    unsigned result = UINT32_MAX;
+
+    _text(_payload[0], PAYLOAD_SIZE);
+    _firmware(_payload[1], PAYLOAD_SIZE);
+
+    printf("decompress_t: %u bytes, chunks of %u bytes\n",
+           (unsigned)sizeof(decompress_t), CHUNK_SIZE);
+
+    for (unsigned p = 0; p < ARRAY_SIZE(_payload); p++) {
+        printf("%s:\n", _payload_names[p]);
+        for (unsigned c = 0; c < ARRAY_SIZE(_codecs); c++) {
+            unsigned kibps = _bench_codec(&_codecs[c], _payload[p]);
+            if (kibps == 0) {
+                puts("FAILED");
+                return 1;
+            }
+            result = MIN(result, kibps);
+        }
+    }
+
+    printf("zconstfs, blocks of %u bytes, %u cached:\n",
+           CONFIG_ZCONSTFS_BLOCKSIZE, CONFIG_ZCONSTFS_CACHE_BLOCKS);
+    for (unsigned c = 0; c < ARRAY_SIZE(_codecs); c++) {
+        if (_mkzconstfs(c) < 0) {
+            puts("FAILED");
+            return 1;
+        }
+        for (unsigned p = 0; p < ARRAY_SIZE(_payload); p++) {
+            char path[16];
+            snprintf(path, sizeof(path), "%s/%u", _mounts[c].mount_point, p);
+
+            uint32_t seq = _bench_vfs(path, _payload[p], false);
+            uint32_t rnd = _bench_vfs(path, _payload[p], true);
+            if (!seq || !rnd) {
+                puts("FAILED");
+                return 1;
+            }
+            printf("  %-8s %-8s %5" PRIu32 " -> %5" PRIu32 " bytes, sequential %6" PRIu32
+                   " us, random %6" PRIu32 " us\n", path, _payload_names[p],
+                   (uint32_t)PAYLOAD_SIZE,
+                   _zblocks[c][p][NUM_BLOCKS], seq, rnd);
+        }
+    }
+
+    printf("{ \"result\" : %u }\n", result);
+
+    return 0;
+}
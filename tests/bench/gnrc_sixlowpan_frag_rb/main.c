@@ -0,0 +1,137 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure 6LoWPAN fragments added to the reassembly buffer per
+ *              second
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/sixlowpan/frag/rb.h"
+#include "net/sixlowpan.h"
+#include "xtimer.h"
+
+#ifndef TEST_DURATION_US
+#define TEST_DURATION_US    (1000000U)
+#endif
+
+#define FRAG_PAYLOAD_SIZE   (96U)
+#define FRAGS_PER_DATAGRAM  (4U)
+#define DATAGRAM_SIZE       (FRAG_PAYLOAD_SIZE * FRAGS_PER_DATAGRAM)
+
+static struct {
+    gnrc_netif_hdr_t hdr;
+    uint8_t src[IEEE802154_LONG_ADDRESS_LEN];
+    uint8_t dst[IEEE802154_LONG_ADDRESS_LEN];
+} _netif_hdr;
+
+/* first fragment carries an additional uncompressed IPv6 dispatch */
+static uint8_t _frag[sizeof(sixlowpan_frag_n_t) + FRAG_PAYLOAD_SIZE + 1];
+
+static void _timer_callback(void *_flag)
+{
+    atomic_flag *flag = _flag;
+    atomic_flag_clear(flag);
+}
+
+static size_t _build_frag(unsigned n, uint16_t tag)
+{
+    sixlowpan_frag_n_t *hdr = (sixlowpan_frag_n_t *)_frag;
+
+    hdr->disp_size = byteorder_htons(DATAGRAM_SIZE);
+    hdr->tag = byteorder_htons(tag);
+    if (n == 0) {
+        hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
+        _frag[sizeof(sixlowpan_frag_t)] = SIXLOWPAN_UNCOMP;
+        return sizeof(sixlowpan_frag_t) + 1 + FRAG_PAYLOAD_SIZE;
+    }
+    hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
+    hdr->offset = (n * FRAG_PAYLOAD_SIZE) / 8;
+    return sizeof(sixlowpan_frag_n_t) + FRAG_PAYLOAD_SIZE;
+}
+
+static void _set_sender(unsigned sender)
+{
+    uint8_t src[IEEE802154_LONG_ADDRESS_LEN] = {
+        0x02, 0x00, 0x5e, 0xef, 0x10, 0x00,
+        (uint8_t)(sender >> 8), (uint8_t)sender
+    };
+
+    gnrc_netif_hdr_set_src_addr(&_netif_hdr.hdr, src, sizeof(src));
+}
+
+int main(void)
+{
+    static const uint8_t dst[IEEE802154_LONG_ADDRESS_LEN] = {
+        0x02, 0x00, 0x5e, 0xef, 0x20, 0x00, 0x00, 0x01
+    };
+    atomic_flag flag = ATOMIC_FLAG_INIT;
+    uint32_t frags = 0, datagrams = 0;
+    uint16_t tag = 0;
+    xtimer_t timer = {
+        .callback = _timer_callback,
+        .arg = &flag,
+    };
+
+    puts("main starting");
+    gnrc_pktbuf_init();
+    gnrc_netif_hdr_init(&_netif_hdr.hdr, IEEE802154_LONG_ADDRESS_LEN,
+                        IEEE802154_LONG_ADDRESS_LEN);
+    gnrc_netif_hdr_set_dst_addr(&_netif_hdr.hdr, dst, sizeof(dst));
+    memset(_frag, 0x54, sizeof(_frag));
+
+    atomic_flag_test_and_set(&flag);
+    xtimer_set(&timer, TEST_DURATION_US);
+
+    while (atomic_flag_test_and_set(&flag)) {
+        /* every sender sends the n-th fragment of its current datagram before
+         * any sender sends the (n + 1)-th */
+        for (unsigned n = 0; n < FRAGS_PER_DATAGRAM; n++) {
+            for (unsigned sender = 0; sender < BENCH_SENDERS; sender++) {
+                gnrc_pktsnip_t *pkt;
+                gnrc_sixlowpan_frag_rb_t *rbuf;
+                size_t size = _build_frag(n, tag + sender);
+
+                _set_sender(sender);
+                pkt = gnrc_pktbuf_add(NULL, _frag, size,
+                                      GNRC_NETTYPE_SIXLOWPAN);
+                if (pkt == NULL) {
+                    puts("packet buffer full");
+                    return 1;
+                }
+                rbuf = gnrc_sixlowpan_frag_rb_add(&_netif_hdr.hdr, pkt,
+                                                  n * FRAG_PAYLOAD_SIZE, 0);
+                frags++;
+                /* no receiver registered, so completed datagrams are just
+                 * released */
+                if ((rbuf != NULL) &&
+                    (gnrc_sixlowpan_frag_rb_dispatch_when_complete(
+                        rbuf, &_netif_hdr.hdr) > 0)) {
+                    datagrams++;
+                }
+            }
+        }
+        tag += BENCH_SENDERS;
+    }
+
+    printf("{ \"senders\" : %u, \"fragments\" : %" PRIu32
+           ", \"datagrams\" : %" PRIu32 " }\n",
+           (unsigned)BENCH_SENDERS, frags, datagrams);
+
+    return 0;
+}
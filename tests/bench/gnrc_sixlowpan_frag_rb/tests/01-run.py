@@ -0,0 +1,16 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 The RIOT authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"{ \"senders\" : \d+, \"fragments\" : \d+, "
+                 r"\"datagrams\" : \d+ }")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
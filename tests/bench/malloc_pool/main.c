@@ -0,0 +1,152 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Multi-threaded small allocation benchmark
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "kernel_defines.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#if IS_USED(MODULE_MALLOC_POOL)
+#include "malloc_pool.h"
+#endif
+#if IS_USED(MODULE_TLSF_MALLOC)
+#include "tlsf-malloc.h"
+#endif
+
+#ifndef BENCH_THREADS
+#define BENCH_THREADS       (3U)
+#endif
+
+#ifndef BENCH_ITERATIONS
+#define BENCH_ITERATIONS    (20000U)
+#endif
+
+/* number of allocations each thread keeps alive */
+#ifndef BENCH_SLOTS
+#define BENCH_SLOTS         (8U)
+#endif
+
+#ifndef BENCH_SIZE_MAX
+#define BENCH_SIZE_MAX      (96U)
+#endif
+
+/* number of iterations after which a thread yields to the others */
+#ifndef BENCH_YIELD
+#define BENCH_YIELD         (16U)
+#endif
+
+#ifndef TLSF_HEAP_SIZE
+#define TLSF_HEAP_SIZE      (16 * 1024U)
+#endif
+
+static char _stacks[BENCH_THREADS][THREAD_STACKSIZE_DEFAULT];
+static uint32_t _failed;
+
+#if IS_USED(MODULE_TLSF_MALLOC)
+static uint32_t _tlsf_heap[TLSF_HEAP_SIZE / sizeof(uint32_t)];
+#endif
+
+static void *_worker(void *arg)
+{
+    void *slots[BENCH_SLOTS] = { NULL };
+    /* xorshift32, seeded per thread */
+    uint32_t state = 0x9e3779b9 * ((uintptr_t)arg + 1);
+
+    for (unsigned i = 0; i < BENCH_ITERATIONS; i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+
+        unsigned slot = i % BENCH_SLOTS;
+        free(slots[slot]);
+        slots[slot] = malloc(1 + (state % BENCH_SIZE_MAX));
+        if (slots[slot] == NULL) {
+            _failed++;
+        }
+        else {
+            *(volatile uint8_t *)slots[slot] = i;
+        }
+
+        if ((i % BENCH_YIELD) == (BENCH_YIELD - 1)) {
+            thread_yield();
+        }
+    }
+
+    for (unsigned slot = 0; slot < BENCH_SLOTS; slot++) {
+        free(slots[slot]);
+    }
+#if IS_USED(MODULE_MALLOC_POOL)
+    malloc_pool_tcache_flush();
+#endif
+    return NULL;
+}
+
+static void _run(const char *name)
+{
+    _failed = 0;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    /* the workers preempt main and only return to it after all of them are
+     * done */
+    for (unsigned i = 0; i < BENCH_THREADS; i++) {
+        thread_create(_stacks[i], sizeof(_stacks[i]), THREAD_PRIORITY_MAIN - 1,
+                      THREAD_CREATE_WOUT_YIELD, _worker, (void *)(uintptr_t)i,
+                      "worker");
+    }
+    thread_yield_higher();
+
+    uint32_t duration = ztimer_now(ZTIMER_USEC) - start;
+    uint32_t ops = 2 * BENCH_THREADS * BENCH_ITERATIONS;
+
+    printf("{ \"allocator\" : \"%s\", \"duration_us\" : %" PRIu32
+           ", \"ns_per_op\" : %" PRIu32 ", \"failed\" : %" PRIu32 " }\n",
+           name, duration, (uint32_t)((uint64_t)duration * 1000 / ops), _failed);
+}
+
+int main(void)
+{
+    printf("threads: %u, iterations: %u, slots: %u, sizes: 1..%u\n",
+           BENCH_THREADS, BENCH_ITERATIONS, BENCH_SLOTS, BENCH_SIZE_MAX);
+
+#if IS_USED(MODULE_TLSF_MALLOC)
+    tlsf_add_global_pool(_tlsf_heap, sizeof(_tlsf_heap));
+    _run("tlsf");
+#else
+#if IS_USED(MODULE_MALLOC_POOL)
+    malloc_pool_enable(false);
+#endif
+    _run("libc");
+#endif
+
+#if IS_USED(MODULE_MALLOC_POOL)
+    malloc_pool_enable(true);
+    _run(IS_USED(MODULE_MALLOC_POOL_TCACHE) ? "malloc_pool_tcache" : "malloc_pool");
+
+    for (unsigned cls = 0; cls < CONFIG_MALLOC_POOL_CLASS_NUMOF; cls++) {
+        malloc_pool_stats_t stats;
+        malloc_pool_get_stats(cls, &stats);
+        printf("class %u: block size %u, peak %u/%u, allocs %" PRIu32
+               ", cache hits %" PRIu32 ", exhausted %" PRIu32 "\n",
+               cls, (unsigned)stats.block_size, stats.peak, stats.blocks,
+               stats.allocs, stats.cache_hits, stats.exhausted);
+    }
+#endif
+
+    puts("[SUCCESS]");
+    return 0;
+}
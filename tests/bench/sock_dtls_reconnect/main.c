@@ -0,0 +1,210 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       DTLS reconnect benchmark
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "net/credman.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/dtls.h"
+#include "net/sock/udp.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef ROUNDS
+#define ROUNDS              (24U)
+#endif
+
+#define SERVER_PORT         (20220U)
+#define CREDENTIAL_TAG      (10U)
+#define TIMEOUT_US          (1U * US_PER_SEC)
+/* more clients than sessions fit into CONFIG_DTLS_PEER_MAX */
+#define NUMOF_CLIENTS       (4U)
+
+static const uint8_t _psk_id[] = "Client_identity";
+static const uint8_t _psk_key[] = "secretPSK";
+
+static const credman_credential_t _credential = {
+    .type = CREDMAN_TYPE_PSK,
+    .tag = CREDENTIAL_TAG,
+    .params = {
+        .psk = {
+            .key = { .s = _psk_key, .len = sizeof(_psk_key) - 1, },
+            .id = { .s = _psk_id, .len = sizeof(_psk_id) - 1, },
+        },
+    },
+};
+
+static char _server_stack[THREAD_STACKSIZE_LARGE * 2];
+static uint8_t _server_buf[128];
+static uint8_t _client_buf[128];
+
+static sock_udp_t _client_udp[NUMOF_CLIENTS];
+static sock_dtls_t _clients[NUMOF_CLIENTS];
+static sock_dtls_session_t _sessions[NUMOF_CLIENTS];
+
+static void *_server(void *arg)
+{
+    (void)arg;
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    sock_udp_t udp;
+    sock_dtls_t dtls;
+    sock_dtls_session_t session;
+
+    local.port = SERVER_PORT;
+    if (sock_udp_create(&udp, &local, NULL, 0) < 0 ||
+        sock_dtls_create(&dtls, &udp, CREDENTIAL_TAG, SOCK_DTLS_1_2,
+                         SOCK_DTLS_SERVER) < 0) {
+        puts("error creating server sock");
+        return NULL;
+    }
+
+    while (1) {
+        ssize_t res = sock_dtls_recv(&dtls, &session, _server_buf,
+                                     sizeof(_server_buf), SOCK_NO_TIMEOUT);
+        if (res > 0) {
+            sock_dtls_send(&dtls, &session, _server_buf, res, 0);
+        }
+    }
+
+    return NULL;
+}
+
+/* the first client sends every other request, the others take turns in
+ * between */
+static unsigned _client(unsigned round)
+{
+    return (round % 2) ? 1 + (round / 2) % (NUMOF_CLIENTS - 1) : 0;
+}
+
+/* returns 1 if the request needed a handshake */
+static int _request(sock_dtls_t *dtls, const sock_udp_ep_t *remote,
+                    sock_dtls_session_t *session)
+{
+    static const char req[] = "ping";
+    sock_dtls_session_t closed;
+    ssize_t res;
+
+    /* handle the close_notify of a session the server closed to make room */
+    do {
+        res = sock_dtls_recv(dtls, &closed, _client_buf, sizeof(_client_buf), 0);
+    } while (res != -EAGAIN);
+
+    int handshake = sock_dtls_session_init(dtls, remote, session);
+    if (handshake < 0) {
+        return handshake;
+    }
+    if (handshake > 0) {
+        res = sock_dtls_recv(dtls, session, _client_buf, sizeof(_client_buf),
+                             TIMEOUT_US);
+        if (res != -SOCK_DTLS_HANDSHAKE) {
+            return res < 0 ? res : -EPROTO;
+        }
+    }
+
+    res = sock_dtls_send(dtls, session, req, sizeof(req), TIMEOUT_US);
+    if (res < 0) {
+        return res;
+    }
+    res = sock_dtls_recv(dtls, session, _client_buf, sizeof(_client_buf),
+                         TIMEOUT_US);
+    if (res != sizeof(req)) {
+        return res < 0 ? res : -EPROTO;
+    }
+    return handshake;
+}
+
+static int _run(const char *name, bool reuse, uint32_t *us_per_req)
+{
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = SERVER_PORT };
+    sock_dtls_session_cache_stats_t stats;
+    unsigned handshakes = 0;
+    int res = 0;
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)remote.addr.ipv6);
+    for (unsigned i = 0; i < NUMOF_CLIENTS; i++) {
+        sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+
+        /* sock_dtls_session_init() needs a local end point */
+        local.port = SERVER_PORT + 1 + i;
+        if (sock_udp_create(&_client_udp[i], &local, NULL, 0) < 0 ||
+            sock_dtls_create(&_clients[i], &_client_udp[i], CREDENTIAL_TAG,
+                             SOCK_DTLS_1_2, SOCK_DTLS_CLIENT) < 0) {
+            puts("error creating client sock");
+            return -1;
+        }
+    }
+
+    sock_dtls_session_cache_stats(&stats);
+    uint32_t evicted = stats.evicted;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        unsigned client = _client(i);
+
+        res = _request(&_clients[client], &remote, &_sessions[client]);
+        if (res < 0) {
+            printf("%s: request %u of client %u failed: %d\n", name, i, client,
+                   res);
+            break;
+        }
+        handshakes += res;
+        if (!reuse) {
+            sock_dtls_session_destroy(&_clients[client], &_sessions[client]);
+        }
+    }
+
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+    sock_dtls_session_cache_stats(&stats);
+    evicted = stats.evicted - evicted;
+
+    for (unsigned i = 0; i < NUMOF_CLIENTS; i++) {
+        if (reuse) {
+            sock_dtls_session_destroy(&_clients[i], &_sessions[i]);
+        }
+        sock_dtls_close(&_clients[i]);
+        sock_udp_close(&_client_udp[i]);
+    }
+
+    *us_per_req = time / ROUNDS;
+    printf("%-9s: %u handshakes, %" PRIu32 " sessions evicted, %" PRIu32
+           " us per request\n", name, handshakes, evicted, *us_per_req);
+
+    return res < 0 ? res : 0;
+}
+
+int main(void)
+{
+    uint32_t reconnect, cached;
+
+    if (credman_add(&_credential) != CREDMAN_OK) {
+        puts("error adding credential");
+        return 1;
+    }
+    thread_create(_server_stack, sizeof(_server_stack), THREAD_PRIORITY_MAIN - 1,
+                  0, _server, NULL, "dtls server");
+
+    printf("%u requests of %u clients, %u peers\n", ROUNDS, NUMOF_CLIENTS,
+           CONFIG_DTLS_PEER_MAX);
+    if (_run("reconnect", false, &reconnect) < 0 ||
+        _run("cached", true, &cached) < 0) {
+        return 1;
+    }
+
+    printf("{ \"result\" : %" PRIu32 " }\n", cached);
+
+    return 0;
+}
@@ -0,0 +1,214 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       SUIT pipelined download benchmark
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "hashes/sha256.h"
+#include "mtd.h"
+#include "mtd_emulated.h"
+#include "random.h"
+#include "suit.h"
+#include "suit/pipeline.h"
+#include "suit/transport/mock.h"
+#include "ztimer.h"
+
+#ifndef NET_RTT_US
+#define NET_RTT_US          (2000U)
+#endif
+
+#ifndef NET_US_PER_BYTE
+#define NET_US_PER_BYTE     (4U)
+#endif
+
+#ifndef FLASH_US_PER_BYTE
+#define FLASH_US_PER_BYTE   (4U)
+#endif
+
+#ifndef FLASH_ERASE_US
+#define FLASH_ERASE_US      (5000U)
+#endif
+
+#define SECTOR_COUNT        16
+#define PAGE_PER_SECTOR     8
+#define PAGE_SIZE           128
+#define SECTOR_SIZE         (PAGE_PER_SECTOR * PAGE_SIZE)
+#define PAYLOAD_SIZE        (SECTOR_COUNT * SECTOR_SIZE)
+
+MTD_EMULATED_DEV(0, SECTOR_COUNT, PAGE_PER_SECTOR, PAGE_SIZE);
+
+static mtd_dev_t *_dev = &mtd_emulated_dev0.base;
+
+static uint8_t _payload[PAYLOAD_SIZE];
+static uint8_t _digest[SHA256_DIGEST_LENGTH];
+
+/* the payload fetched by the mock transport */
+const suit_transport_mock_payload_t payloads[] = {
+    { .buf = _payload, .len = PAYLOAD_SIZE },
+};
+const size_t num_payloads = ARRAY_SIZE(payloads);
+
+static suit_manifest_t _manifest;
+
+static const uint16_t _blksizes[] = { 64, 128, 256, 512 };
+
+static void _sleep_us(uint32_t us)
+{
+    if (us) {
+        ztimer_sleep(ZTIMER_USEC, us);
+    }
+}
+
+/* storage stage: erase on sector boundaries, then program */
+static int _write(void *arg, size_t offset, uint8_t *buf, size_t len, int more)
+{
+    (void)arg;
+    (void)more;
+
+    for (size_t pos = offset; pos < offset + len; pos++) {
+        if ((pos % SECTOR_SIZE) == 0) {
+            int res = mtd_erase_sector(_dev, pos / SECTOR_SIZE, 1);
+            if (res < 0) {
+                return res;
+            }
+            _sleep_us(FLASH_ERASE_US);
+        }
+    }
+
+    _sleep_us(len * FLASH_US_PER_BYTE);
+    return mtd_write_page_raw(_dev, buf, offset / PAGE_SIZE, offset % PAGE_SIZE, len);
+}
+
+/* network stage: the mock transport hands out the blocks right away, wait as
+ * long as requesting the block would take */
+static void _recv(size_t len)
+{
+    _sleep_us(NET_RTT_US + len * NET_US_PER_BYTE);
+}
+
+/* every block is written and hashed before the next one is requested */
+static int _recv_write(void *arg, size_t offset, uint8_t *buf, size_t len,
+                       int more)
+{
+    sha256_context_t *sha = arg;
+
+    _recv(len);
+    int res = _write(NULL, offset, buf, len, more);
+    if (res < 0) {
+        return res;
+    }
+    sha256_update(sha, buf, len);
+    return 0;
+}
+
+/* the pipeline writes and hashes a block while the next one is requested */
+static int _recv_put(void *arg, size_t offset, uint8_t *buf, size_t len,
+                     int more)
+{
+    _recv(len);
+    return suit_pipeline_put(arg, offset, buf, len, more);
+}
+
+static int _verify(const uint8_t *digest)
+{
+    if (memcmp(digest, _digest, sizeof(_digest))) {
+        puts("digest mismatch");
+        return -1;
+    }
+    if (memcmp(mtd_emulated_dev0.memory, _payload, PAYLOAD_SIZE)) {
+        puts("storage content mismatch");
+        return -1;
+    }
+    return 0;
+}
+
+static uint32_t _run_sequential(size_t blksize)
+{
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    sha256_context_t sha;
+
+    sha256_init(&sha);
+    memset(mtd_emulated_dev0.memory, 0, PAYLOAD_SIZE);
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    if (suit_transport_mock_fetch_blockwise(&_manifest, blksize, _recv_write,
+                                            &sha) < 0) {
+        return 0;
+    }
+    sha256_final(&sha, digest);
+    uint32_t total = ztimer_now(ZTIMER_USEC) - start;
+
+    return _verify(digest) ? 0 : total;
+}
+
+static uint32_t _run_pipelined(size_t blksize)
+{
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    suit_pipeline_stats_t stats;
+
+    memset(mtd_emulated_dev0.memory, 0, PAYLOAD_SIZE);
+
+    if (suit_pipeline_start(_write, NULL) < 0) {
+        return 0;
+    }
+    int res = suit_transport_mock_fetch_blockwise(&_manifest, blksize,
+                                                  _recv_put, NULL);
+    /* the pipeline must be finished even if the fetch failed */
+    if (suit_pipeline_finish(digest, &stats) < 0 || res < 0 || _verify(digest)) {
+        return 0;
+    }
+
+    printf("  stages: %" PRIu32 " blocks, recv %" PRIu32 " us, stall %" PRIu32
+           " us, write %" PRIu32 " us, hash %" PRIu32 " us\n",
+           stats.blocks, stats.recv_us, stats.stall_us, stats.write_us,
+           stats.hash_us);
+
+    return stats.total_us;
+}
+
+int main(void)
+{
+    unsigned speedup = 0;
+
+    random_bytes(_payload, sizeof(_payload));
+    sha256(_payload, sizeof(_payload), _digest);
+    mtd_init(_dev);
+
+    printf("payload %u bytes, rtt %u us, net %u us/B, flash %u us/B, erase %u us\n",
+           PAYLOAD_SIZE, NET_RTT_US, NET_US_PER_BYTE, FLASH_US_PER_BYTE,
+           FLASH_ERASE_US);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_blksizes); i++) {
+        size_t blksize = _blksizes[i];
+
+        printf("block size %u:\n", (unsigned)blksize);
+        uint32_t seq = _run_sequential(blksize);
+        uint32_t pipe = _run_pipelined(blksize);
+        if (!seq || !pipe) {
+            puts("FAILED");
+            return 1;
+        }
+
+        speedup = (100 * seq) / pipe;
+        printf("  sequential %" PRIu32 " us, pipelined %" PRIu32 " us, %u%%\n",
+               seq, pipe, speedup);
+    }
+
+    printf("{ \"result\" : %u }\n", speedup);
+
+    return 0;
+}
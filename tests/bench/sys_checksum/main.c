@@ -0,0 +1,86 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the CRC implementations
+ *
+ * The CRC-32 implementation is selected by module, build with e.g.
+ * `CRC32_VARIANT=crc32_slice8` to compare them.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "checksum/crc.h"
+#include "checksum/crc16_ccitt.h"
+#include "checksum/crc32.h"
+#include "kernel_defines.h"
+
+#define RUNS        (1000U)
+
+static uint8_t _buf[1024];
+static uint32_t _table[256];
+
+static const char *_crc32_variant(void)
+{
+    if (IS_USED(MODULE_CRC32_SLICE8)) {
+        return "slice-by-8";
+    }
+    if (IS_USED(MODULE_CRC32_FAST)) {
+        return "byte table";
+    }
+    if (IS_USED(MODULE_CRC32_NIBBLE)) {
+        return "nibble table";
+    }
+    return "bitwise";
+}
+
+int main(void)
+{
+    volatile uint32_t res;
+    crc_params_t params =
+        CRC_PARAMS_INIT(32, 0x04c11db7, 0xffffffff, 0xffffffff, true);
+
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = i * 7;
+    }
+
+    /* check that the generic CRC-32 matches */
+    if (crc32(_buf, sizeof(_buf)) != crc_calc(&params, _buf, sizeof(_buf))) {
+        puts("FAIL");
+        return 1;
+    }
+
+    printf("%u x %u bytes, CRC-32 %s\n", RUNS, (unsigned)sizeof(_buf),
+           _crc32_variant());
+
+    BENCHMARK_FUNC("crc32", RUNS, res = crc32(_buf, sizeof(_buf)));
+    BENCHMARK_FUNC("crc16_ccitt_kermit", RUNS,
+                   res = crc16_ccitt_kermit_calc(_buf, sizeof(_buf)));
+    BENCHMARK_FUNC("crc generic bitwise", RUNS,
+                   res = crc_calc(&params, _buf, sizeof(_buf)));
+
+    crc_table_init(&params, _table, 4);
+    params.table = _table;
+    params.table_bits = 4;
+    BENCHMARK_FUNC("crc generic nibble table", RUNS,
+                   res = crc_calc(&params, _buf, sizeof(_buf)));
+
+    crc_table_init(&params, _table, 8);
+    params.table_bits = 8;
+    BENCHMARK_FUNC("crc generic byte table", RUNS,
+                   res = crc_calc(&params, _buf, sizeof(_buf)));
+
+    (void)res;
+    puts("DONE");
+
+    return 0;
+}
@@ -0,0 +1,19 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 The RIOT authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"1000 x 1024 bytes, CRC-32 [a-z0-9 -]+\r\n")
+    for name in ("crc32", "crc16_ccitt_kermit", "crc generic bitwise",
+                 "crc generic nibble table", "crc generic byte table"):
+        child.expect(name + r": +\d+us")
+    child.expect_exact("DONE")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,211 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       mtd_cache module test
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+#include "mtd_emulated.h"
+
+#define SECTOR_COUNT        8
+#define PAGE_PER_SECTOR     4
+#define PAGE_SIZE           64
+#define SECTOR_SIZE         (PAGE_PER_SECTOR * PAGE_SIZE)
+
+MTD_EMULATED_DEV(0, SECTOR_COUNT, PAGE_PER_SECTOR, PAGE_SIZE);
+
+static mtd_dev_t *_parent = &mtd_emulated_dev0.base;
+static mtd_cache_t _cache = MTD_CACHE_INIT(&mtd_emulated_dev0.base);
+static mtd_dev_t *_dev = &_cache.mtd;
+
+static uint8_t _buffer[SECTOR_SIZE];
+
+static void _test_mem(const uint8_t *buffer, size_t len, uint8_t expected)
+{
+    for (size_t i = 0; i < len; i++) {
+        TEST_ASSERT_EQUAL_INT(expected, buffer[i]);
+    }
+}
+
+/* content of the backing device, bypassing the cache */
+static const uint8_t *_backing(uint32_t addr)
+{
+    return mtd_emulated_dev0.memory + addr;
+}
+
+static void set_up(void)
+{
+    mtd_init(_parent);
+    mtd_erase_sector(_parent, 0, SECTOR_COUNT);
+    TEST_ASSERT_EQUAL_INT(0, mtd_init(_dev));
+    mtd_cache_reset_stats(&_cache);
+}
+
+static void test_mtd_cache_geometry(void)
+{
+    TEST_ASSERT_EQUAL_INT(SECTOR_COUNT, _dev->sector_count);
+    TEST_ASSERT_EQUAL_INT(PAGE_PER_SECTOR, _dev->pages_per_sector);
+    TEST_ASSERT_EQUAL_INT(PAGE_SIZE, _dev->page_size);
+    TEST_ASSERT_EQUAL_INT(1, _dev->write_size);
+}
+
+static void test_mtd_cache_coalesce(void)
+{
+    mtd_cache_stats_t stats;
+
+    /* many small writes to the same sector */
+    for (unsigned i = 0; i < SECTOR_SIZE; i += 8) {
+        memset(_buffer, i, 8);
+        TEST_ASSERT_EQUAL_INT(0, mtd_write_page(_dev, _buffer, 0, i, 8));
+    }
+
+    /* nothing reached the device yet */
+    _test_mem((uint8_t *)_backing(0), SECTOR_SIZE, 0xff);
+
+    /* but reads see the new data */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, 16, 8));
+    _test_mem(_buffer, 8, 16);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_dev));
+    for (unsigned i = 0; i < SECTOR_SIZE; i += 8) {
+        _test_mem((uint8_t *)_backing(i), 8, i);
+    }
+
+    /* the state of the sector was unknown, so it was erased once */
+    mtd_cache_get_stats(&_cache, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.loads);
+    TEST_ASSERT_EQUAL_INT(1, stats.erases);
+    TEST_ASSERT_EQUAL_INT(1, stats.writebacks);
+    TEST_ASSERT_EQUAL_INT(PAGE_PER_SECTOR, stats.page_writes);
+
+    /* flushing a clean cache does nothing */
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_dev));
+    mtd_cache_get_stats(&_cache, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.writebacks);
+}
+
+static void test_mtd_cache_program_after_erase(void)
+{
+    mtd_cache_stats_t stats;
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase_sector(_dev, 1, 1));
+
+    /* program page by page with a sync in between, like littlefs does */
+    for (unsigned page = 0; page < PAGE_PER_SECTOR; page++) {
+        memset(_buffer, 0x10 + page, PAGE_SIZE);
+        TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(_dev, _buffer,
+                                                    PAGE_PER_SECTOR + page, 0,
+                                                    PAGE_SIZE));
+        TEST_ASSERT_EQUAL_INT(0, mtd_flush(_dev));
+        _test_mem((uint8_t *)_backing(SECTOR_SIZE + page * PAGE_SIZE), PAGE_SIZE,
+                  0x10 + page);
+    }
+
+    /* only the explicit erase hit the device, pages were programmed once */
+    mtd_cache_get_stats(&_cache, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.erases);
+    TEST_ASSERT_EQUAL_INT(PAGE_PER_SECTOR, stats.page_writes);
+    /* erasing is no access, but keeps the sector cached for the programs */
+    TEST_ASSERT_EQUAL_INT(0, stats.misses);
+    TEST_ASSERT_EQUAL_INT(PAGE_PER_SECTOR, stats.hits);
+
+    /* overwriting a programmed page requires an erase */
+    memset(_buffer, 0x42, PAGE_SIZE);
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page(_dev, _buffer, PAGE_PER_SECTOR, 0, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_dev));
+    mtd_cache_get_stats(&_cache, &stats);
+    TEST_ASSERT_EQUAL_INT(2, stats.erases);
+    _test_mem((uint8_t *)_backing(SECTOR_SIZE), PAGE_SIZE, 0x42);
+    _test_mem((uint8_t *)_backing(SECTOR_SIZE + PAGE_SIZE), PAGE_SIZE, 0x11);
+}
+
+static void test_mtd_cache_evict(void)
+{
+    mtd_cache_stats_t stats;
+
+    /* write one sector more than fits into the cache */
+    for (unsigned sector = 0; sector <= CONFIG_MTD_CACHE_SECTORS; sector++) {
+        memset(_buffer, sector, SECTOR_SIZE);
+        TEST_ASSERT_EQUAL_INT(0, mtd_write_sector(_dev, _buffer, sector, 1));
+    }
+
+    /* least recently used sector was written back */
+    _test_mem((uint8_t *)_backing(0), SECTOR_SIZE, 0);
+    _test_mem((uint8_t *)_backing(SECTOR_SIZE * CONFIG_MTD_CACHE_SECTORS),
+              SECTOR_SIZE, 0xff);
+
+    mtd_cache_get_stats(&_cache, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.writebacks);
+    /* whole sectors are never read */
+    TEST_ASSERT_EQUAL_INT(0, stats.loads);
+
+    /* reads don't evict modified sectors */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, (SECTOR_COUNT - 1) * SECTOR_SIZE,
+                                      SECTOR_SIZE));
+    _test_mem(_buffer, SECTOR_SIZE, 0xff);
+    mtd_cache_get_stats(&_cache, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.writebacks);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_power(_dev, MTD_POWER_DOWN));
+    for (unsigned sector = 0; sector <= CONFIG_MTD_CACHE_SECTORS; sector++) {
+        _test_mem((uint8_t *)_backing(sector * SECTOR_SIZE), SECTOR_SIZE, sector);
+    }
+}
+
+static void test_mtd_cache_read(void)
+{
+    mtd_cache_stats_t stats;
+
+    memset(mtd_emulated_dev0.memory + 2 * SECTOR_SIZE, 0x5a, SECTOR_SIZE);
+
+    for (unsigned i = 0; i < SECTOR_SIZE; i += 16) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, 2 * SECTOR_SIZE + i, 16));
+        _test_mem(_buffer, 16, 0x5a);
+    }
+
+    mtd_cache_get_stats(&_cache, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.loads);
+    TEST_ASSERT_EQUAL_INT(1, stats.misses);
+    TEST_ASSERT_EQUAL_INT(SECTOR_SIZE / 16 - 1, stats.hits);
+
+    /* out of bounds */
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, mtd_read(_dev, _buffer, SECTOR_COUNT * SECTOR_SIZE, 1));
+}
+
+Test *tests_mtd_cache_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_cache_geometry),
+        new_TestFixture(test_mtd_cache_coalesce),
+        new_TestFixture(test_mtd_cache_program_after_erase),
+        new_TestFixture(test_mtd_cache_evict),
+        new_TestFixture(test_mtd_cache_read),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_cache_tests, set_up, NULL, fixtures);
+
+    return (Test *)&mtd_cache_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_mtd_cache_tests());
+    TESTS_END();
+    return 0;
+}
@@ -0,0 +1,396 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the fair queueing scheduler of the GNRC network
+ *              interface send queue with concurrent bulk and control flows
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/pktq.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/icmpv6.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+#include "net/sixlowpan.h"
+#include "test_utils/expect.h"
+
+#define TEST_BULK_DST       (0x01)
+#define TEST_BULK_SIZE      (100U)
+#define TEST_SMALL_SIZE     (20U)
+
+/* IPHC with inline next header ICMPv6 and elided addresses, and a RPL
+ * control message */
+static const uint8_t _iphc_icmpv6[] = { 0x7a, 0x33, PROTNUM_ICMPV6,
+                                        ICMPV6_RPL_CTRL };
+/* IPHC with inline next header ICMPv6, inline hop limit, a link-local source
+ * address with 64-bit IID and a multicast destination in 48 bits, and an echo
+ * request */
+static const uint8_t _iphc_echo[] = { 0x78, 0x19, PROTNUM_ICMPV6, 0x40,
+                                      0, 0, 0, 0, 0, 0, 0, 1,
+                                      0x02, 0, 0, 0, 0, 1,
+                                      ICMPV6_ECHO_REQ };
+/* IPHC with compressed next header (UDP NHC) and elided addresses */
+static const uint8_t _iphc_udp[] = { 0x7e, 0x33, 0xf0, 0x00, 0x00, 0x00, 0x00 };
+/* first fragment header of a 1024 byte datagram */
+static const uint8_t _frag_1[] = { 0xc4, 0x00, 0x12, 0x34 };
+/* subsequent fragment header of the same datagram */
+static const uint8_t _frag_n[] = { 0xe4, 0x00, 0x12, 0x34, 0x0c };
+
+static gnrc_netif_t _netif;
+
+static gnrc_pktsnip_t *_pkt(uint8_t dst, uint8_t flags, gnrc_nettype_t type,
+                            const void *hdr, size_t hdr_len, size_t size)
+{
+    gnrc_pktsnip_t *payload = gnrc_pktbuf_add(NULL, NULL, size, type);
+    gnrc_pktsnip_t *netif_hdr;
+
+    expect(payload != NULL);
+    memset(payload->data, 0, size);
+    memcpy(payload->data, hdr, hdr_len);
+    netif_hdr = gnrc_netif_hdr_build(NULL, 0, &dst, sizeof(dst));
+    expect(netif_hdr != NULL);
+    ((gnrc_netif_hdr_t *)netif_hdr->data)->flags = flags;
+    return gnrc_pkt_prepend(payload, netif_hdr);
+}
+
+static gnrc_pktsnip_t *_bulk(uint8_t dst)
+{
+    return _pkt(dst, 0, GNRC_NETTYPE_SIXLOWPAN, _iphc_udp, sizeof(_iphc_udp),
+                TEST_BULK_SIZE);
+}
+
+static gnrc_pktsnip_t *_small(uint8_t dst)
+{
+    return _pkt(dst, 0, GNRC_NETTYPE_SIXLOWPAN, _iphc_udp, sizeof(_iphc_udp),
+                TEST_SMALL_SIZE);
+}
+
+static gnrc_pktsnip_t *_control(void)
+{
+    return _pkt(TEST_BULK_DST, 0, GNRC_NETTYPE_SIXLOWPAN, _iphc_icmpv6,
+                sizeof(_iphc_icmpv6), TEST_SMALL_SIZE);
+}
+
+static const void *_frag_hdr_of(const gnrc_pktsnip_t *pkt)
+{
+    return sixlowpan_frag_is(pkt->next->data) ? pkt->next->data : NULL;
+}
+
+/* returns a destination whose flow queue differs from TEST_BULK_DST's */
+static uint8_t _other_dst(void)
+{
+    uint32_t bulk_flow, other_flow;
+    gnrc_pktsnip_t *pkt = _bulk(TEST_BULK_DST);
+    uint8_t dst = TEST_BULK_DST;
+
+    gnrc_netif_pktq_classify(pkt, &bulk_flow);
+    gnrc_pktbuf_release(pkt);
+    do {
+        dst++;
+        pkt = _bulk(dst);
+        gnrc_netif_pktq_classify(pkt, &other_flow);
+        gnrc_pktbuf_release(pkt);
+    } while ((bulk_flow % CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS) ==
+             (other_flow % CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS));
+    return dst;
+}
+
+static void set_up(void)
+{
+    gnrc_pktsnip_t *pkt;
+
+    while ((pkt = gnrc_netif_pktq_get(&_netif)) != NULL) {
+        gnrc_pktbuf_release(pkt);
+    }
+    memset(&_netif.send_queue, 0, sizeof(_netif.send_queue));
+}
+
+static void tear_down(void)
+{
+    set_up();
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_usage());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_classify(void)
+{
+    uint32_t flow1, flow2;
+    gnrc_pktsnip_t *pkt;
+    ipv6_hdr_t ipv6 = { .nh = PROTNUM_ICMPV6 };
+    uint8_t uncomp[1 + sizeof(ipv6) + 1] = { SIXLOWPAN_UNCOMP };
+    uint8_t nbr_sol[sizeof(ipv6) + 1];
+
+    memcpy(&uncomp[1], &ipv6, sizeof(ipv6));
+    uncomp[1 + sizeof(ipv6)] = ICMPV6_RTR_SOL;
+    memcpy(nbr_sol, &ipv6, sizeof(ipv6));
+    nbr_sol[sizeof(ipv6)] = ICMPV6_NBR_SOL;
+
+    pkt = _control();
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_CLASS_CONTROL,
+                          gnrc_netif_pktq_classify(pkt, NULL));
+    gnrc_pktbuf_release(pkt);
+
+    pkt = _pkt(TEST_BULK_DST, GNRC_NETIF_HDR_FLAGS_BROADCAST,
+               GNRC_NETTYPE_SIXLOWPAN, _iphc_udp, sizeof(_iphc_udp),
+               TEST_BULK_SIZE);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_CLASS_CONTROL,
+                          gnrc_netif_pktq_classify(pkt, NULL));
+    gnrc_pktbuf_release(pkt);
+
+    pkt = _pkt(TEST_BULK_DST, 0, GNRC_NETTYPE_IPV6, nbr_sol, sizeof(nbr_sol),
+               sizeof(nbr_sol));
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_CLASS_CONTROL,
+                          gnrc_netif_pktq_classify(pkt, NULL));
+    gnrc_pktbuf_release(pkt);
+
+    /* ICMPv6 in a separate snip */
+    pkt = _pkt(TEST_BULK_DST, 0, GNRC_NETTYPE_IPV6, &ipv6, sizeof(ipv6),
+               sizeof(ipv6));
+    pkt->next->next = gnrc_pktbuf_add(NULL, &nbr_sol[sizeof(ipv6)], 1,
+                                      GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_CLASS_CONTROL,
+                          gnrc_netif_pktq_classify(pkt, NULL));
+    gnrc_pktbuf_release(pkt);
+
+    /* other ICMPv6 messages are not control traffic */
+    pkt = _pkt(TEST_BULK_DST, 0, GNRC_NETTYPE_IPV6, &ipv6, sizeof(ipv6),
+               sizeof(ipv6) + 1);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_CLASS_DEFAULT,
+                          gnrc_netif_pktq_classify(pkt, NULL));
+    gnrc_pktbuf_release(pkt);
+
+    pkt = _pkt(TEST_BULK_DST, 0, GNRC_NETTYPE_SIXLOWPAN, _iphc_echo,
+               sizeof(_iphc_echo), TEST_SMALL_SIZE);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_CLASS_DEFAULT,
+                          gnrc_netif_pktq_classify(pkt, NULL));
+    gnrc_pktbuf_release(pkt);
+
+    pkt = _pkt(TEST_BULK_DST, 0, GNRC_NETTYPE_SIXLOWPAN, uncomp,
+               sizeof(uncomp), sizeof(uncomp));
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_CLASS_CONTROL,
+                          gnrc_netif_pktq_classify(pkt, NULL));
+    gnrc_pktbuf_release(pkt);
+
+    pkt = _bulk(TEST_BULK_DST);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_CLASS_DEFAULT,
+                          gnrc_netif_pktq_classify(pkt, &flow1));
+    gnrc_pktbuf_release(pkt);
+
+    /* fragments to the same destination are a flow of their own */
+    pkt = _pkt(TEST_BULK_DST, 0, GNRC_NETTYPE_SIXLOWPAN, _frag_1,
+               sizeof(_frag_1), TEST_BULK_SIZE);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_CLASS_DEFAULT,
+                          gnrc_netif_pktq_classify(pkt, &flow2));
+    TEST_ASSERT(flow1 != flow2);
+    gnrc_pktbuf_release(pkt);
+}
+
+static void test_empty(void)
+{
+    gnrc_pktsnip_t *pkt = _bulk(TEST_BULK_DST);
+
+    TEST_ASSERT(gnrc_netif_pktq_empty(&_netif));
+    TEST_ASSERT_NULL(gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, pkt));
+    TEST_ASSERT(!gnrc_netif_pktq_empty(&_netif));
+    TEST_ASSERT(pkt == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT(gnrc_netif_pktq_empty(&_netif));
+    gnrc_pktbuf_release(pkt);
+}
+
+static void test_control_first(void)
+{
+    gnrc_pktsnip_t *bulk[3], *control, *bcast, *pkt;
+    const gnrc_netif_pktq_stats_t *stats;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(bulk); i++) {
+        bulk[i] = _bulk(TEST_BULK_DST);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, bulk[i]));
+    }
+    control = _control();
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, control));
+    bcast = _pkt(TEST_BULK_DST, GNRC_NETIF_HDR_FLAGS_BROADCAST,
+                 GNRC_NETTYPE_SIXLOWPAN, _iphc_udp, sizeof(_iphc_udp),
+                 TEST_SMALL_SIZE);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, bcast));
+
+    TEST_ASSERT(control == (pkt = gnrc_netif_pktq_get(&_netif)));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(bcast == (pkt = gnrc_netif_pktq_get(&_netif)));
+    gnrc_pktbuf_release(pkt);
+    for (unsigned i = 0; i < ARRAY_SIZE(bulk); i++) {
+        TEST_ASSERT(bulk[i] == (pkt = gnrc_netif_pktq_get(&_netif)));
+        gnrc_pktbuf_release(pkt);
+    }
+    stats = gnrc_netif_pktq_stats(&_netif, GNRC_NETIF_PKTQ_CLASS_CONTROL);
+    TEST_ASSERT_EQUAL_INT(2, stats->queued);
+    TEST_ASSERT_EQUAL_INT(2, stats->sent);
+    TEST_ASSERT_EQUAL_INT(0, stats->backlog);
+    TEST_ASSERT_EQUAL_INT(2, stats->backlog_max);
+    stats = gnrc_netif_pktq_stats(&_netif, GNRC_NETIF_PKTQ_CLASS_DEFAULT);
+    TEST_ASSERT_EQUAL_INT(3, stats->queued);
+    TEST_ASSERT_EQUAL_INT(3, stats->sent);
+    TEST_ASSERT_EQUAL_INT(3, stats->backlog_max);
+}
+
+static void test_drr_fairness(void)
+{
+    gnrc_pktsnip_t *small[2], *pkt;
+    uint8_t other_dst = _other_dst();
+    unsigned small_sent = 0, i = 0;
+
+    /* the bulk flow is queued before the small flow */
+    for (unsigned j = 0; j < 6; j++) {
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif,
+                                                     _bulk(TEST_BULK_DST)));
+    }
+    for (unsigned j = 0; j < ARRAY_SIZE(small); j++) {
+        small[j] = _small(other_dst);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, small[j]));
+    }
+    while ((pkt = gnrc_netif_pktq_get(&_netif)) != NULL) {
+        if (pkt == small[small_sent]) {
+            /* the small flow does not wait for the bulk flow to drain */
+            TEST_ASSERT(i < 4);
+            small_sent++;
+        }
+        gnrc_pktbuf_release(pkt);
+        i++;
+    }
+    TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(small), small_sent);
+    TEST_ASSERT_EQUAL_INT(8, i);
+}
+
+static void test_drop_longest(void)
+{
+    gnrc_pktsnip_t *bulk[CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE], *control, *pkt;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(bulk); i++) {
+        bulk[i] = _bulk(TEST_BULK_DST);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, bulk[i]));
+    }
+    /* the oldest bulk packet is dropped in favor of the control packet */
+    control = _control();
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, control));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netif_pktq_stats(
+            &_netif, GNRC_NETIF_PKTQ_CLASS_DEFAULT)->dropped);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE,
+                          gnrc_netif_pktq_usage());
+    TEST_ASSERT(control == (pkt = gnrc_netif_pktq_get(&_netif)));
+    gnrc_pktbuf_release(pkt);
+    for (unsigned i = 1; i < ARRAY_SIZE(bulk); i++) {
+        TEST_ASSERT(bulk[i] == (pkt = gnrc_netif_pktq_get(&_netif)));
+        gnrc_pktbuf_release(pkt);
+    }
+}
+
+static void test_drop_datagram(void)
+{
+    gnrc_pktsnip_t *bulk, *pkt;
+
+    /* a datagram whose first fragment was sent already */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(
+            &_netif, _pkt(TEST_BULK_DST, 0, GNRC_NETTYPE_SIXLOWPAN, _frag_1,
+                          sizeof(_frag_1), TEST_BULK_SIZE)));
+    for (unsigned i = 1; i < (CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE / 2); i++) {
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(
+                &_netif, _pkt(TEST_BULK_DST, 0, GNRC_NETTYPE_SIXLOWPAN,
+                              _frag_n, sizeof(_frag_n), TEST_BULK_SIZE)));
+    }
+    gnrc_pktbuf_release(gnrc_netif_pktq_get(&_netif));
+    /* another flow, still shorter than the datagram's */
+    bulk = _bulk(_other_dst());
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, bulk));
+    while (gnrc_netif_pktq_usage() < CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE) {
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, _control()));
+    }
+    /* the remainder of the datagram is dropped as a whole */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, _control()));
+    TEST_ASSERT_EQUAL_INT((CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE / 2) - 1,
+                          gnrc_netif_pktq_stats(
+            &_netif, GNRC_NETIF_PKTQ_CLASS_DEFAULT)->dropped);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netif_pktq_stats(
+            &_netif, GNRC_NETIF_PKTQ_CLASS_DEFAULT)->backlog);
+    while ((pkt = gnrc_netif_pktq_get(&_netif)) != NULL) {
+        TEST_ASSERT(_frag_hdr_of(pkt) == NULL);
+        gnrc_pktbuf_release(pkt);
+    }
+}
+
+static void test_drop_tail_of_longest(void)
+{
+    gnrc_pktsnip_t *pkt;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif,
+                                                     _bulk(TEST_BULK_DST)));
+    }
+    /* the longest flow queue does not push out its own packets */
+    pkt = _bulk(TEST_BULK_DST);
+    TEST_ASSERT_EQUAL_INT(-1, gnrc_netif_pktq_put(&_netif, pkt));
+    gnrc_pktbuf_release(pkt);
+    /* ... but another flow does */
+    pkt = _small(_other_dst());
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, pkt));
+    TEST_ASSERT_EQUAL_INT(2, gnrc_netif_pktq_stats(
+            &_netif, GNRC_NETIF_PKTQ_CLASS_DEFAULT)->dropped);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE,
+                          gnrc_netif_pktq_stats(
+            &_netif, GNRC_NETIF_PKTQ_CLASS_DEFAULT)->backlog);
+}
+
+static void test_push_back_first(void)
+{
+    gnrc_pktsnip_t *bulk = _bulk(TEST_BULK_DST), *control = _control();
+    gnrc_pktsnip_t *pkt;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, bulk));
+    TEST_ASSERT(bulk == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, control));
+    /* the device was busy, bulk goes back to the head of the queue */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_push_back(&_netif, bulk));
+    TEST_ASSERT(bulk == (pkt = gnrc_netif_pktq_get(&_netif)));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(control == (pkt = gnrc_netif_pktq_get(&_netif)));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_netif_pktq_empty(&_netif));
+}
+
+static void run_unittests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_classify),
+        new_TestFixture(test_empty),
+        new_TestFixture(test_control_first),
+        new_TestFixture(test_drr_fairness),
+        new_TestFixture(test_drop_longest),
+        new_TestFixture(test_drop_datagram),
+        new_TestFixture(test_drop_tail_of_longest),
+        new_TestFixture(test_push_back_first),
+    };
+
+    EMB_UNIT_TESTCALLER(pktq_fq_tests, set_up, tear_down, fixtures);
+
+    TESTS_START();
+    TESTS_RUN((Test *)&pktq_fq_tests);
+    TESTS_END();
+}
+
+int main(void)
+{
+    gnrc_pktbuf_init();
+    run_unittests();
+    return 0;
+}
@@ -552,6 +552,44 @@ static void test_rbuf_get_by_dg(void)
     _check_pktbuf(entry);
 }
 
+static void test_rbuf_get_by_dg__multiple_datagrams(void)
+{
+    const gnrc_sixlowpan_frag_rb_t *rbuf = gnrc_sixlowpan_frag_rb_array();
+    gnrc_sixlowpan_frag_rb_t *entries[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        gnrc_pktsnip_t *pkt;
+
+        _set_fragment_tag(_fragment1, TEST_TAG + i);
+        pkt = gnrc_pktbuf_add(NULL, _fragment1, sizeof(_fragment1),
+                              GNRC_NETTYPE_SIXLOWPAN);
+        TEST_ASSERT_NOT_NULL(pkt);
+        TEST_ASSERT_NOT_NULL((entries[i] = gnrc_sixlowpan_frag_rb_add(
+                &_test_netif_hdr.hdr, pkt, TEST_FRAGMENT1_OFFSET, TEST_PAGE
+            )));
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        TEST_ASSERT(entries[i] == gnrc_sixlowpan_frag_rb_get_by_datagram(
+                &_test_netif_hdr.hdr, TEST_TAG + i
+            ));
+        TEST_ASSERT_EQUAL_INT(TEST_TAG + i, entries[i]->super.tag);
+    }
+    /* removed entries must not be found, all others must stay reachable */
+    gnrc_sixlowpan_frag_rb_rm_by_datagram(&_test_netif_hdr.hdr, TEST_TAG);
+    TEST_ASSERT(!gnrc_sixlowpan_frag_rb_exists(&_test_netif_hdr.hdr, TEST_TAG));
+    for (unsigned i = 1; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        TEST_ASSERT(entries[i] == gnrc_sixlowpan_frag_rb_get_by_datagram(
+                &_test_netif_hdr.hdr, TEST_TAG + i
+            ));
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        if (!gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
+            gnrc_pktbuf_release(rbuf[i].pkt);
+        }
+    }
+    _check_pktbuf(NULL);
+}
+
 static void test_rbuf_exists(void)
 {
     const gnrc_sixlowpan_frag_rb_t *entry;
@@ -648,6 +686,7 @@ static void run_unittests(void)
         new_TestFixture(test_rbuf_add__overlap_lhs),
         new_TestFixture(test_rbuf_add__overlap_rhs),
         new_TestFixture(test_rbuf_get_by_dg),
+        new_TestFixture(test_rbuf_get_by_dg__multiple_datagrams),
         new_TestFixture(test_rbuf_exists),
         new_TestFixture(test_rbuf_rm_by_dg),
         new_TestFixture(test_rbuf_rm),
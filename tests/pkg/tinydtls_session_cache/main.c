@@ -0,0 +1,217 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the sock_dtls session cache
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "container.h"
+#include "embUnit.h"
+#include "event.h"
+#include "net/credman.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/async/event.h"
+#include "net/sock/dtls.h"
+#include "net/sock/udp.h"
+#include "net/sock/util.h"
+#include "thread.h"
+#include "timex.h"
+
+#define SERVER_PORT         (20220U)
+#define CREDENTIAL_TAG      (10U)
+#define TIMEOUT_US          (1U * US_PER_SEC)
+/* each client takes a peer on both ends, twice CONFIG_DTLS_PEER_MAX */
+#define NUMOF_CLIENTS       (CONFIG_DTLS_PEER_MAX)
+
+static const uint8_t _psk_id[] = "Client_identity";
+static const uint8_t _psk_key[] = "secretPSK";
+
+static const credman_credential_t _credential = {
+    .type = CREDMAN_TYPE_PSK,
+    .tag = CREDENTIAL_TAG,
+    .params = {
+        .psk = {
+            .key = { .s = _psk_key, .len = sizeof(_psk_key) - 1, },
+            .id = { .s = _psk_id, .len = sizeof(_psk_id) - 1, },
+        },
+    },
+};
+
+static char _server_stack[THREAD_STACKSIZE_LARGE * 2];
+static uint8_t _server_buf[128];
+static uint8_t _client_buf[128];
+
+static sock_udp_t _server_udp;
+static sock_dtls_t _server;
+static sock_udp_t _client_udp[NUMOF_CLIENTS];
+static sock_dtls_t _clients[NUMOF_CLIENTS];
+
+/* the events of all socks, only handled after the clients connected */
+static event_queue_t _queue;
+
+/* closed sessions reported by the event handler */
+static struct {
+    sock_dtls_t *sock;
+    sock_udp_ep_t remote;
+} _closed[2 * NUMOF_CLIENTS];
+static unsigned _closed_numof;
+static unsigned _closed_missing;
+
+static void _event_handler(sock_dtls_t *sock, sock_async_flags_t type, void *arg)
+{
+    (void)arg;
+    sock_dtls_session_t session;
+
+    if (!(type & SOCK_ASYNC_CONN_FIN)) {
+        return;
+    }
+    /* like gcoap, expect the session of every CONN_FIN */
+    if (!sock_dtls_get_event_session(sock, &session)) {
+        _closed_missing++;
+        return;
+    }
+    if (_closed_numof < ARRAY_SIZE(_closed)) {
+        _closed[_closed_numof].sock = sock;
+        sock_dtls_session_get_udp_ep(&session, &_closed[_closed_numof].remote);
+    }
+    _closed_numof++;
+}
+
+static void *_server_thread(void *arg)
+{
+    (void)arg;
+    sock_dtls_session_t session;
+
+    while (1) {
+        ssize_t res = sock_dtls_recv(&_server, &session, _server_buf,
+                                     sizeof(_server_buf), SOCK_NO_TIMEOUT);
+        if (res > 0) {
+            sock_dtls_send(&_server, &session, _server_buf, res, 0);
+        }
+    }
+
+    return NULL;
+}
+
+static int _connect(sock_dtls_t *dtls)
+{
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = SERVER_PORT };
+    sock_dtls_session_t session;
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)remote.addr.ipv6);
+    ssize_t res = sock_dtls_session_init(dtls, &remote, &session);
+    if (res <= 0) {
+        return res;
+    }
+    res = sock_dtls_recv(dtls, &session, _client_buf, sizeof(_client_buf),
+                         TIMEOUT_US);
+    return res == -SOCK_DTLS_HANDSHAKE ? 0 : -1;
+}
+
+static void _handle_events(void)
+{
+    event_t *event;
+
+    /* handling a CONN_FIN may queue the next one */
+    while ((event = event_get(&_queue))) {
+        event->handler(event);
+    }
+}
+
+static bool _is_client_port(uint16_t port)
+{
+    return port > SERVER_PORT && port <= SERVER_PORT + NUMOF_CLIENTS;
+}
+
+static void test_session_cache_evict_queued(void)
+{
+    sock_dtls_session_cache_stats_t stats;
+
+    for (unsigned i = 0; i < NUMOF_CLIENTS; i++) {
+        TEST_ASSERT_EQUAL_INT(0, _connect(&_clients[i]));
+    }
+    sock_dtls_session_cache_stats(&stats);
+    TEST_ASSERT(stats.evicted > 0);
+
+    _handle_events();
+
+    TEST_ASSERT_EQUAL_INT(0, _closed_missing);
+    /* the other end of an evicted session is closed by its close_notify */
+    TEST_ASSERT(_closed_numof >= stats.evicted);
+
+    for (unsigned i = 0; i < _closed_numof; i++) {
+        if (_closed[i].sock == &_server) {
+            TEST_ASSERT(_is_client_port(_closed[i].remote.port));
+        }
+        else {
+            TEST_ASSERT_EQUAL_INT(SERVER_PORT, _closed[i].remote.port);
+        }
+        /* every session is reported once */
+        for (unsigned j = 0; j < i; j++) {
+            TEST_ASSERT(_closed[i].sock != _closed[j].sock ||
+                        !sock_udp_ep_equal(&_closed[i].remote, &_closed[j].remote));
+        }
+    }
+}
+
+static Test *tests_tinydtls_session_cache(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_session_cache_evict_queued),
+    };
+
+    EMB_UNIT_TESTCALLER(tinydtls_session_cache_tests, NULL, NULL, fixtures);
+
+    return (Test *)&tinydtls_session_cache_tests;
+}
+
+int main(void)
+{
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+
+    event_queue_init(&_queue);
+    if (credman_add(&_credential) != CREDMAN_OK) {
+        puts("error adding credential");
+        return 1;
+    }
+
+    local.port = SERVER_PORT;
+    if (sock_udp_create(&_server_udp, &local, NULL, 0) < 0 ||
+        sock_dtls_create(&_server, &_server_udp, CREDENTIAL_TAG, SOCK_DTLS_1_2,
+                         SOCK_DTLS_SERVER) < 0) {
+        puts("error creating server sock");
+        return 1;
+    }
+    sock_dtls_event_init(&_server, &_queue, _event_handler, NULL);
+
+    for (unsigned i = 0; i < NUMOF_CLIENTS; i++) {
+        /* sock_dtls_session_init() needs a local end point */
+        local.port = SERVER_PORT + 1 + i;
+        if (sock_udp_create(&_client_udp[i], &local, NULL, 0) < 0 ||
+            sock_dtls_create(&_clients[i], &_client_udp[i], CREDENTIAL_TAG,
+                             SOCK_DTLS_1_2, SOCK_DTLS_CLIENT) < 0) {
+            puts("error creating client sock");
+            return 1;
+        }
+        sock_dtls_event_init(&_clients[i], &_queue, _event_handler, NULL);
+    }
+
+    thread_create(_server_stack, sizeof(_server_stack), THREAD_PRIORITY_MAIN - 1,
+                  0, _server_thread, NULL, "dtls server");
+
+    TESTS_START();
+    TESTS_RUN(tests_tinydtls_session_cache());
+    TESTS_END();
+
+    return 0;
+}
@@ -24,11 +24,16 @@
 
 #include "hashes.h"
 #include "bloom.h"
+#include "bloom/blocked.h"
+#include "bloom/counting.h"
 #include "random.h"
 #include "bitfield.h"
+#include "container.h"
 
 #define BLOOM_BITS (1UL << 12)
 #define BLOOM_HASHF (8)
+/* fewer bits fit into a block, see bloom/blocked.h */
+#define BLOOM_BLOCKED_K (4)
 #define lenB 512
 #define lenA (10 * 1000)
 
@@ -47,6 +52,55 @@ hashfp_t hashes[BLOOM_HASHF] = {
     (hashfp_t) rotating_hash, (hashfp_t) one_at_a_time_hash,
 };
 
+static bloom_blocked_t bloom_blocked;
+static uint64_t words[BLOOM_BLOCKED_WORDS(BLOOM_BITS)];
+
+/* same number of positions, but four bits each */
+static bloom_counting_t bloom_counting;
+static uint8_t counters[BLOOM_COUNTING_BYTES(BLOOM_BITS)];
+
+typedef struct {
+    const char *name;
+    void (*add)(const uint8_t *buf, size_t len);
+    bool (*check)(const uint8_t *buf, size_t len);
+} filter_t;
+
+static void _classic_add(const uint8_t *buf, size_t len)
+{
+    bloom_add(&bloom, buf, len);
+}
+
+static bool _classic_check(const uint8_t *buf, size_t len)
+{
+    return bloom_check(&bloom, buf, len);
+}
+
+static void _blocked_add(const uint8_t *buf, size_t len)
+{
+    bloom_blocked_add(&bloom_blocked, buf, len);
+}
+
+static bool _blocked_check(const uint8_t *buf, size_t len)
+{
+    return bloom_blocked_check(&bloom_blocked, buf, len);
+}
+
+static void _counting_add(const uint8_t *buf, size_t len)
+{
+    bloom_counting_add(&bloom_counting, buf, len);
+}
+
+static bool _counting_check(const uint8_t *buf, size_t len)
+{
+    return bloom_counting_check(&bloom_counting, buf, len);
+}
+
+static const filter_t filters[] = {
+    { "classic", _classic_add, _classic_check },
+    { "blocked", _blocked_add, _blocked_check },
+    { "counting", _counting_add, _counting_check },
+};
+
 static void buf_fill(uint32_t *buf, int len)
 {
     for (int k = 0; k < len; k++) {
@@ -54,13 +108,26 @@ static void buf_fill(uint32_t *buf, int len)
     }
 }
 
-int main(void)
+/* time it takes to generate the elements that are checked */
+static uint32_t fill_time(void)
 {
-    bloom_init(&bloom, BLOOM_BITS, bf, hashes, BLOOM_HASHF);
+    random_init(myseed);
 
-    printf("Testing Bloom filter.\n\n");
-    printf("m: %" PRIuSIZE " k: %" PRIuSIZE "\n\n", bloom.m, bloom.k);
+    uint32_t start = xtimer_now_usec();
+
+    for (int i = 0; i < lenA; i++) {
+        buf_fill(buf, BUF_SIZE);
+        buf[0] = MAGIC_A;
+    }
+
+    return xtimer_now_usec() - start;
+}
+
+static void run(const filter_t *filter, uint32_t t_fill)
+{
+    printf("\n%s filter\n", filter->name);
 
+    /* all filters see the same elements */
     random_init(myseed);
 
     unsigned long t1 = xtimer_now_usec();
@@ -68,9 +135,8 @@ int main(void)
     for (int i = 0; i < lenB; i++) {
         buf_fill(buf, BUF_SIZE);
         buf[0] = MAGIC_B;
-        bloom_add(&bloom,
-                  (uint8_t *) buf,
-                  BUF_SIZE * sizeof(uint32_t) / sizeof(uint8_t));
+        filter->add((uint8_t *) buf,
+                    BUF_SIZE * sizeof(uint32_t) / sizeof(uint8_t));
     }
 
     unsigned long t2 = xtimer_now_usec();
@@ -86,9 +152,8 @@ int main(void)
         buf_fill(buf, BUF_SIZE);
         buf[0] = MAGIC_A;
 
-        if (bloom_check(&bloom,
-                        (uint8_t *) buf,
-                        BUF_SIZE * sizeof(uint32_t) / sizeof(uint8_t))) {
+        if (filter->check((uint8_t *) buf,
+                          BUF_SIZE * sizeof(uint32_t) / sizeof(uint8_t))) {
             in++;
         }
         else {
@@ -100,7 +165,13 @@ int main(void)
     printf("checking %d elements took %" PRIu32 "ms\n", lenA,
            (uint32_t) (t4 - t3) / 1000);
 
-    printf("\n");
+    uint32_t t_check = (uint32_t) (t4 - t3) - t_fill;
+    if ((int32_t) t_check <= 0) {
+        t_check = 1;
+    }
+    printf("%" PRIu32 " lookups/s\n",
+           (uint32_t) (((uint64_t) lenA * US_PER_SEC) / t_check));
+
     printf("%d elements probably in the filter.\n", in);
     printf("%d elements not in the filter.\n", not_in);
     unsigned false_positive_rate = (1000UL * in) /  lenA;
@@ -115,6 +186,23 @@ int main(void)
 
     print(buf, res);
     puts(" false positive rate.");
+}
+
+int main(void)
+{
+    bloom_init(&bloom, BLOOM_BITS, bf, hashes, BLOOM_HASHF);
+    bloom_blocked_init(&bloom_blocked, words, ARRAY_SIZE(words),
+                       BLOOM_BLOCKED_K);
+    bloom_counting_init(&bloom_counting, BLOOM_BITS, counters, BLOOM_HASHF);
+
+    printf("Testing Bloom filter.\n\n");
+    printf("m: %" PRIuSIZE " k: %" PRIuSIZE "\n", bloom.m, bloom.k);
+
+    uint32_t t_fill = fill_time();
+
+    for (unsigned i = 0; i < ARRAY_SIZE(filters); i++) {
+        run(&filters[i], t_fill);
+    }
 
     bloom_del(&bloom);
     printf("\nAll done!\n");
@@ -16,11 +16,14 @@ TIMEOUT = 150
 def testfunc(child):
     child.expect_exact("Testing Bloom filter.")
     child.expect_exact("m: 4096 k: 8")
-    child.expect(r"adding 512 elements took \d+ms", timeout=TIMEOUT)
-    child.expect(r"checking 10000 elements took \d+ms", timeout=TIMEOUT)
-    child.expect(r"\d+ elements probably in the filter.")
-    child.expect(r"\d+ elements not in the filter.")
-    child.expect(r"0\.\d+ false positive rate.")
+    for name in ("classic", "blocked", "counting"):
+        child.expect_exact("{} filter".format(name))
+        child.expect(r"adding 512 elements took \d+ms", timeout=TIMEOUT)
+        child.expect(r"checking 10000 elements took \d+ms", timeout=TIMEOUT)
+        child.expect(r"\d+ lookups/s")
+        child.expect(r"\d+ elements probably in the filter.")
+        child.expect(r"\d+ elements not in the filter.")
+        child.expect(r"0\.\d+ false positive rate.")
     child.expect_exact("All done!")
 
 
@@ -0,0 +1,224 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for ownership-transfer channels
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+
+#include "chan.h"
+#include "embUnit.h"
+#include "thread.h"
+#include "time_units.h"
+#include "ztimer.h"
+
+#define BUF_TYPE        (0x4242)
+#define QUEUE_SIZE      (4U)
+#define BUFS_NUMOF      (8U)
+#define TIMEOUT_US      (10 * US_PER_MS)
+
+typedef struct {
+    chan_buf_t buf;
+    unsigned value;
+} test_buf_t;
+
+static msg_t _queues[3][QUEUE_SIZE];
+static chan_t _chans[3];
+static test_buf_t _bufs[BUFS_NUMOF];
+static unsigned _freed;
+
+static char _stacks[2][THREAD_STACKSIZE_DEFAULT];
+
+static void _free(chan_buf_t *buf)
+{
+    (void)buf;
+    _freed++;
+}
+
+static void set_up(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_chans); i++) {
+        chan_init(&_chans[i], _queues[i], QUEUE_SIZE, BUF_TYPE);
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_bufs); i++) {
+        chan_buf_init(&_bufs[i].buf, _free);
+        _bufs[i].value = i;
+    }
+    _freed = 0;
+}
+
+static unsigned _value(chan_buf_t *buf)
+{
+    return CHAN_BUF_CONTAINER(buf, test_buf_t, buf)->value;
+}
+
+static void test_send_recv(void)
+{
+    chan_send(&_chans[0], &_bufs[0].buf);
+    TEST_ASSERT_EQUAL_INT(1, chan_avail(&_chans[0]));
+
+    chan_buf_t *buf = chan_recv(&_chans[0]);
+    TEST_ASSERT(buf == &_bufs[0].buf);
+    TEST_ASSERT_EQUAL_INT(0, _value(buf));
+    TEST_ASSERT_EQUAL_INT(0, _freed);
+    chan_buf_release(buf);
+    TEST_ASSERT_EQUAL_INT(1, _freed);
+}
+
+static void test_try_send_recv(void)
+{
+    TEST_ASSERT_NULL(chan_try_recv(&_chans[0]));
+    for (unsigned i = 0; i < QUEUE_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, chan_try_send(&_chans[0], &_bufs[i].buf));
+    }
+    TEST_ASSERT_EQUAL_INT(-EAGAIN, chan_try_send(&_chans[0], &_bufs[QUEUE_SIZE].buf));
+    for (unsigned i = 0; i < QUEUE_SIZE; i++) {
+        chan_buf_t *buf = chan_try_recv(&_chans[0]);
+        TEST_ASSERT_NOT_NULL(buf);
+        TEST_ASSERT_EQUAL_INT(i, _value(buf));
+        chan_buf_release(buf);
+    }
+    TEST_ASSERT_NULL(chan_try_recv(&_chans[0]));
+    TEST_ASSERT_EQUAL_INT(QUEUE_SIZE, _freed);
+}
+
+static void test_recv_timeout(void)
+{
+    chan_buf_t *buf = NULL;
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    TEST_ASSERT_EQUAL_INT(-ETIMEDOUT, chan_recv_timeout(&_chans[0], &buf,
+                                                        ZTIMER_USEC, TIMEOUT_US));
+    TEST_ASSERT(ztimer_now(ZTIMER_USEC) - start >= TIMEOUT_US);
+    TEST_ASSERT_NULL(buf);
+
+    chan_send(&_chans[0], &_bufs[0].buf);
+    TEST_ASSERT_EQUAL_INT(0, chan_recv_timeout(&_chans[0], &buf,
+                                               ZTIMER_USEC, TIMEOUT_US));
+    TEST_ASSERT(buf == &_bufs[0].buf);
+}
+
+static void *_receiver(void *arg)
+{
+    chan_buf_release(chan_recv(arg));
+    return NULL;
+}
+
+static void test_send_timeout(void)
+{
+    for (unsigned i = 0; i < QUEUE_SIZE; i++) {
+        chan_send(&_chans[0], &_bufs[i].buf);
+    }
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    TEST_ASSERT_EQUAL_INT(-ETIMEDOUT, chan_send_timeout(&_chans[0], &_bufs[QUEUE_SIZE].buf,
+                                                        ZTIMER_USEC, TIMEOUT_US));
+    TEST_ASSERT(ztimer_now(ZTIMER_USEC) - start >= TIMEOUT_US);
+    TEST_ASSERT_EQUAL_INT(QUEUE_SIZE, chan_avail(&_chans[0]));
+
+    /* the receiver only runs once we block on the full channel */
+    thread_create(_stacks[0], sizeof(_stacks[0]), THREAD_PRIORITY_MAIN + 1,
+                  THREAD_CREATE_WOUT_YIELD, _receiver, &_chans[0], "receiver");
+    TEST_ASSERT_EQUAL_INT(0, chan_send_timeout(&_chans[0], &_bufs[QUEUE_SIZE].buf,
+                                               ZTIMER_USEC, TIMEOUT_US));
+    TEST_ASSERT_EQUAL_INT(QUEUE_SIZE, chan_avail(&_chans[0]));
+
+    /* let the receiver release the buffer it got */
+    ztimer_sleep(ZTIMER_USEC, US_PER_MS);
+    TEST_ASSERT_EQUAL_INT(1, _freed);
+}
+
+static void *_sender(void *arg)
+{
+    chan_send(&_chans[0], arg);
+    return NULL;
+}
+
+static void test_recv_many(void)
+{
+    chan_buf_t *bufs[BUFS_NUMOF];
+
+    for (unsigned i = 0; i < QUEUE_SIZE; i++) {
+        chan_send(&_chans[0], &_bufs[i].buf);
+    }
+    /* both senders block on the full channel */
+    for (unsigned i = 0; i < ARRAY_SIZE(_stacks); i++) {
+        thread_create(_stacks[i], sizeof(_stacks[i]), THREAD_PRIORITY_MAIN - 1,
+                      THREAD_CREATE_WOUT_YIELD, _sender,
+                      &_bufs[QUEUE_SIZE + i].buf, "sender");
+    }
+    thread_yield_higher();
+    TEST_ASSERT_EQUAL_INT(QUEUE_SIZE, chan_avail(&_chans[0]));
+
+    /* receiving the first buffer lets the first sender complete right away,
+     * draining the rest lets the second sender complete */
+    TEST_ASSERT_EQUAL_INT(QUEUE_SIZE + 1, chan_recv_many(&_chans[0], bufs, ARRAY_SIZE(bufs)));
+    TEST_ASSERT_EQUAL_INT(1, chan_avail(&_chans[0]));
+    TEST_ASSERT_EQUAL_INT(1, chan_recv_many(&_chans[0], &bufs[QUEUE_SIZE + 1],
+                                            ARRAY_SIZE(bufs) - QUEUE_SIZE - 1));
+    for (unsigned i = 0; i < QUEUE_SIZE + 2; i++) {
+        TEST_ASSERT_EQUAL_INT(i, _value(bufs[i]));
+    }
+    TEST_ASSERT_EQUAL_INT(0, chan_try_recv_many(&_chans[0], bufs, ARRAY_SIZE(bufs)));
+}
+
+static void test_dispatch(void)
+{
+    chan_t *const chans[] = { &_chans[0], &_chans[1], &_chans[2] };
+
+    /* fill up the last channel */
+    for (unsigned i = 1; i <= QUEUE_SIZE; i++) {
+        chan_send(&_chans[2], &_bufs[i].buf);
+    }
+
+    TEST_ASSERT_EQUAL_INT(2, chan_dispatch(chans, ARRAY_SIZE(chans), &_bufs[0].buf));
+    TEST_ASSERT_EQUAL_INT(0, _freed);
+
+    chan_buf_t *buf = chan_recv(&_chans[0]);
+    TEST_ASSERT(buf == &_bufs[0].buf);
+    chan_buf_release(buf);
+    TEST_ASSERT_EQUAL_INT(0, _freed);
+    buf = chan_recv(&_chans[1]);
+    TEST_ASSERT(buf == &_bufs[0].buf);
+    chan_buf_release(buf);
+    TEST_ASSERT_EQUAL_INT(1, _freed);
+
+    /* a buffer no channel takes is freed right away */
+    TEST_ASSERT_EQUAL_INT(0, chan_dispatch(&chans[2], 1, &_bufs[QUEUE_SIZE + 1].buf));
+    TEST_ASSERT_EQUAL_INT(2, _freed);
+}
+
+static Test *tests_chan(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_send_recv),
+        new_TestFixture(test_try_send_recv),
+        new_TestFixture(test_recv_timeout),
+        new_TestFixture(test_send_timeout),
+        new_TestFixture(test_recv_many),
+        new_TestFixture(test_dispatch),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, NULL, fixtures);
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    puts("chan test");
+    TESTS_START();
+    TESTS_RUN(tests_chan());
+    TESTS_END();
+
+    return 0;
+}
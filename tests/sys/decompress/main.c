@@ -0,0 +1,318 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the decompress module and zconstfs
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "container.h"
+#include "decompress.h"
+#include "embUnit.h"
+#include "fs/zconstfs.h"
+#include "macros/math.h"
+#include "vfs.h"
+
+#if IS_USED(MODULE_DECOMPRESS_HEATSHRINK)
+#include "heatshrink_encoder.h"
+#endif
+
+#define TEXT_SIZE       (800U)
+
+static const char _lorem[] =
+    "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do "
+    "eiusmod tempor incididunt ut labore et dolore magna aliqua. ";
+
+/**
+ * _text as created by LZ4_compress_default() of liblz4 1.9.4, in blocks of
+ * 512 bytes with a little endian length prefix each, like
+ * `dist/tools/decompress/rzip.py -c lz4 --raw` does
+ */
+static const uint8_t _lz4_stream[] = {
+    0x9f, 0x00, 0xf2, 0x57, 0x4c, 0x6f, 0x72, 0x65, 0x6d, 0x20, 0x69, 0x70,
+    0x73, 0x75, 0x6d, 0x20, 0x64, 0x6f, 0x6c, 0x6f, 0x72, 0x20, 0x73, 0x69,
+    0x74, 0x20, 0x61, 0x6d, 0x65, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73,
+    0x65, 0x63, 0x74, 0x65, 0x74, 0x75, 0x72, 0x20, 0x61, 0x64, 0x69, 0x70,
+    0x69, 0x73, 0x63, 0x69, 0x6e, 0x67, 0x20, 0x65, 0x6c, 0x69, 0x74, 0x2c,
+    0x20, 0x73, 0x65, 0x64, 0x20, 0x64, 0x6f, 0x20, 0x65, 0x69, 0x75, 0x73,
+    0x6d, 0x6f, 0x64, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x6f, 0x72, 0x20, 0x69,
+    0x6e, 0x63, 0x69, 0x64, 0x69, 0x64, 0x75, 0x6e, 0x74, 0x20, 0x75, 0x74,
+    0x20, 0x6c, 0x61, 0x62, 0x6f, 0x72, 0x65, 0x20, 0x65, 0x74, 0x5b, 0x00,
+    0xff, 0x01, 0x65, 0x20, 0x6d, 0x61, 0x67, 0x6e, 0x61, 0x20, 0x61, 0x6c,
+    0x69, 0x71, 0x75, 0x61, 0x2e, 0x20, 0x74, 0x00, 0x61, 0x04, 0xf0, 0x00,
+    0x0f, 0xe8, 0x00, 0x59, 0x04, 0x74, 0x00, 0x04, 0xf0, 0x00, 0x0f, 0x5c,
+    0x01, 0x51, 0x0c, 0x74, 0x00, 0x05, 0xf0, 0x00, 0x06, 0xd0, 0x01, 0x50,
+    0x70, 0x69, 0x73, 0x63, 0x69, 0x89, 0x00, 0xf0, 0x2b, 0x6e, 0x67, 0x20,
+    0x65, 0x6c, 0x69, 0x74, 0x2c, 0x20, 0x73, 0x65, 0x64, 0x20, 0x64, 0x6f,
+    0x20, 0x65, 0x69, 0x75, 0x73, 0x6d, 0x6f, 0x64, 0x20, 0x74, 0x65, 0x6d,
+    0x70, 0x6f, 0x72, 0x20, 0x69, 0x6e, 0x63, 0x69, 0x64, 0x69, 0x64, 0x75,
+    0x6e, 0x74, 0x20, 0x75, 0x74, 0x20, 0x6c, 0x61, 0x62, 0x6f, 0x72, 0x65,
+    0x20, 0x65, 0x74, 0x20, 0x64, 0x6f, 0x6c, 0x0a, 0x00, 0xf2, 0x0a, 0x6d,
+    0x61, 0x67, 0x6e, 0x61, 0x20, 0x61, 0x6c, 0x69, 0x71, 0x75, 0x61, 0x2e,
+    0x20, 0x4c, 0x6f, 0x72, 0x65, 0x6d, 0x20, 0x69, 0x70, 0x73, 0x75, 0x6d,
+    0x21, 0x00, 0xff, 0x08, 0x20, 0x73, 0x69, 0x74, 0x20, 0x61, 0x6d, 0x65,
+    0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x61, 0x64, 0x69, 0x70, 0x69,
+    0x73, 0x63, 0x69, 0x74, 0x00, 0x59, 0x8f, 0x65, 0x63, 0x74, 0x65, 0x74,
+    0x75, 0x72, 0x20, 0x74, 0x00, 0x20, 0x50, 0x20, 0x65, 0x74, 0x20, 0x64,
+};
+
+static const uint32_t _lz4_blocks[] = { 0, 161, sizeof(_lz4_stream) };
+
+static const zconstfs_file_t _zfiles[] = {
+    { .path = "/text", .size = TEXT_SIZE, .data = _lz4_stream,
+      .blocks = _lz4_blocks },
+};
+
+static const zconstfs_t _zfs = {
+    .nfiles = ARRAY_SIZE(_zfiles),
+    .files = _zfiles,
+    .codec = DECOMPRESS_CODEC_LZ4,
+};
+
+static vfs_mount_t _mount = {
+    .fs = &zconstfs_file_system,
+    .mount_point = "/z",
+    .private_data = (void *)&_zfs,
+};
+
+static uint8_t _text[TEXT_SIZE];
+static uint8_t _out[TEXT_SIZE];
+static size_t _out_len;
+static decompress_t _ctx;
+
+/* the lorem ipsum sentence, rotated by 8 more characters on every repetition */
+static void _mktext(void)
+{
+    const size_t len = sizeof(_lorem) - 1;
+    size_t pos = 0;
+
+    for (unsigned i = 0; pos < TEXT_SIZE; i++) {
+        size_t rot = (i % 7) * 8;
+        for (size_t j = 0; j < len && pos < TEXT_SIZE; j++) {
+            _text[pos++] = _lorem[(rot + j) % len];
+        }
+    }
+}
+
+static int _write(void *arg, const uint8_t *buf, size_t len)
+{
+    (void)arg;
+
+    if (_out_len + len > sizeof(_out)) {
+        return -EOVERFLOW;
+    }
+    memcpy(&_out[_out_len], buf, len);
+    _out_len += len;
+
+    return 0;
+}
+
+static int _decode(decompress_codec_t codec, const uint8_t *stream, size_t len,
+                   size_t chunk)
+{
+    _out_len = 0;
+    memset(_out, 0, sizeof(_out));
+
+    int res = decompress_init(&_ctx, codec, _write, NULL);
+    if (res < 0) {
+        return res;
+    }
+    for (size_t off = 0; off < len; off += chunk) {
+        res = decompress_feed(&_ctx, &stream[off], MIN(chunk, len - off));
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    return decompress_finish(&_ctx);
+}
+
+static void test_lz4_stream(void)
+{
+    static const size_t chunks[] = { 1, 7, 64, sizeof(_lz4_stream) };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(chunks); i++) {
+        TEST_ASSERT_EQUAL_INT(0, _decode(DECOMPRESS_CODEC_LZ4, _lz4_stream,
+                                         sizeof(_lz4_stream), chunks[i]));
+        TEST_ASSERT_EQUAL_INT(TEXT_SIZE, _out_len);
+        TEST_ASSERT_EQUAL_INT(sizeof(_lz4_stream), _ctx.in_bytes);
+        TEST_ASSERT_EQUAL_INT(TEXT_SIZE, _ctx.out_bytes);
+        TEST_ASSERT(memcmp(_out, _text, TEXT_SIZE) == 0);
+    }
+}
+
+static void test_lz4_truncated(void)
+{
+    /* the second block is cut off */
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, _decode(DECOMPRESS_CODEC_LZ4, _lz4_stream,
+                                            sizeof(_lz4_stream) - 1, 16));
+    TEST_ASSERT_EQUAL_INT(512, _out_len);
+}
+
+static void test_lz4_corrupt(void)
+{
+    uint8_t stream[sizeof(_lz4_stream)];
+
+    /* a block length beyond CONFIG_DECOMPRESS_LZ4_BLOCKSIZE */
+    memcpy(stream, _lz4_stream, sizeof(stream));
+    stream[1] = 0xff;
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, _decode(DECOMPRESS_CODEC_LZ4, stream,
+                                            sizeof(stream), 64));
+
+    /* a match offset pointing before the start of the block */
+    memcpy(stream, _lz4_stream, sizeof(stream));
+    stream[_lz4_blocks[1] + 2] = 0x0f;
+    stream[_lz4_blocks[1] + 3] = 0xff;
+    stream[_lz4_blocks[1] + 4] = 0xff;
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, _decode(DECOMPRESS_CODEC_LZ4, stream,
+                                            sizeof(stream), 64));
+}
+
+static void test_hdr_parse(void)
+{
+    uint8_t hdr[] = {
+        'R', 'Z', 'I', 'P', DECOMPRESS_CODEC_LZ4, 9, 0x00, 0x00,
+        TEXT_SIZE & 0xff, TEXT_SIZE >> 8, 0x00, 0x00,
+    };
+    decompress_codec_t codec;
+    uint32_t size;
+
+    TEST_ASSERT_EQUAL_INT(sizeof(decompress_hdr_t),
+                          decompress_hdr_parse(hdr, sizeof(hdr), &codec, &size));
+    TEST_ASSERT_EQUAL_INT(DECOMPRESS_CODEC_LZ4, codec);
+    TEST_ASSERT_EQUAL_INT(TEXT_SIZE, size);
+
+    TEST_ASSERT_EQUAL_INT(-EINVAL, decompress_hdr_parse(hdr, sizeof(hdr) - 1,
+                                                        &codec, &size));
+
+    /* blocks larger than the decoder buffer */
+    hdr[5] = 16;
+    TEST_ASSERT_EQUAL_INT(-ENOTSUP, decompress_hdr_parse(hdr, sizeof(hdr),
+                                                         &codec, &size));
+
+    hdr[5] = 9;
+    hdr[0] = 'X';
+    TEST_ASSERT_EQUAL_INT(-EINVAL, decompress_hdr_parse(hdr, sizeof(hdr),
+                                                        &codec, &size));
+}
+
+#if IS_USED(MODULE_DECOMPRESS_HEATSHRINK)
+static heatshrink_encoder _hse;
+static uint8_t _hs_stream[TEXT_SIZE + TEXT_SIZE / 8 + 1];
+
+static size_t _heatshrink_compress(void)
+{
+    const uint8_t *in = _text;
+    size_t len = TEXT_SIZE;
+    size_t pos = 0;
+
+    heatshrink_encoder_reset(&_hse);
+    while (len) {
+        size_t sunk = 0;
+        heatshrink_encoder_sink(&_hse, (uint8_t *)in, len, &sunk);
+        in += sunk;
+        len -= sunk;
+
+        HSE_poll_res res;
+        do {
+            size_t written = 0;
+            res = heatshrink_encoder_poll(&_hse, &_hs_stream[pos],
+                                          sizeof(_hs_stream) - pos, &written);
+            pos += written;
+        } while (res == HSER_POLL_MORE);
+    }
+    while (heatshrink_encoder_finish(&_hse) == HSER_FINISH_MORE) {
+        size_t written = 0;
+        heatshrink_encoder_poll(&_hse, &_hs_stream[pos], sizeof(_hs_stream) - pos,
+                                &written);
+        pos += written;
+    }
+
+    return pos;
+}
+
+static void test_heatshrink_stream(void)
+{
+    static const size_t chunks[] = { 1, 7, 64 };
+    size_t len = _heatshrink_compress();
+
+    TEST_ASSERT(len > 0 && len < TEXT_SIZE);
+    for (unsigned i = 0; i < ARRAY_SIZE(chunks); i++) {
+        TEST_ASSERT_EQUAL_INT(0, _decode(DECOMPRESS_CODEC_HEATSHRINK, _hs_stream,
+                                         len, chunks[i]));
+        TEST_ASSERT_EQUAL_INT(TEXT_SIZE, _out_len);
+        TEST_ASSERT(memcmp(_out, _text, TEXT_SIZE) == 0);
+    }
+}
+#endif
+
+static void test_zconstfs(void)
+{
+    struct stat st;
+    uint8_t buf[100];
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&_mount));
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_stat("/z/text", &st));
+    TEST_ASSERT_EQUAL_INT(TEXT_SIZE, st.st_size);
+    TEST_ASSERT_EQUAL_INT(DIV_ROUND_UP(sizeof(_lz4_stream), 512), st.st_blocks);
+
+    int fd = vfs_open("/z/text", O_RDONLY, 0);
+    TEST_ASSERT(fd >= 0);
+
+    /* a read across the block boundary */
+    TEST_ASSERT_EQUAL_INT(500, vfs_lseek(fd, 500, SEEK_SET));
+    TEST_ASSERT_EQUAL_INT(sizeof(buf), vfs_read(fd, buf, sizeof(buf)));
+    TEST_ASSERT(memcmp(buf, &_text[500], sizeof(buf)) == 0);
+
+    /* the last, short block */
+    TEST_ASSERT_EQUAL_INT(TEXT_SIZE - 50, vfs_lseek(fd, -50, SEEK_END));
+    TEST_ASSERT_EQUAL_INT(50, vfs_read(fd, buf, sizeof(buf)));
+    TEST_ASSERT(memcmp(buf, &_text[TEXT_SIZE - 50], 50) == 0);
+    TEST_ASSERT_EQUAL_INT(0, vfs_read(fd, buf, sizeof(buf)));
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+    TEST_ASSERT_EQUAL_INT(0, vfs_umount(&_mount, false));
+}
+
+static Test *tests_decompress(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_lz4_stream),
+        new_TestFixture(test_lz4_truncated),
+        new_TestFixture(test_lz4_corrupt),
+        new_TestFixture(test_hdr_parse),
+#if IS_USED(MODULE_DECOMPRESS_HEATSHRINK)
+        new_TestFixture(test_heatshrink_stream),
+#endif
+        new_TestFixture(test_zconstfs),
+    };
+
+    EMB_UNIT_TESTCALLER(decompress_tests, NULL, NULL, fixtures);
+
+    return (Test *)&decompress_tests;
+}
+
+int main(void)
+{
+    _mktext();
+
+    TESTS_START();
+    TESTS_RUN(tests_decompress());
+    TESTS_END();
+
+    return 0;
+}
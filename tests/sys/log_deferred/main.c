@@ -0,0 +1,64 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Deferred binary logging test application
+ *
+ * The log messages are only readable with
+ * `dist/tools/log_deferred/log_deferred.py`, see `tests/01-run.py`.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "log.h"
+#include "log_deferred.h"
+#include "ztimer.h"
+
+/* messages per measurement, all must fit into the ring buffer */
+#define BATCH       (16U)
+#define ROUNDS      (8U)
+
+static const char _long[] =
+    "0123456789012345678901234567890123456789"
+    "0123456789012345678901234567890123456789";
+
+int main(void)
+{
+    log_deferred_stats_t stats;
+    uint32_t time = 0;
+
+    LOG_ERROR("int %d unsigned %u hex 0x%02x\n", -42, 42U, 0xab);
+    LOG_WARNING("int64 %" PRId64 " string '%s' char %c\n",
+                INT64_C(-1234567890123), "test", 'x');
+    LOG_INFO("double %.3f pointer %p\n", 3.14159, (void *)0x1234);
+    LOG_DEBUG("no arguments\n");
+    LOG_INFO("long '%s'\n", _long);
+    log_deferred_flush();
+
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        for (unsigned j = 0; j < BATCH; j++) {
+            LOG_INFO("message %u\n", i * BATCH + j);
+        }
+        time += ztimer_now(ZTIMER_USEC) - start;
+        log_deferred_flush();
+    }
+
+    log_deferred_stats(&stats);
+    printf("LOG_INFO(): %" PRIu32 " ns per message\n",
+           (uint32_t)((uint64_t)time * 1000 / (ROUNDS * BATCH)));
+    printf("written %" PRIu32 " dropped %" PRIu32 "\n",
+           stats.written, stats.dropped);
+    puts("SUCCESS");
+
+    return 0;
+}
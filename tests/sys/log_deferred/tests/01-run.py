@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 The RIOT authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import io
+import os
+import subprocess
+import sys
+from testrunner import run
+
+sys.path.append(os.path.join(os.environ["RIOTBASE"], "dist/tools/log_deferred"))
+import log_deferred  # noqa: E402
+
+MESSAGES = [
+    "int -42 unsigned 42 hex 0xab\n",
+    "int64 -1234567890123 string 'test' char x\n",
+    "double 3.142 pointer 0x1234\n",
+    "no arguments\n",
+]
+
+
+def check_decoded():
+    """Run the application again and decode its output, native only"""
+    proc = subprocess.Popen([os.environ["ELFFILE"]], stdout=subprocess.PIPE)
+    data = b""
+    while b"SUCCESS" not in data:
+        chunk = proc.stdout.read1(4096)
+        if not chunk:
+            break
+        data += chunk
+    proc.kill()
+    proc.wait()
+
+    out = io.StringIO()
+    decoder = log_deferred.Decoder(os.environ["ELFFILE"])
+    decoder.process(data, out, final=True)
+    text = out.getvalue()
+    for msg in MESSAGES:
+        assert msg in text, msg
+    # the string is cut to fit into a message
+    assert "long '0123456789" in text
+    for i in range(8 * 16):
+        assert "message {}\n".format(i) in text
+
+
+def testfunc(child):
+    child.expect(r"LOG_INFO\(\): \d+ ns per message\r\n")
+    child.expect(r"written (\d+) dropped 0\r\n")
+    # RIOT logs during boot, too
+    assert int(child.match.group(1)) >= 5 + 8 * 16
+    child.expect_exact("SUCCESS")
+    if os.environ.get("BOARD", "").startswith("native"):
+        check_decoded()
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
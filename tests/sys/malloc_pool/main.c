@@ -0,0 +1,245 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the size-class pool allocator
+ *
+ * @}
+ */
+
+#include <stdalign.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "kernel_defines.h"
+
+#include "malloc_monitor.h"
+#include "malloc_pool.h"
+
+#define BLOCK_SIZE_MIN  CONFIG_MALLOC_POOL_BLOCK_SIZE_MIN
+#define BLOCK_SIZE_MAX  MALLOC_POOL_BLOCK_SIZE_MAX
+#define CLASS_MAX       (CONFIG_MALLOC_POOL_CLASS_NUMOF - 1)
+
+static const char _data[] = "malloc_pool";
+
+static void set_up(void)
+{
+    malloc_pool_enable(true);
+    malloc_pool_tcache_flush();
+    malloc_pool_reset_stats();
+}
+
+static void test_size_classes(void)
+{
+    static const size_t sizes[][2] = {
+        { 1, BLOCK_SIZE_MIN },
+        { BLOCK_SIZE_MIN, BLOCK_SIZE_MIN },
+        { BLOCK_SIZE_MIN + 1, 2 * BLOCK_SIZE_MIN },
+        { BLOCK_SIZE_MAX, BLOCK_SIZE_MAX },
+    };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(sizes); i++) {
+        void *volatile ptr = malloc(sizes[i][0]);
+        TEST_ASSERT_NOT_NULL(ptr);
+        TEST_ASSERT_EQUAL_INT(sizes[i][1], malloc_pool_block_size(ptr));
+        TEST_ASSERT_EQUAL_INT(0, (uintptr_t)ptr % alignof(max_align_t));
+        free(ptr);
+    }
+
+    void *volatile ptr = malloc(BLOCK_SIZE_MAX + 1);
+    TEST_ASSERT_NOT_NULL(ptr);
+    TEST_ASSERT_EQUAL_INT(0, malloc_pool_block_size(ptr));
+    TEST_ASSERT_EQUAL_INT(1, malloc_pool_get_oversized());
+    free(ptr);
+}
+
+static void test_not_pool_block(void)
+{
+    int foo;
+
+    TEST_ASSERT(!malloc_pool_free(NULL));
+    TEST_ASSERT(!malloc_pool_free(&foo));
+    TEST_ASSERT_EQUAL_INT(0, malloc_pool_block_size(NULL));
+    TEST_ASSERT_EQUAL_INT(0, malloc_pool_block_size(&foo));
+}
+
+static void test_exhausted(void)
+{
+    void *volatile ptrs[CONFIG_MALLOC_POOL_BLOCKS_NUMOF + 1];
+    malloc_pool_stats_t stats;
+
+    TEST_ASSERT_EQUAL_INT(0, malloc_pool_get_stats(CLASS_MAX, &stats));
+    uint16_t used = stats.used;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(ptrs); i++) {
+        ptrs[i] = malloc(BLOCK_SIZE_MAX);
+        TEST_ASSERT_NOT_NULL(ptrs[i]);
+    }
+    /* the last block was allocated from the heap */
+    TEST_ASSERT_EQUAL_INT(0, malloc_pool_block_size(ptrs[ARRAY_SIZE(ptrs) - 1]));
+
+    TEST_ASSERT_EQUAL_INT(0, malloc_pool_get_stats(CLASS_MAX, &stats));
+    TEST_ASSERT_EQUAL_INT(BLOCK_SIZE_MAX, stats.block_size);
+    TEST_ASSERT_EQUAL_INT(CONFIG_MALLOC_POOL_BLOCKS_NUMOF, stats.blocks);
+    TEST_ASSERT_EQUAL_INT(CONFIG_MALLOC_POOL_BLOCKS_NUMOF, stats.used);
+    TEST_ASSERT_EQUAL_INT(CONFIG_MALLOC_POOL_BLOCKS_NUMOF, stats.peak);
+    TEST_ASSERT_EQUAL_INT(CONFIG_MALLOC_POOL_BLOCKS_NUMOF - used, stats.allocs);
+    TEST_ASSERT_EQUAL_INT(1, stats.exhausted);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(ptrs); i++) {
+        free(ptrs[i]);
+    }
+    malloc_pool_tcache_flush();
+    TEST_ASSERT_EQUAL_INT(0, malloc_pool_get_stats(CLASS_MAX, &stats));
+    TEST_ASSERT_EQUAL_INT(used, stats.used);
+    TEST_ASSERT_EQUAL_INT(CONFIG_MALLOC_POOL_BLOCKS_NUMOF, stats.peak);
+}
+
+static void test_tcache(void)
+{
+    if (!IS_USED(MODULE_MALLOC_POOL_TCACHE)) {
+        return;
+    }
+
+    malloc_pool_stats_t stats;
+    void *volatile ptr1 = malloc(BLOCK_SIZE_MAX);
+    free(ptr1);
+    void *volatile ptr2 = malloc(BLOCK_SIZE_MAX);
+    TEST_ASSERT(ptr1 == ptr2);
+
+    TEST_ASSERT_EQUAL_INT(0, malloc_pool_get_stats(CLASS_MAX, &stats));
+    TEST_ASSERT_EQUAL_INT(1, stats.allocs);
+    TEST_ASSERT_EQUAL_INT(1, stats.cache_hits);
+    free(ptr2);
+}
+
+static void test_calloc(void)
+{
+    static const uint8_t zero[BLOCK_SIZE_MIN] = { 0 };
+
+    void *volatile ptr = malloc(BLOCK_SIZE_MIN);
+    TEST_ASSERT_NOT_NULL(ptr);
+    memset(ptr, 0xff, BLOCK_SIZE_MIN);
+    free(ptr);
+
+    ptr = calloc(1, BLOCK_SIZE_MIN);
+    TEST_ASSERT_NOT_NULL(ptr);
+    TEST_ASSERT_EQUAL_INT(BLOCK_SIZE_MIN, malloc_pool_block_size(ptr));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(zero, ptr, sizeof(zero)));
+    free(ptr);
+}
+
+static void test_realloc(void)
+{
+    void *volatile ptr = realloc(NULL, sizeof(_data));
+    TEST_ASSERT_NOT_NULL(ptr);
+    TEST_ASSERT_EQUAL_INT(BLOCK_SIZE_MIN, malloc_pool_block_size(ptr));
+    memcpy(ptr, _data, sizeof(_data));
+
+    /* still fits into the block */
+    void *volatile old = ptr;
+    ptr = realloc(ptr, BLOCK_SIZE_MIN);
+    TEST_ASSERT(old == ptr);
+
+    /* moves to the next size class */
+    ptr = realloc(ptr, BLOCK_SIZE_MIN + 1);
+    TEST_ASSERT_NOT_NULL(ptr);
+    TEST_ASSERT_EQUAL_INT(2 * BLOCK_SIZE_MIN, malloc_pool_block_size(ptr));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_data, ptr, sizeof(_data)));
+
+    /* moves to the heap */
+    ptr = realloc(ptr, BLOCK_SIZE_MAX + 1);
+    TEST_ASSERT_NOT_NULL(ptr);
+    TEST_ASSERT_EQUAL_INT(0, malloc_pool_block_size(ptr));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_data, ptr, sizeof(_data)));
+    free(ptr);
+
+    /* frees the block */
+    malloc_pool_stats_t stats;
+    ptr = malloc(BLOCK_SIZE_MAX);
+    malloc_pool_tcache_flush();
+    TEST_ASSERT_EQUAL_INT(0, malloc_pool_get_stats(CLASS_MAX, &stats));
+    uint16_t used = stats.used;
+    ptr = realloc(ptr, 0);
+    malloc_pool_tcache_flush();
+    TEST_ASSERT_EQUAL_INT(0, malloc_pool_get_stats(CLASS_MAX, &stats));
+    TEST_ASSERT_EQUAL_INT(used - 1, stats.used);
+}
+
+static void test_disable(void)
+{
+    void *volatile ptr1 = malloc(1);
+    TEST_ASSERT_EQUAL_INT(BLOCK_SIZE_MIN, malloc_pool_block_size(ptr1));
+
+    malloc_pool_enable(false);
+    TEST_ASSERT(!malloc_pool_is_enabled());
+    void *volatile ptr2 = malloc(1);
+    TEST_ASSERT_NOT_NULL(ptr2);
+    TEST_ASSERT_EQUAL_INT(0, malloc_pool_block_size(ptr2));
+
+    /* pool blocks can still be freed */
+    free(ptr1);
+    free(ptr2);
+    malloc_pool_enable(true);
+}
+
+static void test_fragmentation(void)
+{
+    size_t frag = malloc_monitor_get_fragmentation_current();
+    malloc_monitor_reset_high_watermark();
+
+    void *volatile ptr1 = malloc(1);
+    TEST_ASSERT_EQUAL_INT(frag + BLOCK_SIZE_MIN - 1,
+                          malloc_monitor_get_fragmentation_current());
+
+    /* heap allocations do not contribute */
+    void *volatile ptr2 = malloc(BLOCK_SIZE_MAX + 1);
+    TEST_ASSERT_EQUAL_INT(frag + BLOCK_SIZE_MIN - 1,
+                          malloc_monitor_get_fragmentation_current());
+
+    ptr1 = realloc(ptr1, BLOCK_SIZE_MIN + 2);
+    TEST_ASSERT_EQUAL_INT(frag + BLOCK_SIZE_MIN - 2,
+                          malloc_monitor_get_fragmentation_current());
+    TEST_ASSERT_EQUAL_INT(frag + BLOCK_SIZE_MIN - 1,
+                          malloc_monitor_get_fragmentation_high_watermark());
+
+    free(ptr1);
+    free(ptr2);
+    TEST_ASSERT_EQUAL_INT(frag, malloc_monitor_get_fragmentation_current());
+}
+
+static Test *tests_malloc_pool(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_size_classes),
+        new_TestFixture(test_not_pool_block),
+        new_TestFixture(test_exhausted),
+        new_TestFixture(test_tcache),
+        new_TestFixture(test_calloc),
+        new_TestFixture(test_realloc),
+        new_TestFixture(test_disable),
+        new_TestFixture(test_fragmentation),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, NULL, fixtures);
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    puts("malloc_pool test");
+    TESTS_START();
+    TESTS_RUN(tests_malloc_pool());
+    TESTS_END();
+
+    return 0;
+}
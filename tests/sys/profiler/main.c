@@ -0,0 +1,78 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Sampling profiler test application
+ *
+ * A low priority thread spins in a busy loop while the main thread sleeps,
+ * so almost all samples must be attributed to the busy thread.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "profiler.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define SAMPLE_RATE_HZ  (1000U)
+#define DURATION_MS     (500U)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static volatile bool _done;
+
+static __attribute__((noinline)) uint32_t _busy(uint32_t x)
+{
+    for (unsigned i = 0; i < 1000; i++) {
+        x = x * 1103515245U + 12345U;
+    }
+    return x;
+}
+
+static void *_busy_thread(void *arg)
+{
+    (void)arg;
+    volatile uint32_t x = 0;
+
+    while (!_done) {
+        x = _busy(x);
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    profiler_stats_t stats;
+
+    printf("busy loop at %p\n", (void *)(uintptr_t)_busy);
+
+    profiler_start(SAMPLE_RATE_HZ);
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN + 1, 0,
+                  _busy_thread, NULL, "busy");
+    ztimer_sleep(ZTIMER_MSEC, DURATION_MS);
+    profiler_stop();
+    _done = true;
+
+    profiler_dump();
+
+    /* allow for a slow timer, but samples must have been taken */
+    profiler_stats(&stats);
+    if (stats.samples < SAMPLE_RATE_HZ * DURATION_MS / 1000 / 2) {
+        printf("FAILURE: only %" PRIu32 " samples\n", stats.samples);
+        return 1;
+    }
+
+    puts("SUCCESS");
+
+    return 0;
+}
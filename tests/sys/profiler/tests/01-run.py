@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 The RIOT authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"profiler: thread (\d+) busy\r\n")
+    busy = child.match.group(1)
+    counts = {}
+    while True:
+        idx = child.expect([r"profiler: sample (\d+) 0x[0-9a-f]+ (\d+)\r\n",
+                            r"profiler: total (\d+) dropped 0\r\n"])
+        if idx == 1:
+            break
+        pid, count = child.match.group(1), int(child.match.group(2))
+        counts[pid] = counts.get(pid, 0) + count
+    total = int(child.match.group(1))
+    assert sum(counts.values()) == total
+    # the busy thread runs for almost the whole sampling period
+    assert counts.get(busy, 0) >= total * 9 // 10
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
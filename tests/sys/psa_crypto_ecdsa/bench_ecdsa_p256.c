@@ -0,0 +1,119 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmarks PSA ECDSA verification with and without the
+ *              precomputed tables of `psa_asymmetric_ecc_p256r1_precomp`
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "psa/crypto.h"
+#include "psa_ecc.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef VERIFY_ROUNDS
+#define VERIFY_ROUNDS   (10U)
+#endif
+
+static const psa_algorithm_t algo = PSA_ALG_ECDSA(PSA_ALG_SHA_256);
+
+/* RFC6979 A.2.5, P-256, SHA-256 of "sample" */
+static const uint8_t public_key[] = {0x04, 0x60, 0xFE, 0xD4, 0xBA, 0x25, 0x5A, 0x9D, 0x31, 0xC9,
+    0x61, 0xEB, 0x74, 0xC6, 0x35, 0x6D, 0x68, 0xC0, 0x49, 0xB8, 0x92, 0x3B, 0x61, 0xFA, 0x6C, 0xE6,
+    0x69, 0x62, 0x2E, 0x60, 0xF2, 0x9F, 0xB6, 0x79, 0x03, 0xFE, 0x10, 0x08, 0xB8, 0xBC, 0x99, 0xA4,
+    0x1A, 0xE9, 0xE9, 0x56, 0x28, 0xBC, 0x64, 0xF2, 0xF1, 0xB2, 0x0C, 0x2D, 0x7E, 0x9F, 0x51, 0x77,
+    0xA3, 0xC2, 0x94, 0xD4, 0x46, 0x22, 0x99};
+
+/* certain PSA backends require the data to be in RAM rather than ROM
+ * so these values cannot be `const` */
+static uint8_t hash[] = {0xAF, 0x2B, 0xDB, 0xE1, 0xAA, 0x9B, 0x6E, 0xC1, 0xE2, 0xAD, 0xE1, 0xD6,
+    0x94, 0xF4, 0x1F, 0xC7, 0x1A, 0x83, 0x1D, 0x02, 0x68, 0xE9, 0x89, 0x15, 0x62, 0x11, 0x3D, 0x8A,
+    0x62, 0xAD, 0xD1, 0xBF};
+static uint8_t signature[] = {0xEF, 0xD4, 0x8B, 0x2A, 0xAC, 0xB6, 0xA8, 0xFD, 0x11, 0x40,
+    0xDD, 0x9C, 0xD4, 0x5E, 0x81, 0xD6, 0x9D, 0x2C, 0x87, 0x7B, 0x56, 0xAA, 0xF9, 0x91, 0xC3, 0x4D,
+    0x0E, 0xA8, 0x4E, 0xAF, 0x37, 0x16, 0xF7, 0xCB, 0x1C, 0x94, 0x2D, 0x65, 0x7C, 0x41, 0xD4, 0x36,
+    0xC7, 0xA1, 0xB6, 0xE2, 0x9F, 0x65, 0xF3, 0xE9, 0x00, 0xDB, 0xB9, 0xAF, 0xF4, 0x06, 0x4D, 0xC4,
+    0xAB, 0x2F, 0x84, 0x3A, 0xCD, 0xA8};
+
+static uint32_t _ops_per_sec(uint32_t us)
+{
+    return us ? (uint64_t)VERIFY_ROUNDS * US_PER_SEC / us : 0;
+}
+
+/**
+ * @brief   Measure verifications per second of the backend and of
+ *          @ref psa_verify_hash with a key that is used repeatedly
+ *
+ * @return  psa_status_t
+ */
+psa_status_t bench_ecdsa_p256(void)
+{
+    psa_key_attributes_t key_attr = psa_key_attributes_init();
+    psa_key_id_t key_id;
+    psa_status_t status;
+    uint32_t start, without, with;
+
+    psa_set_key_usage_flags(&key_attr, PSA_KEY_USAGE_VERIFY_HASH);
+    psa_set_key_algorithm(&key_attr, algo);
+    psa_set_key_bits(&key_attr, 256);
+    psa_set_key_type(&key_attr, PSA_KEY_TYPE_ECC_PUBLIC_KEY(PSA_ECC_FAMILY_SECP_R1));
+
+    status = psa_import_key(&key_attr, public_key, sizeof(public_key), &key_id);
+    if (status != PSA_SUCCESS) {
+        return status;
+    }
+
+    /* the backend computes every verification from scratch */
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < VERIFY_ROUNDS; i++) {
+        status = psa_ecc_p256r1_verify_hash(&key_attr, algo, public_key, sizeof(public_key),
+                                            hash, sizeof(hash), signature, sizeof(signature));
+        if (status != PSA_SUCCESS) {
+            goto out;
+        }
+    }
+    without = ztimer_now(ZTIMER_USEC) - start;
+
+    /* the first uses of the key compute its table, if the module is used */
+    for (unsigned i = 0; i < CONFIG_PSA_ECC_PRECOMP_MIN_USES; i++) {
+        status = psa_verify_hash(key_id, algo, hash, sizeof(hash), signature, sizeof(signature));
+        if (status != PSA_SUCCESS) {
+            goto out;
+        }
+    }
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < VERIFY_ROUNDS; i++) {
+        status = psa_verify_hash(key_id, algo, hash, sizeof(hash), signature, sizeof(signature));
+        if (status != PSA_SUCCESS) {
+            goto out;
+        }
+    }
+    with = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("ECDSA verify without precomputation: %u ops/s\n",
+           (unsigned)_ops_per_sec(without));
+    printf("ECDSA verify with precomputation: %u ops/s\n",
+           (unsigned)_ops_per_sec(with));
+
+    /* a tampered signature must still fail with the table */
+    signature[40] ^= 1;
+    status = psa_verify_hash(key_id, algo, hash, sizeof(hash), signature, sizeof(signature));
+    signature[40] ^= 1;
+    status = (status == PSA_SUCCESS) ? PSA_ERROR_GENERIC_ERROR : PSA_SUCCESS;
+
+out:
+    psa_destroy_key(key_id);
+    return status;
+}
@@ -21,6 +21,7 @@
 
 extern psa_status_t example_ecdsa_p256(void);
 extern psa_status_t test_ecdsa_p256_vectors(void);
+extern psa_status_t bench_ecdsa_p256(void);
 
 int main(void)
 {
@@ -36,6 +37,12 @@ int main(void)
     ztimer_acquire(ZTIMER_USEC);
     ztimer_now_t start = ztimer_now(ZTIMER_USEC);
 
+    status = bench_ecdsa_p256();
+    if (status != PSA_SUCCESS) {
+        failed = true;
+        printf("ECDSA benchmark failed: %s\n", psa_status_to_humanly_readable(status));
+    }
+
     start = ztimer_now(ZTIMER_USEC);
     status = example_ecdsa_p256();
     printf("ECDSA took %d us\n", (int)(ztimer_now(ZTIMER_USEC) - start));
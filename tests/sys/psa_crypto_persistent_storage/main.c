@@ -24,6 +24,7 @@ int main(void)
     TESTS_RUN(tests_psa_persistent_single_key_storage());
     TESTS_RUN(tests_psa_persistent_asym_keypair_storage());
     TESTS_RUN(tests_psa_fail_overwrite_existing_key());
+    TESTS_RUN(tests_psa_persistent_key_cache());
     TESTS_END();
     return 0;
 }
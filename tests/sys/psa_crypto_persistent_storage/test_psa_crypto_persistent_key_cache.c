@@ -0,0 +1,114 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Lookup of persistently stored keys that are cached in key slots,
+ *              and of keys that have to be read from storage again
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "embUnit.h"
+#include "psa/crypto.h"
+#include "psa_crypto_slot_management.h"
+#include "tests_psa_persistent_storage.h"
+#include "ztimer.h"
+
+#define KEY_ID_FIRST        (100U)
+/* one key more than fits into the key slots */
+#define KEY_COUNT           (PSA_SINGLE_KEY_COUNT + 1)
+#define LOOKUP_ROUNDS       (10U)
+
+static void _import_keys(void)
+{
+    psa_key_attributes_t attr = psa_key_attributes_init();
+
+    psa_set_key_algorithm(&attr, PSA_ALG_CBC_NO_PADDING);
+    psa_set_key_usage_flags(&attr, PSA_KEY_USAGE_ENCRYPT);
+    psa_set_key_bits(&attr, 128);
+    psa_set_key_type(&attr, PSA_KEY_TYPE_AES);
+    psa_set_key_lifetime(&attr, PSA_KEY_LIFETIME_FROM_PERSISTENCE_AND_LOCATION
+                                    (PSA_KEY_LIFETIME_PERSISTENT, PSA_KEY_LOCATION_LOCAL_STORAGE));
+
+    for (unsigned i = 0; i < KEY_COUNT; i++) {
+        psa_key_id_t id = KEY_ID_FIRST + i;
+        psa_set_key_id(&attr, id);
+        TEST_ASSERT_PSA_SUCCESS(psa_import_key(&attr, KEY_128, AES_128_KEY_SIZE, &id));
+    }
+}
+
+static void _destroy_keys(void)
+{
+    for (unsigned i = 0; i < KEY_COUNT; i++) {
+        TEST_ASSERT_PSA_SUCCESS(psa_destroy_key(KEY_ID_FIRST + i));
+    }
+}
+
+/* look up keys first to first + count - 1 round robin */
+static psa_status_t _lookup(unsigned first, unsigned count, uint32_t *us_per_lookup,
+                            uint32_t *storage_reads)
+{
+    psa_key_attributes_t attr;
+    psa_key_slot_stats_t stats;
+    psa_status_t status = PSA_SUCCESS;
+
+    psa_get_key_slot_stats(&stats);
+    *storage_reads = stats.storage_reads;
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned round = 0; round < LOOKUP_ROUNDS && status == PSA_SUCCESS; round++) {
+        for (unsigned i = 0; i < count && status == PSA_SUCCESS; i++) {
+            status = psa_get_key_attributes(KEY_ID_FIRST + first + i, &attr);
+        }
+    }
+    *us_per_lookup = (ztimer_now(ZTIMER_USEC) - start) / (LOOKUP_ROUNDS * count);
+
+    psa_get_key_slot_stats(&stats);
+    *storage_reads = stats.storage_reads - *storage_reads;
+
+    return status;
+}
+
+/**
+ * @brief   The most recently used persistent keys stay in the key slots, keys
+ *          used less recently are read from storage again
+ */
+static void test_psa_persistent_key_cache(void)
+{
+    uint32_t cached, uncached, storage_reads;
+
+    _import_keys();
+
+    /* the first key has been pushed out by the last one */
+    TEST_ASSERT_PSA_SUCCESS(_lookup(1, KEY_COUNT - 1, &cached, &storage_reads));
+    TEST_ASSERT_EQUAL_INT(0, storage_reads);
+
+    /* cycling through more keys than fit into the slots always misses */
+    TEST_ASSERT_PSA_SUCCESS(_lookup(0, KEY_COUNT, &uncached, &storage_reads));
+    TEST_ASSERT_EQUAL_INT(LOOKUP_ROUNDS * KEY_COUNT, storage_reads);
+
+    printf("\nkey lookup: %" PRIu32 " us cached, %" PRIu32 " us from storage\n",
+           cached, uncached);
+
+    _destroy_keys();
+}
+
+Test* tests_psa_persistent_key_cache(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_psa_persistent_key_cache),
+    };
+
+    EMB_UNIT_TESTCALLER(tests_psa_persistent_key_cache_tests, NULL, NULL, fixtures);
+
+    return (Test *)&tests_psa_persistent_key_cache_tests;
+}
@@ -48,6 +48,7 @@ static const uint8_t OVERWRITE_KEY_128[AES_128_KEY_SIZE] = {
 Test* tests_psa_persistent_single_key_storage(void);
 Test* tests_psa_persistent_asym_keypair_storage(void);
 Test* tests_psa_fail_overwrite_existing_key(void);
+Test* tests_psa_persistent_key_cache(void);
 
 #ifdef __cplusplus
 }
@@ -15,14 +15,19 @@
  * @}
  */
 
+#include <inttypes.h>
 #include <stdio.h>
 #include <string.h>
 
 #include "embUnit.h"
 #include "senml/cbor.h"
+#include "senml/gnrc.h"
 #include "fmt.h"
+#include "thread.h"
+#include "ztimer.h"
 
 #define BUF_SIZE (128)
+#define BENCH_RUNS (1000U)
 
 static uint8_t cbor_buf[BUF_SIZE];
 static char result[2 * BUF_SIZE];
@@ -30,9 +35,9 @@ static char expect[] = "89A5216943424F522074657374221A608404D001616D07187802F953
                        "0102F953B0A2060202183DA2060302183DA2060402C48220190267A2060504"
                        "F5A20606036752494F54204F53A20607084400010203A201626B6705183D";
 
-void test_senml_encode(void)
+static int _encode(nanocbor_encoder_t *enc, void *arg)
 {
-    nanocbor_encoder_t enc;
+    (void)arg;
 
     /* Some common attributes to set on the first element */
     senml_attr_t attr = {
@@ -81,20 +86,29 @@ void test_senml_encode(void)
         .unit = SENML_UNIT_KILOGRAM,
     };
 
-    /* Initialize encoder, and start array */
-    nanocbor_encoder_init(&enc, cbor_buf, sizeof cbor_buf);
-    nanocbor_fmt_array(&enc, 9);
+    /* Start array */
+    nanocbor_fmt_array(enc, 9);
 
     /* Encode the values */
-    senml_encode_value_cbor(&enc, &vf);
-    senml_encode_value_cbor(&enc, &vd);
-    senml_encode_value_cbor(&enc, &vi);
-    senml_encode_value_cbor(&enc, &vu);
-    senml_encode_value_cbor(&enc, &vdf);
-    senml_encode_bool_cbor(&enc, &vb);
-    senml_encode_string_cbor(&enc, &vs);
-    senml_encode_data_cbor(&enc, &vdat);
-    senml_encode_sum_cbor(&enc, &sum);
+    senml_encode_value_cbor(enc, &vf);
+    senml_encode_value_cbor(enc, &vd);
+    senml_encode_value_cbor(enc, &vi);
+    senml_encode_value_cbor(enc, &vu);
+    senml_encode_value_cbor(enc, &vdf);
+    senml_encode_bool_cbor(enc, &vb);
+    senml_encode_string_cbor(enc, &vs);
+    senml_encode_data_cbor(enc, &vdat);
+    senml_encode_sum_cbor(enc, &sum);
+
+    return 0;
+}
+
+void test_senml_encode(void)
+{
+    nanocbor_encoder_t enc;
+
+    nanocbor_encoder_init(&enc, cbor_buf, sizeof cbor_buf);
+    _encode(&enc, NULL);
 
     size_t len = nanocbor_encoded_len(&enc);
 
@@ -105,19 +119,107 @@ void test_senml_encode(void)
     TEST_ASSERT_EQUAL_INT(0, strncmp(expect, result, len));
 }
 
+void test_senml_encode_gnrc(void)
+{
+    gnrc_pktsnip_t *snip = senml_gnrc_encode_cbor(NULL, _encode, NULL);
+
+    TEST_ASSERT_NOT_NULL(snip);
+    TEST_ASSERT_EQUAL_INT(sizeof(expect) - 1, 2 * snip->size);
+
+    fmt_bytes_hex(result, snip->data, snip->size);
+    TEST_ASSERT_EQUAL_INT(0, strncmp(expect, result, sizeof(expect) - 1));
+
+    gnrc_pktbuf_release(snip);
+}
+
 Test *tests_senml(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_senml_encode),
+        new_TestFixture(test_senml_encode_gnrc),
     };
     EMB_UNIT_TESTCALLER(senml_tests, NULL, NULL, fixtures);
     return (Test *)&senml_tests;
 }
 
+/* encoding into a buffer, then copying into the packet buffer */
+static gnrc_pktsnip_t *_encode_copy(void)
+{
+    uint8_t buf[BUF_SIZE];
+    nanocbor_encoder_t enc;
+
+    nanocbor_encoder_init(&enc, buf, sizeof(buf));
+    _encode(&enc, NULL);
+
+    return gnrc_pktbuf_add(NULL, buf, nanocbor_encoded_len(&enc),
+                           GNRC_NETTYPE_UNDEF);
+}
+
+/* the encoding runs in a fresh thread, so its stack usage can be measured */
+static char _peak_stack[THREAD_STACKSIZE_DEFAULT];
+static gnrc_pktsnip_t *_peak_snip;
+
+static void *_peak_copy(void *arg)
+{
+    (void)arg;
+    _peak_snip = _encode_copy();
+    return NULL;
+}
+
+static void *_peak_direct(void *arg)
+{
+    (void)arg;
+    _peak_snip = senml_gnrc_encode_cbor(NULL, _encode, NULL);
+    return NULL;
+}
+
+/* peak RAM used by an encoding: stack of the thread and the packet buffer */
+static unsigned _peak(thread_task_func_t func)
+{
+    /* the thread has a higher priority, so it finished when this returns */
+    thread_create(_peak_stack, sizeof(_peak_stack), THREAD_PRIORITY_MAIN - 1, 0,
+                  func, NULL, "peak");
+    unsigned used = sizeof(_peak_stack) -
+                    measure_stack_free_internal(_peak_stack, sizeof(_peak_stack));
+
+    if (_peak_snip != NULL) {
+        used += sizeof(*_peak_snip) + _peak_snip->size;
+        gnrc_pktbuf_release(_peak_snip);
+    }
+    return used;
+}
+
+static void _bench(void)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_RUNS; i++) {
+        gnrc_pktbuf_release(_encode_copy());
+    }
+    uint32_t copy = ztimer_now(ZTIMER_USEC) - start;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_RUNS; i++) {
+        gnrc_pktbuf_release(senml_gnrc_encode_cbor(NULL, _encode, NULL));
+    }
+    uint32_t direct = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("buffer + copy: %" PRIu32 " us, %u bytes of stack buffer\n",
+           copy / BENCH_RUNS, BUF_SIZE);
+    printf("direct:        %" PRIu32 " us, no stack buffer\n",
+           direct / BENCH_RUNS);
+
+    unsigned peak_copy = _peak(_peak_copy);
+    unsigned peak_direct = _peak(_peak_direct);
+    printf("peak RAM: buffer + copy %u bytes, direct %u bytes\n",
+           peak_copy, peak_direct);
+}
+
 int main(void)
 {
     TESTS_START();
     TESTS_RUN(tests_senml());
     TESTS_END();
+
+    _bench();
     return 0;
 }
@@ -0,0 +1,67 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @file
+ * @brief       Test for the batch mode and the hashed command lookup of the
+ *              shell
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "shell.h"
+
+/* c00 returns 0, c01 returns 1, ... */
+static int _cmd_number(int argc, char **argv)
+{
+    (void)argc;
+    return atoi(&argv[0][1]);
+}
+
+#define NUMBER_CMD(n)   SHELL_COMMAND(c ## n, "returns " #n, _cmd_number)
+
+NUMBER_CMD(00); NUMBER_CMD(01); NUMBER_CMD(02); NUMBER_CMD(03);
+NUMBER_CMD(04); NUMBER_CMD(05); NUMBER_CMD(06); NUMBER_CMD(07);
+NUMBER_CMD(08); NUMBER_CMD(09); NUMBER_CMD(10); NUMBER_CMD(11);
+NUMBER_CMD(12); NUMBER_CMD(13); NUMBER_CMD(14); NUMBER_CMD(15);
+NUMBER_CMD(16); NUMBER_CMD(17); NUMBER_CMD(18); NUMBER_CMD(19);
+NUMBER_CMD(20); NUMBER_CMD(21); NUMBER_CMD(22); NUMBER_CMD(23);
+NUMBER_CMD(24); NUMBER_CMD(25); NUMBER_CMD(26); NUMBER_CMD(27);
+NUMBER_CMD(28); NUMBER_CMD(29); NUMBER_CMD(30); NUMBER_CMD(31);
+
+static int _cmd_argc(int argc, char **argv)
+{
+    for (int i = 1; i < argc; i++) {
+        printf("arg %d: %s\n", i, argv[i]);
+    }
+    return argc;
+}
+
+SHELL_COMMAND(argc, "returns the number of arguments", _cmd_argc);
+
+static int _cmd_local(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+    return 100;
+}
+
+static const shell_command_t _commands[] = {
+    { "local", "command from the list", _cmd_local },
+    /* overrides the command in the XFA */
+    { "c31", "command from the list", _cmd_local },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    puts("test_shell_batch");
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 The RIOT authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import errno
+import sys
+
+from testrunner import run
+
+RESULT = "\x1e"
+
+
+def netstring(cmd):
+    return "{}:{},".format(len(cmd.encode()), cmd)
+
+
+def expect_result(child, seq, res):
+    child.expect(RESULT + r"(\d+) (-?\d+)\r?\n")
+    assert int(child.match.group(1)) == seq
+    assert int(child.match.group(2)) == res
+
+
+def testfunc(child):
+    child.expect_exact("test_shell_batch")
+    child.expect_exact("> ")
+
+    # commands are found in the list and in the XFA
+    cmds = ["c{:02}".format(i) for i in range(32)] + ["local", "argc"]
+    child.sendline("batch")
+    child.sendline("".join(netstring(cmd) for cmd in cmds) + "0:,")
+    for seq in range(31):
+        expect_result(child, seq, seq)
+    expect_result(child, 31, 100)
+    expect_result(child, 32, 100)
+    expect_result(child, 33, 1)
+    child.expect_exact("> ")
+
+    # arguments are parsed like in interactive mode, errors are reported
+    child.sendline("batch")
+    child.sendline(netstring('argc one "two three"') + netstring("nope") +
+               netstring("c" * 200) + netstring("c07") +
+               "0:,")
+    child.expect_exact("arg 2: two three")
+    expect_result(child, 0, 3)
+    child.expect_exact("shell: command not found: nope")
+    expect_result(child, 1, -errno.ENOEXEC)
+    expect_result(child, 2, -errno.ENOBUFS)
+    expect_result(child, 3, 7)
+    child.expect_exact("> ")
+
+    # a protocol error ends the batch, the rest of the line is discarded
+    child.sendline("batch")
+    child.sendline(netstring("c01") + "3;c02," + netstring("c03"))
+    expect_result(child, 0, 1)
+    child.expect_exact("> ")
+    child.sendline("batch")
+    child.sendline(netstring("c04"))
+    expect_result(child, 0, 4)
+    child.sendline("0:,")
+    child.expect_exact("> ")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,66 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Asynchronous STDIO test application
+ *
+ * A high priority thread writes a burst of lines, which must all arrive in
+ * order while the buffer is smaller than the output.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "stdio_async.h"
+#include "stdio_base.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define LINES       (32U)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+
+static void *_burst(void *arg)
+{
+    (void)arg;
+
+    for (unsigned i = 0; i < LINES; i++) {
+        printf("line %02u of the burst\n", i);
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    static const char line[] = "0123456789abcdef0123456789abcdef\n";
+    stdio_async_stats_t stats;
+
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1, 0,
+                  _burst, NULL, "burst");
+
+    /* fits into the buffer, must not wait for the backend */
+    stdio_async_flush();
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    stdio_write(line, strlen(line));
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+    stdio_async_flush();
+    printf("stdio_write(): %" PRIu32 " us for %u bytes\n",
+           time, (unsigned)strlen(line));
+
+    stdio_async_stats(&stats);
+    printf("written %" PRIu32 " dropped %" PRIu32 " max used %u\n",
+           stats.written, stats.dropped, stats.max_used);
+    puts("SUCCESS");
+
+    return 0;
+}
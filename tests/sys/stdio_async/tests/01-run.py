@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 The RIOT authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+LINES = 32
+BUFSIZE = 64
+
+
+def testfunc(child):
+    for i in range(LINES):
+        child.expect_exact("line {:02} of the burst\r\n".format(i))
+    child.expect_exact("0123456789abcdef0123456789abcdef\r\n")
+    child.expect(r"stdio_write\(\): \d+ us for 33 bytes\r\n")
+    child.expect(r"written \d+ dropped 0 max used (\d+)\r\n")
+    assert int(child.match.group(1)) == BUFSIZE
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
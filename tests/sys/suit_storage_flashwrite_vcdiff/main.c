@@ -0,0 +1,169 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for delta updates through the SUIT
+ *              flashwrite storage backend
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "embUnit.h"
+#include "macros/utils.h"
+#include "periph/flashpage.h"
+#include "riotboot/slot.h"
+#include "suit.h"
+#include "suit/storage.h"
+#include "ztimer.h"
+
+/* Generated with mkdelta.py */
+#include "blob/source.bin.h"
+#include "blob/target.bin.h"
+#include "blob/delta.bin.h"
+
+static suit_manifest_t _manifest;
+static suit_storage_t *_storage;
+
+static void _erase_slot(unsigned slot)
+{
+    unsigned page = flashpage_page((void *)riotboot_slot_get_hdr(slot));
+    unsigned last = flashpage_page((uint8_t *)riotboot_slot_get_hdr(slot) +
+                                   riotboot_slot_size(slot) - 1);
+
+    while (page <= last) {
+        flashpage_erase(page++);
+    }
+}
+
+static bool _slot_matches(unsigned slot, const uint8_t *data, size_t len)
+{
+    return memcmp(riotboot_slot_get_hdr(slot), data, len) == 0;
+}
+
+/* passes data to the storage in blocks of blksize bytes, like a transport */
+static int _transfer(const uint8_t *data, size_t len, size_t image_len,
+                     size_t blksize)
+{
+    int res = suit_storage_start(_storage, &_manifest, image_len);
+    if (res < 0) {
+        return res;
+    }
+
+    for (size_t pos = 0; pos < len; pos += blksize) {
+        res = suit_storage_write(_storage, &_manifest, &data[pos], pos,
+                                 MIN(blksize, len - pos));
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    return suit_storage_finish(_storage, &_manifest);
+}
+
+static void setup(void)
+{
+    /* the running image */
+    _erase_slot(riotboot_slot_current());
+    flashpage_write((void *)riotboot_slot_get_hdr(riotboot_slot_current()),
+                    source_bin, source_bin_len);
+
+    _erase_slot(riotboot_slot_other());
+}
+
+static void test_flashwrite_delta(void)
+{
+    static const size_t blksizes[] = { 4, 7, 64, 512 };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(blksizes); i++) {
+        _erase_slot(riotboot_slot_other());
+
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        TEST_ASSERT_EQUAL_INT(SUIT_OK, _transfer(delta_bin, delta_bin_len,
+                                                 target_bin_len, blksizes[i]));
+        TEST_ASSERT(suit_storage_is_encoded(_storage));
+        TEST_ASSERT_EQUAL_INT(0, suit_storage_install(_storage, &_manifest));
+        uint32_t duration = ztimer_now(ZTIMER_USEC) - start;
+
+        printf("delta, block size %3u: %u bytes transferred for %u image bytes, "
+               "%" PRIu32 " us\n", (unsigned)blksizes[i], (unsigned)delta_bin_len,
+               (unsigned)target_bin_len, duration);
+
+        TEST_ASSERT(_slot_matches(riotboot_slot_other(), target_bin, target_bin_len));
+        /* the source is only read */
+        TEST_ASSERT(_slot_matches(riotboot_slot_current(), source_bin, source_bin_len));
+    }
+}
+
+static void test_flashwrite_full(void)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, _transfer(target_bin, target_bin_len,
+                                             target_bin_len, 64));
+    TEST_ASSERT(!suit_storage_is_encoded(_storage));
+    TEST_ASSERT_EQUAL_INT(0, suit_storage_install(_storage, &_manifest));
+    uint32_t duration = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("image, block size  64: %u bytes transferred for %u image bytes, "
+           "%" PRIu32 " us\n", (unsigned)target_bin_len,
+           (unsigned)target_bin_len, duration);
+
+    TEST_ASSERT(_slot_matches(riotboot_slot_other(), target_bin, target_bin_len));
+}
+
+static void test_flashwrite_delta_size_mismatch(void)
+{
+    /* the manifest announces a larger image than the delta produces */
+    TEST_ASSERT_EQUAL_INT(SUIT_ERR_STORAGE, _transfer(delta_bin, delta_bin_len,
+                                                      target_bin_len + 1, 64));
+
+    /* the delta produces more than the manifest announces */
+    TEST_ASSERT_EQUAL_INT(SUIT_ERR_STORAGE, _transfer(delta_bin, delta_bin_len,
+                                                      target_bin_len - 1, 64));
+}
+
+static void test_flashwrite_delta_offset(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, suit_storage_start(_storage, &_manifest, target_bin_len));
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, suit_storage_write(_storage, &_manifest,
+                                                      delta_bin, 0, 64));
+    /* a block is missing */
+    TEST_ASSERT_EQUAL_INT(SUIT_ERR_STORAGE, suit_storage_write(_storage, &_manifest,
+                                                               &delta_bin[128], 128, 64));
+}
+
+static Test *tests_suit_storage_flashwrite_vcdiff(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_flashwrite_delta),
+        new_TestFixture(test_flashwrite_full),
+        new_TestFixture(test_flashwrite_delta_size_mismatch),
+        new_TestFixture(test_flashwrite_delta_offset),
+    };
+
+    EMB_UNIT_TESTCALLER(suit_storage_flashwrite_vcdiff_tests, setup, NULL, fixtures);
+
+    return (Test *)&suit_storage_flashwrite_vcdiff_tests;
+}
+
+int main(void)
+{
+    suit_storage_init_all();
+    _storage = suit_storage_find_by_id("");
+
+    TESTS_START();
+    TESTS_RUN(tests_suit_storage_flashwrite_vcdiff());
+    TESTS_END();
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 The RIOT authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+"""Create the test images and the delta between them
+
+source.bin is the image in the running slot, target.bin the update. The delta
+is written in the interleaved VCDIFF format of open-vcdiff, i.e. the output
+of `vcdiff delta -interleaved -dictionary source.bin <target.bin`. It is built
+from a fixed list of edits instead of a diff, so it contains copies from the
+source and from the target window at known places.
+"""
+
+import random
+import sys
+
+VCDIFF_HDR = bytes([0xd6, 0xc3, 0xc4, ord("S"), 0x00])
+VCD_SOURCE = 0x01
+# default code table: ADD with a separate size, ADD of 1 to 17 bytes and COPY
+# in VCD_SELF mode with a separate size
+INST_ADD = 1
+INST_ADD_MAX = 17
+INST_COPY = 19
+
+SOURCE_SIZE = 4096
+
+
+def varint(value):
+    """Encode an integer as described in RFC 3284, section 2"""
+    out = [value & 0x7f]
+    value >>= 7
+    while value:
+        out.insert(0, 0x80 | (value & 0x7f))
+        value >>= 7
+    return bytes(out)
+
+
+class Delta:
+    def __init__(self, source):
+        self.source = source
+        self.target = bytearray()
+        self.inst = bytearray()
+
+    def add(self, data):
+        if len(data) <= INST_ADD_MAX:
+            self.inst += bytes([INST_ADD + len(data)]) + data
+        else:
+            self.inst += bytes([INST_ADD]) + varint(len(data)) + data
+        self.target += data
+
+    def copy_source(self, offset, size):
+        self.inst += bytes([INST_COPY]) + varint(size) + varint(offset)
+        self.target += self.source[offset:offset + size]
+
+    def copy_target(self, offset, size):
+        # copies must not overlap the data they produce
+        assert offset + size <= len(self.target)
+        addr = len(self.source) + offset
+        self.inst += bytes([INST_COPY]) + varint(size) + varint(addr)
+        self.target += self.target[offset:offset + size]
+
+    def encode(self):
+        window = bytes([0x00]) + varint(0) + varint(len(self.inst)) + varint(0) + self.inst
+        enc = varint(len(self.target)) + window
+        return (VCDIFF_HDR + bytes([VCD_SOURCE]) + varint(len(self.source)) +
+                varint(0) + varint(len(enc)) + enc)
+
+
+def main():
+    rnd = random.Random(42)
+    words = [bytes(rnd.getrandbits(8) for _ in range(2)) for _ in range(32)]
+
+    # riotboot header followed by instructions from a small set of encodings
+    source = bytearray(b"RIOT" + bytes(rnd.getrandbits(8) for _ in range(12)))
+    while len(source) < SOURCE_SIZE:
+        source += rnd.choice(words)
+    source = bytes(source[:SOURCE_SIZE])
+
+    delta = Delta(source)
+    # new header
+    delta.add(b"RIOT" + bytes(rnd.getrandbits(8) for _ in range(12)))
+    delta.copy_source(16, 1000)
+    delta.add(bytes(rnd.getrandbits(8) for _ in range(64)))
+    delta.copy_source(1100, 1400)
+    # the start of the image, including the magic number and the first block
+    delta.copy_target(0, 300)
+    delta.copy_target(6, 50)
+    delta.add(bytes(rnd.getrandbits(8) for _ in range(37)))
+    # recently written data
+    delta.copy_target(len(delta.target) - 10, 7)
+    delta.copy_target(len(delta.target) - 40, 33)
+    delta.copy_source(2600, SOURCE_SIZE - 2600)
+    delta.copy_target(1200, 400)
+    delta.add(bytes(rnd.getrandbits(8) for _ in range(100)))
+
+    with open("source.bin", "wb") as f:
+        f.write(source)
+    with open("target.bin", "wb") as f:
+        f.write(delta.target)
+    with open("delta.bin", "wb") as f:
+        f.write(delta.encode())
+
+    print("source %d, target %d, delta %d bytes" %
+          (len(source), len(delta.target), len(delta.encode())), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
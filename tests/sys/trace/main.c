@@ -10,21 +10,80 @@
  * @file
  * @brief       trace module test application
  *
- * This test application tests basic functionality of `sys/trace`.
+ * This test application tests basic functionality of `sys/trace`, measures
+ * the overhead of recording an event and exports the trace of a message
+ * exchange between two threads.
  *
  * @author      Kaspar Schleiser <kaspar@schleiser.de>
  *
  * @}
  */
 
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "thread.h"
 #include "trace.h"
+#include "ztimer.h"
+
+#define BENCH_EVENTS    (10000U)
+#define PING_ROUNDS     (8U)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+
+static void *_pong(void *arg)
+{
+    (void)arg;
+    msg_t m;
+
+    while (1) {
+        msg_receive(&m);
+        msg_reply(&m, &m);
+    }
+
+    return NULL;
+}
+
+static void _bench(const char *name, void (*record)(uint32_t))
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_EVENTS; i++) {
+        record(i);
+    }
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("%s: %" PRIu32 " ns per event\n", name,
+           (uint32_t)(((uint64_t)time * 1000) / BENCH_EVENTS));
+}
+
+static void _trace_user(uint32_t val)
+{
+    trace_event(TRACE_EVENT_USER, val);
+}
 
 int main(void)
 {
+    trace_reset();
     trace(0);
     trace(1);
 
     trace_dump();
 
+    _bench("trace()", trace);
+    _bench("trace_event()", _trace_user);
+
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1,
+                                     0, _pong, NULL, "pong");
+
+    trace_reset();
+    for (unsigned i = 0; i < PING_ROUNDS; i++) {
+        msg_t m = { .type = i };
+        msg_send_receive(&m, &m, pid);
+    }
+    unsigned n = trace_export();
+
+    printf("\nexported %u records, %" PRIu32 " lost\n", n, trace_lost());
+
     return 0;
 }
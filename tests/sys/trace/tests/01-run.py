@@ -7,6 +7,11 @@ from testrunner import run
 def testfunc(child):
     child.expect(r"n=   0 t=\ +\d+ v=0x00000000\r\n")
     child.expect(r"n=   1 t=\+\ +\d+ v=0x00000001\r\n")
+    child.expect(r"trace\(\): \d+ ns per event\r\n")
+    child.expect(r"trace_event\(\): \d+ ns per event\r\n")
+    # every round records at least a send, a receive and two thread switches
+    child.expect(r"exported (\d+) records, 0 lost\r\n")
+    assert int(child.match.group(1)) >= 8 * 4
 
 
 if __name__ == "__main__":
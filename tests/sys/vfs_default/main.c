@@ -14,10 +14,77 @@
  * @}
  */
 
+#include <errno.h>
+#include <inttypes.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
 
 #include "shell.h"
 #include "vfs_default.h"
+#include "ztimer.h"
+
+#define BENCH_RUNS_DEFAULT  (1000)
+
+typedef int (*bench_fn_t)(const char *path);
+
+static int _stat(const char *path)
+{
+    struct stat st;
+    return vfs_stat(path, &st);
+}
+
+static int _opendir(const char *path)
+{
+    vfs_DIR dir;
+    int res = vfs_opendir(&dir, path);
+    if (res == 0) {
+        vfs_closedir(&dir);
+    }
+    return res;
+}
+
+static void _bench(const char *name, bench_fn_t fn, const char *path, unsigned runs)
+{
+    int res = 0;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < runs; i++) {
+        res = fn(path);
+    }
+    uint32_t diff = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("%-8s %-24s %4d %8" PRIu32 " us %6" PRIu32 " ns/op\n",
+           name, path, res, diff, (uint32_t)(diff * 1000ULL / runs));
+}
+
+static int _bench_cmd(int argc, char **argv)
+{
+    unsigned runs = BENCH_RUNS_DEFAULT;
+    if (argc > 1) {
+        runs = atoi(argv[1]);
+    }
+    if (runs == 0) {
+        printf("usage: %s [runs]\n", argv[0]);
+        return -EINVAL;
+    }
+
+    vfs_DIR mount = {0};
+    char path[64];
+
+    puts("op       path                      res     total    per op");
+    while (vfs_iterate_mount_dirs(&mount)) {
+        const char *mp = mount.mp->mount_point;
+
+        _bench("stat", _stat, mp, runs);
+        snprintf(path, sizeof(path), "%s/missing", mp);
+        _bench("stat", _stat, path, runs);
+        _bench("opendir", _opendir, mp, runs);
+    }
+
+    return 0;
+}
+
+SHELL_COMMAND(vfs_bench, "Measure path lookup: vfs_bench [runs]", _bench_cmd);
 
 int main(void)
 {
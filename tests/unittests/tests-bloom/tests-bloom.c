@@ -7,10 +7,14 @@
 #include <string.h>
 #include <stdio.h>
 
+#include "container.h"
+
 #include "tests-bloom.h"
 
 #include "hashes.h"
 #include "bloom.h"
+#include "bloom/blocked.h"
+#include "bloom/counting.h"
 #include "bitfield.h"
 
 #include "tests-bloom-sets.h"
@@ -21,7 +25,14 @@
 #define TESTS_BLOOM_NOT_IN_FILTER (996)
 #define TESTS_BLOOM_FALSE_POS_RATE_THR (0.005)
 
+#define TESTS_BLOOM_BLOCKED_BITS (512)
+#define TESTS_BLOOM_COUNTING_M (128)
+
 static bloom_t bloom;
+static bloom_blocked_t bloom_blocked;
+static uint64_t words[BLOOM_BLOCKED_WORDS(TESTS_BLOOM_BLOCKED_BITS)];
+static bloom_counting_t bloom_counting;
+static uint8_t counters[BLOOM_COUNTING_BYTES(TESTS_BLOOM_COUNTING_M)];
 BITFIELD(bf, TESTS_BLOOM_BITS);
 hashfp_t hashes[TESTS_BLOOM_HASHF] = {
                      (hashfp_t) fnv_hash,
@@ -83,6 +94,122 @@ static void test_bloom_based_on_dictionary_fixture(void)
     TEST_ASSERT(false_positive_rate < TESTS_BLOOM_FALSE_POS_RATE_THR * 1000);
 }
 
+static void test_bloom_hash64(void)
+{
+    /* FNV-1a of the empty string, then mixed */
+    TEST_ASSERT(bloom_hash64(NULL, 0) == 0xefd01f60ba992926ULL);
+    TEST_ASSERT(bloom_hash64((const uint8_t *)"a", 1) !=
+                bloom_hash64((const uint8_t *)"b", 1));
+}
+
+static void set_up_bloom_blocked(void)
+{
+    memset(words, 0xff, sizeof(words));
+    bloom_blocked_init(&bloom_blocked, words, ARRAY_SIZE(words),
+                       TESTS_BLOOM_HASHF);
+}
+
+static void test_bloom_blocked_based_on_dictionary_fixture(void)
+{
+    int in = 0;
+
+    for (int i = 0; i < lenA; i++) {
+        TEST_ASSERT(!bloom_blocked_check(&bloom_blocked,
+                                         (const uint8_t *)A[i], strlen(A[i])));
+    }
+
+    for (int i = 0; i < lenB; i++) {
+        bloom_blocked_add(&bloom_blocked, (const uint8_t *)B[i], strlen(B[i]));
+    }
+    for (int i = 0; i < lenB; i++) {
+        TEST_ASSERT(bloom_blocked_check(&bloom_blocked,
+                                        (const uint8_t *)B[i], strlen(B[i])));
+    }
+
+    for (int i = 0; i < lenA; i++) {
+        if (bloom_blocked_check(&bloom_blocked,
+                                (const uint8_t *)A[i], strlen(A[i]))) {
+            in++;
+        }
+    }
+    TEST_ASSERT(in < TESTS_BLOOM_FALSE_POS_RATE_THR * lenA);
+}
+
+static void test_bloom_blocked_check_add(void)
+{
+    const uint8_t *word = (const uint8_t *)B[0];
+
+    TEST_ASSERT(!bloom_blocked_check_add(&bloom_blocked, word, strlen(B[0])));
+    TEST_ASSERT(bloom_blocked_check_add(&bloom_blocked, word, strlen(B[0])));
+    TEST_ASSERT(bloom_blocked_check(&bloom_blocked, word, strlen(B[0])));
+
+    bloom_blocked_clear(&bloom_blocked);
+    TEST_ASSERT(!bloom_blocked_check(&bloom_blocked, word, strlen(B[0])));
+}
+
+static void set_up_bloom_counting(void)
+{
+    memset(counters, 0xff, sizeof(counters));
+    bloom_counting_init(&bloom_counting, TESTS_BLOOM_COUNTING_M, counters,
+                        TESTS_BLOOM_HASHF);
+}
+
+static void test_bloom_counting_based_on_dictionary_fixture(void)
+{
+    int in = 0;
+
+    for (int i = 0; i < lenB; i++) {
+        bloom_counting_add(&bloom_counting, (const uint8_t *)B[i], strlen(B[i]));
+    }
+    for (int i = 0; i < lenB; i++) {
+        TEST_ASSERT(bloom_counting_check(&bloom_counting,
+                                         (const uint8_t *)B[i], strlen(B[i])));
+    }
+
+    for (int i = 0; i < lenA; i++) {
+        if (bloom_counting_check(&bloom_counting,
+                                 (const uint8_t *)A[i], strlen(A[i]))) {
+            in++;
+        }
+    }
+    TEST_ASSERT(in < TESTS_BLOOM_FALSE_POS_RATE_THR * lenA);
+}
+
+static void test_bloom_counting_remove(void)
+{
+    static const uint8_t empty[sizeof(counters)];
+
+    /* add the first element twice */
+    bloom_counting_add(&bloom_counting, (const uint8_t *)B[0], strlen(B[0]));
+    for (int i = 0; i < lenB; i++) {
+        bloom_counting_add(&bloom_counting, (const uint8_t *)B[i], strlen(B[i]));
+    }
+
+    for (int i = lenB - 1; i > 0; i--) {
+        TEST_ASSERT(bloom_counting_remove(&bloom_counting,
+                                          (const uint8_t *)B[i], strlen(B[i])));
+        /* the remaining elements are still in */
+        for (int j = 0; j < i; j++) {
+            TEST_ASSERT(bloom_counting_check(&bloom_counting,
+                                             (const uint8_t *)B[j],
+                                             strlen(B[j])));
+        }
+    }
+
+    TEST_ASSERT(bloom_counting_remove(&bloom_counting,
+                                      (const uint8_t *)B[0], strlen(B[0])));
+    TEST_ASSERT(bloom_counting_check(&bloom_counting,
+                                     (const uint8_t *)B[0], strlen(B[0])));
+    TEST_ASSERT(bloom_counting_remove(&bloom_counting,
+                                      (const uint8_t *)B[0], strlen(B[0])));
+    TEST_ASSERT(!bloom_counting_check(&bloom_counting,
+                                      (const uint8_t *)B[0], strlen(B[0])));
+    TEST_ASSERT(!bloom_counting_remove(&bloom_counting,
+                                       (const uint8_t *)B[0], strlen(B[0])));
+
+    TEST_ASSERT_EQUAL_INT(0, memcmp(empty, counters, sizeof(counters)));
+}
+
 Test *tests_bloom_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -95,7 +222,36 @@ Test *tests_bloom_tests(void)
     return (Test *)&bloom_tests;
 }
 
+Test *tests_bloom_blocked_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_bloom_hash64),
+        new_TestFixture(test_bloom_blocked_based_on_dictionary_fixture),
+        new_TestFixture(test_bloom_blocked_check_add),
+    };
+
+    EMB_UNIT_TESTCALLER(bloom_blocked_tests, set_up_bloom_blocked, NULL,
+                        fixtures);
+
+    return (Test *)&bloom_blocked_tests;
+}
+
+Test *tests_bloom_counting_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_bloom_counting_based_on_dictionary_fixture),
+        new_TestFixture(test_bloom_counting_remove),
+    };
+
+    EMB_UNIT_TESTCALLER(bloom_counting_tests, set_up_bloom_counting, NULL,
+                        fixtures);
+
+    return (Test *)&bloom_counting_tests;
+}
+
 void tests_bloom(void)
 {
     TESTS_RUN(tests_bloom_tests());
+    TESTS_RUN(tests_bloom_blocked_tests());
+    TESTS_RUN(tests_bloom_counting_tests());
 }
@@ -33,6 +33,20 @@ void tests_bloom(void);
  */
 Test *tests_bloom_tests(void);
 
+/**
+ * @brief   Generates tests for bloom/blocked.h
+ *
+ * @return  embUnit tests if successful, NULL if not.
+ */
+Test *tests_bloom_blocked_tests(void);
+
+/**
+ * @brief   Generates tests for bloom/counting.h
+ *
+ * @return  embUnit tests if successful, NULL if not.
+ */
+Test *tests_bloom_counting_tests(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,88 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#include "checksum/crc.h"
+#include "container.h"
+#include "tests-checksum.h"
+
+/* check values from the "Catalogue of parametrised CRC algorithms" */
+static const struct {
+    crc_params_t params;
+    uint32_t check;
+} _crcs[] = {
+    { CRC_PARAMS_INIT(32, 0x04c11db7, 0xffffffff, 0xffffffff, true), 0xcbf43926 },
+    { CRC_PARAMS_INIT(32, 0x1edc6f41, 0xffffffff, 0xffffffff, true), 0xe3069283 },
+    { CRC_PARAMS_INIT(32, 0x04c11db7, 0xffffffff, 0xffffffff, false), 0xfc891918 },
+    { CRC_PARAMS_INIT(16, 0x1021, 0xffff, 0x0000, false), 0x29b1 },
+    { CRC_PARAMS_INIT(16, 0x1021, 0x0000, 0x0000, true), 0x2189 },
+    { CRC_PARAMS_INIT(16, 0x8005, 0xffff, 0x0000, true), 0x4b37 },
+    { CRC_PARAMS_INIT(8, 0x07, 0x00, 0x00, false), 0xf4 },
+    { CRC_PARAMS_INIT(8, 0x31, 0x00, 0x00, true), 0xa1 },
+    { CRC_PARAMS_INIT(7, 0x09, 0x00, 0x00, false), 0x75 },
+    { CRC_PARAMS_INIT(5, 0x05, 0x1f, 0x1f, true), 0x19 },
+};
+
+static const unsigned char _check_buf[] = "123456789";
+
+static void _test_crcs(unsigned table_bits)
+{
+    uint32_t table[256];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_crcs); i++) {
+        crc_params_t params = _crcs[i].params;
+        if (table_bits) {
+            crc_table_init(&params, table, table_bits);
+            params.table = table;
+            params.table_bits = table_bits;
+        }
+
+        TEST_ASSERT_EQUAL_INT(_crcs[i].check,
+                              crc_calc(&params, _check_buf,
+                                       sizeof(_check_buf) - 1));
+
+        uint32_t crc = crc_init(&params);
+        crc = crc_update(&params, crc, _check_buf, 4);
+        crc = crc_update(&params, crc, &_check_buf[4],
+                         sizeof(_check_buf) - 1 - 4);
+        TEST_ASSERT_EQUAL_INT(_crcs[i].check, crc_finish(&params, crc));
+    }
+}
+
+static void test_checksum_crc_bitwise(void)
+{
+    _test_crcs(0);
+}
+
+static void test_checksum_crc_nibble_table(void)
+{
+    _test_crcs(4);
+}
+
+static void test_checksum_crc_byte_table(void)
+{
+    _test_crcs(8);
+}
+
+static void test_checksum_crc_empty(void)
+{
+    const crc_params_t params =
+        CRC_PARAMS_INIT(16, 0x1021, 0xffff, 0x0000, false);
+
+    TEST_ASSERT_EQUAL_INT(0xffff, crc_calc(&params, _check_buf, 0));
+}
+
+Test *tests_checksum_crc_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_checksum_crc_bitwise),
+        new_TestFixture(test_checksum_crc_nibble_table),
+        new_TestFixture(test_checksum_crc_byte_table),
+        new_TestFixture(test_checksum_crc_empty),
+    };
+
+    EMB_UNIT_TESTCALLER(checksum_crc_tests, NULL, NULL, fixtures);
+
+    return (Test *)&checksum_crc_tests;
+}
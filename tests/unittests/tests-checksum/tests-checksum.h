@@ -75,6 +75,13 @@ Test *tests_checksum_crc16_ccitt_false_tests(void);
  */
 Test *tests_checksum_crc16_ccitt_aug_tests(void);
 
+/**
+ * @brief   Generates tests for checksum/crc.h
+ *
+ * @return  embUnit tests if successful, NULL if not.
+ */
+Test *tests_checksum_crc_tests(void);
+
 /**
  * @brief   Generates tests for checksum/crc32.h
  *
@@ -10,6 +10,7 @@
 #include "embUnit.h"
 
 #include "mbox.h"
+#include "thread.h"
 
 #include "tests-core.h"
 
@@ -58,10 +59,71 @@ static void test_mbox_put_get(void)
     TEST_ASSERT_EQUAL_INT(0, mbox_try_get(&mbox, &msg));
 }
 
+#define WRITERS     3
+
+static mbox_t _mbox;
+static msg_t _queue[2];
+static char _writer_stacks[WRITERS][THREAD_STACKSIZE_SMALL];
+static unsigned _writers_done;
+
+static void *_writer(void *arg)
+{
+    msg_t msg = { .content.value = (uintptr_t)arg };
+
+    mbox_put(&_mbox, &msg);
+    _writers_done++;
+    return NULL;
+}
+
+static void test_mbox_try_get_many(void)
+{
+    msg_t msg = { .type = 0 };
+    msg_t msgs[ARRAY_SIZE(_queue) + 1];
+
+    mbox_init(&_mbox, _queue, ARRAY_SIZE(_queue));
+    _writers_done = 0;
+    for (unsigned i = 0; i < ARRAY_SIZE(_queue); i++) {
+        msg.content.value = gen_val(i);
+        TEST_ASSERT_EQUAL_INT(1, mbox_try_put(&_mbox, &msg));
+    }
+
+    /* the writers run right away and block on the full mailbox */
+    for (unsigned i = 0; i < WRITERS; i++) {
+        thread_create(_writer_stacks[i], sizeof(_writer_stacks[i]),
+                      THREAD_PRIORITY_MAIN - 1, 0, _writer,
+                      (void *)(uintptr_t)gen_val(ARRAY_SIZE(_queue) + i),
+                      "mbox writer");
+    }
+    TEST_ASSERT_EQUAL_INT(0, _writers_done);
+
+    /* only as many writers as there are slots can put their message */
+    TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(_queue),
+                          mbox_try_get_many(&_mbox, msgs, ARRAY_SIZE(msgs)));
+    for (unsigned i = 0; i < ARRAY_SIZE(_queue); i++) {
+        TEST_ASSERT_EQUAL_INT(gen_val(i), msgs[i].content.value);
+    }
+    TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(_queue), _writers_done);
+    TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(_queue), mbox_avail(&_mbox));
+
+    /* the last writer gets the next free slot */
+    TEST_ASSERT_EQUAL_INT(1, mbox_try_get_many(&_mbox, msgs, 1));
+    TEST_ASSERT_EQUAL_INT(WRITERS, _writers_done);
+    TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(_queue), mbox_avail(&_mbox));
+
+    TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(_queue),
+                          mbox_try_get_many(&_mbox, msgs, ARRAY_SIZE(msgs)));
+    for (unsigned i = 0; i < ARRAY_SIZE(_queue); i++) {
+        TEST_ASSERT_EQUAL_INT(gen_val(ARRAY_SIZE(_queue) + 1 + i),
+                              msgs[i].content.value);
+    }
+    TEST_ASSERT_EQUAL_INT(0, mbox_try_get_many(&_mbox, msgs, ARRAY_SIZE(msgs)));
+}
+
 Test *tests_core_mbox_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_mbox_put_get),
+        new_TestFixture(test_mbox_try_get_many),
     };
 
     EMB_UNIT_TESTCALLER(core_mbox_tests, NULL, NULL, fixtures);
@@ -0,0 +1,389 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <errno.h>
+
+#include "embUnit.h"
+#include "evtimer.h"
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "net/gnrc/rpl/routes.h"
+
+#include "_nib-internal.h"
+
+#include "tests-gnrc_rpl_routes.h"
+
+#define GLOBAL_PREFIX       { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0 }
+#define LINK_LOCAL_PREFIX   { 0xfe, 0x80, 0, 0, 0, 0, 0, 0 }
+#define IFACE               (6)
+#define LIFETIME            (300U)
+
+static ipv6_addr_t _target(uint8_t last)
+{
+    ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX } } };
+
+    addr.u8[15] = last;
+    return addr;
+}
+
+static ipv6_addr_t _next_hop(uint8_t last)
+{
+    ipv6_addr_t addr = { .u64 = { { .u8 = LINK_LOCAL_PREFIX } } };
+
+    addr.u8[15] = last;
+    return addr;
+}
+
+static unsigned _ft_numof(void)
+{
+    void *state = NULL;
+    gnrc_ipv6_nib_ft_t fte;
+    unsigned numof = 0;
+
+    while (gnrc_ipv6_nib_ft_iter(NULL, 0, &state, &fte)) {
+        numof++;
+    }
+    return numof;
+}
+
+static void set_up(void)
+{
+    evtimer_event_t *tmp;
+
+    gnrc_rpl_routes_reset();
+    for (evtimer_event_t *ptr = _nib_evtimer.events;
+         (ptr != NULL) && (tmp = (ptr->next), 1);
+         ptr = tmp) {
+        evtimer_del((evtimer_t *)(&_nib_evtimer), ptr);
+    }
+    _nib_init();
+}
+
+/*
+ * Updates routes with invalid prefix lengths.
+ * Expected result: gnrc_rpl_routes_update() returns -EINVAL
+ */
+static void test_rpl_routes_update__EINVAL(void)
+{
+    ipv6_addr_t target = _target(2), nh = _next_hop(1);
+
+    TEST_ASSERT_EQUAL_INT(-EINVAL, gnrc_rpl_routes_update(&target, 0, &nh,
+                                                          IFACE, LIFETIME));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, gnrc_rpl_routes_update(&target, 129, &nh,
+                                                          IFACE, LIFETIME));
+}
+
+/*
+ * Removes a route that was never added.
+ * Expected result: gnrc_rpl_routes_update() returns -ENOENT
+ */
+static void test_rpl_routes_update__ENOENT(void)
+{
+    ipv6_addr_t target = _target(2), nh = _next_hop(1);
+
+    TEST_ASSERT_EQUAL_INT(-ENOENT, gnrc_rpl_routes_update(&target, 128, &nh,
+                                                          IFACE, 0));
+}
+
+/*
+ * Fills the route store and then adds another route.
+ * Expected result: gnrc_rpl_routes_update() returns -ENOMEM
+ */
+static void test_rpl_routes_update__ENOMEM_routes(void)
+{
+    ipv6_addr_t nh = _next_hop(1);
+    ipv6_addr_t target;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_RPL_ROUTES_NUMOF; i++) {
+        /* every other target, so they are not aggregated */
+        target = _target(2 * i);
+        TEST_ASSERT_EQUAL_INT(GNRC_RPL_ROUTES_ADDED,
+                              gnrc_rpl_routes_update(&target, 128, &nh, IFACE,
+                                                     LIFETIME));
+    }
+    target = _target(2 * CONFIG_GNRC_RPL_ROUTES_NUMOF);
+    TEST_ASSERT_EQUAL_INT(-ENOMEM, gnrc_rpl_routes_update(&target, 128, &nh,
+                                                          IFACE, LIFETIME));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_rpl_routes_stats()->full);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_RPL_ROUTES_NUMOF, _ft_numof());
+}
+
+/*
+ * Adds routes via more next hops than the next hop table can hold.
+ * Expected result: gnrc_rpl_routes_update() returns -ENOMEM
+ */
+static void test_rpl_routes_update__ENOMEM_next_hops(void)
+{
+    ipv6_addr_t target, nh;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_RPL_ROUTES_NEXT_HOP_NUMOF; i++) {
+        target = _target(2 * i);
+        nh = _next_hop(i + 1);
+        TEST_ASSERT_EQUAL_INT(GNRC_RPL_ROUTES_ADDED,
+                              gnrc_rpl_routes_update(&target, 128, &nh, IFACE,
+                                                     LIFETIME));
+    }
+    target = _target(2 * CONFIG_GNRC_RPL_ROUTES_NEXT_HOP_NUMOF);
+    nh = _next_hop(CONFIG_GNRC_RPL_ROUTES_NEXT_HOP_NUMOF + 1);
+    TEST_ASSERT_EQUAL_INT(-ENOMEM, gnrc_rpl_routes_update(&target, 128, &nh,
+                                                          IFACE, LIFETIME));
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_RPL_ROUTES_NEXT_HOP_NUMOF,
+                          gnrc_rpl_routes_stats()->next_hops);
+}
+
+/*
+ * Fills the next hop table and moves an existing route to yet another next
+ * hop.
+ * Expected result: gnrc_rpl_routes_update() returns -ENOMEM and the route is
+ * removed from the store and the forwarding table, so the store does not keep
+ * the old next hop
+ */
+static void test_rpl_routes_update__ENOMEM_next_hops_existing(void)
+{
+    ipv6_addr_t target = _target(0), nh;
+    gnrc_ipv6_nib_ft_t fte;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_RPL_ROUTES_NEXT_HOP_NUMOF; i++) {
+        ipv6_addr_t tmp = _target(2 * i);
+
+        nh = _next_hop(i + 1);
+        TEST_ASSERT_EQUAL_INT(GNRC_RPL_ROUTES_ADDED,
+                              gnrc_rpl_routes_update(&tmp, 128, &nh, IFACE,
+                                                     LIFETIME));
+    }
+    nh = _next_hop(CONFIG_GNRC_RPL_ROUTES_NEXT_HOP_NUMOF + 1);
+    TEST_ASSERT_EQUAL_INT(-ENOMEM, gnrc_rpl_routes_update(&target, 128, &nh,
+                                                          IFACE, LIFETIME));
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_RPL_ROUTES_NEXT_HOP_NUMOF - 1,
+                          gnrc_rpl_routes_stats()->routes);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, gnrc_rpl_routes_get(&target, NULL, NULL));
+    TEST_ASSERT(gnrc_ipv6_nib_ft_get(&target, NULL, &fte) != 0);
+}
+
+/*
+ * Adds a route, refreshes it, moves it to another next hop, and removes it.
+ * Expected result: the forwarding table follows the route, but a refresh does
+ * not remove the forwarding table entry
+ */
+static void test_rpl_routes_update__add_refresh_move_remove(void)
+{
+    ipv6_addr_t target = _target(2), nh1 = _next_hop(1), nh2 = _next_hop(2);
+    ipv6_addr_t res_nh;
+    kernel_pid_t res_iface;
+    gnrc_ipv6_nib_ft_t fte;
+    const gnrc_rpl_routes_stats_t *stats = gnrc_rpl_routes_stats();
+
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_ROUTES_ADDED,
+                          gnrc_rpl_routes_update(&target, 128, &nh1, IFACE,
+                                                 LIFETIME));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&target, NULL, &fte));
+    TEST_ASSERT(ipv6_addr_equal(&nh1, &fte.next_hop));
+    TEST_ASSERT_EQUAL_INT(128, gnrc_rpl_routes_get(&target, &res_nh,
+                                                   &res_iface));
+    TEST_ASSERT(ipv6_addr_equal(&nh1, &res_nh));
+    TEST_ASSERT_EQUAL_INT(IFACE, res_iface);
+    TEST_ASSERT_EQUAL_INT(1, stats->nib_ops);
+
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_ROUTES_REFRESHED,
+                          gnrc_rpl_routes_update(&target, 128, &nh1, IFACE,
+                                                 LIFETIME));
+    TEST_ASSERT_EQUAL_INT(1, stats->refreshes);
+    TEST_ASSERT_EQUAL_INT(1, stats->changes);
+    TEST_ASSERT_EQUAL_INT(2, stats->nib_ops);
+    TEST_ASSERT_EQUAL_INT(1, _ft_numof());
+
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_ROUTES_MOVED,
+                          gnrc_rpl_routes_update(&target, 128, &nh2, IFACE,
+                                                 LIFETIME));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&target, NULL, &fte));
+    TEST_ASSERT(ipv6_addr_equal(&nh2, &fte.next_hop));
+    TEST_ASSERT_EQUAL_INT(1, stats->next_hops);
+    TEST_ASSERT_EQUAL_INT(1, _ft_numof());
+
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_ROUTES_REMOVED,
+                          gnrc_rpl_routes_update(&target, 128, &nh2, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, gnrc_rpl_routes_get(&target, NULL, NULL));
+    TEST_ASSERT_EQUAL_INT(0, _ft_numof());
+    TEST_ASSERT_EQUAL_INT(0, stats->routes);
+    TEST_ASSERT_EQUAL_INT(1, stats->routes_max);
+    TEST_ASSERT_EQUAL_INT(0, stats->next_hops);
+}
+
+/*
+ * Adds two targets only differing in their last bit via the same next hop,
+ * then removes one of them.
+ * Expected result: both are installed as one aggregated forwarding table entry
+ * which is split again on removal
+ */
+static void test_rpl_routes_update__aggregate(void)
+{
+    ipv6_addr_t target2 = _target(2), target3 = _target(3);
+    ipv6_addr_t nh = _next_hop(1);
+    void *state = NULL;
+    gnrc_ipv6_nib_ft_t fte;
+
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_ROUTES_ADDED,
+                          gnrc_rpl_routes_update(&target2, 128, &nh, IFACE,
+                                                 LIFETIME));
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_ROUTES_ADDED,
+                          gnrc_rpl_routes_update(&target3, 128, &nh, IFACE,
+                                                 LIFETIME));
+    TEST_ASSERT_EQUAL_INT(2, gnrc_rpl_routes_stats()->aggregated);
+    TEST_ASSERT(gnrc_ipv6_nib_ft_iter(NULL, 0, &state, &fte));
+    TEST_ASSERT(ipv6_addr_equal(&target2, &fte.dst));
+    TEST_ASSERT_EQUAL_INT(127, fte.dst_len);
+    TEST_ASSERT(!gnrc_ipv6_nib_ft_iter(NULL, 0, &state, &fte));
+    /* both targets are still resolved by the route store */
+    TEST_ASSERT_EQUAL_INT(128, gnrc_rpl_routes_get(&target3, NULL, NULL));
+
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_ROUTES_REMOVED,
+                          gnrc_rpl_routes_update(&target2, 128, &nh, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_rpl_routes_stats()->aggregated);
+    state = NULL;
+    TEST_ASSERT(gnrc_ipv6_nib_ft_iter(NULL, 0, &state, &fte));
+    TEST_ASSERT(ipv6_addr_equal(&target3, &fte.dst));
+    TEST_ASSERT_EQUAL_INT(128, fte.dst_len);
+    TEST_ASSERT(!gnrc_ipv6_nib_ft_iter(NULL, 0, &state, &fte));
+}
+
+/*
+ * Adds two targets only differing in their last bit via different next hops.
+ * Expected result: both are installed as separate forwarding table entries
+ */
+static void test_rpl_routes_update__no_aggregate_next_hop(void)
+{
+    ipv6_addr_t target2 = _target(2), target3 = _target(3);
+    ipv6_addr_t nh1 = _next_hop(1), nh2 = _next_hop(2);
+
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_ROUTES_ADDED,
+                          gnrc_rpl_routes_update(&target2, 128, &nh1, IFACE,
+                                                 LIFETIME));
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_ROUTES_ADDED,
+                          gnrc_rpl_routes_update(&target3, 128, &nh2, IFACE,
+                                                 LIFETIME));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_rpl_routes_stats()->aggregated);
+    TEST_ASSERT_EQUAL_INT(2, _ft_numof());
+}
+
+/*
+ * Aggregates two targets and then adds a route for the aggregate's prefix via
+ * another next hop.
+ * Expected result: the aggregate is split, so the more specific routes are not
+ * hidden by the new route
+ */
+static void test_rpl_routes_update__split_aggregate(void)
+{
+    ipv6_addr_t target2 = _target(2), target3 = _target(3);
+    ipv6_addr_t nh1 = _next_hop(1), nh2 = _next_hop(2);
+    gnrc_ipv6_nib_ft_t fte;
+
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_ROUTES_ADDED,
+                          gnrc_rpl_routes_update(&target2, 128, &nh1, IFACE,
+                                                 LIFETIME));
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_ROUTES_ADDED,
+                          gnrc_rpl_routes_update(&target3, 128, &nh1, IFACE,
+                                                 LIFETIME));
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_ROUTES_ADDED,
+                          gnrc_rpl_routes_update(&target2, 127, &nh2, IFACE,
+                                                 LIFETIME));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_rpl_routes_stats()->aggregated);
+    TEST_ASSERT_EQUAL_INT(3, _ft_numof());
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&target3, NULL, &fte));
+    TEST_ASSERT(ipv6_addr_equal(&nh1, &fte.next_hop));
+}
+
+/*
+ * Aggregates two targets, removes one of them and adds it again.
+ * Expected result: the split aggregate is withdrawn once, but not if it is
+ * aggregated again before it was popped
+ */
+static void test_rpl_routes_pop_withdrawn(void)
+{
+    ipv6_addr_t target2 = _target(2), target3 = _target(3);
+    ipv6_addr_t nh = _next_hop(1);
+    ipv6_addr_t withdrawn;
+
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_ROUTES_ADDED,
+                          gnrc_rpl_routes_update(&target2, 128, &nh, IFACE,
+                                                 LIFETIME));
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_ROUTES_ADDED,
+                          gnrc_rpl_routes_update(&target3, 128, &nh, IFACE,
+                                                 LIFETIME));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, gnrc_rpl_routes_pop_withdrawn(&withdrawn));
+
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_ROUTES_REMOVED,
+                          gnrc_rpl_routes_update(&target3, 128, &nh, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(127, gnrc_rpl_routes_pop_withdrawn(&withdrawn));
+    TEST_ASSERT(ipv6_addr_equal(&target2, &withdrawn));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, gnrc_rpl_routes_pop_withdrawn(&withdrawn));
+
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_ROUTES_ADDED,
+                          gnrc_rpl_routes_update(&target3, 128, &nh, IFACE,
+                                                 LIFETIME));
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_ROUTES_REMOVED,
+                          gnrc_rpl_routes_update(&target3, 128, &nh, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_ROUTES_ADDED,
+                          gnrc_rpl_routes_update(&target3, 128, &nh, IFACE,
+                                                 LIFETIME));
+    TEST_ASSERT_EQUAL_INT(2, gnrc_rpl_routes_stats()->aggregated);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, gnrc_rpl_routes_pop_withdrawn(&withdrawn));
+}
+
+/*
+ * Adds a /64 and a /128 route and looks up destinations within the /64.
+ * Expected result: gnrc_rpl_routes_get() returns the longest matching route
+ */
+static void test_rpl_routes_get__longest_match(void)
+{
+    ipv6_addr_t target = _target(2), other = _target(4);
+    ipv6_addr_t nh1 = _next_hop(1), nh2 = _next_hop(2);
+    ipv6_addr_t res_nh;
+
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_ROUTES_ADDED,
+                          gnrc_rpl_routes_update(&target, 64, &nh1, IFACE,
+                                                 LIFETIME));
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_ROUTES_ADDED,
+                          gnrc_rpl_routes_update(&target, 128, &nh2, IFACE,
+                                                 LIFETIME));
+    TEST_ASSERT_EQUAL_INT(128, gnrc_rpl_routes_get(&target, &res_nh, NULL));
+    TEST_ASSERT(ipv6_addr_equal(&nh2, &res_nh));
+    TEST_ASSERT_EQUAL_INT(64, gnrc_rpl_routes_get(&other, &res_nh, NULL));
+    TEST_ASSERT(ipv6_addr_equal(&nh1, &res_nh));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, gnrc_rpl_routes_get(&nh1, NULL, NULL));
+    TEST_ASSERT_EQUAL_INT(3, gnrc_rpl_routes_stats()->lookups);
+    TEST_ASSERT(gnrc_rpl_routes_stats()->probes >= 2);
+}
+
+static Test *tests_gnrc_rpl_routes_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_rpl_routes_update__EINVAL),
+        new_TestFixture(test_rpl_routes_update__ENOENT),
+        new_TestFixture(test_rpl_routes_update__ENOMEM_routes),
+        new_TestFixture(test_rpl_routes_update__ENOMEM_next_hops),
+        new_TestFixture(test_rpl_routes_update__ENOMEM_next_hops_existing),
+        new_TestFixture(test_rpl_routes_update__add_refresh_move_remove),
+        new_TestFixture(test_rpl_routes_update__aggregate),
+        new_TestFixture(test_rpl_routes_update__no_aggregate_next_hop),
+        new_TestFixture(test_rpl_routes_update__split_aggregate),
+        new_TestFixture(test_rpl_routes_pop_withdrawn),
+        new_TestFixture(test_rpl_routes_get__longest_match),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_rpl_routes_tests, set_up, NULL, fixtures);
+
+    return (Test *)&gnrc_rpl_routes_tests;
+}
+
+void tests_gnrc_rpl_routes(void)
+{
+    TESTS_RUN(tests_gnrc_rpl_routes_tests());
+}
+/** @} */
@@ -0,0 +1,95 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+
+#include "hashes/pbkdf2.h"
+
+#include "tests-hashes.h"
+
+static int _check(const char *password, const char *salt, int iterations,
+                  const uint8_t *expected)
+{
+    uint8_t key[PBKDF2_KEY_SIZE];
+
+    pbkdf2_sha256(password, strlen(password), salt, strlen(salt),
+                  iterations, key);
+
+    return memcmp(key, expected, sizeof(key)) == 0;
+}
+
+/* PBKDF2-HMAC-SHA256 of "password" and "salt", the first iterations take a
+ * different path than the later ones */
+static void test_hashes_pbkdf2_1(void)
+{
+    static const uint8_t expected[] = {
+        0x12, 0x0f, 0xb6, 0xcf, 0xfc, 0xf8, 0xb3, 0x2c,
+        0x43, 0xe7, 0x22, 0x52, 0x56, 0xc4, 0xf8, 0x37,
+        0xa8, 0x65, 0x48, 0xc9, 0x2c, 0xcc, 0x35, 0x48,
+        0x08, 0x05, 0x98, 0x7c, 0xb7, 0x0b, 0xe1, 0x7b,
+    };
+
+    TEST_ASSERT(_check("password", "salt", 1, expected));
+}
+
+static void test_hashes_pbkdf2_2(void)
+{
+    static const uint8_t expected[] = {
+        0xae, 0x4d, 0x0c, 0x95, 0xaf, 0x6b, 0x46, 0xd3,
+        0x2d, 0x0a, 0xdf, 0xf9, 0x28, 0xf0, 0x6d, 0xd0,
+        0x2a, 0x30, 0x3f, 0x8e, 0xf3, 0xc2, 0x51, 0xdf,
+        0xd6, 0xe2, 0xd8, 0x5a, 0x95, 0x47, 0x4c, 0x43,
+    };
+
+    TEST_ASSERT(_check("password", "salt", 2, expected));
+}
+
+static void test_hashes_pbkdf2_4096(void)
+{
+    static const uint8_t expected[] = {
+        0xc5, 0xe4, 0x78, 0xd5, 0x92, 0x88, 0xc8, 0x41,
+        0xaa, 0x53, 0x0d, 0xb6, 0x84, 0x5c, 0x4c, 0x8d,
+        0x96, 0x28, 0x93, 0xa0, 0x01, 0xce, 0x4e, 0x11,
+        0xa4, 0x96, 0x38, 0x73, 0xaa, 0x98, 0x13, 0x4a,
+    };
+
+    TEST_ASSERT(_check("password", "salt", 4096, expected));
+}
+
+/* a password longer than a block is hashed first */
+static void test_hashes_pbkdf2_long(void)
+{
+    static const uint8_t expected[] = {
+        0xcb, 0x07, 0x73, 0x83, 0x2f, 0x99, 0xe8, 0x62,
+        0x73, 0x83, 0xdc, 0x51, 0x01, 0xa1, 0x30, 0xa2,
+        0xc2, 0x3a, 0x38, 0x14, 0x7a, 0x7d, 0xb6, 0x27,
+        0x13, 0xe7, 0x61, 0xe8, 0x37, 0x2e, 0x14, 0x3e,
+    };
+    char password[101];
+
+    memset(password, 'x', 100);
+    password[100] = '\0';
+
+    TEST_ASSERT(_check(password, "NaCl salt with more than one block"
+                                 "NaCl salt with more than one block"
+                                 "NaCl salt with more than one block",
+                       100, expected));
+}
+
+Test *tests_hashes_pbkdf2_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_hashes_pbkdf2_1),
+        new_TestFixture(test_hashes_pbkdf2_2),
+        new_TestFixture(test_hashes_pbkdf2_4096),
+        new_TestFixture(test_hashes_pbkdf2_long),
+    };
+
+    EMB_UNIT_TESTCALLER(hashes_pbkdf2_tests, NULL, NULL, fixtures);
+
+    return (Test *)&hashes_pbkdf2_tests;
+}
@@ -264,6 +264,34 @@ static void test_hashes_sha256_hash_sequence_abc_long(void)
     TEST_ASSERT(calc_and_compare_hash_wrapper(teststring, h_fips_multiblock));
 }
 
+/**
+ * @brief expected hash for one million times "a"
+ *        (from FIPS 180-2 Appendix B.3)
+ */
+static const unsigned char h_fips_million_a[] =
+                                    {0xcd, 0xc7, 0x6e, 0x5c, 0x99, 0x14, 0xfb, 0x92,
+                                     0x81, 0xa1, 0xc7, 0xe2, 0x84, 0xd7, 0x3e, 0x67,
+                                     0xf1, 0x80, 0x9a, 0x48, 0xa4, 0x97, 0x20, 0x0e,
+                                     0x04, 0x6d, 0x39, 0xcc, 0xc7, 0x11, 0x2c, 0xd0};
+
+static void test_hashes_sha256_hash_sequence_million_a(void)
+{
+    unsigned char buf[1000];
+    unsigned char hash[SHA256_DIGEST_LENGTH];
+    sha256_context_t sha256;
+
+    memset(buf, 'a', sizeof(buf));
+    sha256_init(&sha256);
+    /* odd sized parts, so that most blocks are split */
+    for (unsigned i = 0; i < 1000; i++) {
+        sha256_update(&sha256, buf, 999);
+        sha256_update(&sha256, buf, 1);
+    }
+    sha256_final(&sha256, hash);
+
+    TEST_ASSERT_EQUAL_INT(0, memcmp(h_fips_million_a, hash, sizeof(hash)));
+}
+
 Test *tests_hashes_sha256_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -282,6 +310,7 @@ Test *tests_hashes_sha256_tests(void)
 
         new_TestFixture(test_hashes_sha256_hash_sequence_abc),
         new_TestFixture(test_hashes_sha256_hash_sequence_abc_long),
+        new_TestFixture(test_hashes_sha256_hash_sequence_million_a),
     };
 
     EMB_UNIT_TESTCALLER(hashes_sha256_tests, NULL, NULL,
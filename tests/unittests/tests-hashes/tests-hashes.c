@@ -27,6 +27,7 @@ void tests_hashes(void)
     TESTS_RUN(tests_hashes_sha256_tests());
     TESTS_RUN(tests_hashes_sha256_hmac_tests());
     TESTS_RUN(tests_hashes_sha256_chain_tests());
+    TESTS_RUN(tests_hashes_pbkdf2_tests());
     TESTS_RUN(tests_hashes_sha384_tests());
     TESTS_RUN(tests_hashes_sha512_tests());
     TESTS_RUN(tests_hashes_sha512_224_tests());
@@ -64,6 +64,25 @@ static vfs_mount_t _test_vfs_mount = {
     .private_data = (void *)&fs_data,
 };
 
+static const constfs_file_t _nested_files[] = {
+    {
+        .path = "/nested.txt",
+        .data = str_data,
+        .size = sizeof(str_data),
+    },
+};
+
+static const constfs_t nested_fs_data = {
+    .files = _nested_files,
+    .nfiles = ARRAY_SIZE(_nested_files),
+};
+
+static vfs_mount_t _test_vfs_mount_nested = {
+    .mount_point = "/test/sub",
+    .fs = &constfs_file_system,
+    .private_data = (void *)&nested_fs_data,
+};
+
 static void test_vfs_mount_umount(void)
 {
     int res;
@@ -170,6 +189,56 @@ static void test_vfs_constfs_read_lseek(void)
     TEST_ASSERT_EQUAL_INT(0, res);
 }
 
+static void _check_nested(void)
+{
+    struct stat st;
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_stat("/test/sub/nested.txt", &st));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, vfs_stat("/test/nested.txt", &st));
+    TEST_ASSERT_EQUAL_INT(0, vfs_stat("/test/test.txt", &st));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, vfs_stat("/test/sub/test.txt", &st));
+    /* mount point is only a prefix of the path name */
+    TEST_ASSERT_EQUAL_INT(-ENOENT, vfs_stat("/test/subnested.txt", &st));
+}
+
+static void test_vfs_mount__nested(void)
+{
+    int res;
+    res = vfs_mount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    res = vfs_mount(&_test_vfs_mount_nested);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    _check_nested();
+
+    int fd = vfs_open("/test/sub/nested.txt", O_RDONLY, 0);
+    TEST_ASSERT(fd >= 0);
+    res = vfs_umount(&_test_vfs_mount_nested, false);
+    TEST_ASSERT_EQUAL_INT(-EBUSY, res);
+    /* a failed umount must not hide the mount */
+    _check_nested();
+    res = vfs_close(fd);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    res = vfs_umount(&_test_vfs_mount_nested, false);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    fd = vfs_open("/test/sub/nested.txt", O_RDONLY, 0);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, fd);
+    res = vfs_umount(&_test_vfs_mount, false);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    /* the longer mount point wins regardless of the mount order */
+    res = vfs_mount(&_test_vfs_mount_nested);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    res = vfs_mount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    _check_nested();
+
+    res = vfs_umount(&_test_vfs_mount, false);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    res = vfs_umount(&_test_vfs_mount_nested, false);
+    TEST_ASSERT_EQUAL_INT(0, res);
+}
+
 #if MODULE_NEWLIB || MODULE_PICOLIBC || defined(CPU_NATIVE)
 static void test_vfs_constfs__posix(void)
 {
@@ -209,6 +278,7 @@ Test *tests_vfs_mount_constfs_tests(void)
         new_TestFixture(test_vfs_umount__invalid_mount),
         new_TestFixture(test_vfs_constfs_open),
         new_TestFixture(test_vfs_constfs_read_lseek),
+        new_TestFixture(test_vfs_mount__nested),
 #if MODULE_NEWLIB || MODULE_PICOLIBC || defined(CPU_NATIVE)
         new_TestFixture(test_vfs_constfs__posix),
 #endif
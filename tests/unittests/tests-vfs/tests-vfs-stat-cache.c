@@ -0,0 +1,236 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the vfs_stat_cache module
+ */
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "container.h"
+#include "embUnit/embUnit.h"
+
+#include "vfs.h"
+
+#include "tests-vfs.h"
+
+#define _NAME_MAX   (8)
+
+/* a file system holding a few empty files that grow when written */
+static struct {
+    char name[_NAME_MAX];
+    off_t size;
+} _files[2];
+
+static unsigned _stat_calls;
+
+static int _find(const char *name)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_files); i++) {
+        if (strcmp(_files[i].name, name) == 0) {
+            return i;
+        }
+    }
+    return -ENOENT;
+}
+
+static int _mock_open(vfs_file_t *filp, const char *name, int flags, mode_t mode)
+{
+    (void)mode;
+    int i = _find(name);
+
+    if (i < 0 && (flags & O_CREAT)) {
+        i = _find("");
+        if (i < 0 || strlen(name) >= _NAME_MAX) {
+            return -ENOSPC;
+        }
+        strcpy(_files[i].name, name);
+        _files[i].size = 0;
+    }
+    if (i >= 0) {
+        filp->private_data.value = i;
+    }
+    return i < 0 ? i : 0;
+}
+
+static ssize_t _mock_write(vfs_file_t *filp, const void *src, size_t nbytes)
+{
+    (void)src;
+    _files[filp->private_data.value].size += nbytes;
+    return nbytes;
+}
+
+static int _mock_stat(vfs_mount_t *mountp, const char *restrict path,
+                      struct stat *restrict buf)
+{
+    (void)mountp;
+    int i = _find(path);
+
+    _stat_calls++;
+    if (i < 0) {
+        return i;
+    }
+    buf->st_mode = S_IFREG;
+    buf->st_size = _files[i].size;
+    return 0;
+}
+
+static int _mock_unlink(vfs_mount_t *mountp, const char *name)
+{
+    (void)mountp;
+    int i = _find(name);
+
+    if (i < 0) {
+        return i;
+    }
+    _files[i].name[0] = '\0';
+    return 0;
+}
+
+static int _mock_rename(vfs_mount_t *mountp, const char *from_path,
+                        const char *to_path)
+{
+    (void)mountp;
+    int i = _find(from_path);
+
+    if (i < 0) {
+        return i;
+    }
+    if (strlen(to_path) >= _NAME_MAX) {
+        return -ENAMETOOLONG;
+    }
+    strcpy(_files[i].name, to_path);
+    return 0;
+}
+
+static const vfs_file_ops_t _mock_file_ops = {
+    .open = _mock_open,
+    .write = _mock_write,
+};
+
+static const vfs_file_system_ops_t _mock_fs_ops = {
+    .stat = _mock_stat,
+    .unlink = _mock_unlink,
+    .rename = _mock_rename,
+};
+
+static const vfs_file_system_t _mock_fs = {
+    .f_op = &_mock_file_ops,
+    .fs_op = &_mock_fs_ops,
+};
+
+static vfs_mount_t _test_mount = {
+    .mount_point = "/sc",
+    .fs = &_mock_fs,
+};
+
+static void setUp(void)
+{
+    memset(_files, 0, sizeof(_files));
+    int res = vfs_mount(&_test_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+}
+
+static void tearDown(void)
+{
+    vfs_umount(&_test_mount, false);
+}
+
+/* returns the size reported by vfs_stat(), or its error */
+static off_t _size(const char *path)
+{
+    struct stat st;
+    int res = vfs_stat(path, &st);
+
+    return res < 0 ? res : st.st_size;
+}
+
+static void test_vfs_stat_cache__hit(void)
+{
+    int fd = vfs_open("/sc/a", O_CREAT | O_WRONLY, 0);
+    TEST_ASSERT(fd >= 0);
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+
+    unsigned calls = _stat_calls;
+    TEST_ASSERT_EQUAL_INT(0, _size("/sc/a"));
+    TEST_ASSERT_EQUAL_INT(0, _size("/sc/a"));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _size("/sc/b"));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _size("/sc/b"));
+    TEST_ASSERT_EQUAL_INT(calls + 2, _stat_calls);
+}
+
+static void test_vfs_stat_cache__write(void)
+{
+    int fd = vfs_open("/sc/a", O_CREAT | O_WRONLY, 0);
+    TEST_ASSERT(fd >= 0);
+    TEST_ASSERT_EQUAL_INT(0, _size("/sc/a"));
+
+    TEST_ASSERT_EQUAL_INT(4, vfs_write(fd, "data", 4));
+    TEST_ASSERT_EQUAL_INT(4, _size("/sc/a"));
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+}
+
+static void test_vfs_stat_cache__unlink(void)
+{
+    int fd = vfs_open("/sc/a", O_CREAT | O_WRONLY, 0);
+    TEST_ASSERT(fd >= 0);
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+    TEST_ASSERT_EQUAL_INT(0, _size("/sc/a"));
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_unlink("/sc/a"));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _size("/sc/a"));
+}
+
+static void test_vfs_stat_cache__rename(void)
+{
+    int fd = vfs_open("/sc/a", O_CREAT | O_WRONLY, 0);
+    TEST_ASSERT(fd >= 0);
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+    TEST_ASSERT_EQUAL_INT(0, _size("/sc/a"));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _size("/sc/b"));
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_rename("/sc/a", "/sc/b"));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _size("/sc/a"));
+    TEST_ASSERT_EQUAL_INT(0, _size("/sc/b"));
+}
+
+static void test_vfs_stat_cache__umount(void)
+{
+    int fd = vfs_open("/sc/a", O_CREAT | O_WRONLY, 0);
+    TEST_ASSERT(fd >= 0);
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+    TEST_ASSERT_EQUAL_INT(0, _size("/sc/a"));
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_umount(&_test_mount, false));
+    unsigned calls = _stat_calls;
+    TEST_ASSERT(_size("/sc/a") < 0);
+    TEST_ASSERT_EQUAL_INT(calls, _stat_calls);
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&_test_mount));
+    TEST_ASSERT_EQUAL_INT(0, _size("/sc/a"));
+}
+
+Test *tests_vfs_stat_cache_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_vfs_stat_cache__hit),
+        new_TestFixture(test_vfs_stat_cache__write),
+        new_TestFixture(test_vfs_stat_cache__unlink),
+        new_TestFixture(test_vfs_stat_cache__rename),
+        new_TestFixture(test_vfs_stat_cache__umount),
+    };
+
+    EMB_UNIT_TESTCALLER(vfs_stat_cache_tests, setUp, tearDown, fixtures);
+
+    return (Test *)&vfs_stat_cache_tests;
+}
+
+/** @} */